@@ -0,0 +1,98 @@
+/**
+ * @file adt_arena.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-05
+ * @version 1.0
+ */
+
+#ifndef __ADT_ARENA_H__
+#define __ADT_ARENA_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+
+// every allocation starts at a multiple of kArenaAlignment
+#define kArenaAlignment 8
+// a chunk (header + alignment + bytes) must fit in one 64KB MM block
+#define kArenaMaxChunkSize (65536 - 64)
+
+// Chunk of memory handed out by bumping used_. base_ is the first aligned
+// byte of the block, which MM only aligns to 4.
+typedef struct arena_chunk_s
+{
+  struct arena_chunk_s *next_;
+  u8 *base_;
+  u32 used_;
+} ArenaChunk;
+
+// Bump allocator. alloc only moves an offset forward and there is no free:
+// everything allocated goes away at once with reset, which keeps the chunks
+// to serve the next round without calling MM again.
+typedef struct arena_s
+{
+  ArenaChunk *first_;
+  ArenaChunk *current_;
+  u32 chunk_size_;
+  struct arena_ops_s *ops_;
+} Arena;
+
+struct arena_ops_s
+{
+  /**
+ * @brief Destroys the arena and gives every chunk back to MM.
+ *
+ * Everything allocated from the arena (containers included) becomes invalid.
+ *
+ * @param arena Pointer to the arena.
+ * @return kErrorCode_Ok on success, kErrorCode_ArenaNull if the arena is NULL.
+ */
+  s16 (*destroy)(Arena *arena);
+
+  /**
+ * @brief Frees everything allocated from the arena at once.
+ *
+ * The chunks are kept for the next allocations.
+ *
+ * @param arena Pointer to the arena.
+ * @return kErrorCode_Ok on success, kErrorCode_ArenaNull if the arena is NULL.
+ */
+  s16 (*reset)(Arena *arena);
+
+  /**
+ * @brief Allocates bytes from the arena, aligned to kArenaAlignment.
+ *
+ * A new chunk is taken from MM when the current one is full.
+ *
+ * @param arena Pointer to the arena.
+ * @param bytes Number of bytes (1 .. chunk size of the arena).
+ * @return Pointer to the memory, or NULL if the arena is NULL, bytes is out
+ *         of range or MM has no memory left.
+ */
+  void *(*alloc)(Arena *arena, u32 bytes);
+
+  /**
+ * @brief Returns the bytes allocated since the last reset, padding included, or 0 if NULL.
+ */
+  u32 (*used)(Arena *arena);
+
+  /**
+ * @brief Returns the bytes reserved from MM by all the chunks, or 0 if NULL.
+ */
+  u32 (*capacity)(Arena *arena);
+
+  /**
+ * @brief Prints the chunks of the arena and how much of them is used.
+ */
+  void (*print)(Arena *arena);
+};
+
+/**
+ * @brief Creates an arena with its first chunk.
+ *
+ * @param chunk_size Bytes per chunk (1 .. kArenaMaxChunkSize), also the
+ *        largest single allocation.
+ * @return A pointer to the new arena, or NULL on error.
+ */
+Arena *ARENA_create(u32 chunk_size);
+
+#endif // __ADT_ARENA_H__
@@ -0,0 +1,181 @@
+/**
+ * @file adt_avltree.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-23
+ * @version 1.0
+ */
+
+#ifndef __ADT_AVLTREE_H__
+#define __ADT_AVLTREE_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_cursor.h"
+#include "adt_pool.h"
+
+#define kAVLTreeSlabBytes (256 * 1024)
+
+// Orders two payloads: negative, 0 or positive like memcmp
+typedef s32 (*AVLTreeCompare)(const void *a, u16 a_bytes, const void *b, u16 b_bytes);
+
+// Node of the tree: a MemoryNode holding the payload, whose next_ and prev_
+// link the nodes in order so the elements can be walked with a Cursor, the
+// children, and the height and the number of nodes of its subtree.
+typedef struct avltree_node_s
+{
+  MemoryNode node_;
+  struct avltree_node_s *left_;
+  struct avltree_node_s *right_;
+  u32 count_;   // nodes of the subtree, itself included
+  u8 height_;   // 1 for a leaf
+} AVLTreeNode;
+
+// Sorted set of payloads on an AVL tree: the heights of the two subtrees of
+// every node differ at most in one, so the tree is never deeper than
+// 1.44 log2(n). The subtree counts give the element at a position (select)
+// and the position of an element (rank) in O(log n). The nodes come from a
+// pool of the tree, the payloads are owned by the tree.
+typedef struct avltree_s
+{
+  AVLTreeNode *root_;
+  AVLTreeNode *first_;  // smallest element
+  AVLTreeNode *last_;   // largest element
+  AVLTreeCompare compare_;
+  Pool *pool_;
+  struct avltree_ops_s *ops_;
+} AVLTree;
+
+struct avltree_ops_s
+{
+  /**
+ * @brief Destroys the tree, its nodes and the payloads.
+ *
+ * @param tree Pointer to the tree.
+ * @return kErrorCode_Ok on success, kErrorCode_AVLTreeNull if the tree is NULL.
+ */
+  s16 (*destroy)(AVLTree *tree);
+
+  /**
+ * @brief Empties the tree without freeing the payloads.
+ *
+ * @param tree Pointer to the tree.
+ * @return kErrorCode_Ok on success, kErrorCode_AVLTreeNull if the tree is NULL.
+ */
+  s16 (*softReset)(AVLTree *tree);
+
+  /**
+ * @brief Empties the tree, freeing the payloads. The nodes go back to its pool.
+ *
+ * @param tree Pointer to the tree.
+ * @return kErrorCode_Ok on success, kErrorCode_AVLTreeNull if the tree is NULL.
+ */
+  s16 (*reset)(AVLTree *tree);
+
+  /**
+ * @brief Returns the number of elements, or 0 if NULL.
+ */
+  u32 (*length)(AVLTree *tree);
+
+  /**
+ * @brief Checks if the tree has no elements. Returns False if NULL.
+ */
+  boolean (*isEmpty)(AVLTree *tree);
+
+  /**
+ * @brief Returns the smallest element, or NULL if the tree is NULL or empty.
+ */
+  void *(*first)(AVLTree *tree);
+
+  /**
+ * @brief Returns the largest element, or NULL if the tree is NULL or empty.
+ */
+  void *(*last)(AVLTree *tree);
+
+  /**
+ * @brief Returns the element at a position of the order (select), in O(log n).
+ *
+ * @param tree Pointer to the tree.
+ * @param index Position, 0 for the smallest element.
+ * @return The element, or NULL if the tree is NULL or index is not below the length.
+ */
+  void *(*at)(AVLTree *tree, u32 index);
+
+  /**
+ * @brief Returns the number of elements below a payload (rank), in O(log n).
+ *
+ * It is the position of the payload if it is in the tree, or the one it
+ * would take if it was inserted. Returns 0 if the tree or data are NULL.
+ */
+  u32 (*rank)(AVLTree *tree, const void *data, u16 bytes);
+
+  /**
+ * @brief Inserts a payload at its place in the order.
+ *
+ * @param tree Pointer to the tree.
+ * @param data Pointer to the payload, owned by the tree from now on.
+ * @param bytes The size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_AVLTreeNull if the tree is
+ *         NULL, kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if
+ *         bytes is 0, kErrorCode_KeyExists if an equal element is in the
+ *         tree (it is kept) or kErrorCode_Memory if there is no memory for
+ *         the node.
+ */
+  s16 (*insert)(AVLTree *tree, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the element equal to a payload.
+ *
+ * @param tree Pointer to the tree.
+ * @param data Payload to compare with, not stored.
+ * @param bytes The size of the payload.
+ * @return The element removed, owned by the caller, or NULL if the tree or
+ *         data are NULL or there is no equal element.
+ */
+  void *(*erase)(AVLTree *tree, const void *data, u16 bytes);
+
+  /**
+ * @brief Returns the element equal to a payload, or NULL if the tree or data are NULL or there is none.
+ */
+  void *(*find)(AVLTree *tree, const void *data, u16 bytes);
+
+  /**
+ * @brief Sets a cursor from the first element not below a payload to the last one.
+ *
+ * The cursor is left invalid if every element is below.
+ *
+ * @return kErrorCode_Ok, kErrorCode_AVLTreeNull or kErrorCode_Null if data or cursor are NULL.
+ */
+  s16 (*lowerBound)(AVLTree *tree, const void *data, u16 bytes, Cursor *cursor);
+
+  /**
+ * @brief Sets a cursor over the elements in order, invalid if the tree is empty.
+ *
+ * @return kErrorCode_Ok, kErrorCode_AVLTreeNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(AVLTree *tree, Cursor *cursor);
+
+  /**
+ * @brief Sets a cursor over the elements in reverse order, invalid if the tree is empty.
+ *
+ * @return kErrorCode_Ok, kErrorCode_AVLTreeNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*rbegin)(AVLTree *tree, Cursor *cursor);
+
+  /**
+ * @brief Prints the features of the tree and its elements in order.
+ */
+  void (*print)(AVLTree *tree);
+};
+
+/**
+ * @brief Creates an empty tree.
+ *
+ * @param compare Order of the payloads, NULL to compare their bytes with
+ *        memcmp, the shorter first when one is a prefix of the other.
+ * @return A pointer to the new tree, or NULL if there is not enough memory.
+ */
+AVLTree *AVLTREE_create(AVLTreeCompare compare);
+
+#endif // __ADT_AVLTREE_H__
@@ -0,0 +1,119 @@
+/**
+ * @file adt_binary.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-07-10
+ * @version 1.0
+ */
+
+#ifndef __ADT_BINARY_H__
+#define __ADT_BINARY_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_dllist.h"
+#include "adt_queue.h"
+
+#define kBinaryMagic 0x4E494244 // "DBIN" read as a little endian u32
+#define kBinaryVersion 1
+
+// Layout of a binary container file, in the byte order of the machine:
+//
+//   BinaryHeader
+//   u64 offsets[count_ + 1]  where element i is the bytes offsets[i] .. offsets[i + 1]
+//   payloads                 packed one after the other, without padding
+//
+// offsets are counted from the start of the file and offsets[count_] is the
+// size of the file. Payloads keep no alignment, copy them before reading
+// them as wider types on targets that trap on unaligned accesses.
+typedef struct binary_header_s {
+  u32 magic_;
+  u16 version_;
+  u16 count_;
+  u64 bytes_; // size of the whole file
+} BinaryHeader;
+
+/**
+ * @brief Writes the elements of a vector, first to last, to a binary file.
+ *
+ * @return kErrorCode_Ok, kErrorCode_VectorNull if the vector is NULL,
+ *         kErrorCode_Null if path is NULL or kErrorCode_File if the file
+ *         can't be written.
+ */
+s16 BINARY_saveVector(Vector *vector, const char *path);
+
+/**
+ * @brief Writes the elements of a list, first to last, to a binary file.
+ *
+ * @return kErrorCode_Ok, kErrorCode_ListNull if the list is NULL,
+ *         kErrorCode_Null if path is NULL or kErrorCode_File if the file
+ *         can't be written.
+ */
+s16 BINARY_saveList(List *list, const char *path);
+
+/**
+ * @brief Writes the elements of a doubly linked list, first to last, to a binary file.
+ *
+ * @return kErrorCode_Ok, kErrorCode_ListNull if the list is NULL,
+ *         kErrorCode_Null if path is NULL or kErrorCode_File if the file
+ *         can't be written.
+ */
+s16 BINARY_saveDLList(DLList *list, const char *path);
+
+/**
+ * @brief Writes the elements of a queue, front to back, to a binary file.
+ *
+ * @return kErrorCode_Ok, kErrorCode_QueueNull if the queue is NULL,
+ *         kErrorCode_Null if path is NULL or kErrorCode_File if the file
+ *         can't be written.
+ */
+s16 BINARY_saveQueue(Queue *queue, const char *path);
+
+// The mmapLoad functions map the file and build a read-only container over
+// it: the data_ of every MemoryNode points into the mapping, nothing is
+// copied and MM isn't used. Its nodes come from OS pages as one block, they
+// don't fit in MM for big files. Any binary file loads in any of the four
+// containers.
+//
+// The queries, first/last/at, traverse, traverseEx and the cursors work as
+// usual. Inserts, resize, concat into it and the resets return
+// kErrorCode_ReadOnly and the extractions NULL. destroy unmaps the file and
+// frees the nodes, so the payloads become invalid. The payloads must never
+// be written nor freed, not even through the MemoryNode ops.
+
+/**
+ * @brief Maps a binary file as a read-only vector with capacity == length.
+ *
+ * @return The vector, or NULL if path is NULL, the file can't be mapped or
+ *         it isn't a valid binary container.
+ */
+Vector *BINARY_mmapLoadVector(const char *path);
+
+/**
+ * @brief Maps a binary file as a read-only list with capacity == length.
+ *
+ * @return The list, or NULL if path is NULL, the file can't be mapped or it
+ *         isn't a valid binary container.
+ */
+List *BINARY_mmapLoadList(const char *path);
+
+/**
+ * @brief Maps a binary file as a read-only doubly linked list with capacity == length.
+ *
+ * @return The list, or NULL if path is NULL, the file can't be mapped or it
+ *         isn't a valid binary container.
+ */
+DLList *BINARY_mmapLoadDLList(const char *path);
+
+/**
+ * @brief Maps a binary file as a read-only queue, the first element at the front.
+ *
+ * enqueue fails and dequeue returns NULL.
+ *
+ * @return The queue, or NULL if path is NULL, the file can't be mapped or it
+ *         isn't a valid binary container.
+ */
+Queue *BINARY_mmapLoadQueue(const char *path);
+
+#endif // __ADT_BINARY_H__
@@ -0,0 +1,237 @@
+/**
+ * @file adt_bloom.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-28
+ * @version 1.0
+ */
+
+#ifndef __ADT_BLOOM_H__
+#define __ADT_BLOOM_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+
+// bits of a BloomFilter block, one cache line
+#define kBloomBlockBits (CACHE_LINE_SIZE * 8)
+#define kBloomBlockWords (CACHE_LINE_SIZE / sizeof(u64))
+// 4-bit counters of a CountingBloom block, one cache line
+#define kBloomBlockCounters (CACHE_LINE_SIZE * 2)
+#define kBloomCounterMax 15
+#define kBloomMaxHashes 16
+
+// Probabilistic set of keys: contains never misses a key added, and says
+// yes to a key not added with about the false positive rate it was sized
+// for. The bits are split in blocks of a cache line; a key sets its bits
+// in a single block, so a lookup touches one line. Every bit of a key
+// comes from one 64-bit hash of its bytes. The blocks come from OS pages.
+typedef struct bloom_filter_s
+{
+  u64 *blocks_;          // block_count_ * kBloomBlockWords words
+  u32 block_count_;
+  u16 hashes_;           // bits set per key
+  u32 length_;           // keys added, an upper bound after merge
+  struct bloom_filter_ops_s *ops_;
+} BloomFilter;
+
+struct bloom_filter_ops_s
+{
+  /**
+ * @brief Destroys the filter and gives its blocks back to the OS.
+ *
+ * @param filter Pointer to the filter.
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull if the filter is NULL.
+ */
+  s16 (*destroy)(BloomFilter *filter);
+
+  /**
+ * @brief Removes every key.
+ *
+ * @param filter Pointer to the filter.
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull if the filter is NULL.
+ */
+  s16 (*reset)(BloomFilter *filter);
+
+  /**
+ * @brief Returns the number of keys added, or 0 if NULL.
+ */
+  u32 (*length)(BloomFilter *filter);
+
+  /**
+ * @brief Returns the bytes taken by the blocks, or 0 if NULL.
+ */
+  u64 (*memory)(BloomFilter *filter);
+
+  /**
+ * @brief Adds a key.
+ *
+ * @param filter Pointer to the filter.
+ * @param data Bytes of the key.
+ * @param bytes Number of bytes of the key.
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull if the filter is
+ *         NULL, kErrorCode_Null if data is NULL or kErrorCode_BytesZero if
+ *         bytes is 0.
+ */
+  s16 (*add)(BloomFilter *filter, const void *data, u16 bytes);
+
+  /**
+ * @brief Tells if a key may have been added.
+ *
+ * @return True if the key may have been added, False if it was not or any argument is NULL or 0.
+ */
+  boolean (*contains)(BloomFilter *filter, const void *data, u16 bytes);
+
+  /**
+ * @brief Adds the payload of a node as a key.
+ *
+ * @return kErrorCode_Ok, kErrorCode_BloomNull, kErrorCode_Null if the node is NULL, or the errors of add.
+ */
+  s16 (*addNode)(BloomFilter *filter, MemoryNode *node);
+
+  /**
+ * @brief Tells if the payload of a node may have been added.
+ */
+  boolean (*containsNode)(BloomFilter *filter, MemoryNode *node);
+
+  /**
+ * @brief Adds the keys of other, created with the same keys and false positive rate (union).
+ *
+ * @return kErrorCode_Ok, kErrorCode_BloomNull if a filter is NULL or kErrorCode_BloomShape if their sizes differ.
+ */
+  s16 (*merge)(BloomFilter *filter, BloomFilter *other);
+
+  /**
+ * @brief Keeps only the bits also set in other, created with the same keys and false positive rate.
+ *
+ * The result contains the keys added to both, with a false positive rate
+ * up to the one of the smaller filter.
+ *
+ * @return kErrorCode_Ok, kErrorCode_BloomNull if a filter is NULL or kErrorCode_BloomShape if their sizes differ.
+ */
+  s16 (*intersect)(BloomFilter *filter, BloomFilter *other);
+
+  /**
+ * @brief Prints the features of the filter.
+ */
+  void (*print)(BloomFilter *filter);
+};
+
+/**
+ * @brief Creates an empty filter for a number of keys.
+ *
+ * @param keys Number of keys expected.
+ * @param false_positive_rate Rate of false positives once the keys are added, in (0, 1).
+ * @return A pointer to the new filter, or NULL if keys is 0, the rate is out of range or there is not enough memory.
+ */
+BloomFilter *BLOOM_create(u32 keys, double false_positive_rate);
+
+// Bloom filter that also removes keys: every bit is a 4-bit counter. A
+// counter that reaches kBloomCounterMax stays there, so erasing never
+// makes a key added go missing; only erasing a key that was never added
+// does. It takes four times the memory of a BloomFilter with the same rate.
+typedef struct counting_bloom_s
+{
+  u8 *counters_;         // two counters per byte, the first one in the low bits
+  u32 block_count_;
+  u16 hashes_;
+  u32 length_;
+  struct counting_bloom_ops_s *ops_;
+} CountingBloom;
+
+struct counting_bloom_ops_s
+{
+  /**
+ * @brief Destroys the filter and gives its blocks back to the OS.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull if the filter is NULL.
+ */
+  s16 (*destroy)(CountingBloom *filter);
+
+  /**
+ * @brief Removes every key.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull if the filter is NULL.
+ */
+  s16 (*reset)(CountingBloom *filter);
+
+  /**
+ * @brief Returns the number of keys added and not erased, or 0 if NULL.
+ */
+  u32 (*length)(CountingBloom *filter);
+
+  /**
+ * @brief Returns the bytes taken by the counters, or 0 if NULL.
+ */
+  u64 (*memory)(CountingBloom *filter);
+
+  /**
+ * @brief Adds a key.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull if the filter is
+ *         NULL, kErrorCode_Null if data is NULL or kErrorCode_BytesZero if
+ *         bytes is 0.
+ */
+  s16 (*add)(CountingBloom *filter, const void *data, u16 bytes);
+
+  /**
+ * @brief Tells if a key may have been added.
+ *
+ * @return True if the key may have been added, False if it was not or any argument is NULL or 0.
+ */
+  boolean (*contains)(CountingBloom *filter, const void *data, u16 bytes);
+
+  /**
+ * @brief Erases a key added before.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_BloomNull, kErrorCode_Null,
+ *         kErrorCode_BytesZero, or kErrorCode_KeyNotFound if the key is
+ *         surely not in the filter, which is left as it was.
+ */
+  s16 (*erase)(CountingBloom *filter, const void *data, u16 bytes);
+
+  /**
+ * @brief Adds the payload of a node as a key.
+ */
+  s16 (*addNode)(CountingBloom *filter, MemoryNode *node);
+
+  /**
+ * @brief Tells if the payload of a node may have been added.
+ */
+  boolean (*containsNode)(CountingBloom *filter, MemoryNode *node);
+
+  /**
+ * @brief Erases the payload of a node added before.
+ */
+  s16 (*eraseNode)(CountingBloom *filter, MemoryNode *node);
+
+  /**
+ * @brief Adds the counters of other, created with the same keys and false positive rate (union).
+ *
+ * @return kErrorCode_Ok, kErrorCode_BloomNull if a filter is NULL or kErrorCode_BloomShape if their sizes differ.
+ */
+  s16 (*merge)(CountingBloom *filter, CountingBloom *other);
+
+  /**
+ * @brief Keeps the lower of each pair of counters (intersection).
+ *
+ * @return kErrorCode_Ok, kErrorCode_BloomNull if a filter is NULL or kErrorCode_BloomShape if their sizes differ.
+ */
+  s16 (*intersect)(CountingBloom *filter, CountingBloom *other);
+
+  /**
+ * @brief Prints the features of the filter.
+ */
+  void (*print)(CountingBloom *filter);
+};
+
+/**
+ * @brief Creates an empty counting filter for a number of keys.
+ *
+ * @param keys Number of keys expected.
+ * @param false_positive_rate Rate of false positives once the keys are added, in (0, 1).
+ * @return A pointer to the new filter, or NULL if keys is 0, the rate is out of range or there is not enough memory.
+ */
+CountingBloom *COUNTBLOOM_create(u32 keys, double false_positive_rate);
+
+#endif // __ADT_BLOOM_H__
@@ -0,0 +1,250 @@
+/**
+ * @file adt_bptree.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-19
+ * @version 1.0
+ */
+
+#ifndef __ADT_BPTREE_H__
+#define __ADT_BPTREE_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_pool.h"
+#include "adt_vector.h"
+
+// Every node is 8 cache lines, its fanout follows from the key size
+#define kBPTreeNodeBytes (8 * CACHE_LINE_SIZE)
+#define kBPTreeMaxKeyBytes 64
+// nodes per slab of the pool of a tree
+#define kBPTreeSlabNodes 512
+
+// Orders two keys of bytes bytes: negative, 0 or positive like memcmp
+typedef s32 (*BPTreeCompare)(const void *a, const void *b, u16 bytes);
+
+// Header of a node, followed in the same kBPTreeNodeBytes by its arrays:
+// the keys, stored inline and contiguous so a search touches few lines,
+// then the children (inner node) or the data pointers and sizes (leaf).
+// Each array has one slot more than a full node, used while splitting.
+typedef struct bptree_node_s
+{
+  u16 count_;     // keys of the node
+  u16 leaf_;
+  u32 pad_;
+  struct bptree_node_s *next_;  // leaves: neighbours in key order
+  struct bptree_node_s *prev_;
+} BPTreeNode;
+
+// Ordered map of fixed-size keys to payloads, on a B+ tree: the payloads
+// are in the leaves, linked in key order for the range scans, and the
+// inner nodes only route. Keys are compared as bytes (big endian integers
+// keep their order) unless a comparator is given. The nodes come from a
+// pool of the tree, the payloads are owned by the tree like in the other
+// containers.
+typedef struct bptree_s
+{
+  BPTreeNode *root_;
+  BPTreeNode *first_;     // leftmost leaf
+  u32 length_;
+  u32 reserved_;
+  u16 key_bytes_;
+  u16 height_;            // 0 empty, 1 when the root is a leaf
+  u16 leaf_max_;          // entries of a full leaf
+  u16 inner_max_;         // keys of a full inner node
+  u16 leaf_data_offset_;  // offsets of the arrays from the start of a node
+  u16 leaf_size_offset_;
+  u16 inner_child_offset_;
+  BPTreeNode *reserve_;   // nodes taken before an insertion, so a split can't fail
+  BPTreeCompare compare_;
+  Pool *pool_;
+  struct bptree_ops_s *ops_;
+} BPTree;
+
+// Position of an entry, to walk the entries in key order:
+//
+//   BPTreeCursor cursor;
+//   for (tree->ops_->lowerBound(tree, from, &cursor);
+//        True == BPTREE_cursorValid(&cursor) && memcmp(BPTREE_cursorKey(&cursor), to, bytes) < 0;
+//        BPTREE_cursorNext(&cursor))
+//
+// Inserting or erasing entries invalidates the cursor.
+typedef struct bptree_cursor_s
+{
+  BPTreeNode *leaf_;  // NULL once past the last entry
+  u16 index_;
+  BPTree *tree_;
+} BPTreeCursor;
+
+struct bptree_ops_s
+{
+  /**
+ * @brief Destroys the tree, its nodes and the payloads.
+ *
+ * @param tree Pointer to the tree.
+ * @return kErrorCode_Ok on success, kErrorCode_BPTreeNull if the tree is NULL.
+ */
+  s16 (*destroy)(BPTree *tree);
+
+  /**
+ * @brief Empties the tree without freeing the payloads.
+ *
+ * @param tree Pointer to the tree.
+ * @return kErrorCode_Ok on success, kErrorCode_BPTreeNull if the tree is NULL.
+ */
+  s16 (*softReset)(BPTree *tree);
+
+  /**
+ * @brief Empties the tree, freeing the payloads. The nodes go back to its pool.
+ *
+ * @param tree Pointer to the tree.
+ * @return kErrorCode_Ok on success, kErrorCode_BPTreeNull if the tree is NULL.
+ */
+  s16 (*reset)(BPTree *tree);
+
+  /**
+ * @brief Returns the number of entries, or 0 if NULL.
+ */
+  u32 (*length)(BPTree *tree);
+
+  /**
+ * @brief Checks if the tree has no entries. Returns False if NULL.
+ */
+  boolean (*isEmpty)(BPTree *tree);
+
+  /**
+ * @brief Inserts a payload under a key.
+ *
+ * A full node splits in two halves, but the last node of a level splits
+ * leaving the left one full, so the keys inserted in order fill the nodes.
+ *
+ * @param tree Pointer to the tree.
+ * @param key key_bytes_ bytes, copied into the tree.
+ * @param data Pointer to the payload, owned by the tree from now on.
+ * @param bytes The size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_BPTreeNull if the tree is
+ *         NULL, kErrorCode_Null if key is NULL, kErrorCode_SrcNull if data
+ *         is NULL, kErrorCode_BytesZero if bytes is 0, kErrorCode_KeyExists
+ *         if the key is in the tree (its payload is kept) or
+ *         kErrorCode_Memory if the pool can't get the nodes of a split.
+ */
+  s16 (*insert)(BPTree *tree, const void *key, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the entry of a key.
+ *
+ * A node left below half full borrows an entry from a sibling, or merges
+ * with it when the sibling is at half.
+ *
+ * @param tree Pointer to the tree.
+ * @param key key_bytes_ bytes.
+ * @return The payload, owned by the caller, or NULL if the tree or the key
+ *         are NULL or the key is not in the tree.
+ */
+  void *(*erase)(BPTree *tree, const void *key);
+
+  /**
+ * @brief Returns the payload of a key, or NULL if the tree or the key are NULL or the key is not in the tree.
+ */
+  void *(*find)(BPTree *tree, const void *key);
+
+  /**
+ * @brief Sets a cursor on the first entry whose key is not below key.
+ *
+ * The cursor is left invalid if every key is below.
+ *
+ * @return kErrorCode_Ok, kErrorCode_BPTreeNull or kErrorCode_Null if key or cursor are NULL.
+ */
+  s16 (*lowerBound)(BPTree *tree, const void *key, BPTreeCursor *cursor);
+
+  /**
+ * @brief Sets a cursor on the entry of the smallest key, invalid if the tree is empty.
+ *
+ * @return kErrorCode_Ok, kErrorCode_BPTreeNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(BPTree *tree, BPTreeCursor *cursor);
+
+  /**
+ * @brief Builds the tree bottom up from the payloads of a sorted vector.
+ *
+ * The key of each payload is its first key_bytes_ bytes. The nodes are
+ * filled but for an even share of the remainder, without a single split.
+ * The payloads move to the tree and the vector is left empty.
+ *
+ * @param tree Pointer to an empty tree.
+ * @param sorted Vector of payloads in strictly increasing key order.
+ * @return kErrorCode_Ok on success, kErrorCode_BPTreeNull if the tree is
+ *         NULL, kErrorCode_VectorNull if the vector is NULL,
+ *         kErrorCode_KeyExists if the tree is not empty,
+ *         kErrorCode_SizeMismatch if a payload is shorter than a key,
+ *         kErrorCode_KeyOrder if the keys are not strictly increasing or
+ *         kErrorCode_Memory if the pool can't get the nodes. The vector is
+ *         not modified on error.
+ */
+  s16 (*bulkLoad)(BPTree *tree, Vector *sorted);
+
+  /**
+ * @brief Prints the features of the tree and its entries in key order.
+ */
+  void (*print)(BPTree *tree);
+};
+
+/**
+ * @brief Creates an empty tree.
+ *
+ * @param key_bytes Size of the keys (1 .. kBPTreeMaxKeyBytes).
+ * @param compare Key order, NULL to compare the bytes with memcmp.
+ * @return A pointer to the new tree, or NULL if key_bytes is out of range
+ *         or there is not enough memory.
+ */
+BPTree *BPTREE_create(u16 key_bytes, BPTreeCompare compare);
+
+/**
+ * @brief Returns True while the cursor is on an entry.
+ */
+static inline boolean BPTREE_cursorValid(BPTreeCursor *cursor)
+{
+  return NULL != cursor && NULL != cursor->leaf_ ? True : False;
+}
+
+/**
+ * @brief Returns the key of the current entry. The cursor must be valid.
+ */
+static inline const void *BPTREE_cursorKey(BPTreeCursor *cursor)
+{
+  return (const u8 *)(cursor->leaf_ + 1) + (u32)cursor->index_ * cursor->tree_->key_bytes_;
+}
+
+/**
+ * @brief Returns the payload of the current entry. The cursor must be valid.
+ */
+static inline void *BPTREE_cursorData(BPTreeCursor *cursor)
+{
+  return ((void **)((u8 *)cursor->leaf_ + cursor->tree_->leaf_data_offset_))[cursor->index_];
+}
+
+/**
+ * @brief Returns the size of the payload of the current entry. The cursor must be valid.
+ */
+static inline u16 BPTREE_cursorSize(BPTreeCursor *cursor)
+{
+  return ((u16 *)((u8 *)cursor->leaf_ + cursor->tree_->leaf_size_offset_))[cursor->index_];
+}
+
+/**
+ * @brief Moves the cursor to the next entry in key order. Past the last one it becomes invalid.
+ */
+static inline void BPTREE_cursorNext(BPTreeCursor *cursor)
+{
+  if (NULL == cursor || NULL == cursor->leaf_)
+  {
+    return;
+  }
+  if (++cursor->index_ >= cursor->leaf_->count_)
+  {
+    cursor->leaf_ = cursor->leaf_->next_;
+    cursor->index_ = 0;
+  }
+}
+
+#endif // __ADT_BPTREE_H__
@@ -0,0 +1,50 @@
+/**
+ * @file adt_concurrent_dllist.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-29
+ * @version 1.0
+ */
+
+#ifndef __ADT_CONCURRENT_DLLIST_H__
+#define __ADT_CONCURRENT_DLLIST_H__
+
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "adt_dllist.h"
+
+// Node with its own lock. node_ goes first so a MemoryNode* from next_ /
+// prev_ is also a ConcurrentDLListNode*.
+typedef struct concurrent_dllist_node_s {
+  MemoryNode node_;
+  mtx_t lock_;
+} ConcurrentDLListNode;
+
+// Thread-safe DLList with one lock per node (hand-over-hand locking).
+// list_.head_ and list_.tail_ are sentinels that are never removed, so the
+// two ends only contend when the list is almost empty. Locks are always
+// taken from head to tail; operations that start at the tail only try-lock
+// backwards and retry, so no order cycle (deadlock) can happen. A node is
+// only freed with its neighbours locked, so whoever holds a node can trust
+// its next_ and prev_.
+typedef struct concurrent_dllist_s {
+  DLList list_;             // ops_ is concurrent_dllist_ops, length_ unused
+  _Atomic u16 length_;
+  _Atomic u16 capacity_;
+} ConcurrentDLList;
+
+/**
+ * @brief Creates a thread-safe DLList.
+ *
+ * The list is used through the usual dllist_ops_s surface (list->ops_).
+ * Every operation but destroy can run concurrently; traverse calls the
+ * callback with the node locked. Payloads must not be NULL. rotate moves
+ * one node at a time, and cycle behaves like begin: the sentinels end the walk.
+ *
+ * @param capacity Maximum number of elements (> 0).
+ * @return A pointer to the new list, or NULL if capacity is 0 or there is no memory.
+ */
+DLList* ConcurrentDLList_create(u16 capacity);
+
+#endif // __ADT_CONCURRENT_DLLIST_H__
@@ -0,0 +1,96 @@
+/**
+ * @file adt_cursor.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-07-03
+ * @version 1.0
+ */
+
+#ifndef __ADT_CURSOR_H__
+#define __ADT_CURSOR_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+
+// Position inside a container, to walk it without a callback:
+//
+//   Cursor cursor;
+//   for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+//   {
+//     use(CURSOR_get(&cursor));
+//   }
+//
+// Each ADT fills it in its begin (and rbegin) op. Nodes stored contiguously
+// (Vector, Stack) are walked with stride_ +1 or -1, linked nodes (List,
+// DLList, Queue) with stride_ 0 following next_, or prev_ when reverse_.
+// last_ is the final node of the walk, so sentinels and unused storage are
+// never reached. Inserting or extracting elements invalidates the cursor.
+typedef struct cursor_s {
+  MemoryNode *node_; // NULL once the walk is over
+  MemoryNode *last_;
+  s8 stride_;
+  boolean reverse_;
+} Cursor;
+
+/**
+ * @brief Sets a cursor over the nodes first..last, or an invalid one when first is NULL.
+ *
+ * Used by the begin ops of the ADTs.
+ */
+static inline void CURSOR_init(Cursor *cursor, MemoryNode *first, MemoryNode *last, s8 stride, boolean reverse)
+{
+  cursor->node_ = first;
+  cursor->last_ = NULL == first ? NULL : last;
+  cursor->stride_ = stride;
+  cursor->reverse_ = reverse;
+}
+
+/**
+ * @brief Returns True while the cursor is on a node.
+ */
+static inline boolean CURSOR_valid(Cursor *cursor)
+{
+  return NULL != cursor && NULL != cursor->node_ ? True : False;
+}
+
+/**
+ * @brief Returns the data of the current node, NULL when the cursor is not valid.
+ */
+static inline void *CURSOR_get(Cursor *cursor)
+{
+  return NULL != cursor && NULL != cursor->node_ ? cursor->node_->data_ : NULL;
+}
+
+/**
+ * @brief Returns the current node, NULL when the cursor is not valid.
+ */
+static inline MemoryNode *CURSOR_node(Cursor *cursor)
+{
+  return NULL != cursor ? cursor->node_ : NULL;
+}
+
+/**
+ * @brief Moves the cursor to the next node of its walk. Past the last one it becomes invalid.
+ */
+static inline void CURSOR_next(Cursor *cursor)
+{
+  if (NULL == cursor || NULL == cursor->node_)
+  {
+    return;
+  }
+  if (cursor->node_ == cursor->last_)
+  {
+    cursor->node_ = NULL;
+  }
+  else if (0 != cursor->stride_)
+  {
+    cursor->node_ += cursor->stride_;
+  }
+  else
+  {
+    cursor->node_ = True == cursor->reverse_ ? cursor->node_->prev_ : cursor->node_->next_;
+  }
+}
+
+#endif // __ADT_CURSOR_H__
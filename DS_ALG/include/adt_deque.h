@@ -0,0 +1,246 @@
+/**
+ * @file adt_deque.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-12
+ * @version 1.0
+ */
+
+#ifndef __ADT_DEQUE_H__
+#define __ADT_DEQUE_H__
+
+#include "adt_memory_node.h"
+#include "adt_cursor.h"
+
+// Nodes per block, power of two: 16 nodes (640 bytes) fit a 1KB MM block
+#define kDequeBlockShift 4
+#define kDequeBlockNodes (1 << kDequeBlockShift)
+// Block pointers of the first map, doubled when the map fills up. The
+// largest map (8192 pointers) is one 64KB MM block and holds any capacity.
+#define kDequeMapInitial 8
+
+// Double-ended queue on fixed-size blocks of nodes. The blocks in use are
+// consecutive slots of a circular map, so both ends grow and shrink by
+// taking or giving back a block without moving any element, and the
+// element i is found with a shift and a mask from the offset of the first.
+// Each node links to the next one (next_) when inserted, so a cursor walks
+// from block to block; the links of extracted nodes are never followed.
+typedef struct adt_deque_s
+{
+  u16 first_;        // offset of the first element in the first block
+  u16 length_;
+  u16 capacity_;     // maximum number of elements
+  u16 block_first_;  // map slot of the first block
+  u16 blocks_;       // blocks in use
+  u16 map_capacity_; // power of two
+  MemoryNode **map_;
+  MemoryNode *spare_; // last block released, reused by the next one taken
+  struct deque_ops_s *ops_;
+} Deque;
+
+struct deque_ops_s
+{
+  /**
+ * @brief Destroys a deque, freeing its blocks, its map and the data of its elements.
+ *
+ * @param deque Pointer to the deque.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL.
+ */
+  s16 (*destroy)(Deque *deque);
+
+  /**
+ * @brief Empties a deque without freeing the data of its elements.
+ *
+ * @param deque Pointer to the deque.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL,
+ *         kErrorCode_StorageNull if its map is NULL.
+ */
+  s16 (*softReset)(Deque *deque);
+
+  /**
+ * @brief Empties a deque, freeing the data of its elements.
+ *
+ * @param deque Pointer to the deque.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL,
+ *         kErrorCode_StorageNull if its map is NULL.
+ */
+  s16 (*reset)(Deque *deque);
+
+  /**
+ * @brief Changes the maximum number of elements of a deque.
+ *
+ * No element moves. When the new capacity is below the length, the last
+ * elements are extracted and their data freed.
+ *
+ * @param deque Pointer to the deque.
+ * @param new_capacity The new capacity.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL,
+ *         kErrorCode_StorageNull if its map is NULL, kErrorCode_SizeZero if
+ *         the new capacity is 0.
+ */
+  s16 (*resize)(Deque *deque, u16 new_capacity);
+
+  /**
+ * @brief Returns the maximum number of elements of a deque, or 0 if NULL.
+ */
+  u16 (*capacity)(Deque *deque);
+
+  /**
+ * @brief Returns the number of elements of a deque, or 0 if NULL.
+ */
+  u16 (*length)(Deque *deque);
+
+  /**
+ * @brief Checks if a deque is empty. Returns False if NULL.
+ */
+  boolean (*isEmpty)(Deque *deque);
+
+  /**
+ * @brief Checks if a deque is full. Returns False if NULL.
+ */
+  boolean (*isFull)(Deque *deque);
+
+  /**
+ * @brief Returns the data of the first element, or NULL if the deque is empty or NULL.
+ */
+  void *(*first)(Deque *deque);
+
+  /**
+ * @brief Returns the data of the last element, or NULL if the deque is empty or NULL.
+ */
+  void *(*last)(Deque *deque);
+
+  /**
+ * @brief Returns the data of the element at a position, in constant time.
+ *
+ * @param deque Pointer to the deque.
+ * @param position Position from the first element.
+ * @return The data of the element, or NULL if the deque is NULL or the
+ *         position is not below the length.
+ */
+  void *(*at)(Deque *deque, u16 position);
+
+  /**
+ * @brief Inserts an element before the first one, in constant time.
+ *
+ * A block is taken from the spare one or the MM when the first block is
+ * full, and the map doubles when all its slots are in use.
+ *
+ * @param deque Pointer to the deque.
+ * @param data Pointer to the data, owned by the deque from now on.
+ * @param bytes The size of the data.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL,
+ *         kErrorCode_StorageNull if its map is NULL, kErrorCode_SrcNull if
+ *         data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_DequeFull if the deque is full or kErrorCode_Memory if
+ *         there is no memory for a block or the map.
+ */
+  s16 (*insertFirst)(Deque *deque, void *data, u16 bytes);
+
+  /**
+ * @brief Inserts an element after the last one, in constant time.
+ *
+ * Same errors as insertFirst.
+ */
+  s16 (*insertLast)(Deque *deque, void *data, u16 bytes);
+
+  /**
+ * @brief Inserts an element at a position.
+ *
+ * The elements between the position and the nearest end are moved one
+ * place. A position past the last element inserts at the end.
+ *
+ * Same errors as insertFirst.
+ */
+  s16 (*insertAt)(Deque *deque, void *data, u16 bytes, u16 position);
+
+  /**
+ * @brief Extracts the first element, in constant time.
+ *
+ * A block left empty is released: kept as the spare one, or freed.
+ *
+ * @param deque Pointer to the deque.
+ * @return The data of the element, owned by the caller, or NULL if the
+ *         deque is empty or NULL.
+ */
+  void *(*extractFirst)(Deque *deque);
+
+  /**
+ * @brief Extracts the last element, in constant time. Same results as extractFirst.
+ */
+  void *(*extractLast)(Deque *deque);
+
+  /**
+ * @brief Extracts the element at a position.
+ *
+ * The elements between the position and the nearest end are moved one place.
+ *
+ * @param deque Pointer to the deque.
+ * @param position Position from the first element.
+ * @return The data of the element, owned by the caller, or NULL if the
+ *         deque is NULL or the position is not below the length.
+ */
+  void *(*extractAt)(Deque *deque, u16 position);
+
+  /**
+ * @brief Appends a copy of the elements of deque_src to deque.
+ *
+ * The capacity of deque grows by the capacity of deque_src, which is not
+ * modified.
+ *
+ * @param deque Pointer to the destination deque.
+ * @param deque_src Pointer to the source deque.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if a deque is NULL,
+ *         kErrorCode_StorageNull if a map is NULL,
+ *         kErrorCode_NotEnoughCapacity if the capacities add up past 65535
+ *         or kErrorCode_Memory if there is no memory for the copies.
+ */
+  s16 (*concat)(Deque *deque, Deque *deque_src);
+
+  /**
+ * @brief Calls callback with the node of every element, from the first to the last.
+ *
+ * @return kErrorCode_Ok, kErrorCode_DequeNull, kErrorCode_StorageNull or
+ *         kErrorCode_Null if callback is NULL.
+ */
+  s16 (*traverse)(Deque *deque, void (*callback)(MemoryNode *));
+
+  /**
+ * @brief Traverses the elements until the callback returns False.
+ *
+ * @param deque Pointer to the deque.
+ * @param callback Function applied to each element, False stops the traversal.
+ * @param context Pointer passed untouched to every call of callback.
+ * @return kErrorCode_Ok (also when stopped early), kErrorCode_DequeNull,
+ *         kErrorCode_StorageNull or kErrorCode_Null if callback is NULL.
+ */
+  s16 (*traverseEx)(Deque *deque, boolean (*callback)(MemoryNode *, void *), void *context);
+
+  /**
+ * @brief Sets a cursor on the first element, walking to the last one through the next_ links.
+ *
+ * It is left invalid if the deque is empty.
+ *
+ * @return kErrorCode_Ok, kErrorCode_DequeNull, kErrorCode_StorageNull or
+ *         kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(Deque *deque, Cursor *cursor);
+
+  /**
+ * @brief Prints the features of the deque and the content of its elements.
+ */
+  void (*print)(Deque *deque);
+};
+
+/**
+ * @brief Creates an empty deque.
+ *
+ * No block is allocated until the first insertion.
+ *
+ * @param capacity Maximum number of elements.
+ * @return A pointer to the new deque, or NULL if the capacity is 0 or there
+ *         is not enough memory.
+ */
+Deque* DEQUE_create(u16 capacity);
+
+#endif // __ADT_DEQUE_H__
@@ -11,6 +11,7 @@
 
 #include "EDK_MemoryManager/edk_platform_types.h"
 #include "adt_memory_node.h"
+#include "adt_cursor.h"
 
 // Memory Node type
 typedef struct dllist_s {
@@ -297,6 +298,74 @@ struct dllist_ops_s {
 
   s16 (*traverse)(DLList*list, void (*callback)(MemoryNode *));
 
+ /**
+ * @brief Traverses a DLList until the callback asks to stop.
+ *
+ * Like traverse, but the callback also receives the context pointer and
+ * returns True to go on with the next node or False to stop the walk.
+ * An empty DLList is walked without calling the callback.
+ *
+ * @param list Pointer to the DLList to traverse.
+ * @param callback Function applied to each node, False stops the traversal.
+ * @param context Pointer passed untouched to every call of callback.
+ * @return Error code indicating the success or failure of the operation.
+ *         - kErrorCode_Ok: Operation completed successfully, also when stopped early.
+ *         - kErrorCode_ListNull: The provided DLList pointer is NULL.
+ *         - kErrorCode_Null: The provided callback is NULL.
+ */
+  s16 (*traverseEx)(DLList *list, boolean (*callback)(MemoryNode *, void *), void *context);
+
+ /**
+ * @brief Sets a cursor on the first node of a DLList.
+ *
+ * The cursor walks from the head to the tail with CURSOR_next. It is left
+ * invalid if the DLList is empty.
+ *
+ * @param list Pointer to the DLList to walk.
+ * @param cursor Cursor to set.
+ * @return kErrorCode_Ok, kErrorCode_ListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(DLList *list, Cursor *cursor);
+
+ /**
+ * @brief Sets a cursor on the last node of a DLList.
+ *
+ * The cursor walks from the tail back to the head with CURSOR_next. It is
+ * left invalid if the DLList is empty.
+ *
+ * @param list Pointer to the DLList to walk.
+ * @param cursor Cursor to set.
+ * @return kErrorCode_Ok, kErrorCode_ListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*rbegin)(DLList *list, Cursor *cursor);
+
+ /**
+ * @brief Rotates a DLList, moving its first n elements to the end.
+ *
+ * No node is allocated nor freed, only the head and tail move, walking the
+ * shorter way round the ring. A negative n moves the last elements to the
+ * front. With k = n modulo the length it costs O(min(k, length - k)), so
+ * rotating by one either way walks a single node.
+ *
+ * @param list Pointer to the DLList to rotate.
+ * @param n Elements to move from the front to the end.
+ * @return kErrorCode_Ok, also for an empty DLList, or kErrorCode_ListNull.
+ */
+  s16 (*rotate)(DLList *list, s16 n);
+
+ /**
+ * @brief Sets a round-robin cursor on the first node of a DLList.
+ *
+ * On a circular DLList CURSOR_next goes from the tail back to the head, so
+ * the cursor never becomes invalid while the DLList has nodes. On other
+ * DLLists it stops after the tail like begin.
+ *
+ * @param list Pointer to the DLList to walk.
+ * @param cursor Cursor to set.
+ * @return kErrorCode_Ok, kErrorCode_ListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*cycle)(DLList *list, Cursor *cursor);
+
  /**
  * @brief Prints information about a list.
  *
@@ -309,6 +378,19 @@ struct dllist_ops_s {
 
 DLList* DLList_create(u16 capacity); // Creates a new list
 
+/**
+ * @brief Creates a new circular DLList.
+ *
+ * The next_ of the tail points to the head and the prev_ of the head to the
+ * tail, so rotate and cycle give a round-robin over the elements in either
+ * direction. The other ops behave as in a DLList created by DLList_create.
+ *
+ * @param capacity Maximum number of elements.
+ * @return A pointer to the new DLList, or NULL if the capacity is 0 or there
+ *         is not enough memory.
+ */
+DLList* DLList_createCircular(u16 capacity);
+
 
 
 #endif // __ADT_LIST_H__
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ * @file adt_epoch.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-15
+ * @version 1.0
+ */
+
+#ifndef __ADT_EPOCH_H__
+#define __ADT_EPOCH_H__
+
+#include <stdatomic.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+#define kEpochChunkItems 32
+// pin() waits for reclamation while a thread has this many batches pending
+#define kEpochMaxPendingBatches 4
+
+// Pointer waiting to be freed and the function that frees it
+typedef struct epoch_retired_s
+{
+  void *ptr_;
+  void (*free_)(void *ptr);
+} EpochRetired;
+
+typedef struct epoch_chunk_s
+{
+  u16 count_;
+  struct epoch_chunk_s *next_;
+  EpochRetired items_[kEpochChunkItems];
+} EpochChunk;
+
+// Everything one thread retired while the global epoch was epoch_
+typedef struct epoch_bucket_s
+{
+  u32 epoch_;
+  u32 count_;
+  EpochChunk *chunks_;
+} EpochBucket;
+
+// Per thread state. state_ is (epoch << 1) | 1 while the thread is pinned
+// and 0 otherwise; it is the only field other threads read.
+typedef struct epoch_record_s
+{
+  _Atomic u32 state_;
+  u8 pad_state_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  struct epoch_domain_s *domain_;
+  _Atomic boolean in_use_;
+  u16 pin_depth_;
+  u32 pending_;             // retired and not freed yet
+  u32 retired_since_collect_;
+  EpochBucket buckets_[3];  // indexed by epoch % 3
+  EpochChunk *free_chunks_;
+  _Atomic(struct epoch_record_s *) next_;
+} EpochRecord;
+
+// Epoch-based reclamation (Fraser). Threads pin the domain around every
+// access to shared nodes and retire the nodes they unlink instead of
+// freeing them. A pointer retired in epoch e is freed once the global epoch
+// reaches e + 2: the epoch only advances when every pinned thread has seen
+// the current one, so by then nobody can still hold it.
+typedef struct epoch_domain_s
+{
+  _Atomic u32 epoch_;
+  u8 pad_epoch_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  _Atomic(EpochRecord *) records_;  // never shrinks, records are reused
+  u16 batch_size_;
+  _Atomic u64 freed_;
+  struct epoch_ops_s *ops_;
+} EpochDomain;
+
+struct epoch_ops_s
+{
+  /**
+ * @brief Frees every pending pointer, every record and the domain.
+ *
+ * Must only be called once no thread uses the domain.
+ *
+ * @param domain Pointer to the domain.
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the domain is NULL.
+ */
+  s16 (*destroy)(EpochDomain *domain);
+
+  /**
+ * @brief Gives the calling thread a record, reusing one left by an unregistered thread.
+ *
+ * @param domain Pointer to the domain.
+ * @return The record of the thread, or NULL if the domain is NULL or there is no memory.
+ */
+  EpochRecord *(*registerThread)(EpochDomain *domain);
+
+  /**
+ * @brief Releases the record. Waits until everything it retired has been freed.
+ *
+ * @param record Record of the calling thread (must not be pinned).
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the record is NULL,
+ *         kErrorCode_EpochPinned if the thread is still pinned.
+ */
+  s16 (*unregisterThread)(EpochRecord *record);
+
+  /**
+ * @brief Enters a critical section: shared nodes read from now on stay valid until unpin.
+ *
+ * Calls nest. When the thread has too much pending garbage the outermost pin
+ * first helps the epoch advance and waits for its own frees, so memory stays bounded.
+ *
+ * @param record Record of the calling thread.
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the record is NULL.
+ */
+  s16 (*pin)(EpochRecord *record);
+
+  /**
+ * @brief Leaves the critical section opened by the matching pin.
+ *
+ * @param record Record of the calling thread.
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the record is NULL,
+ *         kErrorCode_EpochNotPinned if there is no matching pin.
+ */
+  s16 (*unpin)(EpochRecord *record);
+
+  /**
+ * @brief Schedules a pointer already unlinked from the shared structure to be freed.
+ *
+ * Every batch_size retires the thread tries to advance the epoch and frees
+ * what is already safe.
+ *
+ * @param record Record of the calling thread.
+ * @param ptr Pointer to free.
+ * @param free_fn Function that frees it, or NULL to use MM->free.
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the record is NULL,
+ *         kErrorCode_DataNull if ptr is NULL, kErrorCode_Memory if there is no memory.
+ */
+  s16 (*retire)(EpochRecord *record, void *ptr, void (*free_fn)(void *ptr));
+
+  /**
+ * @brief Moves the global epoch forward if every pinned thread is in the current one.
+ *
+ * @return True if the epoch advanced (by this or another thread), False otherwise.
+ */
+  boolean (*tryAdvance)(EpochDomain *domain);
+
+  /**
+ * @brief Frees the pointers of the record that are safe to free.
+ *
+ * @return Number of pointers freed.
+ */
+  u32 (*collect)(EpochRecord *record);
+
+  /**
+ * @brief Returns the current global epoch, or 0 if NULL.
+ */
+  u32 (*epoch)(EpochDomain *domain);
+
+  /**
+ * @brief Returns the number of pointers the record retired and has not freed yet.
+ */
+  u32 (*pending)(EpochRecord *record);
+
+  /**
+ * @brief Prints the features of the domain and its records. Not thread safe.
+ */
+  void (*print)(EpochDomain *domain);
+};
+
+/**
+ * @brief Creates a new reclamation domain.
+ *
+ * @param batch_size Retires between reclamation attempts of a thread (> 0).
+ *                   A thread never keeps more than kEpochMaxPendingBatches
+ *                   batches pending when it pins.
+ * @return A pointer to the new domain, or NULL if batch_size is 0 or there is no memory.
+ */
+EpochDomain *EPOCH_create(u16 batch_size);
+
+#endif // __ADT_EPOCH_H__
@@ -0,0 +1,877 @@
+/**
+ * @file adt_facade.hpp
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-28
+ * @version 1.0
+ */
+
+#ifndef __ADT_FACADE_HPP__
+#define __ADT_FACADE_HPP__
+
+// Header-only C++17 facade over the C ADTs: ds::vector<T>, ds::list<T>,
+// ds::dllist<T>, ds::queue<T> and ds::stack<T>.
+//
+// - RAII: the destructor destroys every element and then the C container.
+// - Copies are deep (one new payload per element). Moves steal the C
+//   container, the moved-from object is left empty and allocates nothing.
+// - vector, list and dllist have iterators usable with <algorithm>
+//   (random access, forward and bidirectional). queue and stack are
+//   adaptors, like std::queue and std::stack.
+// - Every element is a payload of sizeof(T) bytes owned by a MemoryNode of
+//   the C container. Payloads come from the Allocator, ds::mm_allocator<T>
+//   by default, which binds them to MM.
+// - When a container is full, insertions double its capacity with
+//   ops_->resize, up to the u16 limit of the C ADTs.
+//
+// Mutators report the C error codes (kErrorCode_Ok on success). Only the
+// constructors and the allocator throw (std::bad_alloc), they have no
+// other way to fail.
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+extern "C" {
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_dllist.h"
+#include "adt_stack.h"
+#include "adt_queue.h"
+}
+
+namespace ds {
+
+// Capacity of the C container created by the first insertion
+constexpr u16 kFacadeDefaultCapacity = 8;
+
+/*******************************************************************************
+ * Allocator bound to MM
+ ******************************************************************************/
+// MM only guarantees 4 byte alignment (see aligned_memory.h). Stricter
+// types get alignof(T) extra bytes, the offset to the MM block is kept in
+// the byte just before the aligned address.
+template <typename T>
+class mm_allocator
+{
+  static_assert(alignof(T) <= 128, "the offset to the MM block is a u8");
+  static constexpr bool kRealign = alignof(T) > 4;
+
+public:
+  using value_type = T;
+
+  mm_allocator() noexcept = default;
+  template <typename U>
+  mm_allocator(const mm_allocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n)
+  {
+    std::size_t extra = kRealign ? alignof(T) : 0;
+    u8 *block = static_cast<u8 *>(MM->malloc(static_cast<int>(n * sizeof(T) + extra)));
+    if (nullptr == block)
+    {
+      throw std::bad_alloc();
+    }
+    if (!kRealign)
+    {
+      return reinterpret_cast<T *>(block);
+    }
+    u8 offset = static_cast<u8>(alignof(T) - reinterpret_cast<std::uintptr_t>(block) % alignof(T));
+    block[offset - 1] = offset;
+    return reinterpret_cast<T *>(block + offset);
+  }
+
+  void deallocate(T *memory, std::size_t) noexcept
+  {
+    u8 *aligned = reinterpret_cast<u8 *>(memory);
+    MM->free(kRealign ? aligned - aligned[-1] : aligned);
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const mm_allocator<T> &, const mm_allocator<U> &) noexcept
+{
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const mm_allocator<T> &, const mm_allocator<U> &) noexcept
+{
+  return false;
+}
+
+namespace detail {
+
+// Creation and destruction of the element payloads
+template <typename T, typename Allocator>
+struct payload
+{
+  static_assert(sizeof(T) <= 0xFFFF, "MemoryNode sizes are u16");
+
+  using traits = std::allocator_traits<Allocator>;
+
+  template <typename... Args>
+  static T *create(Allocator &allocator, Args &&...args)
+  {
+    T *element = traits::allocate(allocator, 1);
+    try
+    {
+      traits::construct(allocator, element, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+      traits::deallocate(allocator, element, 1);
+      throw;
+    }
+    return element;
+  }
+
+  static void destroy(Allocator &allocator, void *data)
+  {
+    T *element = static_cast<T *>(data);
+    traits::destroy(allocator, element);
+    traits::deallocate(allocator, element, 1);
+  }
+};
+
+inline u16 growCapacity(u16 capacity)
+{
+  return capacity >= 0x8000 ? 0xFFFF : static_cast<u16>(capacity * 2);
+}
+
+// Walks a chain of MemoryNodes; DLList iterators can also walk back from end()
+template <typename T, typename Container, bool Bidirectional>
+class node_iterator
+{
+public:
+  using iterator_category = std::conditional_t<Bidirectional, std::bidirectional_iterator_tag,
+                                               std::forward_iterator_tag>;
+  using value_type = std::remove_const_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  node_iterator() noexcept = default;
+  node_iterator(MemoryNode *node, Container *container) noexcept : node_(node), container_(container) {}
+  // iterator -> const_iterator
+  template <typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+  node_iterator(const node_iterator<U, Container, Bidirectional> &other) noexcept
+    : node_(other.node()), container_(other.container()) {}
+
+  reference operator*() const { return *static_cast<T *>(node_->data_); }
+  pointer operator->() const { return static_cast<T *>(node_->data_); }
+
+  node_iterator &operator++()
+  {
+    node_ = node_->next_;
+    return *this;
+  }
+  node_iterator operator++(int)
+  {
+    node_iterator previous = *this;
+    node_ = node_->next_;
+    return previous;
+  }
+  template <bool B = Bidirectional, typename = std::enable_if_t<B>>
+  node_iterator &operator--()
+  {
+    node_ = nullptr == node_ ? container_->tail_ : node_->prev_;
+    return *this;
+  }
+  template <bool B = Bidirectional, typename = std::enable_if_t<B>>
+  node_iterator operator--(int)
+  {
+    node_iterator previous = *this;
+    --*this;
+    return previous;
+  }
+
+  bool operator==(const node_iterator &other) const { return node_ == other.node_; }
+  bool operator!=(const node_iterator &other) const { return node_ != other.node_; }
+
+  MemoryNode *node() const { return node_; }
+  Container *container() const { return container_; }
+
+private:
+  MemoryNode *node_ = nullptr;
+  Container *container_ = nullptr;
+};
+
+// Walks the contiguous MemoryNode storage of a Vector
+template <typename T>
+class vector_iterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  vector_iterator() noexcept = default;
+  explicit vector_iterator(MemoryNode *node) noexcept : node_(node) {}
+  template <typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+  vector_iterator(const vector_iterator<U> &other) noexcept : node_(other.node()) {}
+
+  reference operator*() const { return *static_cast<T *>(node_->data_); }
+  pointer operator->() const { return static_cast<T *>(node_->data_); }
+  reference operator[](difference_type n) const { return *static_cast<T *>(node_[n].data_); }
+
+  vector_iterator &operator++() { ++node_; return *this; }
+  vector_iterator operator++(int) { return vector_iterator(node_++); }
+  vector_iterator &operator--() { --node_; return *this; }
+  vector_iterator operator--(int) { return vector_iterator(node_--); }
+  vector_iterator &operator+=(difference_type n) { node_ += n; return *this; }
+  vector_iterator &operator-=(difference_type n) { node_ -= n; return *this; }
+  vector_iterator operator+(difference_type n) const { return vector_iterator(node_ + n); }
+  friend vector_iterator operator+(difference_type n, const vector_iterator &it) { return it + n; }
+  vector_iterator operator-(difference_type n) const { return vector_iterator(node_ - n); }
+  difference_type operator-(const vector_iterator &other) const { return node_ - other.node_; }
+
+  bool operator==(const vector_iterator &other) const { return node_ == other.node_; }
+  bool operator!=(const vector_iterator &other) const { return node_ != other.node_; }
+  bool operator<(const vector_iterator &other) const { return node_ < other.node_; }
+  bool operator>(const vector_iterator &other) const { return node_ > other.node_; }
+  bool operator<=(const vector_iterator &other) const { return node_ <= other.node_; }
+  bool operator>=(const vector_iterator &other) const { return node_ >= other.node_; }
+
+  MemoryNode *node() const { return node_; }
+
+private:
+  MemoryNode *node_ = nullptr;
+};
+
+} // namespace detail
+
+/*******************************************************************************
+ * ds::vector
+ ******************************************************************************/
+template <typename T, typename Allocator = mm_allocator<T>>
+class vector
+{
+public:
+  using value_type = T;
+  using size_type = u16;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = detail::vector_iterator<T>;
+  using const_iterator = detail::vector_iterator<const T>;
+
+  vector() noexcept = default;
+  explicit vector(u16 capacity)
+  {
+    create(capacity);
+  }
+  vector(const vector &other) : allocator_(other.allocator_)
+  {
+    if (!other.empty())
+    {
+      create(other.size());
+      for (const T &element : other)
+      {
+        push_back(element);
+      }
+    }
+  }
+  vector(vector &&other) noexcept : vector_(other.vector_), allocator_(std::move(other.allocator_))
+  {
+    other.vector_ = nullptr;
+  }
+  vector &operator=(vector other) noexcept
+  {
+    swap(other);
+    return *this;
+  }
+  ~vector()
+  {
+    release();
+  }
+
+  void swap(vector &other) noexcept
+  {
+    std::swap(vector_, other.vector_);
+    std::swap(allocator_, other.allocator_);
+  }
+
+  u16 size() const { return nullptr == vector_ ? 0 : vector_->tail_ - vector_->head_; }
+  u16 capacity() const { return nullptr == vector_ ? 0 : vector_->capacity_; }
+  bool empty() const { return 0 == size(); }
+
+  T &operator[](u16 index) { return *static_cast<T *>(vector_->storage_[vector_->head_ + index].data_); }
+  const T &operator[](u16 index) const { return *static_cast<T *>(vector_->storage_[vector_->head_ + index].data_); }
+  T &front() { return (*this)[0]; }
+  const T &front() const { return (*this)[0]; }
+  T &back() { return (*this)[size() - 1]; }
+  const T &back() const { return (*this)[size() - 1]; }
+
+  iterator begin() { return iterator(nodes()); }
+  iterator end() { return iterator(nodes() + size()); }
+  const_iterator begin() const { return const_iterator(nodes()); }
+  const_iterator end() const { return const_iterator(nodes() + size()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  s16 reserve(u16 capacity)
+  {
+    if (nullptr == vector_)
+    {
+      create(0 == capacity ? kFacadeDefaultCapacity : capacity);
+      return kErrorCode_Ok;
+    }
+    return capacity > vector_->capacity_ ? vector_->ops_->resize(vector_, capacity) : kErrorCode_Ok;
+  }
+
+  s16 push_back(const T &value) { return emplace_back(value); }
+  s16 push_back(T &&value) { return emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  s16 emplace_back(Args &&...args)
+  {
+    s16 error = makeRoom();
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    T *element = detail::payload<T, Allocator>::create(allocator_, std::forward<Args>(args)...);
+    error = vector_->ops_->insertLast(vector_, element, sizeof(T));
+    if (kErrorCode_Ok != error)
+    {
+      detail::payload<T, Allocator>::destroy(allocator_, element);
+    }
+    return error;
+  }
+
+  s16 pop_back()
+  {
+    if (empty())
+    {
+      return kErrorCode_VectorEmpty;
+    }
+    detail::payload<T, Allocator>::destroy(allocator_, vector_->ops_->extractLast(vector_));
+    return kErrorCode_Ok;
+  }
+
+  // Destroys the elements, the C vector and its capacity are kept
+  void clear()
+  {
+    while (!empty())
+    {
+      pop_back();
+    }
+  }
+
+  Vector *native() const { return vector_; }
+
+private:
+  void create(u16 capacity)
+  {
+    vector_ = VECTOR_create(capacity);
+    if (nullptr == vector_)
+    {
+      throw std::bad_alloc();
+    }
+  }
+
+  s16 makeRoom()
+  {
+    if (nullptr == vector_)
+    {
+      create(kFacadeDefaultCapacity);
+      return kErrorCode_Ok;
+    }
+    if (vector_->tail_ < vector_->capacity_)
+    {
+      return kErrorCode_Ok;
+    }
+    if (0xFFFF == vector_->capacity_)
+    {
+      return kErrorCode_VectorFull;
+    }
+    return vector_->ops_->resize(vector_, detail::growCapacity(vector_->capacity_));
+  }
+
+  MemoryNode *nodes() const { return nullptr == vector_ ? nullptr : vector_->storage_ + vector_->head_; }
+
+  void release()
+  {
+    if (nullptr != vector_)
+    {
+      clear();
+      vector_->ops_->destroy(vector_);
+      vector_ = nullptr;
+    }
+  }
+
+  Vector *vector_ = nullptr;
+  Allocator allocator_;
+};
+
+/*******************************************************************************
+ * ds::list and ds::dllist
+ ******************************************************************************/
+namespace detail {
+
+// Shared by ds::list and ds::dllist, the C List and DLList have the same
+// layout and ops_. Native is List or DLList, Create its factory.
+template <typename T, typename Allocator, typename Native, Native *(*Create)(u16), bool Bidirectional>
+class basic_list
+{
+public:
+  using value_type = T;
+  using size_type = u16;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = node_iterator<T, Native, Bidirectional>;
+  using const_iterator = node_iterator<const T, Native, Bidirectional>;
+
+  basic_list() noexcept = default;
+  explicit basic_list(u16 capacity)
+  {
+    create(capacity);
+  }
+  basic_list(const basic_list &other) : allocator_(other.allocator_)
+  {
+    if (!other.empty())
+    {
+      create(other.size());
+      for (const T &element : other)
+      {
+        push_back(element);
+      }
+    }
+  }
+  basic_list(basic_list &&other) noexcept : list_(other.list_), allocator_(std::move(other.allocator_))
+  {
+    other.list_ = nullptr;
+  }
+  basic_list &operator=(basic_list other) noexcept
+  {
+    swap(other);
+    return *this;
+  }
+  ~basic_list()
+  {
+    release();
+  }
+
+  void swap(basic_list &other) noexcept
+  {
+    std::swap(list_, other.list_);
+    std::swap(allocator_, other.allocator_);
+  }
+
+  u16 size() const { return nullptr == list_ ? 0 : list_->length_; }
+  u16 capacity() const { return nullptr == list_ ? 0 : list_->capacity_; }
+  bool empty() const { return 0 == size(); }
+
+  T &front() { return *static_cast<T *>(list_->head_->data_); }
+  const T &front() const { return *static_cast<T *>(list_->head_->data_); }
+  T &back() { return *static_cast<T *>(list_->tail_->data_); }
+  const T &back() const { return *static_cast<T *>(list_->tail_->data_); }
+
+  iterator begin() { return iterator(head(), list_); }
+  iterator end() { return iterator(nullptr, list_); }
+  const_iterator begin() const { return const_iterator(head(), list_); }
+  const_iterator end() const { return const_iterator(nullptr, list_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  s16 push_back(const T &value) { return emplace_back(value); }
+  s16 push_back(T &&value) { return emplace_back(std::move(value)); }
+  s16 push_front(const T &value) { return emplace_front(value); }
+  s16 push_front(T &&value) { return emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  s16 emplace_back(Args &&...args)
+  {
+    return emplace(true, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  s16 emplace_front(Args &&...args)
+  {
+    return emplace(false, std::forward<Args>(args)...);
+  }
+
+  s16 pop_front()
+  {
+    if (empty())
+    {
+      return kErrorCode_ListEmpty;
+    }
+    payload<T, Allocator>::destroy(allocator_, list_->ops_->extractFirst(list_));
+    return kErrorCode_Ok;
+  }
+
+  // Walks the whole chain on a singly linked list
+  s16 pop_back()
+  {
+    if (empty())
+    {
+      return kErrorCode_ListEmpty;
+    }
+    payload<T, Allocator>::destroy(allocator_, list_->ops_->extractLast(list_));
+    return kErrorCode_Ok;
+  }
+
+  // Destroys the elements, the C list and its capacity are kept
+  void clear()
+  {
+    while (!empty())
+    {
+      pop_front();
+    }
+  }
+
+  Native *native() const { return list_; }
+
+private:
+  template <typename... Args>
+  s16 emplace(bool last, Args &&...args)
+  {
+    s16 error = makeRoom();
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    T *element = payload<T, Allocator>::create(allocator_, std::forward<Args>(args)...);
+    error = last ? list_->ops_->insertLast(list_, element, sizeof(T))
+                 : list_->ops_->insertFirst(list_, element, sizeof(T));
+    if (kErrorCode_Ok != error)
+    {
+      payload<T, Allocator>::destroy(allocator_, element);
+    }
+    return error;
+  }
+
+  void create(u16 capacity)
+  {
+    list_ = Create(capacity);
+    if (nullptr == list_)
+    {
+      throw std::bad_alloc();
+    }
+  }
+
+  s16 makeRoom()
+  {
+    if (nullptr == list_)
+    {
+      create(kFacadeDefaultCapacity);
+      return kErrorCode_Ok;
+    }
+    if (list_->length_ < list_->capacity_)
+    {
+      return kErrorCode_Ok;
+    }
+    if (0xFFFF == list_->capacity_)
+    {
+      return kErrorCode_NotEnoughCapacity;
+    }
+    return list_->ops_->resize(list_, growCapacity(list_->capacity_));
+  }
+
+  MemoryNode *head() const { return nullptr == list_ ? nullptr : list_->head_; }
+
+  void release()
+  {
+    if (nullptr != list_)
+    {
+      clear();
+      list_->ops_->destroy(list_);
+      list_ = nullptr;
+    }
+  }
+
+  Native *list_ = nullptr;
+  Allocator allocator_;
+};
+
+
+} // namespace detail
+
+template <typename T, typename Allocator = mm_allocator<T>>
+using list = detail::basic_list<T, Allocator, List, LIST_create, false>;
+
+template <typename T, typename Allocator = mm_allocator<T>>
+using dllist = detail::basic_list<T, Allocator, DLList, DLList_create, true>;
+
+/*******************************************************************************
+ * ds::queue
+ ******************************************************************************/
+template <typename T, typename Allocator = mm_allocator<T>>
+class queue
+{
+public:
+  using value_type = T;
+  using size_type = u16;
+  using reference = T &;
+  using const_reference = const T &;
+
+  queue() noexcept = default;
+  explicit queue(u16 capacity)
+  {
+    create(capacity);
+  }
+  // Copies the elements in order, walking the List of the C queue
+  queue(const queue &other) : allocator_(other.allocator_)
+  {
+    if (!other.empty())
+    {
+      create(other.size());
+      for (MemoryNode *node = other.queue_->storage_->head_; nullptr != node; node = node->next_)
+      {
+        push(*static_cast<const T *>(node->data_));
+      }
+    }
+  }
+  queue(queue &&other) noexcept : queue_(other.queue_), allocator_(std::move(other.allocator_))
+  {
+    other.queue_ = nullptr;
+  }
+  queue &operator=(queue other) noexcept
+  {
+    swap(other);
+    return *this;
+  }
+  ~queue()
+  {
+    release();
+  }
+
+  void swap(queue &other) noexcept
+  {
+    std::swap(queue_, other.queue_);
+    std::swap(allocator_, other.allocator_);
+  }
+
+  u16 size() const { return nullptr == queue_ ? 0 : queue_->ops_->length(queue_); }
+  bool empty() const { return 0 == size(); }
+
+  T &front() { return *static_cast<T *>(queue_->ops_->front(queue_)); }
+  const T &front() const { return *static_cast<T *>(queue_->ops_->front(queue_)); }
+  T &back() { return *static_cast<T *>(queue_->ops_->back(queue_)); }
+  const T &back() const { return *static_cast<T *>(queue_->ops_->back(queue_)); }
+
+  s16 push(const T &value) { return emplace(value); }
+  s16 push(T &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  s16 emplace(Args &&...args)
+  {
+    s16 error = makeRoom();
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    T *element = detail::payload<T, Allocator>::create(allocator_, std::forward<Args>(args)...);
+    error = queue_->ops_->enqueue(queue_, element, sizeof(T));
+    if (kErrorCode_Ok != error)
+    {
+      detail::payload<T, Allocator>::destroy(allocator_, element);
+    }
+    return error;
+  }
+
+  s16 pop()
+  {
+    if (empty())
+    {
+      return kErrorCode_QueueEmpty;
+    }
+    detail::payload<T, Allocator>::destroy(allocator_, queue_->ops_->dequeue(queue_));
+    return kErrorCode_Ok;
+  }
+
+  Queue *native() const { return queue_; }
+
+private:
+  void create(u16 capacity)
+  {
+    queue_ = QUEUE_create(capacity);
+    if (nullptr == queue_)
+    {
+      throw std::bad_alloc();
+    }
+  }
+
+  s16 makeRoom()
+  {
+    if (nullptr == queue_)
+    {
+      create(kFacadeDefaultCapacity);
+      return kErrorCode_Ok;
+    }
+    if (True != queue_->ops_->isFull(queue_))
+    {
+      return kErrorCode_Ok;
+    }
+    u16 capacity = queue_->ops_->capacity(queue_);
+    if (0xFFFF == capacity)
+    {
+      return kErrorCode_QueueFull;
+    }
+    return queue_->ops_->resize(queue_, detail::growCapacity(capacity));
+  }
+
+  void release()
+  {
+    if (nullptr != queue_)
+    {
+      while (!empty())
+      {
+        pop();
+      }
+      queue_->ops_->destroy(queue_);
+      queue_ = nullptr;
+    }
+  }
+
+  Queue *queue_ = nullptr;
+  Allocator allocator_;
+};
+
+/*******************************************************************************
+ * ds::stack
+ ******************************************************************************/
+template <typename T, typename Allocator = mm_allocator<T>>
+class stack
+{
+public:
+  using value_type = T;
+  using size_type = u16;
+  using reference = T &;
+  using const_reference = const T &;
+
+  stack() noexcept = default;
+  explicit stack(u16 capacity)
+  {
+    create(capacity);
+  }
+  // Copies the elements bottom to top, walking the Vector of the C stack
+  stack(const stack &other) : allocator_(other.allocator_)
+  {
+    if (!other.empty())
+    {
+      create(other.size());
+      Vector *storage = other.stack_->storage_;
+      for (u16 i = storage->head_; i < storage->tail_; ++i)
+      {
+        push(*static_cast<const T *>(storage->storage_[i].data_));
+      }
+    }
+  }
+  stack(stack &&other) noexcept : stack_(other.stack_), allocator_(std::move(other.allocator_))
+  {
+    other.stack_ = nullptr;
+  }
+  stack &operator=(stack other) noexcept
+  {
+    swap(other);
+    return *this;
+  }
+  ~stack()
+  {
+    release();
+  }
+
+  void swap(stack &other) noexcept
+  {
+    std::swap(stack_, other.stack_);
+    std::swap(allocator_, other.allocator_);
+  }
+
+  u16 size() const { return nullptr == stack_ ? 0 : stack_->ops_->length(stack_); }
+  bool empty() const { return 0 == size(); }
+
+  T &top() { return *static_cast<T *>(stack_->ops_->top(stack_)); }
+  const T &top() const { return *static_cast<T *>(stack_->ops_->top(stack_)); }
+
+  s16 push(const T &value) { return emplace(value); }
+  s16 push(T &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  s16 emplace(Args &&...args)
+  {
+    s16 error = makeRoom();
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    T *element = detail::payload<T, Allocator>::create(allocator_, std::forward<Args>(args)...);
+    error = stack_->ops_->push(stack_, element, sizeof(T));
+    if (kErrorCode_Ok != error)
+    {
+      detail::payload<T, Allocator>::destroy(allocator_, element);
+    }
+    return error;
+  }
+
+  s16 pop()
+  {
+    if (empty())
+    {
+      return kErrorCode_VectorEmpty;
+    }
+    detail::payload<T, Allocator>::destroy(allocator_, stack_->ops_->pop(stack_));
+    return kErrorCode_Ok;
+  }
+
+  Stack *native() const { return stack_; }
+
+private:
+  void create(u16 capacity)
+  {
+    stack_ = STACK_create(capacity);
+    if (nullptr == stack_)
+    {
+      throw std::bad_alloc();
+    }
+  }
+
+  s16 makeRoom()
+  {
+    if (nullptr == stack_)
+    {
+      create(kFacadeDefaultCapacity);
+      return kErrorCode_Ok;
+    }
+    if (True != stack_->ops_->isFull(stack_))
+    {
+      return kErrorCode_Ok;
+    }
+    u16 capacity = stack_->ops_->capacity(stack_);
+    if (0xFFFF == capacity)
+    {
+      return kErrorCode_StackFull;
+    }
+    return stack_->ops_->resize(stack_, detail::growCapacity(capacity));
+  }
+
+  void release()
+  {
+    if (nullptr != stack_)
+    {
+      while (!empty())
+      {
+        pop();
+      }
+      stack_->ops_->destroy(stack_);
+      stack_ = nullptr;
+    }
+  }
+
+  Stack *stack_ = nullptr;
+  Allocator allocator_;
+};
+
+} // namespace ds
+
+#endif // __ADT_FACADE_HPP__
@@ -0,0 +1,393 @@
+/**
+ * @file adt_fast_path.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-21
+ * @version 1.0
+ */
+
+#ifndef __ADT_FAST_PATH_H__
+#define __ADT_FAST_PATH_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_dllist.h"
+#include "adt_stack.h"
+#include "adt_queue.h"
+
+// Inline versions of the read-only and append operations of Vector, List,
+// DLList, Stack and Queue for tight loops. They read the structs directly
+// instead of going through ops_, so the compiler can inline them.
+//
+// The caller guarantees what the ops_ versions check: containers are not
+// NULL, positions are in range and data is not NULL with bytes > 0. Those
+// checks are only compiled in DEBUG builds, where they return the same
+// value as the ops_ version. Running out of capacity is always reported.
+//
+// Appends on lists allocate the node with MEMNODE_create, so arena lists
+// take their own ops_ path for them. Concurrent DLLists take the ops_ path
+// for everything, their nodes and counters are not the plain ones.
+
+#ifdef DEBUG
+#define FAST_CHECK(condition, result) \
+  if (!(condition))                   \
+  {                                   \
+    return result;                    \
+  }
+#else
+#define FAST_CHECK(condition, result)
+#endif
+
+extern struct list_ops_s list_ops;
+extern struct dllist_ops_s dllist_ops;
+
+/*******************************************************************************
+ * Vector
+ ******************************************************************************/
+static inline u16 VECTOR_fastCapacity(Vector *vector)
+{
+  FAST_CHECK(NULL != vector, 0);
+  return vector->capacity_;
+}
+
+static inline u16 VECTOR_fastLength(Vector *vector)
+{
+  FAST_CHECK(NULL != vector, 0);
+  return vector->tail_ - vector->head_;
+}
+
+static inline boolean VECTOR_fastIsEmpty(Vector *vector)
+{
+  FAST_CHECK(NULL != vector, True);
+  return vector->tail_ == vector->head_ ? True : False;
+}
+
+static inline boolean VECTOR_fastIsFull(Vector *vector)
+{
+  FAST_CHECK(NULL != vector, False);
+  return vector->tail_ >= vector->capacity_ ? True : False;
+}
+
+static inline void *VECTOR_fastFirst(Vector *vector)
+{
+  FAST_CHECK(NULL != vector && NULL != vector->storage_, NULL);
+  return vector->tail_ == vector->head_ ? NULL : vector->storage_[vector->head_].data_;
+}
+
+static inline void *VECTOR_fastLast(Vector *vector)
+{
+  FAST_CHECK(NULL != vector && NULL != vector->storage_, NULL);
+  return vector->tail_ == vector->head_ ? NULL : vector->storage_[vector->tail_ - 1].data_;
+}
+
+static inline void *VECTOR_fastAt(Vector *vector, u16 position)
+{
+  FAST_CHECK(NULL != vector && NULL != vector->storage_, NULL);
+  FAST_CHECK(position >= vector->head_ && position < vector->tail_, NULL);
+  return vector->storage_[position].data_;
+}
+
+static inline s16 VECTOR_fastInsertLast(Vector *vector, void *data, u16 bytes)
+{
+  FAST_CHECK(NULL != vector, kErrorCode_VectorNull);
+  FAST_CHECK(NULL != vector->storage_, kErrorCode_StorageNull);
+  FAST_CHECK(NULL != data, kErrorCode_SrcNull);
+  FAST_CHECK(0 != bytes, kErrorCode_BytesZero);
+  if (vector->tail_ >= vector->capacity_)
+  {
+    return kErrorCode_VectorFull;
+  }
+  MemoryNode *node = &vector->storage_[vector->tail_++];
+  node->data_ = data;
+  node->size_ = bytes;
+  return kErrorCode_Ok;
+}
+
+/*******************************************************************************
+ * List
+ ******************************************************************************/
+static inline u16 LIST_fastCapacity(List *list)
+{
+  FAST_CHECK(NULL != list, 0);
+  return list->capacity_;
+}
+
+static inline u16 LIST_fastLength(List *list)
+{
+  FAST_CHECK(NULL != list, 0);
+  return list->length_;
+}
+
+static inline boolean LIST_fastIsEmpty(List *list)
+{
+  FAST_CHECK(NULL != list, True);
+  return 0 == list->length_ ? True : False;
+}
+
+static inline boolean LIST_fastIsFull(List *list)
+{
+  FAST_CHECK(NULL != list, False);
+  return list->length_ >= list->capacity_ ? True : False;
+}
+
+static inline void *LIST_fastFirst(List *list)
+{
+  FAST_CHECK(NULL != list, NULL);
+  return NULL == list->head_ ? NULL : list->head_->data_;
+}
+
+static inline void *LIST_fastLast(List *list)
+{
+  FAST_CHECK(NULL != list, NULL);
+  return NULL == list->tail_ ? NULL : list->tail_->data_;
+}
+
+static inline void *LIST_fastAt(List *list, u16 index)
+{
+  FAST_CHECK(NULL != list && index < list->length_, NULL);
+  MemoryNode *node = list->head_;
+  for (u16 i = 0; i < index; ++i)
+  {
+    node = node->next_;
+  }
+  return node->data_;
+}
+
+static inline s16 LIST_fastInsertLast(List *list, void *data, u16 bytes)
+{
+  FAST_CHECK(NULL != list, kErrorCode_ListNull);
+  FAST_CHECK(NULL != data, kErrorCode_SrcNull);
+  FAST_CHECK(0 != bytes, kErrorCode_BytesZero);
+  if (&list_ops != list->ops_)
+  {
+    return list->ops_->insertLast(list, data, bytes);
+  }
+  if (list->length_ >= list->capacity_)
+  {
+    return kErrorCode_NotEnoughCapacity;
+  }
+  MemoryNode *node = MEMNODE_create();
+  if (NULL == node)
+  {
+    return kErrorCode_NodeNull;
+  }
+  node->data_ = data;
+  node->size_ = bytes;
+  if (NULL == list->tail_)
+  {
+    list->head_ = node;
+  }
+  else
+  {
+    list->tail_->next_ = node;
+  }
+  list->tail_ = node;
+  list->length_++;
+  return kErrorCode_Ok;
+}
+
+/*******************************************************************************
+ * DLList
+ ******************************************************************************/
+static inline u16 DLList_fastCapacity(DLList *list)
+{
+  FAST_CHECK(NULL != list, 0);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->capacity(list);
+  }
+  return list->capacity_;
+}
+
+static inline u16 DLList_fastLength(DLList *list)
+{
+  FAST_CHECK(NULL != list, 0);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->length(list);
+  }
+  return list->length_;
+}
+
+static inline boolean DLList_fastIsEmpty(DLList *list)
+{
+  FAST_CHECK(NULL != list, True);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->isEmpty(list);
+  }
+  return 0 == list->length_ ? True : False;
+}
+
+static inline boolean DLList_fastIsFull(DLList *list)
+{
+  FAST_CHECK(NULL != list, False);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->isFull(list);
+  }
+  return list->length_ >= list->capacity_ ? True : False;
+}
+
+static inline void *DLList_fastFirst(DLList *list)
+{
+  FAST_CHECK(NULL != list, NULL);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->first(list);
+  }
+  return NULL == list->head_ ? NULL : list->head_->data_;
+}
+
+static inline void *DLList_fastLast(DLList *list)
+{
+  FAST_CHECK(NULL != list, NULL);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->last(list);
+  }
+  return NULL == list->tail_ ? NULL : list->tail_->data_;
+}
+
+// Walks from the nearest end
+static inline void *DLList_fastAt(DLList *list, u16 index)
+{
+  FAST_CHECK(NULL != list, NULL);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->at(list, index);
+  }
+  FAST_CHECK(index < list->length_, NULL);
+  MemoryNode *node;
+  if (index < list->length_ / 2)
+  {
+    node = list->head_;
+    for (u16 i = 0; i < index; ++i)
+    {
+      node = node->next_;
+    }
+  }
+  else
+  {
+    node = list->tail_;
+    for (u16 i = list->length_ - 1; i > index; --i)
+    {
+      node = node->prev_;
+    }
+  }
+  return node->data_;
+}
+
+static inline s16 DLList_fastInsertLast(DLList *list, void *data, u16 bytes)
+{
+  FAST_CHECK(NULL != list, kErrorCode_ListNull);
+  FAST_CHECK(NULL != data, kErrorCode_SrcNull);
+  FAST_CHECK(0 != bytes, kErrorCode_BytesZero);
+  if (&dllist_ops != list->ops_)
+  {
+    return list->ops_->insertLast(list, data, bytes);
+  }
+  if (list->length_ >= list->capacity_)
+  {
+    return kErrorCode_NotEnoughCapacity;
+  }
+  MemoryNode *node = MEMNODE_create();
+  if (NULL == node)
+  {
+    return kErrorCode_NodeNull;
+  }
+  node->data_ = data;
+  node->size_ = bytes;
+  node->prev_ = list->tail_;
+  if (NULL == list->tail_)
+  {
+    list->head_ = node;
+  }
+  else
+  {
+    list->tail_->next_ = node;
+  }
+  list->tail_ = node;
+  list->length_++;
+  return kErrorCode_Ok;
+}
+
+/*******************************************************************************
+ * Stack (Vector storage, the top is the last element)
+ ******************************************************************************/
+static inline u16 STACK_fastLength(Stack *stack)
+{
+  FAST_CHECK(NULL != stack && NULL != stack->storage_, 0);
+  return VECTOR_fastLength(stack->storage_);
+}
+
+static inline boolean STACK_fastIsEmpty(Stack *stack)
+{
+  FAST_CHECK(NULL != stack && NULL != stack->storage_, True);
+  return VECTOR_fastIsEmpty(stack->storage_);
+}
+
+static inline boolean STACK_fastIsFull(Stack *stack)
+{
+  FAST_CHECK(NULL != stack && NULL != stack->storage_, False);
+  return VECTOR_fastIsFull(stack->storage_);
+}
+
+// Returns the top without extracting it
+static inline void *STACK_fastTop(Stack *stack)
+{
+  FAST_CHECK(NULL != stack && NULL != stack->storage_, NULL);
+  return VECTOR_fastLast(stack->storage_);
+}
+
+static inline s16 STACK_fastPush(Stack *stack, void *data, u16 bytes)
+{
+  FAST_CHECK(NULL != stack && NULL != stack->storage_, kErrorCode_StackNull);
+  s16 error = VECTOR_fastInsertLast(stack->storage_, data, bytes);
+  return kErrorCode_VectorFull == error ? kErrorCode_StackFull : error;
+}
+
+/*******************************************************************************
+ * Queue (List storage, the front is the first element)
+ ******************************************************************************/
+static inline u16 QUEUE_fastLength(Queue *queue)
+{
+  FAST_CHECK(NULL != queue && NULL != queue->storage_, 0);
+  return LIST_fastLength(queue->storage_);
+}
+
+static inline boolean QUEUE_fastIsEmpty(Queue *queue)
+{
+  FAST_CHECK(NULL != queue && NULL != queue->storage_, True);
+  return LIST_fastIsEmpty(queue->storage_);
+}
+
+static inline boolean QUEUE_fastIsFull(Queue *queue)
+{
+  FAST_CHECK(NULL != queue && NULL != queue->storage_, False);
+  return LIST_fastIsFull(queue->storage_);
+}
+
+static inline void *QUEUE_fastFront(Queue *queue)
+{
+  FAST_CHECK(NULL != queue && NULL != queue->storage_, NULL);
+  return LIST_fastFirst(queue->storage_);
+}
+
+static inline void *QUEUE_fastBack(Queue *queue)
+{
+  FAST_CHECK(NULL != queue && NULL != queue->storage_, NULL);
+  return LIST_fastLast(queue->storage_);
+}
+
+static inline s16 QUEUE_fastEnqueue(Queue *queue, void *data, u16 bytes)
+{
+  FAST_CHECK(NULL != queue && NULL != queue->storage_, kErrorCode_QueueNull);
+  s16 error = LIST_fastInsertLast(queue->storage_, data, bytes);
+  return kErrorCode_NotEnoughCapacity == error ? kErrorCode_QueueFull : error;
+}
+
+#endif // __ADT_FAST_PATH_H__
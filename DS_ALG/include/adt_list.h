@@ -11,6 +11,8 @@
 
 #include "EDK_MemoryManager/edk_platform_types.h"
 #include "adt_memory_node.h"
+#include "adt_cursor.h"
+#include "adt_arena.h"
 
 // Memory Node type
 typedef struct list_s {
@@ -288,6 +290,64 @@ struct list_ops_s {
 
   s16 (*traverse)(List *list, void (*callback)(MemoryNode *));
 
+ /**
+ * @brief Traverses a list until the callback asks to stop.
+ *
+ * Like traverse, but the callback also receives the context pointer and
+ * returns True to go on with the next node or False to stop the walk.
+ * An empty list is walked without calling the callback.
+ *
+ * @param list Pointer to the list to traverse.
+ * @param callback Function applied to each node, False stops the traversal.
+ * @param context Pointer passed untouched to every call of callback.
+ * @return Error code indicating the success or failure of the operation.
+ *         - kErrorCode_Ok: Operation completed successfully, also when stopped early.
+ *         - kErrorCode_ListNull: The provided list pointer is NULL.
+ *         - kErrorCode_Null: The provided callback is NULL.
+ */
+  s16 (*traverseEx)(List *list, boolean (*callback)(MemoryNode *, void *), void *context);
+
+ /**
+ * @brief Sets a cursor on the first node of a list.
+ *
+ * The cursor walks from the head to the tail with CURSOR_next. It is left
+ * invalid if the list is empty.
+ *
+ * @param list Pointer to the list to walk.
+ * @param cursor Cursor to set.
+ * @return kErrorCode_Ok, kErrorCode_ListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(List *list, Cursor *cursor);
+
+ /**
+ * @brief Rotates a list, moving its first n elements to the end.
+ *
+ * No node is allocated nor freed, only the head and tail move: the list is
+ * closed in a ring, walked n steps and opened again. A negative n moves the
+ * last elements to the front. n is taken modulo the length and the walk
+ * only goes forward, so it costs O(k) with k = n modulo the length: a
+ * negative n walks length - |n| nodes.
+ *
+ * @param list Pointer to the list to rotate.
+ * @param n Elements to move from the front to the end.
+ * @return kErrorCode_Ok, also for an empty list, or kErrorCode_ListNull.
+ */
+  s16 (*rotate)(List *list, s16 n);
+
+ /**
+ * @brief Sets a round-robin cursor on the first node of a list.
+ *
+ * On a circular list CURSOR_next goes from the tail back to the head, so
+ * the cursor never becomes invalid while the list has nodes. On other lists
+ * it stops after the tail like begin. Inserting or extracting elements
+ * invalidates the cursor.
+ *
+ * @param list Pointer to the list to walk.
+ * @param cursor Cursor to set.
+ * @return kErrorCode_Ok, kErrorCode_ListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*cycle)(List *list, Cursor *cursor);
+
  /**
  * @brief Prints information about a list.
  *
@@ -300,6 +360,51 @@ struct list_ops_s {
 
 List* LIST_create(u16 capacity); // Creates a new list
 
+/**
+ * @brief Creates a new list of shared payloads.
+ *
+ * Its nodes use memory_node_shared_ops: the payloads inserted come from
+ * MEMNODE_sharedAlloc or MEMNODE_retain and the list owns one reference to
+ * each. concat takes a new reference to each payload of the source, without
+ * copying it, or a shared copy if the source payload isn't shared. reset,
+ * destroy and resize drop the references, and the extractions hand them
+ * over to the caller, who gives them back with MEMNODE_release.
+ *
+ * @param capacity Maximum number of elements.
+ * @return A pointer to the new list, or NULL if the capacity is 0 or there
+ *         is not enough memory.
+ */
+List* LIST_createShared(u16 capacity);
+
+/**
+ * @brief Creates a new list whose memory comes from an arena.
+ *
+ * The list, its nodes and the payload copies made by concat are
+ * bump-allocated from the arena; payloads inserted should come from the same
+ * arena. destroy, reset and the extractions don't free anything: the memory
+ * goes back with the next reset of the arena, after which the list must not
+ * be used.
+ *
+ * @param capacity Maximum number of elements.
+ * @param arena Arena the list allocates from.
+ * @return A pointer to the new list, or NULL if the capacity is 0, the arena
+ *         is NULL or it has no memory left.
+ */
+List* LIST_createInArena(u16 capacity, Arena* arena);
+
+/**
+ * @brief Creates a new circular list.
+ *
+ * The next_ of the tail points to the head, so rotate and cycle give a
+ * round-robin over the elements without extracting and inserting them. The
+ * other ops behave as in a list created by LIST_create.
+ *
+ * @param capacity Maximum number of elements.
+ * @return A pointer to the new list, or NULL if the capacity is 0 or there
+ *         is not enough memory.
+ */
+List* LIST_createCircular(u16 capacity);
+
 
 
 #endif // __ADT_LIST_H__
\ No newline at end of file
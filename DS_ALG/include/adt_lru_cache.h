@@ -0,0 +1,173 @@
+/**
+ * @file adt_lru_cache.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-26
+ * @version 1.0
+ */
+
+#ifndef __ADT_LRU_CACHE_H__
+#define __ADT_LRU_CACHE_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_cursor.h"
+#include "adt_pool.h"
+
+#define kLRUCacheMaxKeyBytes 64
+// buckets of a new cache, doubled each time the entries outnumber them
+#define kLRUCacheInitialBuckets 1024
+#define kLRUCacheSlabBytes (256 * 1024)
+
+// Receives the key and the payload of an entry the cache drops by itself:
+// evicted to stay within the budget, replaced by put, or emptied by reset.
+// The payload belongs to the callback from then on.
+typedef void (*LRUCacheEvict)(const void *key, MemoryNode *node, void *context);
+
+// Entry of the cache: a MemoryNode holding the payload, whose next_ and
+// prev_ link the entries from the most to the least recently used, the
+// link of its bucket and the key.
+typedef struct lru_cache_entry_s
+{
+  MemoryNode node_;
+  struct lru_cache_entry_s *chain_;  // next entry of the same bucket
+  u32 hash_;
+  u8 key_[];                         // key_bytes_ bytes
+} LRUCacheEntry;
+
+// Cache of payloads by fixed-size keys that drops the least recently used
+// ones when the sum of the payload sizes goes over a byte budget. A hash
+// index over the entries finds a key in O(1), and the entries themselves
+// are the recency list, so a hit only relinks one node and an eviction
+// takes the last one. The entries come from a pool of the cache and the
+// buckets from OS pages.
+typedef struct lru_cache_s
+{
+  LRUCacheEntry *first_;      // most recently used
+  LRUCacheEntry *last_;       // next to evict
+  LRUCacheEntry **buckets_;
+  u32 bucket_mask_;           // buckets - 1, a power of two
+  u32 length_;
+  u64 bytes_;                 // sum of the payload sizes
+  u64 budget_;
+  u16 key_bytes_;
+  LRUCacheEvict evict_;
+  void *context_;
+  Pool *pool_;
+  struct lru_cache_ops_s *ops_;
+} LRUCache;
+
+struct lru_cache_ops_s
+{
+  /**
+ * @brief Destroys the cache, its entries and the payloads, freed with the MM.
+ *
+ * The eviction callback is not called.
+ *
+ * @param cache Pointer to the cache.
+ * @return kErrorCode_Ok on success, kErrorCode_LRUCacheNull if the cache is NULL.
+ */
+  s16 (*destroy)(LRUCache *cache);
+
+  /**
+ * @brief Empties the cache without freeing the payloads.
+ *
+ * @param cache Pointer to the cache.
+ * @return kErrorCode_Ok on success, kErrorCode_LRUCacheNull if the cache is NULL.
+ */
+  s16 (*softReset)(LRUCache *cache);
+
+  /**
+ * @brief Empties the cache, dropping every payload from the least recently used.
+ *
+ * @param cache Pointer to the cache.
+ * @return kErrorCode_Ok on success, kErrorCode_LRUCacheNull if the cache is NULL.
+ */
+  s16 (*reset)(LRUCache *cache);
+
+  /**
+ * @brief Returns the number of entries, or 0 if NULL.
+ */
+  u32 (*length)(LRUCache *cache);
+
+  /**
+ * @brief Returns the sum of the sizes of the payloads, or 0 if NULL.
+ */
+  u64 (*bytes)(LRUCache *cache);
+
+  /**
+ * @brief Returns the payload of a key and makes it the most recently used.
+ *
+ * @return The payload, or NULL if the cache or the key are NULL or the key is not cached.
+ */
+  void *(*get)(LRUCache *cache, const void *key);
+
+  /**
+ * @brief Returns the payload of a key without changing the order of use.
+ *
+ * @return The payload, or NULL if the cache or the key are NULL or the key is not cached.
+ */
+  void *(*peek)(LRUCache *cache, const void *key);
+
+  /**
+ * @brief Caches a payload under a key as the most recently used.
+ *
+ * The payload of a key already cached is replaced and dropped, unless it
+ * is the same pointer as data, which is kept and only takes the new size.
+ * Then the least recently used entries are dropped until the payloads fit
+ * in the budget.
+ *
+ * @param cache Pointer to the cache.
+ * @param key key_bytes_ bytes, copied into the cache.
+ * @param data Pointer to the payload, owned by the cache from now on.
+ * @param bytes The size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_LRUCacheNull if the cache
+ *         is NULL, kErrorCode_Null if key is NULL, kErrorCode_SrcNull if
+ *         data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_NotEnoughCapacity if bytes is over the whole budget
+ *         or kErrorCode_Memory if there is no memory for the entry. On
+ *         error nothing is dropped.
+ */
+  s16 (*put)(LRUCache *cache, const void *key, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the entry of a key.
+ *
+ * @return The payload, owned by the caller, or NULL if the cache or the key are NULL or the key is not cached.
+ */
+  void *(*erase)(LRUCache *cache, const void *key);
+
+  /**
+ * @brief Changes the byte budget, dropping the least recently used entries that no longer fit.
+ *
+ * @return kErrorCode_Ok, kErrorCode_LRUCacheNull or kErrorCode_SizeZero if budget is 0.
+ */
+  s16 (*setBudget)(LRUCache *cache, u64 budget);
+
+  /**
+ * @brief Sets a cursor over the payloads from the most to the least recently used.
+ *
+ * @return kErrorCode_Ok, kErrorCode_LRUCacheNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(LRUCache *cache, Cursor *cursor);
+
+  /**
+ * @brief Prints the features of the cache and its entries from the most recently used.
+ */
+  void (*print)(LRUCache *cache);
+};
+
+/**
+ * @brief Creates an empty cache.
+ *
+ * @param key_bytes Size of the keys (1 .. kLRUCacheMaxKeyBytes).
+ * @param budget Maximum sum of the sizes of the payloads.
+ * @param evict Receives the payloads the cache drops, NULL to free them with the MM.
+ * @param context Passed to evict.
+ * @return A pointer to the new cache, or NULL if key_bytes is out of range,
+ *         budget is 0 or there is not enough memory.
+ */
+LRUCache *LRUCACHE_create(u16 key_bytes, u64 budget, LRUCacheEvict evict, void *context);
+
+#endif // __ADT_LRU_CACHE_H__
@@ -253,5 +253,72 @@ s16 MEMNODE_createFromRef(MemoryNode **node);
  */
 s16 MEMNODE_createLite(MemoryNode *node); // Creates a memory node without memory allocation
 
+
+// Shared payloads: a reference count lives in a header just before the data,
+// so several nodes point to the same bytes without copying them. The nodes
+// holding shared payloads use memory_node_shared_ops: reset and free drop
+// their reference, the last one frees the payload, and memSet, memMask,
+// memCopy and memConcat copy the payload before changing it if another node
+// still references it (copy-on-write). setData and softReset don't touch the
+// references: a node set with setData takes over one reference of the
+// caller, and softReset hands the reference of the node to the caller.
+extern struct memory_node_ops_s memory_node_shared_ops;
+
+/**
+ * @brief Initializes a lightweight memory node for shared payloads.
+ *
+ * Same as MEMNODE_createLite, with the operations of the shared payloads.
+ *
+ * @param node Pointer to the memory node to be initialized.
+ * @return kErrorCode_Ok on success, kErrorCode_Memory if the input node is NULL.
+ */
+s16 MEMNODE_createLiteShared(MemoryNode *node);
+
+/**
+ * @brief Allocates a shared payload of bytes bytes, with one reference.
+ *
+ * @param bytes Size of the payload, at most 0xFFFF minus the header.
+ * @return Pointer to the data of the payload, or NULL if bytes is 0 or too
+ *         big, or if there is not enough memory.
+ */
+void* MEMNODE_sharedAlloc(u16 bytes);
+
+/**
+ * @brief Adds a reference to a shared payload.
+ *
+ * @param data Data of a shared payload.
+ * @return data, or NULL if data is NULL.
+ */
+void* MEMNODE_retain(void *data);
+
+/**
+ * @brief Drops a reference to a shared payload, freeing it with the last one.
+ *
+ * Gives back the payloads extracted from the containers of shared payloads.
+ *
+ * @param data Data of a shared payload.
+ * @return kErrorCode_Ok on success, kErrorCode_DataNull if data is NULL.
+ */
+s16 MEMNODE_release(void *data);
+
+/**
+ * @brief Returns the number of references to a shared payload, 0 if data is NULL.
+ */
+u32 MEMNODE_references(void *data);
+
+/**
+ * @brief Makes a node reference the payload of another one, without copying it.
+ *
+ * The previous payload of node, if any, is released. If src holds a
+ * payload of its own, not shared, the node gets a shared copy of it.
+ *
+ * @param node Node of shared payloads that takes the reference.
+ * @param src Node whose payload is shared.
+ * @return kErrorCode_Ok on success, kErrorCode_NodeNull if a node is NULL,
+ *         kErrorCode_DataNull if src has no payload, or kErrorCode_Memory if
+ *         the copy can't be allocated.
+ */
+s16 MEMNODE_share(MemoryNode *node, MemoryNode *src);
+
 #endif // __ADT_MEMORY_NODE_H__
 
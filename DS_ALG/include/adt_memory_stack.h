@@ -0,0 +1,142 @@
+/**
+ * @file adt_memory_stack.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-12
+ * @version 1.0
+ */
+
+#ifndef __ADT_MEMORY_STACK_H__
+#define __ADT_MEMORY_STACK_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+
+// every allocation starts at a multiple of kMemoryStackAlignment
+#define kMemoryStackAlignment 8
+// the block (alignment + bytes) must fit in one 64KB MM block
+#define kMemoryStackMaxCapacity (65536 - 64)
+
+#ifdef DEBUG
+// Debug builds put a header before every allocation and guard bytes after
+// it, so overruns are caught when the allocation is freed or checked.
+#define kMemoryStackGuardBytes 8
+#define kMemoryStackGuardValue 0xFD
+#define kMemoryStackFreedValue 0xDD
+#endif
+
+// The two ends of the block. Low allocations grow up from the start and
+// high allocations grow down from the end, so two lifetimes (e.g. one frame
+// and one level load) can share the block without mixing their markers.
+typedef enum
+{
+  kMemoryStackSide_Low = 0,
+  kMemoryStackSide_High = 1,
+} MemoryStackSide;
+
+// Top of one side at a given moment, returned by marker and given back to
+// freeToMarker. Only valid for the side it was taken from.
+typedef u32 MemoryStackMarker;
+
+// LIFO allocator over a single MM block. alloc moves the top of one side,
+// freeToMarker moves it back, releasing everything allocated on that side
+// after the marker was taken.
+typedef struct memory_stack_s
+{
+  void *block_;      // what MM returned
+  u8 *base_;         // first aligned byte of the block
+  u32 capacity_;
+  u32 low_;          // first free byte of the low side
+  u32 high_;         // first used byte of the high side, capacity_ if empty
+  u32 high_water_;   // largest number of bytes used at once
+  struct memory_stack_ops_s *ops_;
+} MemoryStack;
+
+struct memory_stack_ops_s
+{
+  /**
+ * @brief Destroys the memory stack and gives its block back to MM.
+ *
+ * Everything allocated from it (containers included) becomes invalid.
+ *
+ * @param stack Pointer to the memory stack.
+ * @return kErrorCode_Ok on success, kErrorCode_MemoryStackNull if the stack is NULL.
+ */
+  s16 (*destroy)(MemoryStack *stack);
+
+  /**
+ * @brief Frees both sides at once. The high-water mark is kept.
+ *
+ * @param stack Pointer to the memory stack.
+ * @return kErrorCode_Ok on success, kErrorCode_MemoryStackNull if the stack is NULL.
+ */
+  s16 (*reset)(MemoryStack *stack);
+
+  /**
+ * @brief Allocates bytes on one side, aligned to kMemoryStackAlignment.
+ *
+ * @param stack Pointer to the memory stack.
+ * @param side Side to allocate from.
+ * @param bytes Number of bytes.
+ * @return Pointer to the memory, or NULL if the stack is NULL, bytes is 0
+ *         or both sides would overlap.
+ */
+  void *(*alloc)(MemoryStack *stack, MemoryStackSide side, u32 bytes);
+
+  /**
+ * @brief Returns the current top of one side, or 0 if the stack is NULL.
+ */
+  MemoryStackMarker (*marker)(MemoryStack *stack, MemoryStackSide side);
+
+  /**
+ * @brief Frees everything allocated on one side after the marker was taken.
+ *
+ * Debug builds check the guard bytes of the freed allocations and fill
+ * them with kMemoryStackFreedValue.
+ *
+ * @param stack Pointer to the memory stack.
+ * @param side Side the marker was taken from.
+ * @param marker Marker returned by marker.
+ * @return kErrorCode_Ok on success, kErrorCode_MemoryStackNull if the stack
+ *         is NULL, kErrorCode_MemoryStackMarker if the marker is past the
+ *         top of the side, kErrorCode_MemoryStackGuard if a freed
+ *         allocation was overrun (the memory is freed anyway).
+ */
+  s16 (*freeToMarker)(MemoryStack *stack, MemoryStackSide side, MemoryStackMarker marker);
+
+  /**
+ * @brief Checks the guard bytes of every live allocation.
+ *
+ * Always kErrorCode_Ok in builds without DEBUG.
+ *
+ * @param stack Pointer to the memory stack.
+ * @return kErrorCode_Ok if no allocation was overrun, kErrorCode_MemoryStackNull
+ *         if the stack is NULL, kErrorCode_MemoryStackGuard otherwise.
+ */
+  s16 (*checkGuards)(MemoryStack *stack);
+
+  /**
+ * @brief Returns the bytes used by both sides, padding included, or 0 if NULL.
+ */
+  u32 (*used)(MemoryStack *stack);
+
+  /**
+ * @brief Returns the largest number of bytes used at once since creation, or 0 if NULL.
+ */
+  u32 (*highWater)(MemoryStack *stack);
+
+  /**
+ * @brief Prints how much of each side is used.
+ */
+  void (*print)(MemoryStack *stack);
+};
+
+/**
+ * @brief Creates a memory stack over one MM block.
+ *
+ * @param capacity Bytes shared by both sides (kMemoryStackAlignment ..
+ *        kMemoryStackMaxCapacity), rounded down to kMemoryStackAlignment.
+ * @return A pointer to the new memory stack, or NULL on error.
+ */
+MemoryStack *MEMSTACK_create(u32 capacity);
+
+#endif // __ADT_MEMORY_STACK_H__
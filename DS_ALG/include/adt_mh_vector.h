@@ -10,6 +10,7 @@
 #define __ADT_VECTOR_H__
 
 #include "adt_memory_node.h"
+#include "adt_cursor.h"
 
 typedef struct adt_mh_vector_s
 {
@@ -73,6 +74,10 @@ struct mh_vector_ops_s
 
     s16 (*traverse)(Mh_Vector *vector, void (*callback)(MemoryNode *)); // Calls to a function from all elements of the vector
 
+    s16 (*traverseEx)(Mh_Vector *vector, boolean (*callback)(MemoryNode *, void *), void *context); // Same as traverse with a context, stops when the callback returns False
+
+    s16 (*begin)(Mh_Vector *vector, Cursor *cursor); // Sets a cursor on the first element of the vector
+
   
     void (*print)(Mh_Vector *vector); // Prints the features and content of the vector
 };
@@ -0,0 +1,235 @@
+/**
+ * @file adt_mpmc_queue.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-08
+ * @version 1.0
+ */
+
+#ifndef __ADT_MPMC_QUEUE_H__
+#define __ADT_MPMC_QUEUE_H__
+
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// Slot of the bounded queue. sequence_ tells producers and consumers whose
+// turn it is on this slot (Vyukov's bounded MPMC algorithm).
+typedef struct mpmc_cell_s
+{
+  _Atomic u32 sequence_;
+  u16 size_;
+  void *data_;
+} MPMCCell;
+
+// Bounded multi-producer/multi-consumer queue.
+typedef struct mpmc_queue_s
+{
+  _Atomic u32 enqueue_pos_;
+  u8 pad_enqueue_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  _Atomic u32 dequeue_pos_;
+  u8 pad_dequeue_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  u32 mask_;        // capacity_ - 1
+  u32 capacity_;    // always a power of two
+  MPMCCell *storage_;
+  struct mpmc_queue_ops_s *ops_;
+} MPMCQueue;
+
+struct mpmc_queue_ops_s
+{
+  /**
+ * @brief Destroys the queue, freeing every pending payload, the ring and the queue.
+ *
+ * Must only be called once every producer and consumer has stopped.
+ *
+ * @param qu Pointer to the queue.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL.
+ */
+  s16 (*destroy)(MPMCQueue *qu);
+
+  /**
+ * @brief Frees every pending payload and leaves the queue empty. Not thread safe.
+ *
+ * @param qu Pointer to the queue.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL.
+ */
+  s16 (*reset)(MPMCQueue *qu);
+
+  /**
+ * @brief Returns the number of slots of the ring (power of two), or 0 if NULL.
+ */
+  u16 (*capacity)(MPMCQueue *qu);
+
+  /**
+ * @brief Returns a snapshot of the number of pending elements, or 0 if NULL.
+ */
+  u16 (*length)(MPMCQueue *qu);
+
+  /**
+ * @brief Checks if the queue has no pending elements (True if NULL).
+ */
+  boolean (*isEmpty)(MPMCQueue *qu);
+
+  /**
+ * @brief Checks if every slot is in use (False if NULL).
+ */
+  boolean (*isFull)(MPMCQueue *qu);
+
+  /**
+ * @brief Adds an element at the back, yielding the thread while the queue is full.
+ *
+ * @param qu Pointer to the queue.
+ * @param data Pointer to the payload. The queue takes ownership.
+ * @param bytes Size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL,
+ *         kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if bytes is 0.
+ */
+  s16 (*enqueue)(MPMCQueue *qu, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the front element, yielding the thread while the queue is empty.
+ *
+ * @param qu Pointer to the queue.
+ * @return The payload of the extracted element, or NULL if the queue is NULL.
+ */
+  void *(*dequeue)(MPMCQueue *qu);
+
+  /**
+ * @brief Adds an element at the back without waiting.
+ *
+ * @return Same as enqueue, plus kErrorCode_QueueFull if there is no free slot.
+ */
+  s16 (*tryEnqueue)(MPMCQueue *qu, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the front element without waiting.
+ *
+ * @return The payload of the extracted element, or NULL if the queue is empty or NULL.
+ */
+  void *(*tryDequeue)(MPMCQueue *qu);
+
+  /**
+ * @brief Prints the features and pending content of the queue. Not thread safe.
+ */
+  void (*print)(MPMCQueue *qu);
+};
+
+/**
+ * @brief Creates a new bounded multi-producer/multi-consumer queue.
+ *
+ * The requested capacity is rounded up to the next power of two (minimum 2).
+ *
+ * @param capacity Minimum number of elements the queue must hold (1..32768).
+ * @return A pointer to the new queue, or NULL on invalid capacity or lack of memory.
+ */
+MPMCQueue *MPMCQUEUE_create(u16 capacity);
+
+
+// Segment of the unbounded queue: a fixed array of payload slots filled and
+// drained with fetch-and-add indices, linked to the next segment.
+// refs_ counts the threads working on the segment; its two top bits mark a
+// segment unlinked from the queue (retired) and one already back in the pool.
+typedef struct mpmc_segment_s
+{
+  _Atomic u32 enqueue_idx_;
+  u8 pad_enqueue_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  _Atomic u32 dequeue_idx_;
+  u8 pad_dequeue_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  _Atomic u32 refs_;
+  u8 pad_refs_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  _Atomic(struct mpmc_segment_s *) next_;
+  struct mpmc_segment_s *pool_next_;
+  u32 index_;               // position in the chain, gives length() in O(1)
+  _Atomic(void *) *slots_;
+} MPMCSegment;
+
+// Unbounded multi-producer/multi-consumer queue on a linked list of pooled
+// segments. Segment memory is never returned to MM while the queue lives, so
+// a thread may always bump refs_ of a pointer it read and then check that the
+// segment is still the head/tail; the last reference of a retired segment
+// puts it back in the pool.
+typedef struct mpmc_seg_queue_s
+{
+  _Atomic(MPMCSegment *) head_;
+  u8 pad_head_[CACHE_LINE_SIZE - sizeof(void *)];
+  _Atomic(MPMCSegment *) tail_;
+  u8 pad_tail_[CACHE_LINE_SIZE - sizeof(void *)];
+  mtx_t pool_mutex_;        // slow path only: once per segment
+  MPMCSegment *pool_;
+  u16 segment_capacity_;
+  struct mpmc_seg_queue_ops_s *ops_;
+} MPMCSegQueue;
+
+struct mpmc_seg_queue_ops_s
+{
+  /**
+ * @brief Destroys the queue: pending payloads, live and pooled segments.
+ *
+ * Must only be called once every producer and consumer has stopped.
+ *
+ * @param qu Pointer to the queue.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL.
+ */
+  s16 (*destroy)(MPMCSegQueue *qu);
+
+  /**
+ * @brief Returns a snapshot of the number of pending elements, or 0 if NULL.
+ */
+  u32 (*length)(MPMCSegQueue *qu);
+
+  /**
+ * @brief Checks if the queue has no pending elements (True if NULL).
+ */
+  boolean (*isEmpty)(MPMCSegQueue *qu);
+
+  /**
+ * @brief Adds an element at the back. Only fails if no segment can be allocated.
+ *
+ * Only the payload is stored: dequeue hands back the pointer, as Queue does.
+ *
+ * @param qu Pointer to the queue.
+ * @param data Pointer to the payload. The queue takes ownership.
+ * @param bytes Size of the payload (must not be 0).
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL,
+ *         kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_Memory if a new segment cannot be allocated.
+ */
+  s16 (*enqueue)(MPMCSegQueue *qu, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the front element, yielding the thread while the queue is empty.
+ *
+ * @return The payload of the extracted element, or NULL if the queue is NULL.
+ */
+  void *(*dequeue)(MPMCSegQueue *qu);
+
+  /**
+ * @brief Same as enqueue: an unbounded queue never reports kErrorCode_QueueFull.
+ */
+  s16 (*tryEnqueue)(MPMCSegQueue *qu, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the front element without waiting.
+ *
+ * @return The payload of the extracted element, or NULL if the queue is empty or NULL.
+ */
+  void *(*tryDequeue)(MPMCSegQueue *qu);
+
+  /**
+ * @brief Prints the segments of the queue. Not thread safe.
+ */
+  void (*print)(MPMCSegQueue *qu);
+};
+
+/**
+ * @brief Creates a new unbounded multi-producer/multi-consumer queue.
+ *
+ * @param segment_capacity Number of payload slots of each pooled segment.
+ * @return A pointer to the new queue, or NULL if segment_capacity is 0 or
+ *         there is not enough memory.
+ */
+MPMCSegQueue *MPMCSEGQUEUE_create(u16 segment_capacity);
+
+#endif // __ADT_MPMC_QUEUE_H__
@@ -0,0 +1,107 @@
+/**
+ * @file adt_pool.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-19
+ * @version 1.0
+ */
+
+#ifndef __ADT_POOL_H__
+#define __ADT_POOL_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// object sizes are rounded up to a multiple of kPoolAlignment
+#define kPoolAlignment 8
+
+// Slab of OS pages. The header takes the first cache line, so the objects
+// whose size is a multiple of CACHE_LINE_SIZE start on a cache line.
+typedef struct pool_slab_s
+{
+  struct pool_slab_s *next_;
+} PoolSlab;
+
+// Allocator of objects of one size, for the nodes of the containers that
+// outgrow the MM (its largest class holds a few hundred blocks). Objects
+// are carved from slabs taken from the OS with FILEMAP_pagesAlloc; a freed
+// object goes to a free list threaded through its first bytes and is the
+// next one handed out. Slabs only go back to the OS with destroy.
+typedef struct pool_s
+{
+  void *free_;          // freed objects, most recent first
+  PoolSlab *first_;
+  PoolSlab *current_;   // slab being carved
+  u32 slab_used_;       // bytes of current_ handed out, header included
+  u32 object_bytes_;
+  u32 slab_bytes_;
+  u32 live_;            // objects handed out and not freed
+  struct pool_ops_s *ops_;
+} Pool;
+
+struct pool_ops_s
+{
+  /**
+ * @brief Destroys the pool and gives every slab back to the OS.
+ *
+ * Every object of the pool becomes invalid.
+ *
+ * @param pool Pointer to the pool.
+ * @return kErrorCode_Ok on success, kErrorCode_PoolNull if the pool is NULL.
+ */
+  s16 (*destroy)(Pool *pool);
+
+  /**
+ * @brief Frees every object at once. The slabs are kept for the next allocations.
+ *
+ * @param pool Pointer to the pool.
+ * @return kErrorCode_Ok on success, kErrorCode_PoolNull if the pool is NULL.
+ */
+  s16 (*reset)(Pool *pool);
+
+  /**
+ * @brief Allocates an object, aligned to kPoolAlignment and not cleared.
+ *
+ * @param pool Pointer to the pool.
+ * @return Pointer to the object, or NULL if the pool is NULL or the OS
+ *         has no memory for a new slab.
+ */
+  void *(*alloc)(Pool *pool);
+
+  /**
+ * @brief Gives an object back to the pool.
+ *
+ * @param pool Pointer to the pool.
+ * @param object Object allocated from this pool.
+ * @return kErrorCode_Ok on success, kErrorCode_PoolNull if the pool is
+ *         NULL, kErrorCode_Null if object is NULL.
+ */
+  s16 (*free)(Pool *pool, void *object);
+
+  /**
+ * @brief Returns the objects handed out and not freed, or 0 if NULL.
+ */
+  u32 (*live)(Pool *pool);
+
+  /**
+ * @brief Returns the bytes taken from the OS by all the slabs, or 0 if NULL.
+ */
+  u64 (*capacity)(Pool *pool);
+
+  /**
+ * @brief Prints the sizes of the pool and how many objects are in use.
+ */
+  void (*print)(Pool *pool);
+};
+
+/**
+ * @brief Creates a pool. Its first slab is taken by the first allocation.
+ *
+ * @param object_bytes Bytes per object, at least one pointer.
+ * @param slab_bytes Bytes per slab, header included. Must hold one object.
+ * @return A pointer to the new pool, or NULL if object_bytes is 0, a slab
+ *         can't hold an object or there is not enough memory.
+ */
+Pool *POOL_create(u32 object_bytes, u32 slab_bytes);
+
+#endif // __ADT_POOL_H__
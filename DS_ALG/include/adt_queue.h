@@ -12,6 +12,7 @@
 
 #include "EDK_MemoryManager/edk_platform_types.h"
 #include "adt_list.h"
+#include "adt_cursor.h"
 
 typedef struct queue_s
 {
@@ -33,7 +34,10 @@ struct queue_ops_s
 	void* (*back)(Queue *qu);//last
 	void* (*front)(Queue *qu);//first
 	s16(*concat)(Queue* qu, Queue* qu_src);
+	s16 (*traverseEx)(Queue* qu, boolean (*callback)(MemoryNode*, void*), void* context);//front to back, stops when callback returns False
+	s16 (*begin)(Queue* qu, Cursor* cursor);//cursor on the front
 	void (*print)(Queue* stack);
+	s16 (*sync)(Queue* qu);//durable queues: makes every logged operation durable, nothing to do otherwise
 
 
 
@@ -42,4 +46,36 @@ struct queue_ops_s
 
 Queue* QUEUE_create(u16 capacity);
 
+// Log of a durable queue: segment files <path>.00000000.log, .00000001.log...
+// appended with a record per enqueue (its payload and sequence number) and
+// per dequeue (the acknowledged offset: the first sequence not consumed yet).
+// Every record carries a checksum, so a torn tail left by a crash is cut at
+// the first bad record. <path>.meta keeps the oldest segment and the offset
+// acknowledged when segments whose elements were all consumed get deleted.
+#define kDurableQueuePathMax 240
+// closed segments kept on disk, the current one grows past its size after it
+#define kDurableQueueSegments 64
+
+/**
+ * @brief Opens a queue whose operations are logged to disk, replaying the log found at path.
+ *
+ * The elements enqueued and not dequeued before a restart, or a crash, are
+ * back in the queue in the same order. enqueue copies the payload into MM,
+ * dequeue hands the copy over to the caller, who frees it with MM->free.
+ * The log is fsync'ed once every batch logged operations (group commit) or
+ * with sync: the operations after the last fsync can be lost in a crash, a
+ * lost dequeue delivers its element again. destroy syncs and closes the log
+ * but keeps its files. reset dequeues and frees every element, resize only
+ * changes the capacity in memory and concat enqueues copies of the elements
+ * of the source.
+ *
+ * @param path Prefix of the log files, shorter than kDurableQueuePathMax - 16.
+ * @param capacity Maximum number of elements, grown if the log replays more.
+ * @param batch Logged operations per fsync, 1 to make every one durable.
+ * @param segment_bytes A new segment is started when the current one reaches it.
+ * @return A pointer to the new queue, or NULL on error or if the log can't be
+ *         opened.
+ */
+Queue* QUEUE_openDurable(const char* path, u16 capacity, u16 batch, u32 segment_bytes);
+
 #endif // __ADT_QUEUE_H__
\ No newline at end of file
@@ -0,0 +1,167 @@
+/**
+ * @file adt_skiplist.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-21
+ * @version 1.0
+ */
+
+#ifndef __ADT_SKIPLIST_H__
+#define __ADT_SKIPLIST_H__
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_cursor.h"
+#include "adt_pool.h"
+
+// A tower climbs one more level with probability 1/4: 1.33 links per
+// element on average, and 4^16 elements before the top level fills
+#define kSkipListMaxLevel 16
+#define kSkipListSlabBytes (64 * 1024)
+
+// Orders two payloads: negative, 0 or positive like memcmp
+typedef s32 (*SkipListCompare)(const void *a, u16 a_bytes, const void *b, u16 b_bytes);
+
+// Tower of an element: a MemoryNode holding the payload, whose next_ and
+// prev_ link the bottom level in both directions so the elements can be
+// walked with a Cursor, and the forward links of every level it reaches.
+// forward_[0] is node_.next_ as a tower.
+typedef struct skiplist_node_s
+{
+  MemoryNode node_;
+  u16 height_;
+  struct skiplist_node_s *forward_[];
+} SkipListNode;
+
+// Sorted set of payloads on a skip list. The towers of each height come
+// from their own pool, created with the first tower of that height. Every
+// link of a level only skips forward, so an insertion or an erasure only
+// rewrites the links of the predecessors found on the way down.
+typedef struct skiplist_s
+{
+  SkipListNode *head_;  // tower of kSkipListMaxLevel links without payload
+  SkipListNode *tail_;  // last element, NULL when empty
+  u32 length_;
+  u16 level_;           // levels in use, 1 when empty
+  u64 seed_;            // state of the generator of the heights
+  SkipListCompare compare_;
+  Pool *pools_[kSkipListMaxLevel];  // towers of height i + 1
+  struct skiplist_ops_s *ops_;
+} SkipList;
+
+struct skiplist_ops_s
+{
+  /**
+ * @brief Destroys the skip list, its towers and the payloads.
+ *
+ * @param list Pointer to the skip list.
+ * @return kErrorCode_Ok on success, kErrorCode_SkipListNull if the list is NULL.
+ */
+  s16 (*destroy)(SkipList *list);
+
+  /**
+ * @brief Empties the skip list without freeing the payloads.
+ *
+ * @param list Pointer to the skip list.
+ * @return kErrorCode_Ok on success, kErrorCode_SkipListNull if the list is NULL.
+ */
+  s16 (*softReset)(SkipList *list);
+
+  /**
+ * @brief Empties the skip list, freeing the payloads. The towers go back to the pools.
+ *
+ * @param list Pointer to the skip list.
+ * @return kErrorCode_Ok on success, kErrorCode_SkipListNull if the list is NULL.
+ */
+  s16 (*reset)(SkipList *list);
+
+  /**
+ * @brief Returns the number of elements, or 0 if NULL.
+ */
+  u32 (*length)(SkipList *list);
+
+  /**
+ * @brief Checks if the skip list has no elements. Returns False if NULL.
+ */
+  boolean (*isEmpty)(SkipList *list);
+
+  /**
+ * @brief Returns the smallest element, or NULL if the list is NULL or empty.
+ */
+  void *(*first)(SkipList *list);
+
+  /**
+ * @brief Returns the largest element, or NULL if the list is NULL or empty.
+ */
+  void *(*last)(SkipList *list);
+
+  /**
+ * @brief Inserts a payload at its place in the order.
+ *
+ * @param list Pointer to the skip list.
+ * @param data Pointer to the payload, owned by the list from now on.
+ * @param bytes The size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_SkipListNull if the list is
+ *         NULL, kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if
+ *         bytes is 0, kErrorCode_KeyExists if an equal element is in the
+ *         list (it is kept) or kErrorCode_Memory if there is no memory for
+ *         the tower.
+ */
+  s16 (*insert)(SkipList *list, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the element equal to a payload.
+ *
+ * @param list Pointer to the skip list.
+ * @param data Payload to compare with, not stored.
+ * @param bytes The size of the payload.
+ * @return The element removed, owned by the caller, or NULL if the list or
+ *         data are NULL or there is no equal element.
+ */
+  void *(*erase)(SkipList *list, const void *data, u16 bytes);
+
+  /**
+ * @brief Returns the element equal to a payload, or NULL if the list or data are NULL or there is none.
+ */
+  void *(*find)(SkipList *list, const void *data, u16 bytes);
+
+  /**
+ * @brief Sets a cursor from the first element not below a payload to the last one.
+ *
+ * The cursor is left invalid if every element is below.
+ *
+ * @return kErrorCode_Ok, kErrorCode_SkipListNull or kErrorCode_Null if data or cursor are NULL.
+ */
+  s16 (*lowerBound)(SkipList *list, const void *data, u16 bytes, Cursor *cursor);
+
+  /**
+ * @brief Sets a cursor over the elements in order, invalid if the list is empty.
+ *
+ * @return kErrorCode_Ok, kErrorCode_SkipListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*begin)(SkipList *list, Cursor *cursor);
+
+  /**
+ * @brief Sets a cursor over the elements in reverse order, invalid if the list is empty.
+ *
+ * @return kErrorCode_Ok, kErrorCode_SkipListNull or kErrorCode_Null if cursor is NULL.
+ */
+  s16 (*rbegin)(SkipList *list, Cursor *cursor);
+
+  /**
+ * @brief Prints the features of the skip list and its elements in order.
+ */
+  void (*print)(SkipList *list);
+};
+
+/**
+ * @brief Creates an empty skip list.
+ *
+ * @param compare Order of the payloads, NULL to compare their bytes with
+ *        memcmp, the shorter first when one is a prefix of the other.
+ * @return A pointer to the new skip list, or NULL if there is not enough memory.
+ */
+SkipList *SKIPLIST_create(SkipListCompare compare);
+
+#endif // __ADT_SKIPLIST_H__
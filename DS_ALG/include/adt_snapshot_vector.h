@@ -0,0 +1,174 @@
+/**
+ * @file adt_snapshot_vector.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-22
+ * @version 1.0
+ */
+
+#ifndef __ADT_SNAPSHOT_VECTOR_H__
+#define __ADT_SNAPSHOT_VECTOR_H__
+
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "adt_memory_node.h"
+#include "adt_epoch.h"
+
+// header + storage of a version must fit in one 64KB MM block
+#define kSnapshotVectorMaxCapacity 1600
+// a write retires up to two blocks (version and payload): at most
+// 2 * kEpochMaxPendingBatches writes wait to be freed, big versions included
+#define kSnapshotVectorBatchSize 2
+
+// Immutable once published. The storage follows the header in the same
+// block and its nodes share their payloads with the other versions.
+typedef struct snapshot_version_s
+{
+  u32 number_;
+  u16 length_;
+  u16 capacity_;
+  MemoryNode *storage_;
+} SnapshotVersion;
+
+// Read-mostly vector (RCU). Readers pin the domain and read the current
+// version without locks; writers serialize on a mutex, copy the version,
+// change the copy and publish it. The replaced version and the payloads it
+// no longer shares are retired and freed once no reader can hold them.
+typedef struct snapshot_vector_s
+{
+  _Atomic(SnapshotVersion *) current_;
+  u8 pad_current_[CACHE_LINE_SIZE - sizeof(SnapshotVersion *)];
+  EpochDomain *domain_;
+  EpochRecord *writer_record_;  // only used under writer_mutex_
+  mtx_t writer_mutex_;
+  struct snapshot_vector_ops_s *ops_;
+} SnapshotVector;
+
+struct snapshot_vector_ops_s
+{
+  /**
+ * @brief Destroys the vector, its versions and every payload.
+ *
+ * Must only be called once no reader nor writer uses the vector.
+ *
+ * @param vector Pointer to the vector.
+ * @return kErrorCode_Ok on success, kErrorCode_VectorNull if the vector is NULL.
+ */
+  s16 (*destroy)(SnapshotVector *vector);
+
+  /**
+ * @brief Registers the calling thread as a reader.
+ *
+ * @param vector Pointer to the vector.
+ * @return The record the thread passes to acquire and release, or NULL on error.
+ */
+  EpochRecord *(*registerReader)(SnapshotVector *vector);
+
+  /**
+ * @brief Unregisters a reader. The thread must not hold a version.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the record is NULL,
+ *         kErrorCode_EpochPinned if the reader still holds a version.
+ */
+  s16 (*unregisterReader)(EpochRecord *reader);
+
+  /**
+ * @brief Returns the current version. Wait-free.
+ *
+ * The version and its payloads stay valid and unchanged until release,
+ * whatever the writers do meanwhile. Calls nest. Hold versions briefly and
+ * never write while holding one: writers wait once a few versions are
+ * pending, and the held one cannot be freed.
+ *
+ * @param vector Pointer to the vector.
+ * @param reader Record of the calling thread.
+ * @return The current version, or NULL if vector or reader are NULL.
+ */
+  const SnapshotVersion *(*acquire)(SnapshotVector *vector, EpochRecord *reader);
+
+  /**
+ * @brief Gives back the version returned by the matching acquire.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_EpochNull if the record is NULL,
+ *         kErrorCode_EpochNotPinned if there is no matching acquire.
+ */
+  s16 (*release)(SnapshotVector *vector, EpochRecord *reader);
+
+  /**
+ * @brief Returns the number of elements of a version, or 0 if NULL.
+ */
+  u16 (*length)(const SnapshotVersion *version);
+
+  /**
+ * @brief Returns the element at the given position of a version.
+ *
+ * @return The payload, or NULL if the version is NULL or the position is out of range.
+ */
+  void *(*at)(const SnapshotVersion *version, u16 position);
+
+  /**
+ * @brief Publishes a version with the element added at the beginning.
+ *
+ * The vector takes ownership of data. The capacity doubles when needed up
+ * to kSnapshotVectorMaxCapacity.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_VectorNull if the vector is NULL,
+ *         kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_VectorFull if the vector is at kSnapshotVectorMaxCapacity.
+ */
+  s16 (*insertFirst)(SnapshotVector *vector, void *data, u16 bytes);
+
+  /**
+ * @brief Publishes a version with the element added at the end. Same errors as insertFirst.
+ */
+  s16 (*insertLast)(SnapshotVector *vector, void *data, u16 bytes);
+
+  /**
+ * @brief Publishes a version with the element added at the given position.
+ *
+ * A position past the end inserts last. Same errors as insertFirst.
+ */
+  s16 (*insertAt)(SnapshotVector *vector, void *data, u16 bytes, u16 position);
+
+  /**
+ * @brief Publishes a version where the element at the given position is replaced.
+ *
+ * The old payload is freed once no reader can hold it.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_VectorNull if the vector is NULL,
+ *         kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_PositionMismatch if there is no element at position.
+ */
+  s16 (*setAt)(SnapshotVector *vector, void *data, u16 bytes, u16 position);
+
+  /**
+ * @brief Publishes a version without the element at the given position.
+ *
+ * The payload is freed once no reader can hold it.
+ *
+ * @return kErrorCode_Ok on success, kErrorCode_VectorNull if the vector is NULL,
+ *         kErrorCode_PositionMismatch if there is no element at position.
+ */
+  s16 (*removeAt)(SnapshotVector *vector, u16 position);
+
+  /**
+ * @brief Returns the number of versions published so far, or 0 if NULL.
+ */
+  u32 (*version)(SnapshotVector *vector);
+
+  /**
+ * @brief Prints the features and content of the current version. Not thread safe.
+ */
+  void (*print)(SnapshotVector *vector);
+};
+
+/**
+ * @brief Creates an empty snapshot vector.
+ *
+ * @param capacity Capacity of the first version (1 .. kSnapshotVectorMaxCapacity).
+ * @return A pointer to the new vector, or NULL on error.
+ */
+SnapshotVector *SNAPSHOTVECTOR_create(u16 capacity);
+
+#endif // __ADT_SNAPSHOT_VECTOR_H__
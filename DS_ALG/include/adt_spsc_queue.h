@@ -0,0 +1,151 @@
+/**
+ * @file adt_spsc_queue.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-06
+ * @version 1.0
+ */
+
+#ifndef __ADT_SPSC_QUEUE_H__
+#define __ADT_SPSC_QUEUE_H__
+
+#include <stdatomic.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+
+// Bounded single-producer/single-consumer queue over a power-of-two ring.
+// head_ is only written by the consumer and tail_ only by the producer; each
+// side keeps a cached copy of the other index so the shared line is only
+// touched when the ring looks full (producer) or empty (consumer).
+typedef struct spsc_queue_s
+{
+  _Atomic u32 head_;   // next slot to dequeue (consumer)
+  u32 cached_tail_;    // consumer's last seen tail_
+  u8 pad_head_[CACHE_LINE_SIZE - sizeof(_Atomic u32) - sizeof(u32)];
+  _Atomic u32 tail_;   // next slot to enqueue (producer)
+  u32 cached_head_;    // producer's last seen head_
+  u8 pad_tail_[CACHE_LINE_SIZE - sizeof(_Atomic u32) - sizeof(u32)];
+  u32 mask_;           // capacity_ - 1
+  u32 capacity_;       // always a power of two
+  MemoryNode *storage_;
+  struct spsc_queue_ops_s *ops_;
+} SPSCQueue;
+
+struct spsc_queue_ops_s
+{
+  /**
+ * @brief Destroys the queue, freeing every pending payload, the ring and the queue itself.
+ *
+ * Must only be called once producer and consumer have stopped using the queue.
+ *
+ * @param qu Pointer to the queue to be destroyed.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL.
+ */
+  s16 (*destroy)(SPSCQueue *qu);
+
+  /**
+ * @brief Frees every pending payload and leaves the queue empty.
+ *
+ * Not thread safe: producer and consumer must be stopped.
+ *
+ * @param qu Pointer to the queue to be reset.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL.
+ */
+  s16 (*reset)(SPSCQueue *qu);
+
+  /**
+ * @brief Returns the number of slots of the ring (power of two).
+ *
+ * @param qu Pointer to the queue.
+ * @return The capacity of the queue, or 0 if the queue is NULL.
+ */
+  u16 (*capacity)(SPSCQueue *qu);
+
+  /**
+ * @brief Returns the number of pending elements.
+ *
+ * When called while the other side is running, the value is a snapshot that
+ * may already be stale when it is returned.
+ *
+ * @param qu Pointer to the queue.
+ * @return The number of elements in the queue, or 0 if the queue is NULL.
+ */
+  u16 (*length)(SPSCQueue *qu);
+
+  /**
+ * @brief Checks if the queue has no pending elements.
+ *
+ * @param qu Pointer to the queue.
+ * @return True if the queue is empty or NULL, False otherwise.
+ */
+  boolean (*isEmpty)(SPSCQueue *qu);
+
+  /**
+ * @brief Checks if every slot of the ring is in use.
+ *
+ * @param qu Pointer to the queue.
+ * @return True if the queue is full, False otherwise or if the queue is NULL.
+ */
+  boolean (*isFull)(SPSCQueue *qu);
+
+  /**
+ * @brief Adds an element at the back of the queue. Producer side only.
+ *
+ * The queue takes ownership of the payload, exactly as Queue does.
+ *
+ * @param qu Pointer to the queue.
+ * @param data Pointer to the payload.
+ * @param bytes Size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_QueueNull if the queue is NULL,
+ *         kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_QueueFull if there is no free slot.
+ */
+  s16 (*enqueue)(SPSCQueue *qu, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the element at the front of the queue. Consumer side only.
+ *
+ * @param qu Pointer to the queue.
+ * @return The payload of the extracted element, or NULL if the queue is empty or NULL.
+ */
+  void *(*dequeue)(SPSCQueue *qu);
+
+  /**
+ * @brief Returns the last enqueued element without extracting it. Producer side only.
+ *
+ * @param qu Pointer to the queue.
+ * @return The payload at the back, or NULL if the queue is empty or NULL.
+ */
+  void *(*back)(SPSCQueue *qu);
+
+  /**
+ * @brief Returns the next element to be dequeued without extracting it. Consumer side only.
+ *
+ * @param qu Pointer to the queue.
+ * @return The payload at the front, or NULL if the queue is empty or NULL.
+ */
+  void *(*front)(SPSCQueue *qu);
+
+  /**
+ * @brief Prints the features and pending content of the queue.
+ *
+ * @param qu Pointer to the queue.
+ */
+  void (*print)(SPSCQueue *qu);
+};
+
+/**
+ * @brief Creates a new single-producer/single-consumer queue.
+ *
+ * The requested capacity is rounded up to the next power of two so slot
+ * indices can be computed with a mask instead of a division.
+ *
+ * @param capacity Minimum number of elements the queue must hold (1..32768).
+ * @return A pointer to the new queue, or NULL if capacity is 0 or too big,
+ *         or if there is not enough memory.
+ */
+SPSCQueue *SPSCQUEUE_create(u16 capacity);
+
+#endif // __ADT_SPSC_QUEUE_H__
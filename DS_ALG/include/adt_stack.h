@@ -163,6 +163,34 @@ struct stack_ops_s
  */
     s16 (*concat)(Stack *stack, Stack *stack_src);
 
+    /**
+ * @brief Traverses a stack from the top to the bottom until the callback asks to stop.
+ *
+ * The callback receives each node and the context pointer, and returns True
+ * to go on with the next element or False to stop the walk.
+ *
+ * @param stack Pointer to the stack to traverse.
+ * @param callback Function applied to each element, False stops the traversal.
+ * @param context Pointer passed untouched to every call of callback.
+ * @return Returns an error code indicating the result of the operation.
+ *         - `kErrorCode_Ok` if the traversal was successful, also when stopped early.
+ *         - `kErrorCode_StackNull` if the stack is NULL.
+ *         - `kErrorCode_Null` if the callback is NULL.
+ */
+    s16 (*traverseEx)(Stack *stack, boolean (*callback)(MemoryNode *, void *), void *context);
+
+    /**
+ * @brief Sets a cursor on the top of a stack.
+ *
+ * The cursor walks from the top to the bottom with CURSOR_next. It is left
+ * invalid if the stack is empty.
+ *
+ * @param stack Pointer to the stack to walk.
+ * @param cursor Cursor to set.
+ * @return Returns `kErrorCode_Ok`, `kErrorCode_StackNull` or `kErrorCode_Null` if the cursor is NULL.
+ */
+    s16 (*begin)(Stack *stack, Cursor *cursor);
+
     /**
  * @brief Function pointer type for printing the contents of a stack.
  *
@@ -184,4 +212,18 @@ struct stack_ops_s
  */
 Stack *STACK_create(u16 capacity);
 
+/**
+ * @brief Create a temporary stack whose memory comes from one side of a memory stack.
+ *
+ * The stack and its storage are allocated on that side; destroy doesn't free
+ * anything and the stack dies with the next freeToMarker below it (or reset).
+ *
+ * @param capacity The maximum number of elements the stack can hold.
+ * @param memory_stack Memory stack the stack allocates from.
+ * @param side Side of the memory stack.
+ * @return Returns a pointer to the new stack, or NULL if the capacity is 0,
+ *         memory_stack is NULL or it has no memory left.
+ */
+Stack *STACK_createInMemoryStack(u16 capacity, MemoryStack *memory_stack, MemoryStackSide side);
+
 #endif // __ADT_STACK_H__
\ No newline at end of file
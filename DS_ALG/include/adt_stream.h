@@ -0,0 +1,157 @@
+/**
+ * @file adt_stream.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-07-15
+ * @version 1.0
+ */
+
+#ifndef __ADT_STREAM_H__
+#define __ADT_STREAM_H__
+
+#include <stdio.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "adt_memory_node.h"
+#include "adt_list.h"
+#include "file_map.h"
+
+// block sizes are rounded up to a multiple of it, the mapping granularity of Windows
+#define kStreamBlockAlignment 65536
+
+typedef enum
+{
+  kStreamMode_Read = 0, // fread into recycled blocks of OS pages
+  kStreamMode_Map,      // map the whole file, blocks are windows of the mapping
+} StreamMode;
+
+// A block of the file and the slices handed out of it. refs_ counts the live
+// slices, plus one while the stream is still cutting it. At zero the block
+// is recycled: its buffer serves the next read, or the pages of its window
+// are dropped from memory.
+typedef struct stream_block_s
+{
+  struct stream_block_s *next_;
+  u8 *data_;
+  u32 bytes_;
+  u32 cut_; // bytes already handed out as slices
+  u32 refs_;
+} StreamBlock;
+
+// Zero copy reader of a file: every slice is a MemoryNode whose data_ points
+// into a block, nothing is copied nor allocated per slice. Slices are
+// slice_size_ bytes but the last one of a block, which can be shorter, and
+// never cross two blocks. They stay valid until released, so a slice kept
+// alive keeps its whole block alive. Not thread safe.
+typedef struct stream_s
+{
+  StreamMode mode_;
+  FILE *file_;    // kStreamMode_Read
+  FileMap map_;   // kStreamMode_Map
+  u64 offset_;    // bytes of the file already read into blocks
+  u64 bytes_;     // size of the file
+  u32 block_size_;
+  u16 slice_size_;
+  StreamBlock *current_; // block being cut, NULL when it must be read
+  StreamBlock *live_;    // blocks with live slices, newest first
+  StreamBlock *free_;    // recycled blocks
+  struct stream_ops_s *ops_;
+} Stream;
+
+struct stream_ops_s
+{
+  /**
+ * @brief Closes the file and frees every block.
+ *
+ * The slices still alive become invalid.
+ *
+ * @param stream Pointer to the stream.
+ * @return kErrorCode_Ok on success, kErrorCode_StreamNull if the stream is NULL.
+ */
+  s16 (*destroy)(Stream *stream);
+
+  /**
+ * @brief Points a node at the next slice of the file.
+ *
+ * Reads, or maps, a new block when the current one is cut. The previous
+ * content of the node is overwritten, not freed.
+ *
+ * @param stream Pointer to the stream.
+ * @param node Node of the caller, created or lite.
+ * @return kErrorCode_Ok, kErrorCode_StreamEnd at the end of the file,
+ *         kErrorCode_StreamNull or kErrorCode_NodeNull if they are NULL, or
+ *         kErrorCode_Memory / kErrorCode_File if a block can't be read.
+ */
+  s16 (*next)(Stream *stream, MemoryNode *node);
+
+  /**
+ * @brief Gives a slice back and soft resets its node.
+ *
+ * The data isn't freed, only the reference to its block is dropped.
+ *
+ * @param stream Pointer to the stream.
+ * @param node Node pointing to a live slice.
+ * @return kErrorCode_Ok, kErrorCode_StreamNull or kErrorCode_NodeNull if
+ *         they are NULL, or kErrorCode_StreamSlice if the data isn't a live
+ *         slice of the stream.
+ */
+  s16 (*release)(Stream *stream, MemoryNode *node);
+
+  /**
+ * @brief Gives back a slice by its data, for the payloads extracted from containers.
+ *
+ * @return Same as release.
+ */
+  s16 (*releaseData)(Stream *stream, void *data);
+
+  /**
+ * @brief Inserts slices at the end of a list until it's full or the file ends.
+ *
+ * The list only gets the references, a node per slice, but it must not
+ * free them: give them back with releaseList, not with reset or destroy.
+ *
+ * @param stream Pointer to the stream.
+ * @param list List to fill.
+ * @return kErrorCode_Ok, kErrorCode_StreamEnd if the file ended before
+ *         inserting anything, or the error of next or of the list.
+ */
+  s16 (*fill)(Stream *stream, List *list);
+
+  /**
+ * @brief Extracts every element of a list filled by fill and releases its slice.
+ *
+ * @return kErrorCode_Ok, kErrorCode_StreamNull or kErrorCode_ListNull if
+ *         they are NULL, or kErrorCode_StreamSlice if an element isn't a
+ *         live slice of the stream.
+ */
+  s16 (*releaseList)(Stream *stream, List *list);
+
+  /**
+ * @brief Returns the number of blocks with live slices, the current one included.
+ */
+  u16 (*liveBlocks)(Stream *stream);
+
+  /**
+ * @brief Returns the bytes handed out as slices so far.
+ */
+  u64 (*position)(Stream *stream);
+
+  /**
+ * @brief Prints the position and the blocks of the stream.
+ */
+  void (*print)(Stream *stream);
+};
+
+/**
+ * @brief Opens a file to be read in slices.
+ *
+ * @param path File to read.
+ * @param mode kStreamMode_Read or kStreamMode_Map.
+ * @param block_size Bytes per block, rounded up to kStreamBlockAlignment.
+ * @param slice_size Bytes per slice (1 .. block size).
+ * @return A pointer to the new stream, or NULL if a parameter is wrong or the
+ *         file can't be opened.
+ */
+Stream *STREAM_create(const char *path, StreamMode mode, u32 block_size, u16 slice_size);
+
+#endif // __ADT_STREAM_H__
@@ -0,0 +1,127 @@
+/**
+ * @file adt_treiber_stack.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-10
+ * @version 1.0
+ */
+
+#ifndef __ADT_TREIBER_STACK_H__
+#define __ADT_TREIBER_STACK_H__
+
+#include <stdatomic.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// Node of the stack. Nodes live in one array allocated at creation and are
+// linked by index; next_ is atomic because a popper may read it while the
+// node is being recycled (its CAS will then fail on the tag).
+typedef struct treiber_node_s
+{
+  _Atomic(void *) data_;
+  u16 size_;
+  _Atomic u16 next_;
+} TreiberNode;
+
+// Lock-free stack (Treiber). head_ and free_ pack, in one 64-bit word that
+// is swapped with a single CAS: the index of the first node, the number of
+// nodes in the list and a tag bumped on every change, so a node popped and
+// pushed back between a load and a CAS (ABA) never fools the CAS.
+// Free nodes form a second Treiber stack, so push/pop never hit MM.
+typedef struct treiber_stack_s
+{
+  _Atomic u64 head_;
+  u8 pad_head_[CACHE_LINE_SIZE - sizeof(_Atomic u64)];
+  _Atomic u64 free_;
+  u8 pad_free_[CACHE_LINE_SIZE - sizeof(_Atomic u64)];
+  u16 capacity_;
+  TreiberNode *nodes_;
+  struct treiber_stack_ops_s *ops_;
+} TreiberStack;
+
+struct treiber_stack_ops_s
+{
+  /**
+ * @brief Destroys the stack, freeing every pending payload, the nodes and the stack.
+ *
+ * Must only be called once no other thread uses the stack.
+ *
+ * @param stack Pointer to the stack.
+ * @return kErrorCode_Ok on success, kErrorCode_StackNull if the stack is NULL.
+ */
+  s16 (*destroy)(TreiberStack *stack);
+
+  /**
+ * @brief Frees every pending payload and leaves the stack empty. Not thread safe.
+ *
+ * @param stack Pointer to the stack.
+ * @return kErrorCode_Ok on success, kErrorCode_StackNull if the stack is NULL.
+ */
+  s16 (*reset)(TreiberStack *stack);
+
+  /**
+ * @brief Returns the number of nodes of the stack, or 0 if NULL.
+ */
+  u16 (*capacity)(TreiberStack *stack);
+
+  /**
+ * @brief Returns a snapshot of the number of elements, or 0 if NULL.
+ */
+  u16 (*length)(TreiberStack *stack);
+
+  /**
+ * @brief Checks if the stack has no elements (True if NULL).
+ */
+  boolean (*isEmpty)(TreiberStack *stack);
+
+  /**
+ * @brief Checks if every node is in use (False if NULL).
+ */
+  boolean (*isFull)(TreiberStack *stack);
+
+  /**
+ * @brief Pushes an element on top of the stack.
+ *
+ * @param stack Pointer to the stack.
+ * @param data Pointer to the payload. The stack takes ownership.
+ * @param bytes Size of the payload.
+ * @return kErrorCode_Ok on success, kErrorCode_StackNull if the stack is NULL,
+ *         kErrorCode_SrcNull if data is NULL, kErrorCode_BytesZero if bytes is 0,
+ *         kErrorCode_StackFull if there is no free node.
+ */
+  s16 (*push)(TreiberStack *stack, void *data, u16 bytes);
+
+  /**
+ * @brief Removes the top element.
+ *
+ * @param stack Pointer to the stack.
+ * @return The payload of the extracted element, or NULL if the stack is empty or NULL.
+ */
+  void *(*pop)(TreiberStack *stack);
+
+  /**
+ * @brief Returns the payload on top without removing it.
+ *
+ * Only a snapshot: another thread may pop (and free) it right after.
+ *
+ * @param stack Pointer to the stack.
+ * @return The payload on top, or NULL if the stack is empty or NULL.
+ */
+  void *(*top)(TreiberStack *stack);
+
+  /**
+ * @brief Prints the features and content of the stack. Not thread safe.
+ */
+  void (*print)(TreiberStack *stack);
+};
+
+/**
+ * @brief Creates a new lock-free stack with every node preallocated.
+ *
+ * @param capacity Maximum number of elements (1..65534).
+ * @return A pointer to the new stack, or NULL on invalid capacity or lack of memory.
+ */
+TreiberStack *TREIBERSTACK_create(u16 capacity);
+
+#endif // __ADT_TREIBER_STACK_H__
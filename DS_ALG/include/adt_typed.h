@@ -0,0 +1,795 @@
+/**
+ * @file adt_typed.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-19
+ * @version 1.0
+ */
+
+#ifndef __ADT_TYPED_H__
+#define __ADT_TYPED_H__
+
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+#include "aligned_memory.h"
+
+// Type-specialized Vector, List and Queue generated by macros.
+//
+// The generic ADTs keep void* payloads in MemoryNodes and call everything
+// through ops_, so the compiler can't inline an access and every element is
+// a separate MM block. These store T by value, their functions are static
+// inline and named after the generic operations:
+//
+//   DEFINE_VECTOR(u32)   -> Vector_u32, VECTOR_u32_create, VECTOR_u32_insertLast...
+//   DEFINE_LIST(u32)     -> List_u32, LIST_u32_create, LIST_u32_insertLast...
+//   DEFINE_QUEUE(u32)    -> Queue_u32, QUEUE_u32_create, QUEUE_u32_enqueue...
+//
+// T has to be a single identifier (typedef pointers and multi-word types
+// first). DEFINE_QUEUE(T) is built on List_T, like Queue on List, so it
+// needs DEFINE_LIST(T) before it. Each macro goes once per type and
+// translation unit. Element accessors return a pointer into the container
+// (NULL if there is no such element) and extract copies the element to out.
+// Error codes are the ones of the generic ADTs.
+
+// The MM aligns its blocks to 4 bytes only, so the blocks that hold T by
+// value come from ALIGNED_malloc when T needs more (double, u64...)
+static inline void *TYPED_malloc(u32 bytes, u32 alignment)
+{
+  return alignment > 4 ? ALIGNED_malloc(bytes) : MM->malloc(bytes);
+}
+
+static inline void TYPED_free(void *ptr, u32 alignment)
+{
+  if (alignment > 4)
+  {
+    ALIGNED_free(ptr);
+  }
+  else
+  {
+    MM->free(ptr);
+  }
+}
+
+/*******************************************************************************
+ * Vector of T: elements [0, tail_) of storage_
+ ******************************************************************************/
+#define DEFINE_VECTOR(T)                                                       \
+typedef struct vector_##T##_s                                                  \
+{                                                                              \
+  T *storage_;                                                                 \
+  u16 tail_;                                                                   \
+  u16 capacity_;                                                               \
+} Vector_##T;                                                                  \
+                                                                               \
+static inline Vector_##T *VECTOR_##T##_create(u16 capacity)                    \
+{                                                                              \
+  if (0 == capacity)                                                           \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  Vector_##T *vector = MM->malloc(sizeof(Vector_##T));                         \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  vector->storage_ = TYPED_malloc(sizeof(T) * capacity, _Alignof(T));          \
+  if (NULL == vector->storage_)                                                \
+  {                                                                            \
+    MM->free(vector);                                                          \
+    return NULL;                                                               \
+  }                                                                            \
+  vector->tail_ = 0;                                                           \
+  vector->capacity_ = capacity;                                                \
+  return vector;                                                               \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_destroy(Vector_##T *vector)                     \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  TYPED_free(vector->storage_, _Alignof(T));                                   \
+  MM->free(vector);                                                            \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_reset(Vector_##T *vector)                       \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  vector->tail_ = 0;                                                           \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+/* Elements past the new capacity are lost */                                  \
+static inline s16 VECTOR_##T##_resize(Vector_##T *vector, u16 new_capacity)    \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  if (0 == new_capacity)                                                       \
+  {                                                                            \
+    return kErrorCode_SizeZero;                                                \
+  }                                                                            \
+  if (new_capacity == vector->capacity_)                                       \
+  {                                                                            \
+    return kErrorCode_Ok;                                                      \
+  }                                                                            \
+  T *storage = TYPED_malloc(sizeof(T) * new_capacity, _Alignof(T));            \
+  if (NULL == storage)                                                         \
+  {                                                                            \
+    return kErrorCode_Memory;                                                  \
+  }                                                                            \
+  if (vector->tail_ > new_capacity)                                            \
+  {                                                                            \
+    vector->tail_ = new_capacity;                                              \
+  }                                                                            \
+  memcpy(storage, vector->storage_, sizeof(T) * vector->tail_);                \
+  TYPED_free(vector->storage_, _Alignof(T));                                   \
+  vector->storage_ = storage;                                                  \
+  vector->capacity_ = new_capacity;                                            \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline u16 VECTOR_##T##_capacity(Vector_##T *vector)                    \
+{                                                                              \
+  return NULL == vector ? 0 : vector->capacity_;                               \
+}                                                                              \
+                                                                               \
+static inline u16 VECTOR_##T##_length(Vector_##T *vector)                      \
+{                                                                              \
+  return NULL == vector ? 0 : vector->tail_;                                   \
+}                                                                              \
+                                                                               \
+static inline boolean VECTOR_##T##_isEmpty(Vector_##T *vector)                 \
+{                                                                              \
+  return NULL == vector || 0 == vector->tail_ ? True : False;                  \
+}                                                                              \
+                                                                               \
+static inline boolean VECTOR_##T##_isFull(Vector_##T *vector)                  \
+{                                                                              \
+  return NULL != vector && vector->tail_ == vector->capacity_ ? True : False;  \
+}                                                                              \
+                                                                               \
+static inline T *VECTOR_##T##_at(Vector_##T *vector, u16 position)             \
+{                                                                              \
+  if (NULL == vector || position >= vector->tail_)                             \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  return &vector->storage_[position];                                          \
+}                                                                              \
+                                                                               \
+static inline T *VECTOR_##T##_first(Vector_##T *vector)                        \
+{                                                                              \
+  return VECTOR_##T##_at(vector, 0);                                           \
+}                                                                              \
+                                                                               \
+static inline T *VECTOR_##T##_last(Vector_##T *vector)                         \
+{                                                                              \
+  return NULL == vector ? NULL : VECTOR_##T##_at(vector, vector->tail_ - 1);   \
+}                                                                              \
+                                                                               \
+/* A position past the last element inserts at the end */                      \
+static inline s16 VECTOR_##T##_insertAt(Vector_##T *vector, T value,           \
+                                        u16 position)                          \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  if (vector->tail_ == vector->capacity_)                                      \
+  {                                                                            \
+    return kErrorCode_VectorFull;                                              \
+  }                                                                            \
+  if (position > vector->tail_)                                                \
+  {                                                                            \
+    position = vector->tail_;                                                  \
+  }                                                                            \
+  memmove(&vector->storage_[position + 1], &vector->storage_[position],        \
+          sizeof(T) * (vector->tail_ - position));                             \
+  vector->storage_[position] = value;                                          \
+  vector->tail_++;                                                             \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_insertFirst(Vector_##T *vector, T value)        \
+{                                                                              \
+  return VECTOR_##T##_insertAt(vector, value, 0);                              \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_insertLast(Vector_##T *vector, T value)         \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  if (vector->tail_ == vector->capacity_)                                      \
+  {                                                                            \
+    return kErrorCode_VectorFull;                                              \
+  }                                                                            \
+  vector->storage_[vector->tail_++] = value;                                   \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_extractAt(Vector_##T *vector, u16 position,     \
+                                         T *out)                               \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  if (0 == vector->tail_)                                                      \
+  {                                                                            \
+    return kErrorCode_VectorEmpty;                                             \
+  }                                                                            \
+  if (position >= vector->tail_)                                               \
+  {                                                                            \
+    return kErrorCode_PositionMismatch;                                        \
+  }                                                                            \
+  if (NULL != out)                                                             \
+  {                                                                            \
+    *out = vector->storage_[position];                                         \
+  }                                                                            \
+  vector->tail_--;                                                             \
+  memmove(&vector->storage_[position], &vector->storage_[position + 1],        \
+          sizeof(T) * (vector->tail_ - position));                             \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_extractFirst(Vector_##T *vector, T *out)        \
+{                                                                              \
+  return VECTOR_##T##_extractAt(vector, 0, out);                               \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_extractLast(Vector_##T *vector, T *out)         \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  if (0 == vector->tail_)                                                      \
+  {                                                                            \
+    return kErrorCode_VectorEmpty;                                             \
+  }                                                                            \
+  vector->tail_--;                                                             \
+  if (NULL != out)                                                             \
+  {                                                                            \
+    *out = vector->storage_[vector->tail_];                                    \
+  }                                                                            \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+/* Copies the elements of vector_src after the ones of vector, growing it */   \
+static inline s16 VECTOR_##T##_concat(Vector_##T *vector,                      \
+                                      Vector_##T *vector_src)                  \
+{                                                                              \
+  if (NULL == vector || NULL == vector_src)                                    \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  u32 length = (u32)vector->tail_ + vector_src->tail_;                         \
+  if (length > 0xFFFF)                                                         \
+  {                                                                            \
+    return kErrorCode_NotEnoughCapacity;                                       \
+  }                                                                            \
+  if (length > vector->capacity_)                                              \
+  {                                                                            \
+    s16 error = VECTOR_##T##_resize(vector, (u16)length);                      \
+    if (kErrorCode_Ok != error)                                                \
+    {                                                                          \
+      return error;                                                            \
+    }                                                                          \
+  }                                                                            \
+  memmove(&vector->storage_[vector->tail_], vector_src->storage_,              \
+          sizeof(T) * vector_src->tail_);                                      \
+  vector->tail_ = (u16)length;                                                 \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 VECTOR_##T##_traverse(Vector_##T *vector,                    \
+                                        void (*callback)(T *))                 \
+{                                                                              \
+  if (NULL == vector)                                                          \
+  {                                                                            \
+    return kErrorCode_VectorNull;                                              \
+  }                                                                            \
+  if (NULL == callback)                                                        \
+  {                                                                            \
+    return kErrorCode_Null;                                                    \
+  }                                                                            \
+  for (u16 i = 0; i < vector->tail_; ++i)                                      \
+  {                                                                            \
+    callback(&vector->storage_[i]);                                            \
+  }                                                                            \
+  return kErrorCode_Ok;                                                        \
+}
+
+/*******************************************************************************
+ * List of T: singly linked nodes holding T, one MM block per node
+ ******************************************************************************/
+#define DEFINE_LIST(T)                                                         \
+typedef struct list_node_##T##_s                                               \
+{                                                                              \
+  T data_;                                                                     \
+  struct list_node_##T##_s *next_;                                             \
+} ListNode_##T;                                                                \
+                                                                               \
+typedef struct list_##T##_s                                                    \
+{                                                                              \
+  ListNode_##T *head_;                                                         \
+  ListNode_##T *tail_;                                                         \
+  u16 length_;                                                                 \
+  u16 capacity_;                                                               \
+} List_##T;                                                                    \
+                                                                               \
+static inline List_##T *LIST_##T##_create(u16 capacity)                        \
+{                                                                              \
+  if (0 == capacity)                                                           \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  List_##T *list = MM->malloc(sizeof(List_##T));                               \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  list->head_ = NULL;                                                          \
+  list->tail_ = NULL;                                                          \
+  list->length_ = 0;                                                           \
+  list->capacity_ = capacity;                                                  \
+  return list;                                                                 \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_reset(List_##T *list)                             \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  ListNode_##T *node = list->head_;                                            \
+  while (NULL != node)                                                         \
+  {                                                                            \
+    ListNode_##T *next = node->next_;                                          \
+    TYPED_free(node, _Alignof(T));                                             \
+    node = next;                                                               \
+  }                                                                            \
+  list->head_ = NULL;                                                          \
+  list->tail_ = NULL;                                                          \
+  list->length_ = 0;                                                           \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_destroy(List_##T *list)                           \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  LIST_##T##_reset(list);                                                      \
+  MM->free(list);                                                              \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline u16 LIST_##T##_capacity(List_##T *list)                          \
+{                                                                              \
+  return NULL == list ? 0 : list->capacity_;                                   \
+}                                                                              \
+                                                                               \
+static inline u16 LIST_##T##_length(List_##T *list)                            \
+{                                                                              \
+  return NULL == list ? 0 : list->length_;                                     \
+}                                                                              \
+                                                                               \
+static inline boolean LIST_##T##_isEmpty(List_##T *list)                       \
+{                                                                              \
+  return NULL == list || 0 == list->length_ ? True : False;                    \
+}                                                                              \
+                                                                               \
+static inline boolean LIST_##T##_isFull(List_##T *list)                        \
+{                                                                              \
+  return NULL != list && list->length_ == list->capacity_ ? True : False;      \
+}                                                                              \
+                                                                               \
+static inline T *LIST_##T##_first(List_##T *list)                              \
+{                                                                              \
+  return NULL == list || NULL == list->head_ ? NULL : &list->head_->data_;     \
+}                                                                              \
+                                                                               \
+static inline T *LIST_##T##_last(List_##T *list)                               \
+{                                                                              \
+  return NULL == list || NULL == list->tail_ ? NULL : &list->tail_->data_;     \
+}                                                                              \
+                                                                               \
+static inline T *LIST_##T##_at(List_##T *list, u16 index)                      \
+{                                                                              \
+  if (NULL == list || index >= list->length_)                                  \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  ListNode_##T *node = list->head_;                                            \
+  for (u16 i = 0; i < index; ++i)                                              \
+  {                                                                            \
+    node = node->next_;                                                        \
+  }                                                                            \
+  return &node->data_;                                                         \
+}                                                                              \
+                                                                               \
+/* Elements past the new capacity are lost */                                  \
+static inline s16 LIST_##T##_resize(List_##T *list, u16 new_capacity)          \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (0 == new_capacity)                                                       \
+  {                                                                            \
+    return kErrorCode_SizeZero;                                                \
+  }                                                                            \
+  if (new_capacity < list->length_)                                            \
+  {                                                                            \
+    ListNode_##T *node = list->head_;                                          \
+    for (u16 i = 1; i < new_capacity; ++i)                                     \
+    {                                                                          \
+      node = node->next_;                                                      \
+    }                                                                          \
+    ListNode_##T *lost = node->next_;                                          \
+    node->next_ = NULL;                                                        \
+    list->tail_ = node;                                                        \
+    list->length_ = new_capacity;                                              \
+    while (NULL != lost)                                                       \
+    {                                                                          \
+      ListNode_##T *next = lost->next_;                                        \
+      TYPED_free(lost, _Alignof(T));                                           \
+      lost = next;                                                             \
+    }                                                                          \
+  }                                                                            \
+  list->capacity_ = new_capacity;                                              \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_insertFirst(List_##T *list, T value)              \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (list->length_ == list->capacity_)                                        \
+  {                                                                            \
+    return kErrorCode_NotEnoughCapacity;                                       \
+  }                                                                            \
+  ListNode_##T *node = TYPED_malloc(sizeof(ListNode_##T), _Alignof(T));        \
+  if (NULL == node)                                                            \
+  {                                                                            \
+    return kErrorCode_Memory;                                                  \
+  }                                                                            \
+  node->data_ = value;                                                         \
+  node->next_ = list->head_;                                                   \
+  list->head_ = node;                                                          \
+  if (NULL == list->tail_)                                                     \
+  {                                                                            \
+    list->tail_ = node;                                                        \
+  }                                                                            \
+  list->length_++;                                                             \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_insertLast(List_##T *list, T value)               \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (list->length_ == list->capacity_)                                        \
+  {                                                                            \
+    return kErrorCode_NotEnoughCapacity;                                       \
+  }                                                                            \
+  ListNode_##T *node = TYPED_malloc(sizeof(ListNode_##T), _Alignof(T));        \
+  if (NULL == node)                                                            \
+  {                                                                            \
+    return kErrorCode_Memory;                                                  \
+  }                                                                            \
+  node->data_ = value;                                                         \
+  node->next_ = NULL;                                                          \
+  if (NULL == list->tail_)                                                     \
+  {                                                                            \
+    list->head_ = node;                                                        \
+  }                                                                            \
+  else                                                                         \
+  {                                                                            \
+    list->tail_->next_ = node;                                                 \
+  }                                                                            \
+  list->tail_ = node;                                                          \
+  list->length_++;                                                             \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+/* An index past the last element inserts at the end */                        \
+static inline s16 LIST_##T##_insertAt(List_##T *list, T value, u16 index)      \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (0 == index)                                                              \
+  {                                                                            \
+    return LIST_##T##_insertFirst(list, value);                                \
+  }                                                                            \
+  if (index >= list->length_)                                                  \
+  {                                                                            \
+    return LIST_##T##_insertLast(list, value);                                 \
+  }                                                                            \
+  if (list->length_ == list->capacity_)                                        \
+  {                                                                            \
+    return kErrorCode_NotEnoughCapacity;                                       \
+  }                                                                            \
+  ListNode_##T *node = TYPED_malloc(sizeof(ListNode_##T), _Alignof(T));        \
+  if (NULL == node)                                                            \
+  {                                                                            \
+    return kErrorCode_Memory;                                                  \
+  }                                                                            \
+  ListNode_##T *prev = list->head_;                                            \
+  for (u16 i = 1; i < index; ++i)                                              \
+  {                                                                            \
+    prev = prev->next_;                                                        \
+  }                                                                            \
+  node->data_ = value;                                                         \
+  node->next_ = prev->next_;                                                   \
+  prev->next_ = node;                                                          \
+  list->length_++;                                                             \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_extractFirst(List_##T *list, T *out)              \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  ListNode_##T *node = list->head_;                                            \
+  if (NULL == node)                                                            \
+  {                                                                            \
+    return kErrorCode_ListEmpty;                                               \
+  }                                                                            \
+  if (NULL != out)                                                             \
+  {                                                                            \
+    *out = node->data_;                                                        \
+  }                                                                            \
+  list->head_ = node->next_;                                                   \
+  if (NULL == list->head_)                                                     \
+  {                                                                            \
+    list->tail_ = NULL;                                                        \
+  }                                                                            \
+  list->length_--;                                                             \
+  TYPED_free(node, _Alignof(T));                                               \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_extractAt(List_##T *list, u16 index, T *out)      \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (0 == list->length_)                                                      \
+  {                                                                            \
+    return kErrorCode_ListEmpty;                                               \
+  }                                                                            \
+  if (index >= list->length_)                                                  \
+  {                                                                            \
+    return kErrorCode_InvalidIndex;                                            \
+  }                                                                            \
+  if (0 == index)                                                              \
+  {                                                                            \
+    return LIST_##T##_extractFirst(list, out);                                 \
+  }                                                                            \
+  ListNode_##T *prev = list->head_;                                            \
+  for (u16 i = 1; i < index; ++i)                                              \
+  {                                                                            \
+    prev = prev->next_;                                                        \
+  }                                                                            \
+  ListNode_##T *node = prev->next_;                                            \
+  if (NULL != out)                                                             \
+  {                                                                            \
+    *out = node->data_;                                                        \
+  }                                                                            \
+  prev->next_ = node->next_;                                                   \
+  if (node == list->tail_)                                                     \
+  {                                                                            \
+    list->tail_ = prev;                                                        \
+  }                                                                            \
+  list->length_--;                                                             \
+  TYPED_free(node, _Alignof(T));                                               \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_extractLast(List_##T *list, T *out)               \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (0 == list->length_)                                                      \
+  {                                                                            \
+    return kErrorCode_ListEmpty;                                               \
+  }                                                                            \
+  return LIST_##T##_extractAt(list, list->length_ - 1, out);                   \
+}                                                                              \
+                                                                               \
+/* Copies the elements of list_src after the ones of list, growing it */       \
+static inline s16 LIST_##T##_concat(List_##T *list, List_##T *list_src)        \
+{                                                                              \
+  if (NULL == list || NULL == list_src)                                        \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  u32 length = (u32)list->length_ + list_src->length_;                         \
+  if (length > 0xFFFF)                                                         \
+  {                                                                            \
+    return kErrorCode_NotEnoughCapacity;                                       \
+  }                                                                            \
+  if (length > list->capacity_)                                                \
+  {                                                                            \
+    list->capacity_ = (u16)length;                                             \
+  }                                                                            \
+  u16 count = list_src->length_;                                               \
+  ListNode_##T *node = list_src->head_;                                        \
+  for (u16 i = 0; i < count; ++i, node = node->next_)                          \
+  {                                                                            \
+    s16 error = LIST_##T##_insertLast(list, node->data_);                      \
+    if (kErrorCode_Ok != error)                                                \
+    {                                                                          \
+      return error;                                                            \
+    }                                                                          \
+  }                                                                            \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 LIST_##T##_traverse(List_##T *list, void (*callback)(T *))   \
+{                                                                              \
+  if (NULL == list)                                                            \
+  {                                                                            \
+    return kErrorCode_ListNull;                                                \
+  }                                                                            \
+  if (NULL == callback)                                                        \
+  {                                                                            \
+    return kErrorCode_Null;                                                    \
+  }                                                                            \
+  for (ListNode_##T *node = list->head_; NULL != node; node = node->next_)     \
+  {                                                                            \
+    callback(&node->data_);                                                    \
+  }                                                                            \
+  return kErrorCode_Ok;                                                        \
+}
+
+/*******************************************************************************
+ * Queue of T: FIFO on top of List_T, needs DEFINE_LIST(T) first
+ ******************************************************************************/
+#define DEFINE_QUEUE(T)                                                        \
+typedef struct queue_##T##_s                                                   \
+{                                                                              \
+  List_##T *storage_;                                                          \
+} Queue_##T;                                                                   \
+                                                                               \
+static inline Queue_##T *QUEUE_##T##_create(u16 capacity)                      \
+{                                                                              \
+  if (0 == capacity)                                                           \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  Queue_##T *queue = MM->malloc(sizeof(Queue_##T));                            \
+  if (NULL == queue)                                                           \
+  {                                                                            \
+    return NULL;                                                               \
+  }                                                                            \
+  queue->storage_ = LIST_##T##_create(capacity);                               \
+  if (NULL == queue->storage_)                                                 \
+  {                                                                            \
+    MM->free(queue);                                                           \
+    return NULL;                                                               \
+  }                                                                            \
+  return queue;                                                                \
+}                                                                              \
+                                                                               \
+static inline s16 QUEUE_##T##_destroy(Queue_##T *queue)                        \
+{                                                                              \
+  if (NULL == queue)                                                           \
+  {                                                                            \
+    return kErrorCode_QueueNull;                                               \
+  }                                                                            \
+  LIST_##T##_destroy(queue->storage_);                                         \
+  MM->free(queue);                                                             \
+  return kErrorCode_Ok;                                                        \
+}                                                                              \
+                                                                               \
+static inline s16 QUEUE_##T##_reset(Queue_##T *queue)                          \
+{                                                                              \
+  if (NULL == queue)                                                           \
+  {                                                                            \
+    return kErrorCode_QueueNull;                                               \
+  }                                                                            \
+  return LIST_##T##_reset(queue->storage_);                                    \
+}                                                                              \
+                                                                               \
+static inline s16 QUEUE_##T##_resize(Queue_##T *queue, u16 new_capacity)       \
+{                                                                              \
+  if (NULL == queue)                                                           \
+  {                                                                            \
+    return kErrorCode_QueueNull;                                               \
+  }                                                                            \
+  return LIST_##T##_resize(queue->storage_, new_capacity);                     \
+}                                                                              \
+                                                                               \
+static inline u16 QUEUE_##T##_capacity(Queue_##T *queue)                       \
+{                                                                              \
+  return NULL == queue ? 0 : LIST_##T##_capacity(queue->storage_);             \
+}                                                                              \
+                                                                               \
+static inline u16 QUEUE_##T##_length(Queue_##T *queue)                         \
+{                                                                              \
+  return NULL == queue ? 0 : LIST_##T##_length(queue->storage_);               \
+}                                                                              \
+                                                                               \
+static inline boolean QUEUE_##T##_isEmpty(Queue_##T *queue)                    \
+{                                                                              \
+  return NULL == queue ? True : LIST_##T##_isEmpty(queue->storage_);           \
+}                                                                              \
+                                                                               \
+static inline boolean QUEUE_##T##_isFull(Queue_##T *queue)                     \
+{                                                                              \
+  return NULL == queue ? False : LIST_##T##_isFull(queue->storage_);           \
+}                                                                              \
+                                                                               \
+static inline s16 QUEUE_##T##_enqueue(Queue_##T *queue, T value)               \
+{                                                                              \
+  if (NULL == queue)                                                           \
+  {                                                                            \
+    return kErrorCode_QueueNull;                                               \
+  }                                                                            \
+  if (True == LIST_##T##_isFull(queue->storage_))                              \
+  {                                                                            \
+    return kErrorCode_QueueFull;                                               \
+  }                                                                            \
+  return LIST_##T##_insertLast(queue->storage_, value);                        \
+}                                                                              \
+                                                                               \
+static inline s16 QUEUE_##T##_dequeue(Queue_##T *queue, T *out)                \
+{                                                                              \
+  if (NULL == queue)                                                           \
+  {                                                                            \
+    return kErrorCode_QueueNull;                                               \
+  }                                                                            \
+  if (True == LIST_##T##_isEmpty(queue->storage_))                             \
+  {                                                                            \
+    return kErrorCode_QueueEmpty;                                              \
+  }                                                                            \
+  return LIST_##T##_extractFirst(queue->storage_, out);                        \
+}                                                                              \
+                                                                               \
+static inline T *QUEUE_##T##_front(Queue_##T *queue)                           \
+{                                                                              \
+  return NULL == queue ? NULL : LIST_##T##_first(queue->storage_);             \
+}                                                                              \
+                                                                               \
+static inline T *QUEUE_##T##_back(Queue_##T *queue)                            \
+{                                                                              \
+  return NULL == queue ? NULL : LIST_##T##_last(queue->storage_);              \
+}                                                                              \
+                                                                               \
+static inline s16 QUEUE_##T##_concat(Queue_##T *queue, Queue_##T *queue_src)   \
+{                                                                              \
+  if (NULL == queue || NULL == queue_src)                                      \
+  {                                                                            \
+    return kErrorCode_QueueNull;                                               \
+  }                                                                            \
+  return LIST_##T##_concat(queue->storage_, queue_src->storage_);              \
+}
+
+#endif // __ADT_TYPED_H__
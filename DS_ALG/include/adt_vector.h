@@ -10,6 +10,9 @@
 #define __ADT_VECTOR_H__
 
 #include "adt_memory_node.h"
+#include "adt_cursor.h"
+#include "adt_arena.h"
+#include "adt_memory_stack.h"
 
 typedef struct adt_vector_s {
 	u16 head_;
@@ -324,6 +327,32 @@ struct vector_ops_s {
  * @return An appropriate error code if an error occurs, or kErrorCode_Ok if the traversal is successful.
  */
 	s16 (*traverse)(Vector *vector, void (*callback)(MemoryNode *)); // Calls to a function from all elements of the vector
+
+  /**
+ * @brief Traverses the elements of a vector until the callback asks to stop.
+ *
+ * Like traverse, but the callback also receives the context pointer and
+ * returns True to go on with the next element or False to stop the walk.
+ *
+ * @param vector Pointer to the vector to be traversed.
+ * @param callback Function applied to each element, False stops the traversal.
+ * @param context Pointer passed untouched to every call of callback.
+ * @return kErrorCode_Ok (also when stopped early), kErrorCode_VectorNull, kErrorCode_StorageNull
+ *         or kErrorCode_Null if callback is NULL.
+ */
+	s16 (*traverseEx)(Vector *vector, boolean (*callback)(MemoryNode *, void *), void *context);
+
+  /**
+ * @brief Sets a cursor on the first element of a vector.
+ *
+ * The cursor walks from the head to the last element with CURSOR_next. It is
+ * left invalid if the vector is empty.
+ *
+ * @param vector Pointer to the vector to walk.
+ * @param cursor Cursor to set.
+ * @return kErrorCode_Ok, kErrorCode_VectorNull, kErrorCode_StorageNull or kErrorCode_Null if cursor is NULL.
+ */
+	s16 (*begin)(Vector *vector, Cursor *cursor);
 	
   /**
  * @brief Prints information about the vector, including its properties and the content of each element.
@@ -351,4 +380,50 @@ struct vector_ops_s {
  */
 
 Vector* VECTOR_create(u16 capacity); // Creates a new vector
+
+/**
+ * @brief Creates a new vector of shared payloads.
+ *
+ * Its nodes use memory_node_shared_ops: the payloads inserted come from
+ * MEMNODE_sharedAlloc or MEMNODE_retain and the vector owns one reference
+ * to each. concat takes a new reference to each payload of the source,
+ * without copying it, or a shared copy if the source payload isn't shared.
+ * reset, destroy and resize drop the references, and the extractions hand
+ * them over to the caller, who gives them back with MEMNODE_release.
+ *
+ * @param capacity The capacity of the vector.
+ * @return A pointer to the new vector, or NULL if the capacity is 0 or
+ *         there is not enough memory.
+ */
+Vector* VECTOR_createShared(u16 capacity);
+
+/**
+ * @brief Creates a new vector whose memory comes from an arena.
+ *
+ * The vector, its storage and the payload copies made by concat are
+ * bump-allocated from the arena; payloads inserted should come from the same
+ * arena. destroy and reset don't free anything: the memory goes back with
+ * the next reset of the arena, after which the vector must not be used.
+ *
+ * @param capacity The capacity of the vector.
+ * @param arena Arena the vector allocates from.
+ * @return A pointer to the new vector, or NULL if the capacity is 0, the
+ *         arena is NULL or it has no memory left.
+ */
+Vector* VECTOR_createInArena(u16 capacity, Arena *arena);
+
+/**
+ * @brief Creates a temporary vector whose memory comes from one side of a memory stack.
+ *
+ * Same rules as VECTOR_createInArena: destroy and reset don't free anything
+ * and the vector dies with the next freeToMarker below it (or reset) on that
+ * side. resize and concat allocate on the same side.
+ *
+ * @param capacity The capacity of the vector.
+ * @param stack Memory stack the vector allocates from.
+ * @param side Side of the memory stack.
+ * @return A pointer to the new vector, or NULL if the capacity is 0, the
+ *         stack is NULL or it has no memory left.
+ */
+Vector* VECTOR_createInMemoryStack(u16 capacity, MemoryStack *stack, MemoryStackSide side);
 #endif //__ADT_VECTOR_H__
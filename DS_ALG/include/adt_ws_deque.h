@@ -0,0 +1,116 @@
+/**
+ * @file adt_ws_deque.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-13
+ * @version 1.0
+ */
+
+#ifndef __ADT_WS_DEQUE_H__
+#define __ADT_WS_DEQUE_H__
+
+#include <stdatomic.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// Largest ring a deque can grow to: its slots must fit in one MM block
+#define kWSDequeMaxCapacity 4096
+
+// Circular array of the deque. When it fills up the owner copies it into
+// one twice as big; the old one is kept (previous_) until the deque is
+// destroyed because a thief may still be reading from it.
+typedef struct ws_deque_array_s
+{
+  u32 capacity_;            // always a power of two
+  u32 mask_;                // capacity_ - 1
+  struct ws_deque_array_s *previous_;
+  _Atomic(void *) *slots_;
+} WSDequeArray;
+
+// Work-stealing deque (Chase-Lev). The owner thread pushes and pops at the
+// bottom like a stack; any other thread steals from the top like a queue.
+// Only the last element is contended: owner and thieves race for it with
+// a CAS on top_. Elements are task pointers owned by the caller.
+typedef struct ws_deque_s
+{
+  _Atomic s64 top_;         // next element to steal
+  u8 pad_top_[CACHE_LINE_SIZE - sizeof(_Atomic s64)];
+  _Atomic s64 bottom_;      // next free slot of the owner
+  u8 pad_bottom_[CACHE_LINE_SIZE - sizeof(_Atomic s64)];
+  _Atomic(WSDequeArray *) array_;
+  struct ws_deque_ops_s *ops_;
+} WSDeque;
+
+struct ws_deque_ops_s
+{
+  /**
+ * @brief Destroys the deque and every array it used. Pending tasks are not freed.
+ *
+ * Must only be called once no thread uses the deque.
+ *
+ * @param deque Pointer to the deque.
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL.
+ */
+  s16 (*destroy)(WSDeque *deque);
+
+  /**
+ * @brief Returns the number of slots of the current array, or 0 if NULL.
+ */
+  u16 (*capacity)(WSDeque *deque);
+
+  /**
+ * @brief Returns a snapshot of the number of pending tasks, or 0 if NULL.
+ */
+  u16 (*length)(WSDeque *deque);
+
+  /**
+ * @brief Checks if the deque has no pending tasks (True if NULL).
+ */
+  boolean (*isEmpty)(WSDeque *deque);
+
+  /**
+ * @brief Adds a task at the bottom. Owner thread only.
+ *
+ * The array doubles when full, up to kWSDequeMaxCapacity slots.
+ *
+ * @param deque Pointer to the deque.
+ * @param task Pointer to the task (must not be NULL).
+ * @return kErrorCode_Ok on success, kErrorCode_DequeNull if the deque is NULL,
+ *         kErrorCode_SrcNull if task is NULL, kErrorCode_DequeFull if the deque
+ *         cannot grow any more, kErrorCode_Memory if the new array cannot be allocated.
+ */
+  s16 (*push)(WSDeque *deque, void *task);
+
+  /**
+ * @brief Removes the task at the bottom (the newest one). Owner thread only.
+ *
+ * @param deque Pointer to the deque.
+ * @return The task, or NULL if the deque is empty (or a thief took the last one).
+ */
+  void *(*pop)(WSDeque *deque);
+
+  /**
+ * @brief Removes the task at the top (the oldest one). Any thread.
+ *
+ * @param deque Pointer to the deque.
+ * @return The task, or NULL if the deque is empty or another thread won the race.
+ */
+  void *(*steal)(WSDeque *deque);
+
+  /**
+ * @brief Prints the features and pending tasks of the deque. Not thread safe.
+ */
+  void (*print)(WSDeque *deque);
+};
+
+/**
+ * @brief Creates a new work-stealing deque.
+ *
+ * @param capacity Initial number of slots, rounded up to a power of two
+ *                 (1..kWSDequeMaxCapacity).
+ * @return A pointer to the new deque, or NULL on invalid capacity or lack of memory.
+ */
+WSDeque *WSDEQUE_create(u16 capacity);
+
+#endif // __ADT_WS_DEQUE_H__
@@ -0,0 +1,41 @@
+// aligned_memory.h
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Cache line aligned blocks on top of the EDK memory manager, which only
+// guarantees 4 byte alignment. Needed by the concurrent ADTs: 8 byte atomics
+// must never straddle two cache lines and padded indices must start a line.
+
+#ifndef __ALIGNED_MEMORY_H__
+#define __ALIGNED_MEMORY_H__
+
+#include <stdint.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// The block returned by MM is stored just before the aligned address
+static inline void *ALIGNED_malloc(u32 bytes)
+{
+  u8 *raw = MM->malloc(bytes + CACHE_LINE_SIZE + sizeof(void *));
+  if (NULL == raw)
+  {
+    return NULL;
+  }
+  uintptr_t aligned = ((uintptr_t)raw + sizeof(void *) + CACHE_LINE_SIZE - 1) &
+                      ~(uintptr_t)(CACHE_LINE_SIZE - 1);
+  ((void **)aligned)[-1] = raw;
+  return (void *)aligned;
+}
+
+static inline void ALIGNED_free(void *ptr)
+{
+  if (NULL != ptr)
+  {
+    MM->free(((void **)ptr)[-1]);
+  }
+}
+
+#endif // __ALIGNED_MEMORY_H__
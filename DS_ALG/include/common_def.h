@@ -8,6 +8,10 @@
 
 #define VERBOSE_
 
+// Size used to pad shared indices of the concurrent ADTs so that
+// producer and consumer counters never share a cache line.
+#define CACHE_LINE_SIZE 64
+
 typedef enum
 {
   kErrorCode_Ok = 0,
@@ -31,7 +35,37 @@ typedef enum
   kErrorCode_InvalidIndex = -32,
   kErrorCode_ListEmpty = -33,
   kErrorCode_StackNull = -50,
+  kErrorCode_StackFull = -51,
   kErrorCode_QueueNull = -60,
+  kErrorCode_QueueFull = -61,
+  kErrorCode_QueueEmpty = -62,
+  kErrorCode_DequeNull = -70,
+  kErrorCode_DequeFull = -71,
+  kErrorCode_EpochNull = -80,
+  kErrorCode_EpochPinned = -81,
+  kErrorCode_EpochNotPinned = -82,
+  kErrorCode_ArenaNull = -90,
+  kErrorCode_MemoryStackNull = -100,
+  kErrorCode_MemoryStackMarker = -101,
+  kErrorCode_MemoryStackGuard = -102,
+  kErrorCode_File = -110,
+  kErrorCode_FileFormat = -111,
+  kErrorCode_ReadOnly = -112,
+  kErrorCode_StreamNull = -120,
+  kErrorCode_StreamEnd = -121,
+  kErrorCode_StreamSlice = -122,
+  kErrorCode_Logger = -130,
+  kErrorCode_LogFull = -131,
+  kErrorCode_PoolNull = -140,
+  kErrorCode_BPTreeNull = -150,
+  kErrorCode_KeyNotFound = -151,
+  kErrorCode_KeyExists = -152,
+  kErrorCode_KeyOrder = -153,
+  kErrorCode_SkipListNull = -160,
+  kErrorCode_AVLTreeNull = -170,
+  kErrorCode_LRUCacheNull = -180,
+  kErrorCode_BloomNull = -190,
+  kErrorCode_BloomShape = -191,
 }ErrorCode;
 
 #endif // __COMMON_DEF_H__
\ No newline at end of file
@@ -0,0 +1,216 @@
+// file_map.h
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Read-only mapping of a whole file and page allocations straight from the
+// OS, for the data that doesn't fit in the 64KB blocks of the EDK memory
+// manager. POSIX mmap, or the Win32 file mapping API on Windows.
+
+#ifndef __FILE_MAP_H__
+#define __FILE_MAP_H__
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+// MAP_ANONYMOUS and madvise are hidden by strict C11. The define only takes
+// effect before the first system header of the translation unit, so the
+// Linux build defines it for every file, and the calls below fall back to
+// plain POSIX when they are still hidden
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// address_ is page aligned, and NULL for an empty file
+typedef struct file_map_s {
+  u8 *address_;
+  u64 bytes_;
+#ifdef _WIN32
+  HANDLE file_;
+  HANDLE mapping_;
+#endif
+} FileMap;
+
+/**
+ * @brief Maps a whole file for reading.
+ *
+ * Writing through the mapping crashes. The file can be closed, but not
+ * truncated, while it is mapped.
+ *
+ * @return kErrorCode_Ok, kErrorCode_Null if map or path are NULL, or
+ *         kErrorCode_File if the file can't be opened or mapped.
+ */
+static inline s16 FILEMAP_open(FileMap *map, const char *path)
+{
+  if (NULL == map || NULL == path)
+  {
+    return kErrorCode_Null;
+  }
+  map->address_ = NULL;
+  map->bytes_ = 0;
+#ifdef _WIN32
+  map->mapping_ = NULL;
+  map->file_ = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, NULL);
+  if (INVALID_HANDLE_VALUE == map->file_)
+  {
+    return kErrorCode_File;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(map->file_, &size))
+  {
+    CloseHandle(map->file_);
+    return kErrorCode_File;
+  }
+  map->bytes_ = (u64)size.QuadPart;
+  if (0 == map->bytes_)
+  {
+    return kErrorCode_Ok;
+  }
+  map->mapping_ = CreateFileMappingA(map->file_, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (NULL == map->mapping_)
+  {
+    CloseHandle(map->file_);
+    return kErrorCode_File;
+  }
+  map->address_ = MapViewOfFile(map->mapping_, FILE_MAP_READ, 0, 0, 0);
+  if (NULL == map->address_)
+  {
+    CloseHandle(map->mapping_);
+    CloseHandle(map->file_);
+    return kErrorCode_File;
+  }
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return kErrorCode_File;
+  }
+  struct stat info;
+  if (0 != fstat(fd, &info))
+  {
+    close(fd);
+    return kErrorCode_File;
+  }
+  map->bytes_ = (u64)info.st_size;
+  if (0 != map->bytes_)
+  {
+    void *address = mmap(NULL, (size_t)map->bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+    map->address_ = MAP_FAILED == address ? NULL : address;
+  }
+  // the mapping keeps the file alive
+  close(fd);
+  if (0 != map->bytes_ && NULL == map->address_)
+  {
+    return kErrorCode_File;
+  }
+#endif
+  return kErrorCode_Ok;
+}
+
+/**
+ * @brief Unmaps a file mapped by FILEMAP_open.
+ */
+static inline void FILEMAP_close(FileMap *map)
+{
+  if (NULL == map)
+  {
+    return;
+  }
+#ifdef _WIN32
+  if (NULL != map->address_)
+  {
+    UnmapViewOfFile(map->address_);
+  }
+  if (NULL != map->mapping_)
+  {
+    CloseHandle(map->mapping_);
+  }
+  CloseHandle(map->file_);
+  map->mapping_ = NULL;
+  map->file_ = INVALID_HANDLE_VALUE;
+#else
+  if (NULL != map->address_)
+  {
+    munmap(map->address_, (size_t)map->bytes_);
+  }
+#endif
+  map->address_ = NULL;
+  map->bytes_ = 0;
+}
+
+/**
+ * @brief Lets the OS drop the pages of a range of the mapping from memory.
+ *
+ * They are read again from the file if touched. offset must be a multiple
+ * of the page size. Nothing is done on Windows.
+ */
+static inline void FILEMAP_drop(FileMap *map, u64 offset, u64 bytes)
+{
+  if (NULL == map || NULL == map->address_ || offset >= map->bytes_)
+  {
+    return;
+  }
+#ifndef _WIN32
+  if (bytes > map->bytes_ - offset)
+  {
+    bytes = map->bytes_ - offset;
+  }
+#ifdef MADV_DONTNEED
+  madvise(map->address_ + offset, (size_t)bytes, MADV_DONTNEED);
+#endif
+#endif
+}
+
+/**
+ * @brief Allocates zeroed, page aligned memory from the OS, NULL on failure.
+ */
+static inline void *FILEMAP_pagesAlloc(u64 bytes)
+{
+#ifdef _WIN32
+  return VirtualAlloc(NULL, (SIZE_T)bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+#if defined(MAP_ANONYMOUS)
+  void *pages = mmap(NULL, (size_t)bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#elif defined(MAP_ANON)
+  void *pages = mmap(NULL, (size_t)bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+#else
+  // a private mapping of /dev/zero gives the same zeroed pages
+  int zero = open("/dev/zero", O_RDWR);
+  if (zero < 0)
+  {
+    return NULL;
+  }
+  void *pages = mmap(NULL, (size_t)bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, zero, 0);
+  close(zero);
+#endif
+  return MAP_FAILED == pages ? NULL : pages;
+#endif
+}
+
+/**
+ * @brief Gives back memory of FILEMAP_pagesAlloc, bytes being the allocated size.
+ */
+static inline void FILEMAP_pagesFree(void *pages, u64 bytes)
+{
+  if (NULL == pages)
+  {
+    return;
+  }
+#ifdef _WIN32
+  (void)bytes;
+  VirtualFree(pages, 0, MEM_RELEASE);
+#else
+  munmap(pages, (size_t)bytes);
+#endif
+}
+
+#endif // __FILE_MAP_H__
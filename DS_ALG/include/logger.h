@@ -0,0 +1,183 @@
+/**
+ * @file logger.h
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-05
+ * @version 1.0
+ */
+
+#ifndef __LOGGER_H__
+#define __LOGGER_H__
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+#include "common_def.h"
+
+// Asynchronous logger. A log call doesn't format nor write anything: it
+// copies the format and its arguments, encoded as u64, to a ring of the
+// calling thread (lock free, single producer). A flusher thread drains the
+// rings, formats the records and writes them in batches. A full ring drops
+// the record instead of waiting. While the logger isn't running the calls
+// format and print synchronously on stdout.
+//
+// The format must be a string literal, and so must be the %s arguments, or
+// outlive the flush: only their address is copied. Pointers of other types
+// are passed as void*. Width and precision must be literals, not '*'.
+
+#define kLogLevel_Debug 0
+#define kLogLevel_Info 1
+#define kLogLevel_Warning 2
+#define kLogLevel_Error 3
+#define kLogLevel_None 4
+
+// Calls below LOG_LEVEL are removed at compile time. Defined before including
+// this header, or by the build, the default follows VERBOSE_.
+#ifndef LOG_LEVEL
+#ifdef VERBOSE_
+#define LOG_LEVEL kLogLevel_Debug
+#else
+#define LOG_LEVEL kLogLevel_None
+#endif
+#endif
+
+#define kLogMaxArguments 6
+// records per thread, power of two
+#define kLogRingRecords 4096
+
+// One cache line per record
+typedef struct log_record_s
+{
+  const char *format_;
+  u16 level_;
+  u16 count_;
+  u32 pad_;
+  u64 args_[kLogMaxArguments];
+} LogRecord;
+
+/**
+ * @brief Starts the flusher thread, writing to output.
+ *
+ * @param output File the records are written to, stdout or stderr included.
+ * @return kErrorCode_Ok, kErrorCode_Null if output is NULL or kErrorCode_Logger
+ *         if the logger is already running or its thread can't start.
+ */
+s16 LOGGER_start(FILE *output);
+
+/**
+ * @brief Writes every pending record and stops the flusher thread.
+ *
+ * Must only be called once no other thread logs anymore. The rings of the
+ * threads are freed.
+ *
+ * @return kErrorCode_Ok or kErrorCode_Logger if the logger isn't running.
+ */
+s16 LOGGER_stop();
+
+/**
+ * @brief Waits until every record logged before the call is written and flushed.
+ *
+ * @return kErrorCode_Ok or kErrorCode_Logger if the logger isn't running.
+ */
+s16 LOGGER_flush();
+
+/**
+ * @brief Returns the records dropped because a ring was full since the start.
+ */
+u32 LOGGER_dropped();
+
+/**
+ * @brief Logs a record, called by the LOG_* macros.
+ *
+ * @param level kLogLevel_Debug .. kLogLevel_Error.
+ * @param format printf format, see above.
+ * @param count Number of arguments, at most kLogMaxArguments.
+ * @param args Arguments encoded by LOG_ARGUMENT.
+ * @return kErrorCode_Ok, kErrorCode_Null if format is NULL, kErrorCode_LogFull
+ *         if the ring of the thread is full or kErrorCode_Memory if the
+ *         thread can't get a ring.
+ */
+s16 LOGGER_write(u16 level, const char *format, u16 count, const u64 *args);
+
+static inline u64 LOG_encodeInteger(s64 value)
+{
+  return (u64)value;
+}
+
+static inline u64 LOG_encodeUnsigned(u64 value)
+{
+  return value;
+}
+
+static inline u64 LOG_encodeDouble(double value)
+{
+  u64 bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static inline u64 LOG_encodePointer(const void *value)
+{
+  return (u64)(uintptr_t)value;
+}
+
+// Encodes an argument by its type, the integers of any size are widened
+#define LOG_ARGUMENT(x) _Generic((x),                 \
+  float: LOG_encodeDouble,                           \
+  double: LOG_encodeDouble,                          \
+  unsigned long: LOG_encodeUnsigned,                 \
+  unsigned long long: LOG_encodeUnsigned,            \
+  char *: LOG_encodePointer,                         \
+  const char *: LOG_encodePointer,                   \
+  unsigned char *: LOG_encodePointer,                \
+  const unsigned char *: LOG_encodePointer,          \
+  void *: LOG_encodePointer,                         \
+  const void *: LOG_encodePointer,                   \
+  default: LOG_encodeInteger)(x)
+
+// The format counts as an argument: LOG_WRITE picks LOG_WRITE0..6 by the count
+#define LOG_EXPAND(x) x
+#define LOG_SELECT(_1, _2, _3, _4, _5, _6, _7, name, ...) name
+#define LOG_WRITE(level, ...) LOG_EXPAND(LOG_EXPAND(LOG_SELECT(__VA_ARGS__, LOG_WRITE6, LOG_WRITE5, \
+  LOG_WRITE4, LOG_WRITE3, LOG_WRITE2, LOG_WRITE1, LOG_WRITE0, unused))(level, __VA_ARGS__))
+#define LOG_WRITE0(level, format) LOGGER_write(level, format, 0, NULL)
+#define LOG_WRITE1(level, format, a) LOGGER_write(level, format, 1, (const u64[]){LOG_ARGUMENT(a)})
+#define LOG_WRITE2(level, format, a, b) LOGGER_write(level, format, 2, \
+  (const u64[]){LOG_ARGUMENT(a), LOG_ARGUMENT(b)})
+#define LOG_WRITE3(level, format, a, b, c) LOGGER_write(level, format, 3, \
+  (const u64[]){LOG_ARGUMENT(a), LOG_ARGUMENT(b), LOG_ARGUMENT(c)})
+#define LOG_WRITE4(level, format, a, b, c, d) LOGGER_write(level, format, 4, \
+  (const u64[]){LOG_ARGUMENT(a), LOG_ARGUMENT(b), LOG_ARGUMENT(c), LOG_ARGUMENT(d)})
+#define LOG_WRITE5(level, format, a, b, c, d, e) LOGGER_write(level, format, 5, \
+  (const u64[]){LOG_ARGUMENT(a), LOG_ARGUMENT(b), LOG_ARGUMENT(c), LOG_ARGUMENT(d), LOG_ARGUMENT(e)})
+#define LOG_WRITE6(level, format, a, b, c, d, e, f) LOGGER_write(level, format, 6, \
+  (const u64[]){LOG_ARGUMENT(a), LOG_ARGUMENT(b), LOG_ARGUMENT(c), LOG_ARGUMENT(d), LOG_ARGUMENT(e), \
+  LOG_ARGUMENT(f)})
+
+// LOG_ERROR("[%s] %d bytes", __FUNCTION__, bytes): a format and up to
+// kLogMaxArguments arguments
+#if LOG_LEVEL <= kLogLevel_Debug
+#define LOG_DEBUG(...) LOG_WRITE(kLogLevel_Debug, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+#if LOG_LEVEL <= kLogLevel_Info
+#define LOG_INFO(...) LOG_WRITE(kLogLevel_Info, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+#if LOG_LEVEL <= kLogLevel_Warning
+#define LOG_WARNING(...) LOG_WRITE(kLogLevel_Warning, __VA_ARGS__)
+#else
+#define LOG_WARNING(...) ((void)0)
+#endif
+#if LOG_LEVEL <= kLogLevel_Error
+#define LOG_ERROR(...) LOG_WRITE(kLogLevel_Error, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+#endif // __LOGGER_H__
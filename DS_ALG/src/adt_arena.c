@@ -0,0 +1,178 @@
+/**
+ * @file adt_arena.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-05
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "common_def.h"
+#include "adt_arena.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 ARENA_destroy(Arena *arena);
+static s16 ARENA_reset(Arena *arena);
+static void *ARENA_alloc(Arena *arena, u32 bytes);
+static u32 ARENA_used(Arena *arena);
+static u32 ARENA_capacity(Arena *arena);
+static void ARENA_print(Arena *arena);
+
+struct arena_ops_s arena_ops = {
+    .destroy = ARENA_destroy,
+    .reset = ARENA_reset,
+    .alloc = ARENA_alloc,
+    .used = ARENA_used,
+    .capacity = ARENA_capacity,
+    .print = ARENA_print,
+};
+
+#define ARENA_ALIGN(value) (((value) + kArenaAlignment - 1) & ~(uintptr_t)(kArenaAlignment - 1))
+
+static ArenaChunk *ARENA_newChunk(u32 chunk_size)
+{
+  ArenaChunk *chunk = MM->malloc(sizeof(ArenaChunk) + kArenaAlignment + chunk_size);
+  if (NULL == chunk)
+  {
+    return NULL;
+  }
+  chunk->next_ = NULL;
+  chunk->base_ = (u8 *)ARENA_ALIGN((uintptr_t)(chunk + 1));
+  chunk->used_ = 0;
+  return chunk;
+}
+
+Arena *ARENA_create(u32 chunk_size)
+{
+  if (0 == chunk_size || chunk_size > kArenaMaxChunkSize)
+  {
+    return NULL;
+  }
+  Arena *arena = MM->malloc(sizeof(Arena));
+  if (NULL == arena)
+  {
+    return NULL;
+  }
+  arena->first_ = ARENA_newChunk(chunk_size);
+  if (NULL == arena->first_)
+  {
+    MM->free(arena);
+    return NULL;
+  }
+  arena->current_ = arena->first_;
+  arena->chunk_size_ = chunk_size;
+  arena->ops_ = &arena_ops;
+  return arena;
+}
+
+s16 ARENA_destroy(Arena *arena)
+{
+  if (NULL == arena)
+  {
+    return kErrorCode_ArenaNull;
+  }
+  ArenaChunk *chunk = arena->first_;
+  while (NULL != chunk)
+  {
+    ArenaChunk *next = chunk->next_;
+    MM->free(chunk);
+    chunk = next;
+  }
+  MM->free(arena);
+  return kErrorCode_Ok;
+}
+
+s16 ARENA_reset(Arena *arena)
+{
+  if (NULL == arena)
+  {
+    return kErrorCode_ArenaNull;
+  }
+  for (ArenaChunk *chunk = arena->first_; NULL != chunk; chunk = chunk->next_)
+  {
+    chunk->used_ = 0;
+  }
+  arena->current_ = arena->first_;
+  return kErrorCode_Ok;
+}
+
+void *ARENA_alloc(Arena *arena, u32 bytes)
+{
+  if (NULL == arena || 0 == bytes || bytes > arena->chunk_size_)
+  {
+    return NULL;
+  }
+  ArenaChunk *chunk = arena->current_;
+  u32 offset = (u32)ARENA_ALIGN(chunk->used_);
+  if (offset + bytes > arena->chunk_size_)
+  {
+    // chunks kept by a reset are reused before asking MM for a new one
+    if (NULL == chunk->next_)
+    {
+      chunk->next_ = ARENA_newChunk(arena->chunk_size_);
+      if (NULL == chunk->next_)
+      {
+        return NULL;
+      }
+    }
+    chunk = chunk->next_;
+    arena->current_ = chunk;
+    offset = 0;
+  }
+  chunk->used_ = offset + bytes;
+  return chunk->base_ + offset;
+}
+
+u32 ARENA_used(Arena *arena)
+{
+  if (NULL == arena)
+  {
+    return 0;
+  }
+  u32 used = 0;
+  for (ArenaChunk *chunk = arena->first_; NULL != chunk; chunk = chunk->next_)
+  {
+    used += chunk->used_;
+    if (chunk == arena->current_)
+    {
+      break;
+    }
+  }
+  return used;
+}
+
+u32 ARENA_capacity(Arena *arena)
+{
+  if (NULL == arena)
+  {
+    return 0;
+  }
+  u32 capacity = 0;
+  for (ArenaChunk *chunk = arena->first_; NULL != chunk; chunk = chunk->next_)
+  {
+    capacity += arena->chunk_size_;
+  }
+  return capacity;
+}
+
+void ARENA_print(Arena *arena)
+{
+  if (NULL == arena)
+  {
+    printf("\t[Arena Info] Address: NULL\n");
+    return;
+  }
+  printf("\t[Arena Info] Address: %p\n", arena);
+  printf("\t[Arena Info] Chunk size: %u\n", arena->chunk_size_);
+  printf("\t[Arena Info] Used: %u of %u bytes\n", ARENA_used(arena), ARENA_capacity(arena));
+  u16 i = 0;
+  for (ArenaChunk *chunk = arena->first_; NULL != chunk; chunk = chunk->next_)
+  {
+    printf("\t\t[Arena Info] Chunk #%d %p: %u bytes used%s\n", i++, chunk, chunk->used_,
+           chunk == arena->current_ ? " (current)" : "");
+  }
+}
@@ -0,0 +1,573 @@
+/**
+ * @file adt_avltree.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-23
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_avltree.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 AVLTREE_destroy(AVLTree *tree);
+static s16 AVLTREE_softReset(AVLTree *tree);
+static s16 AVLTREE_reset(AVLTree *tree);
+static u32 AVLTREE_length(AVLTree *tree);
+static boolean AVLTREE_isEmpty(AVLTree *tree);
+static void *AVLTREE_first(AVLTree *tree);
+static void *AVLTREE_last(AVLTree *tree);
+static void *AVLTREE_at(AVLTree *tree, u32 index);
+static u32 AVLTREE_rank(AVLTree *tree, const void *data, u16 bytes);
+static s16 AVLTREE_insert(AVLTree *tree, void *data, u16 bytes);
+static void *AVLTREE_erase(AVLTree *tree, const void *data, u16 bytes);
+static void *AVLTREE_find(AVLTree *tree, const void *data, u16 bytes);
+static s16 AVLTREE_lowerBound(AVLTree *tree, const void *data, u16 bytes, Cursor *cursor);
+static s16 AVLTREE_begin(AVLTree *tree, Cursor *cursor);
+static s16 AVLTREE_rbegin(AVLTree *tree, Cursor *cursor);
+static void AVLTREE_print(AVLTree *tree);
+
+struct avltree_ops_s avltree_ops = {
+    .destroy = AVLTREE_destroy,
+    .softReset = AVLTREE_softReset,
+    .reset = AVLTREE_reset,
+    .length = AVLTREE_length,
+    .isEmpty = AVLTREE_isEmpty,
+    .first = AVLTREE_first,
+    .last = AVLTREE_last,
+    .at = AVLTREE_at,
+    .rank = AVLTREE_rank,
+    .insert = AVLTREE_insert,
+    .erase = AVLTREE_erase,
+    .find = AVLTREE_find,
+    .lowerBound = AVLTREE_lowerBound,
+    .begin = AVLTREE_begin,
+    .rbegin = AVLTREE_rbegin,
+    .print = AVLTREE_print,
+};
+
+static s32 AVLTREE_compareBytes(const void *a, u16 a_bytes, const void *b, u16 b_bytes)
+{
+  s32 order = memcmp(a, b, a_bytes < b_bytes ? a_bytes : b_bytes);
+  if (0 != order)
+  {
+    return order;
+  }
+  return (s32)a_bytes - (s32)b_bytes;
+}
+
+AVLTree *AVLTREE_create(AVLTreeCompare compare)
+{
+  AVLTree *tree = MM->malloc(sizeof(AVLTree));
+  if (NULL == tree)
+  {
+    return NULL;
+  }
+  tree->pool_ = POOL_create(sizeof(AVLTreeNode), kAVLTreeSlabBytes);
+  if (NULL == tree->pool_)
+  {
+    MM->free(tree);
+    return NULL;
+  }
+  tree->root_ = NULL;
+  tree->first_ = NULL;
+  tree->last_ = NULL;
+  tree->compare_ = NULL == compare ? AVLTREE_compareBytes : compare;
+  tree->ops_ = &avltree_ops;
+  return tree;
+}
+
+static u8 AVLTREE_height(AVLTreeNode *node)
+{
+  return NULL == node ? 0 : node->height_;
+}
+
+static u32 AVLTREE_count(AVLTreeNode *node)
+{
+  return NULL == node ? 0 : node->count_;
+}
+
+// Recomputes the height and the count of a node from its children
+static void AVLTREE_update(AVLTreeNode *node)
+{
+  u8 left = AVLTREE_height(node->left_);
+  u8 right = AVLTREE_height(node->right_);
+  node->height_ = (left > right ? left : right) + 1;
+  node->count_ = AVLTREE_count(node->left_) + AVLTREE_count(node->right_) + 1;
+}
+
+static AVLTreeNode *AVLTREE_rotateRight(AVLTreeNode *node)
+{
+  AVLTreeNode *left = node->left_;
+  node->left_ = left->right_;
+  left->right_ = node;
+  AVLTREE_update(node);
+  AVLTREE_update(left);
+  return left;
+}
+
+static AVLTreeNode *AVLTREE_rotateLeft(AVLTreeNode *node)
+{
+  AVLTreeNode *right = node->right_;
+  node->right_ = right->left_;
+  right->left_ = node;
+  AVLTREE_update(node);
+  AVLTREE_update(right);
+  return right;
+}
+
+// Updates a node whose subtrees changed, rotating it if their heights differ
+// in two, and returns the root of its subtree
+static AVLTreeNode *AVLTREE_balance(AVLTreeNode *node)
+{
+  AVLTREE_update(node);
+  s16 balance = (s16)AVLTREE_height(node->left_) - (s16)AVLTREE_height(node->right_);
+  if (balance > 1)
+  {
+    if (AVLTREE_height(node->left_->left_) < AVLTREE_height(node->left_->right_))
+    {
+      node->left_ = AVLTREE_rotateLeft(node->left_);
+    }
+    return AVLTREE_rotateRight(node);
+  }
+  if (balance < -1)
+  {
+    if (AVLTREE_height(node->right_->right_) < AVLTREE_height(node->right_->left_))
+    {
+      node->right_ = AVLTREE_rotateRight(node->right_);
+    }
+    return AVLTREE_rotateLeft(node);
+  }
+  return node;
+}
+
+static s32 AVLTREE_compareNode(AVLTree *tree, AVLTreeNode *node, const void *data, u16 bytes)
+{
+  return tree->compare_(node->node_.data_, node->node_.size_, data, bytes);
+}
+
+// Inserts in the subtree of node, prev and next being the closest elements
+// around it found on the way down, and returns the root of the subtree
+static AVLTreeNode *AVLTREE_insertIn(AVLTree *tree, AVLTreeNode *node, void *data, u16 bytes,
+                                     AVLTreeNode *prev, AVLTreeNode *next, s16 *error)
+{
+  if (NULL == node)
+  {
+    node = tree->pool_->ops_->alloc(tree->pool_);
+    if (NULL == node)
+    {
+      *error = kErrorCode_Memory;
+      return NULL;
+    }
+    MEMNODE_createLite(&node->node_);
+    node->node_.ops_->setData(&node->node_, data, bytes);
+    node->left_ = NULL;
+    node->right_ = NULL;
+    node->count_ = 1;
+    node->height_ = 1;
+    node->node_.prev_ = NULL == prev ? NULL : &prev->node_;
+    node->node_.next_ = NULL == next ? NULL : &next->node_;
+    if (NULL == prev)
+    {
+      tree->first_ = node;
+    }
+    else
+    {
+      prev->node_.next_ = &node->node_;
+    }
+    if (NULL == next)
+    {
+      tree->last_ = node;
+    }
+    else
+    {
+      next->node_.prev_ = &node->node_;
+    }
+    *error = kErrorCode_Ok;
+    return node;
+  }
+  s32 order = AVLTREE_compareNode(tree, node, data, bytes);
+  if (0 == order)
+  {
+    *error = kErrorCode_KeyExists;
+    return node;
+  }
+  if (order > 0)
+  {
+    AVLTreeNode *left = AVLTREE_insertIn(tree, node->left_, data, bytes, prev, node, error);
+    if (kErrorCode_Ok != *error)
+    {
+      return node;
+    }
+    node->left_ = left;
+  }
+  else
+  {
+    AVLTreeNode *right = AVLTREE_insertIn(tree, node->right_, data, bytes, node, next, error);
+    if (kErrorCode_Ok != *error)
+    {
+      return node;
+    }
+    node->right_ = right;
+  }
+  return AVLTREE_balance(node);
+}
+
+s16 AVLTREE_insert(AVLTree *tree, void *data, u16 bytes)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_AVLTreeNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  s16 error = kErrorCode_Ok;
+  AVLTreeNode *root = AVLTREE_insertIn(tree, tree->root_, data, bytes, NULL, NULL, &error);
+  if (kErrorCode_Ok == error)
+  {
+    tree->root_ = root;
+  }
+  return error;
+}
+
+// Takes the smallest node out of the subtree of node, returning the new root
+static AVLTreeNode *AVLTREE_detachFirst(AVLTreeNode *node, AVLTreeNode **first)
+{
+  if (NULL == node->left_)
+  {
+    *first = node;
+    return node->right_;
+  }
+  node->left_ = AVLTREE_detachFirst(node->left_, first);
+  return AVLTREE_balance(node);
+}
+
+// Erases the node equal to data from the subtree of node, returning the new root
+static AVLTreeNode *AVLTREE_eraseIn(AVLTree *tree, AVLTreeNode *node, const void *data, u16 bytes, AVLTreeNode **erased)
+{
+  if (NULL == node)
+  {
+    return NULL;
+  }
+  s32 order = AVLTREE_compareNode(tree, node, data, bytes);
+  if (order > 0)
+  {
+    node->left_ = AVLTREE_eraseIn(tree, node->left_, data, bytes, erased);
+  }
+  else if (order < 0)
+  {
+    node->right_ = AVLTREE_eraseIn(tree, node->right_, data, bytes, erased);
+  }
+  else
+  {
+    *erased = node;
+    if (NULL == node->left_ || NULL == node->right_)
+    {
+      return NULL == node->left_ ? node->right_ : node->left_;
+    }
+    // the next element takes the place of the node
+    AVLTreeNode *next = NULL;
+    AVLTreeNode *right = AVLTREE_detachFirst(node->right_, &next);
+    next->left_ = node->left_;
+    next->right_ = right;
+    return AVLTREE_balance(next);
+  }
+  return NULL == *erased ? node : AVLTREE_balance(node);
+}
+
+void *AVLTREE_erase(AVLTree *tree, const void *data, u16 bytes)
+{
+  if (NULL == tree || NULL == data)
+  {
+    return NULL;
+  }
+  AVLTreeNode *erased = NULL;
+  tree->root_ = AVLTREE_eraseIn(tree, tree->root_, data, bytes, &erased);
+  if (NULL == erased)
+  {
+    return NULL;
+  }
+  MemoryNode *prev = erased->node_.prev_;
+  MemoryNode *next = erased->node_.next_;
+  if (NULL == prev)
+  {
+    tree->first_ = (AVLTreeNode *)next;
+  }
+  else
+  {
+    prev->next_ = next;
+  }
+  if (NULL == next)
+  {
+    tree->last_ = (AVLTreeNode *)prev;
+  }
+  else
+  {
+    next->prev_ = prev;
+  }
+  void *element = erased->node_.data_;
+  tree->pool_->ops_->free(tree->pool_, erased);
+  return element;
+}
+
+// First node not below data, NULL if every node is below
+static AVLTreeNode *AVLTREE_lowerNode(AVLTree *tree, const void *data, u16 bytes)
+{
+  AVLTreeNode *bound = NULL;
+  AVLTreeNode *node = tree->root_;
+  while (NULL != node)
+  {
+    if (AVLTREE_compareNode(tree, node, data, bytes) < 0)
+    {
+      node = node->right_;
+    }
+    else
+    {
+      bound = node;
+      node = node->left_;
+    }
+  }
+  return bound;
+}
+
+void *AVLTREE_find(AVLTree *tree, const void *data, u16 bytes)
+{
+  if (NULL == tree || NULL == data)
+  {
+    return NULL;
+  }
+  AVLTreeNode *node = tree->root_;
+  while (NULL != node)
+  {
+    s32 order = AVLTREE_compareNode(tree, node, data, bytes);
+    if (0 == order)
+    {
+      return node->node_.data_;
+    }
+    node = order > 0 ? node->left_ : node->right_;
+  }
+  return NULL;
+}
+
+void *AVLTREE_at(AVLTree *tree, u32 index)
+{
+  if (NULL == tree || index >= AVLTREE_count(tree->root_))
+  {
+    return NULL;
+  }
+  AVLTreeNode *node = tree->root_;
+  for (;;)
+  {
+    u32 left = AVLTREE_count(node->left_);
+    if (index < left)
+    {
+      node = node->left_;
+    }
+    else if (index == left)
+    {
+      return node->node_.data_;
+    }
+    else
+    {
+      index -= left + 1;
+      node = node->right_;
+    }
+  }
+}
+
+u32 AVLTREE_rank(AVLTree *tree, const void *data, u16 bytes)
+{
+  if (NULL == tree || NULL == data)
+  {
+    return 0;
+  }
+  u32 rank = 0;
+  AVLTreeNode *node = tree->root_;
+  while (NULL != node)
+  {
+    if (AVLTREE_compareNode(tree, node, data, bytes) < 0)
+    {
+      rank += AVLTREE_count(node->left_) + 1;
+      node = node->right_;
+    }
+    else
+    {
+      node = node->left_;
+    }
+  }
+  return rank;
+}
+
+s16 AVLTREE_lowerBound(AVLTree *tree, const void *data, u16 bytes, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, False);
+  if (NULL == tree)
+  {
+    return kErrorCode_AVLTreeNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_Null;
+  }
+  AVLTreeNode *node = AVLTREE_lowerNode(tree, data, bytes);
+  if (NULL != node)
+  {
+    CURSOR_init(cursor, &node->node_, &tree->last_->node_, 0, False);
+  }
+  return kErrorCode_Ok;
+}
+
+s16 AVLTREE_begin(AVLTree *tree, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, False);
+  if (NULL == tree)
+  {
+    return kErrorCode_AVLTreeNull;
+  }
+  if (NULL != tree->first_)
+  {
+    CURSOR_init(cursor, &tree->first_->node_, &tree->last_->node_, 0, False);
+  }
+  return kErrorCode_Ok;
+}
+
+s16 AVLTREE_rbegin(AVLTree *tree, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, True);
+  if (NULL == tree)
+  {
+    return kErrorCode_AVLTreeNull;
+  }
+  if (NULL != tree->last_)
+  {
+    CURSOR_init(cursor, &tree->last_->node_, &tree->first_->node_, 0, True);
+  }
+  return kErrorCode_Ok;
+}
+
+void *AVLTREE_first(AVLTree *tree)
+{
+  if (NULL == tree || NULL == tree->first_)
+  {
+    return NULL;
+  }
+  return tree->first_->node_.data_;
+}
+
+void *AVLTREE_last(AVLTree *tree)
+{
+  if (NULL == tree || NULL == tree->last_)
+  {
+    return NULL;
+  }
+  return tree->last_->node_.data_;
+}
+
+// Empties the tree, the payloads freed or not
+static s16 AVLTREE_empty(AVLTree *tree, boolean free_data)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_AVLTreeNull;
+  }
+  if (True == free_data)
+  {
+    for (AVLTreeNode *node = tree->first_; NULL != node; node = (AVLTreeNode *)node->node_.next_)
+    {
+      MM->free(node->node_.data_);
+    }
+  }
+  tree->pool_->ops_->reset(tree->pool_);
+  tree->root_ = NULL;
+  tree->first_ = NULL;
+  tree->last_ = NULL;
+  return kErrorCode_Ok;
+}
+
+s16 AVLTREE_destroy(AVLTree *tree)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_AVLTreeNull;
+  }
+  AVLTREE_empty(tree, True);
+  tree->pool_->ops_->destroy(tree->pool_);
+  MM->free(tree);
+  return kErrorCode_Ok;
+}
+
+s16 AVLTREE_softReset(AVLTree *tree)
+{
+  return AVLTREE_empty(tree, False);
+}
+
+s16 AVLTREE_reset(AVLTree *tree)
+{
+  return AVLTREE_empty(tree, True);
+}
+
+u32 AVLTREE_length(AVLTree *tree)
+{
+  if (NULL == tree)
+  {
+    return 0;
+  }
+  return AVLTREE_count(tree->root_);
+}
+
+boolean AVLTREE_isEmpty(AVLTree *tree)
+{
+  if (NULL == tree)
+  {
+    return False;
+  }
+  return NULL == tree->root_ ? True : False;
+}
+
+void AVLTREE_print(AVLTree *tree)
+{
+  if (NULL == tree)
+  {
+    return;
+  }
+  printf("[AVLTREE INFO] Adress: %p\n", tree);
+  printf("[AVLTREE INFO] Lenght: %u\n", AVLTREE_count(tree->root_));
+  printf("[AVLTREE INFO] Height: %d\n", AVLTREE_height(tree->root_));
+  u32 position = 0;
+  for (AVLTreeNode *node = tree->first_; NULL != node; node = (AVLTreeNode *)node->node_.next_, ++position)
+  {
+    printf(" [AVLTREE INFO] Element #%u, height %d\n", position, node->height_);
+    printf("  [NODE INFO] Adress: %p\n", &node->node_);
+    printf("  [NODE INFO] Size: %d\n", node->node_.size_);
+    printf("  [NODE INFO] Data content:");
+    for (u16 j = 0; j < node->node_.size_; j++)
+    {
+      printf("%c", *((char *)(node->node_.data_) + j));
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
@@ -0,0 +1,427 @@
+/**
+ * @file adt_binary.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-07-10
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_binary.h"
+#include "adt_cursor.h"
+#include "file_map.h"
+
+// stdio buffer of save, one fwrite per payload goes through it
+#define kBinaryWriteBuffer 65536
+
+extern struct vector_ops_s vector_ops;
+extern struct list_ops_s list_ops;
+extern struct dllist_ops_s dllist_ops;
+extern struct queue_ops_s queue_ops;
+
+// Everything a mapped container needs but the payloads, in one block of OS
+// pages. The container goes first so destroy gets the block from it.
+typedef struct binary_block_s {
+  union {
+    Vector vector_;
+    List list_;
+    DLList dllist_;
+  } container_;
+  Queue queue_;
+  FileMap file_;
+  u64 bytes_; // size of the block
+  MemoryNode nodes_[];
+} BinaryBlock;
+
+static void BINARY_release(BinaryBlock *block)
+{
+  FileMap file = block->file_;
+  FILEMAP_pagesFree(block, block->bytes_);
+  FILEMAP_close(&file);
+}
+
+// The ops of the mapped containers are copies of the regular ones whose
+// mutators refuse to work and whose destroy unmaps the file. The regular
+// functions are static, so the copies are made by the first load.
+#define BINARY_READ_ONLY_OPS(Type, name, null_error)                                     \
+  static struct name##_ops_s name##_binary_ops;                                         \
+  static s16 BINARY_##name##Destroy(Type *container)                                    \
+  {                                                                                      \
+    if (NULL == container)                                                               \
+    {                                                                                    \
+      return null_error;                                                                 \
+    }                                                                                    \
+    BINARY_release((BinaryBlock *)container);                                            \
+    return kErrorCode_Ok;                                                                \
+  }                                                                                      \
+  static s16 BINARY_##name##Reset(Type *container)                                      \
+  {                                                                                      \
+    return NULL == container ? null_error : kErrorCode_ReadOnly;                         \
+  }                                                                                      \
+  static s16 BINARY_##name##Resize(Type *container, u16 capacity)                       \
+  {                                                                                      \
+    (void)capacity;                                                                      \
+    return NULL == container ? null_error : kErrorCode_ReadOnly;                         \
+  }                                                                                      \
+  static s16 BINARY_##name##Insert(Type *container, void *data, u16 bytes)              \
+  {                                                                                      \
+    (void)data;                                                                          \
+    (void)bytes;                                                                         \
+    return NULL == container ? null_error : kErrorCode_ReadOnly;                         \
+  }                                                                                      \
+  static s16 BINARY_##name##InsertAt(Type *container, void *data, u16 bytes, u16 index) \
+  {                                                                                      \
+    (void)data;                                                                          \
+    (void)bytes;                                                                         \
+    (void)index;                                                                         \
+    return NULL == container ? null_error : kErrorCode_ReadOnly;                         \
+  }                                                                                      \
+  static void *BINARY_##name##Extract(Type *container)                                  \
+  {                                                                                      \
+    (void)container;                                                                     \
+    return NULL;                                                                         \
+  }                                                                                      \
+  static void *BINARY_##name##ExtractAt(Type *container, u16 index)                     \
+  {                                                                                      \
+    (void)container;                                                                     \
+    (void)index;                                                                         \
+    return NULL;                                                                         \
+  }                                                                                      \
+  static s16 BINARY_##name##Concat(Type *container, Type *src)                          \
+  {                                                                                      \
+    (void)src;                                                                           \
+    return NULL == container ? null_error : kErrorCode_ReadOnly;                         \
+  }                                                                                      \
+  static void BINARY_##name##InitOps()                                                  \
+  {                                                                                      \
+    name##_binary_ops = name##_ops;                                                      \
+    name##_binary_ops.destroy = BINARY_##name##Destroy;                                  \
+    name##_binary_ops.softReset = BINARY_##name##Reset;                                  \
+    name##_binary_ops.reset = BINARY_##name##Reset;                                      \
+    name##_binary_ops.resize = BINARY_##name##Resize;                                    \
+    name##_binary_ops.insertFirst = BINARY_##name##Insert;                               \
+    name##_binary_ops.insertLast = BINARY_##name##Insert;                                \
+    name##_binary_ops.insertAt = BINARY_##name##InsertAt;                                \
+    name##_binary_ops.extractFirst = BINARY_##name##Extract;                             \
+    name##_binary_ops.extractLast = BINARY_##name##Extract;                              \
+    name##_binary_ops.extractAt = BINARY_##name##ExtractAt;                              \
+    name##_binary_ops.concat = BINARY_##name##Concat;                                    \
+  }
+
+BINARY_READ_ONLY_OPS(Vector, vector, kErrorCode_VectorNull)
+BINARY_READ_ONLY_OPS(List, list, kErrorCode_ListNull)
+BINARY_READ_ONLY_OPS(DLList, dllist, kErrorCode_ListNull)
+
+// The queue lives in the block after the list it stores
+static struct queue_ops_s queue_binary_ops;
+
+static s16 BINARY_queueDestroy(Queue *queue)
+{
+  if (NULL == queue || NULL == queue->storage_)
+  {
+    return kErrorCode_QueueNull;
+  }
+  BINARY_release((BinaryBlock *)queue->storage_);
+  return kErrorCode_Ok;
+}
+
+static s16 BINARY_queueReset(Queue *queue)
+{
+  return NULL == queue ? kErrorCode_QueueNull : kErrorCode_ReadOnly;
+}
+
+static s16 BINARY_queueResize(Queue *queue, u16 capacity)
+{
+  (void)capacity;
+  return NULL == queue ? kErrorCode_QueueNull : kErrorCode_ReadOnly;
+}
+
+static s16 BINARY_queueEnqueue(Queue *queue, void *data, u16 bytes)
+{
+  (void)data;
+  (void)bytes;
+  return NULL == queue ? kErrorCode_QueueNull : kErrorCode_ReadOnly;
+}
+
+static void *BINARY_queueDequeue(Queue *queue)
+{
+  (void)queue;
+  return NULL;
+}
+
+static s16 BINARY_queueConcat(Queue *queue, Queue *src)
+{
+  (void)src;
+  return NULL == queue ? kErrorCode_QueueNull : kErrorCode_ReadOnly;
+}
+
+static void BINARY_initOps()
+{
+  // every load writes the same values, once is enough
+  static boolean ready = False;
+  if (True == ready)
+  {
+    return;
+  }
+  BINARY_vectorInitOps();
+  BINARY_listInitOps();
+  BINARY_dllistInitOps();
+  queue_binary_ops = queue_ops;
+  queue_binary_ops.destroy = BINARY_queueDestroy;
+  queue_binary_ops.reset = BINARY_queueReset;
+  queue_binary_ops.resize = BINARY_queueResize;
+  queue_binary_ops.enqueue = BINARY_queueEnqueue;
+  queue_binary_ops.dequeue = BINARY_queueDequeue;
+  queue_binary_ops.concat = BINARY_queueConcat;
+  ready = True;
+}
+
+// Writes the nodes of a walk: header, offset table and payloads
+static s16 BINARY_save(Cursor *first, const char *path)
+{
+  if (NULL == path)
+  {
+    return kErrorCode_Null;
+  }
+  u16 count = 0;
+  u64 payloads = 0;
+  Cursor cursor = *first;
+  for (; True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+  {
+    payloads += NULL == CURSOR_get(&cursor) ? 0 : CURSOR_node(&cursor)->size_;
+    count++;
+  }
+  u64 offset = sizeof(BinaryHeader) + ((u64)count + 1) * sizeof(u64);
+
+  FILE *file = fopen(path, "wb");
+  if (NULL == file)
+  {
+    return kErrorCode_File;
+  }
+  setvbuf(file, NULL, _IOFBF, kBinaryWriteBuffer);
+  BinaryHeader header = {
+      .magic_ = kBinaryMagic,
+      .version_ = kBinaryVersion,
+      .count_ = count,
+      .bytes_ = offset + payloads,
+  };
+  boolean written = 1 == fwrite(&header, sizeof(header), 1, file) ? True : False;
+  for (cursor = *first; True == written && True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+  {
+    written = 1 == fwrite(&offset, sizeof(offset), 1, file) ? True : False;
+    offset += NULL == CURSOR_get(&cursor) ? 0 : CURSOR_node(&cursor)->size_;
+  }
+  if (True == written)
+  {
+    written = 1 == fwrite(&offset, sizeof(offset), 1, file) ? True : False;
+  }
+  for (cursor = *first; True == written && True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+  {
+    MemoryNode *node = CURSOR_node(&cursor);
+    if (NULL != node->data_ && 0 != node->size_)
+    {
+      written = 1 == fwrite(node->data_, node->size_, 1, file) ? True : False;
+    }
+  }
+  if (0 != fclose(file))
+  {
+    written = False;
+  }
+  return True == written ? kErrorCode_Ok : kErrorCode_File;
+}
+
+s16 BINARY_saveVector(Vector *vector, const char *path)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  Cursor cursor;
+  s16 error = vector->ops_->begin(vector, &cursor);
+  return kErrorCode_Ok != error ? error : BINARY_save(&cursor, path);
+}
+
+s16 BINARY_saveList(List *list, const char *path)
+{
+  if (NULL == list)
+  {
+    return kErrorCode_ListNull;
+  }
+  Cursor cursor;
+  s16 error = list->ops_->begin(list, &cursor);
+  return kErrorCode_Ok != error ? error : BINARY_save(&cursor, path);
+}
+
+s16 BINARY_saveDLList(DLList *list, const char *path)
+{
+  if (NULL == list)
+  {
+    return kErrorCode_ListNull;
+  }
+  Cursor cursor;
+  s16 error = list->ops_->begin(list, &cursor);
+  return kErrorCode_Ok != error ? error : BINARY_save(&cursor, path);
+}
+
+s16 BINARY_saveQueue(Queue *queue, const char *path)
+{
+  if (NULL == queue)
+  {
+    return kErrorCode_QueueNull;
+  }
+  Cursor cursor;
+  s16 error = queue->ops_->begin(queue, &cursor);
+  return kErrorCode_Ok != error ? error : BINARY_save(&cursor, path);
+}
+
+// The whole file is checked once here, so the nodes can be built blindly
+static s16 BINARY_check(FileMap *file)
+{
+  if (file->bytes_ < sizeof(BinaryHeader) + sizeof(u64))
+  {
+    return kErrorCode_FileFormat;
+  }
+  BinaryHeader *header = (BinaryHeader *)file->address_;
+  u64 table = sizeof(BinaryHeader) + ((u64)header->count_ + 1) * sizeof(u64);
+  if (kBinaryMagic != header->magic_ || kBinaryVersion != header->version_ ||
+      file->bytes_ != header->bytes_ || table > file->bytes_)
+  {
+    return kErrorCode_FileFormat;
+  }
+  u64 *offsets = (u64 *)(header + 1);
+  if (table != offsets[0] || file->bytes_ != offsets[header->count_])
+  {
+    return kErrorCode_FileFormat;
+  }
+  for (u32 i = 0; i < header->count_; ++i)
+  {
+    if (offsets[i + 1] < offsets[i] || offsets[i + 1] - offsets[i] > 0xFFFF)
+    {
+      return kErrorCode_FileFormat;
+    }
+  }
+  return kErrorCode_Ok;
+}
+
+// Maps the file and builds an unlinked node per element
+static BinaryBlock *BINARY_map(const char *path)
+{
+  FileMap file;
+  if (kErrorCode_Ok != FILEMAP_open(&file, path))
+  {
+    return NULL;
+  }
+  if (kErrorCode_Ok != BINARY_check(&file))
+  {
+    FILEMAP_close(&file);
+    return NULL;
+  }
+  BinaryHeader *header = (BinaryHeader *)file.address_;
+  u64 *offsets = (u64 *)(header + 1);
+  u64 bytes = sizeof(BinaryBlock) + (u64)header->count_ * sizeof(MemoryNode);
+  BinaryBlock *block = FILEMAP_pagesAlloc(bytes);
+  if (NULL == block)
+  {
+    FILEMAP_close(&file);
+    return NULL;
+  }
+  BINARY_initOps();
+  block->file_ = file;
+  block->bytes_ = bytes;
+  for (u32 i = 0; i < header->count_; ++i)
+  {
+    MemoryNode *node = &block->nodes_[i];
+    MEMNODE_createLite(node);
+    node->size_ = (u16)(offsets[i + 1] - offsets[i]);
+    node->data_ = 0 == node->size_ ? NULL : file.address_ + offsets[i];
+    node->next_ = NULL;
+    node->prev_ = NULL;
+  }
+  return block;
+}
+
+static u16 BINARY_count(BinaryBlock *block)
+{
+  return ((BinaryHeader *)block->file_.address_)->count_;
+}
+
+Vector *BINARY_mmapLoadVector(const char *path)
+{
+  BinaryBlock *block = BINARY_map(path);
+  if (NULL == block)
+  {
+    return NULL;
+  }
+  Vector *vector = &block->container_.vector_;
+  vector->head_ = 0;
+  vector->tail_ = BINARY_count(block);
+  vector->capacity_ = vector->tail_;
+  vector->storage_ = block->nodes_;
+  vector->ops_ = &vector_binary_ops;
+  return vector;
+}
+
+// Links the nodes of the block in order, backwards too when doubly
+static void BINARY_link(BinaryBlock *block, u16 count, boolean doubly)
+{
+  for (u32 i = 0; i + 1 < count; ++i)
+  {
+    block->nodes_[i].next_ = &block->nodes_[i + 1];
+    if (True == doubly)
+    {
+      block->nodes_[i + 1].prev_ = &block->nodes_[i];
+    }
+  }
+}
+
+List *BINARY_mmapLoadList(const char *path)
+{
+  BinaryBlock *block = BINARY_map(path);
+  if (NULL == block)
+  {
+    return NULL;
+  }
+  u16 count = BINARY_count(block);
+  BINARY_link(block, count, False);
+  List *list = &block->container_.list_;
+  list->head_ = 0 == count ? NULL : &block->nodes_[0];
+  list->tail_ = 0 == count ? NULL : &block->nodes_[count - 1];
+  list->length_ = count;
+  list->capacity_ = count;
+  list->ops_ = &list_binary_ops;
+  return list;
+}
+
+DLList *BINARY_mmapLoadDLList(const char *path)
+{
+  BinaryBlock *block = BINARY_map(path);
+  if (NULL == block)
+  {
+    return NULL;
+  }
+  u16 count = BINARY_count(block);
+  BINARY_link(block, count, True);
+  DLList *list = &block->container_.dllist_;
+  list->head_ = 0 == count ? NULL : &block->nodes_[0];
+  list->tail_ = 0 == count ? NULL : &block->nodes_[count - 1];
+  list->length_ = count;
+  list->capacity_ = count;
+  list->ops_ = &dllist_binary_ops;
+  return list;
+}
+
+Queue *BINARY_mmapLoadQueue(const char *path)
+{
+  List *list = BINARY_mmapLoadList(path);
+  if (NULL == list)
+  {
+    return NULL;
+  }
+  Queue *queue = &((BinaryBlock *)list)->queue_;
+  queue->storage_ = list;
+  queue->ops_ = &queue_binary_ops;
+  return queue;
+}
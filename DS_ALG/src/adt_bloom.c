@@ -0,0 +1,663 @@
+/**
+ * @file adt_bloom.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-28
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_bloom.h"
+#include "file_map.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#define kBloomPrime 0x9e3779b97f4a7c15ull
+// false positive rate of one bit per key with the best number of hashes
+#define kBloomRatePerBit 0.6185
+// shifts of BLOOM_slot that leave a bit of a block and a counter of a block
+#define kBloomBitShift 23
+#define kBloomCounterShift 25
+
+// odd multipliers of the slots of a key
+static const u32 kBloomSalts[kBloomMaxHashes] = {
+    0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d, 0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31,
+    0x9e3779b1, 0x85ebca6b, 0xc2b2ae35, 0x27d4eb2f, 0x165667b1, 0xd3a2646d, 0xfd7046c5, 0xb55a4f09,
+};
+
+static s16 BLOOM_destroy(BloomFilter *filter);
+static s16 BLOOM_reset(BloomFilter *filter);
+static u32 BLOOM_length(BloomFilter *filter);
+static u64 BLOOM_memory(BloomFilter *filter);
+static s16 BLOOM_add(BloomFilter *filter, const void *data, u16 bytes);
+static boolean BLOOM_contains(BloomFilter *filter, const void *data, u16 bytes);
+static s16 BLOOM_addNode(BloomFilter *filter, MemoryNode *node);
+static boolean BLOOM_containsNode(BloomFilter *filter, MemoryNode *node);
+static s16 BLOOM_merge(BloomFilter *filter, BloomFilter *other);
+static s16 BLOOM_intersect(BloomFilter *filter, BloomFilter *other);
+static void BLOOM_print(BloomFilter *filter);
+
+static s16 COUNTBLOOM_destroy(CountingBloom *filter);
+static s16 COUNTBLOOM_reset(CountingBloom *filter);
+static u32 COUNTBLOOM_length(CountingBloom *filter);
+static u64 COUNTBLOOM_memory(CountingBloom *filter);
+static s16 COUNTBLOOM_add(CountingBloom *filter, const void *data, u16 bytes);
+static boolean COUNTBLOOM_contains(CountingBloom *filter, const void *data, u16 bytes);
+static s16 COUNTBLOOM_erase(CountingBloom *filter, const void *data, u16 bytes);
+static s16 COUNTBLOOM_addNode(CountingBloom *filter, MemoryNode *node);
+static boolean COUNTBLOOM_containsNode(CountingBloom *filter, MemoryNode *node);
+static s16 COUNTBLOOM_eraseNode(CountingBloom *filter, MemoryNode *node);
+static s16 COUNTBLOOM_merge(CountingBloom *filter, CountingBloom *other);
+static s16 COUNTBLOOM_intersect(CountingBloom *filter, CountingBloom *other);
+static void COUNTBLOOM_print(CountingBloom *filter);
+
+struct bloom_filter_ops_s bloom_filter_ops = {
+    .destroy = BLOOM_destroy,
+    .reset = BLOOM_reset,
+    .length = BLOOM_length,
+    .memory = BLOOM_memory,
+    .add = BLOOM_add,
+    .contains = BLOOM_contains,
+    .addNode = BLOOM_addNode,
+    .containsNode = BLOOM_containsNode,
+    .merge = BLOOM_merge,
+    .intersect = BLOOM_intersect,
+    .print = BLOOM_print,
+};
+
+struct counting_bloom_ops_s counting_bloom_ops = {
+    .destroy = COUNTBLOOM_destroy,
+    .reset = COUNTBLOOM_reset,
+    .length = COUNTBLOOM_length,
+    .memory = COUNTBLOOM_memory,
+    .add = COUNTBLOOM_add,
+    .contains = COUNTBLOOM_contains,
+    .erase = COUNTBLOOM_erase,
+    .addNode = COUNTBLOOM_addNode,
+    .containsNode = COUNTBLOOM_containsNode,
+    .eraseNode = COUNTBLOOM_eraseNode,
+    .merge = COUNTBLOOM_merge,
+    .intersect = COUNTBLOOM_intersect,
+    .print = COUNTBLOOM_print,
+};
+
+// Bits (or counters) per key of a classic filter with the false positive rate
+static u32 BLOOM_bitsPerKey(double false_positive_rate)
+{
+  u32 bits = 1;
+  double rate = kBloomRatePerBit;
+  while (rate > false_positive_rate && bits < 64)
+  {
+    rate *= kBloomRatePerBit;
+    ++bits;
+  }
+  return bits;
+}
+
+// Bits set per key: ln 2 times the bits per key
+static u16 BLOOM_hashes(u32 bits_per_key)
+{
+  u32 hashes = (bits_per_key * 693 + 500) / 1000;
+  if (hashes < 1)
+  {
+    return 1;
+  }
+  return hashes > kBloomMaxHashes ? kBloomMaxHashes : (u16)hashes;
+}
+
+// Blocks for the keys. Some blocks get more keys than others, and the
+// fewer slots a block has the more its load varies, so a blocked filter
+// takes bits_per_key^2 * 4 / block_slots more slots per key to keep the rate
+static u32 BLOOM_blocks(u32 keys, u32 bits_per_key, u32 block_slots)
+{
+  u64 tenths_per_key = bits_per_key * 10 + bits_per_key * bits_per_key * 40 / block_slots;
+  u64 slots = ((u64)keys * tenths_per_key + 9) / 10;
+  return (u32)((slots + block_slots - 1) / block_slots);
+}
+
+static u64 BLOOM_mix(u64 hash)
+{
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// 64-bit hash of a key. Long keys are read 32 bytes at a time into four
+// independent lanes, which the compiler can keep in vector registers;
+// the rest goes 8 bytes at a time into a single chain
+static u64 BLOOM_hash(const void *data, u16 bytes)
+{
+  const u8 *cursor = data;
+  u64 lanes[4] = {kBloomPrime, kBloomPrime * 3, kBloomPrime * 5, kBloomPrime * 7};
+  u16 left = bytes;
+  while (left >= sizeof(lanes))
+  {
+    u64 words[4];
+    memcpy(words, cursor, sizeof(words));
+    for (u16 l = 0; l < 4; ++l)
+    {
+      lanes[l] = (lanes[l] ^ words[l]) * kBloomPrime;
+      lanes[l] ^= lanes[l] >> 29;
+    }
+    cursor += sizeof(lanes);
+    left -= sizeof(lanes);
+  }
+  u64 hash = bytes ^ lanes[0] ^ (lanes[1] << 16 | lanes[1] >> 48) ^ (lanes[2] << 32 | lanes[2] >> 32) ^
+             (lanes[3] << 48 | lanes[3] >> 16);
+  while (left >= sizeof(u64))
+  {
+    u64 word;
+    memcpy(&word, cursor, sizeof(word));
+    hash = (hash ^ word) * kBloomPrime;
+    hash ^= hash >> 29;
+    cursor += sizeof(u64);
+    left -= sizeof(u64);
+  }
+  if (left > 0)
+  {
+    u64 word = 0;
+    memcpy(&word, cursor, left);
+    hash = (hash ^ word) * kBloomPrime;
+  }
+  return BLOOM_mix(hash);
+}
+
+// Block of a key: the high half of the hash scaled to the number of blocks
+static u32 BLOOM_block(u64 hash, u32 block_count)
+{
+  return (u32)(((hash >> 32) * block_count) >> 32);
+}
+
+// Slot i of a key inside its block: the top bits of the low half of the
+// hash times the salt i. Every slot is one 32-bit multiply and a shift,
+// without dependencies between them, so the loops over the slots vectorize
+static u32 BLOOM_slot(u64 hash, u16 i, u16 shift)
+{
+  return ((u32)hash * kBloomSalts[i]) >> shift;
+}
+
+// The bits of a key in its block, as one word per 64 bits
+static void BLOOM_mask(u64 hash, u16 hashes, u64 *mask)
+{
+  for (u16 w = 0; w < kBloomBlockWords; ++w)
+  {
+    mask[w] = 0;
+  }
+  for (u16 i = 0; i < hashes; ++i)
+  {
+    u32 bit = BLOOM_slot(hash, i, kBloomBitShift);
+    mask[bit / 64] |= 1ull << (bit % 64);
+  }
+}
+
+BloomFilter *BLOOM_create(u32 keys, double false_positive_rate)
+{
+  if (0 == keys || !(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+  {
+    return NULL;
+  }
+  BloomFilter *filter = MM->malloc(sizeof(BloomFilter));
+  if (NULL == filter)
+  {
+    return NULL;
+  }
+  u32 bits_per_key = BLOOM_bitsPerKey(false_positive_rate);
+  filter->block_count_ = BLOOM_blocks(keys, bits_per_key, kBloomBlockBits);
+  filter->hashes_ = BLOOM_hashes(bits_per_key);
+  filter->length_ = 0;
+  filter->blocks_ = FILEMAP_pagesAlloc((u64)filter->block_count_ * CACHE_LINE_SIZE);
+  if (NULL == filter->blocks_)
+  {
+    MM->free(filter);
+    return NULL;
+  }
+  filter->ops_ = &bloom_filter_ops;
+  return filter;
+}
+
+s16 BLOOM_destroy(BloomFilter *filter)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  FILEMAP_pagesFree(filter->blocks_, (u64)filter->block_count_ * CACHE_LINE_SIZE);
+  MM->free(filter);
+  return kErrorCode_Ok;
+}
+
+s16 BLOOM_reset(BloomFilter *filter)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  memset(filter->blocks_, 0, (u64)filter->block_count_ * CACHE_LINE_SIZE);
+  filter->length_ = 0;
+  return kErrorCode_Ok;
+}
+
+u32 BLOOM_length(BloomFilter *filter)
+{
+  if (NULL == filter)
+  {
+    return 0;
+  }
+  return filter->length_;
+}
+
+u64 BLOOM_memory(BloomFilter *filter)
+{
+  if (NULL == filter)
+  {
+    return 0;
+  }
+  return (u64)filter->block_count_ * CACHE_LINE_SIZE;
+}
+
+s16 BLOOM_add(BloomFilter *filter, const void *data, u16 bytes)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_Null;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  u64 hash = BLOOM_hash(data, bytes);
+  u64 *block = filter->blocks_ + (u64)BLOOM_block(hash, filter->block_count_) * kBloomBlockWords;
+  u64 mask[kBloomBlockWords];
+  BLOOM_mask(hash, filter->hashes_, mask);
+  for (u16 w = 0; w < kBloomBlockWords; ++w)
+  {
+    block[w] |= mask[w];
+  }
+  filter->length_++;
+  return kErrorCode_Ok;
+}
+
+boolean BLOOM_contains(BloomFilter *filter, const void *data, u16 bytes)
+{
+  if (NULL == filter || NULL == data || 0 == bytes)
+  {
+    return False;
+  }
+  u64 hash = BLOOM_hash(data, bytes);
+  const u64 *block = filter->blocks_ + (u64)BLOOM_block(hash, filter->block_count_) * kBloomBlockWords;
+  u64 mask[kBloomBlockWords];
+  BLOOM_mask(hash, filter->hashes_, mask);
+  // every word is checked, without branches, so the loop vectorizes
+  u64 missing = 0;
+  for (u16 w = 0; w < kBloomBlockWords; ++w)
+  {
+    missing |= mask[w] & ~block[w];
+  }
+  return 0 == missing ? True : False;
+}
+
+s16 BLOOM_addNode(BloomFilter *filter, MemoryNode *node)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (NULL == node)
+  {
+    return kErrorCode_Null;
+  }
+  return BLOOM_add(filter, node->data_, node->size_);
+}
+
+boolean BLOOM_containsNode(BloomFilter *filter, MemoryNode *node)
+{
+  if (NULL == node)
+  {
+    return False;
+  }
+  return BLOOM_contains(filter, node->data_, node->size_);
+}
+
+s16 BLOOM_merge(BloomFilter *filter, BloomFilter *other)
+{
+  if (NULL == filter || NULL == other)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (filter->block_count_ != other->block_count_ || filter->hashes_ != other->hashes_)
+  {
+    return kErrorCode_BloomShape;
+  }
+  u64 words = (u64)filter->block_count_ * kBloomBlockWords;
+  for (u64 w = 0; w < words; ++w)
+  {
+    filter->blocks_[w] |= other->blocks_[w];
+  }
+  filter->length_ += other->length_;
+  return kErrorCode_Ok;
+}
+
+s16 BLOOM_intersect(BloomFilter *filter, BloomFilter *other)
+{
+  if (NULL == filter || NULL == other)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (filter->block_count_ != other->block_count_ || filter->hashes_ != other->hashes_)
+  {
+    return kErrorCode_BloomShape;
+  }
+  u64 words = (u64)filter->block_count_ * kBloomBlockWords;
+  for (u64 w = 0; w < words; ++w)
+  {
+    filter->blocks_[w] &= other->blocks_[w];
+  }
+  if (other->length_ < filter->length_)
+  {
+    filter->length_ = other->length_;
+  }
+  return kErrorCode_Ok;
+}
+
+void BLOOM_print(BloomFilter *filter)
+{
+  if (NULL == filter)
+  {
+    return;
+  }
+  u64 words = (u64)filter->block_count_ * kBloomBlockWords;
+  u64 set = 0;
+  for (u64 w = 0; w < words; ++w)
+  {
+    for (u64 word = filter->blocks_[w]; 0 != word; word &= word - 1)
+    {
+      ++set;
+    }
+  }
+  printf("[BLOOM INFO] Adress: %p\n", filter);
+  printf("[BLOOM INFO] Lenght: %u\n", filter->length_);
+  printf("[BLOOM INFO] Blocks: %u (%llu bytes)\n", filter->block_count_, (unsigned long long)BLOOM_memory(filter));
+  printf("[BLOOM INFO] Hashes: %d\n", filter->hashes_);
+  printf("[BLOOM INFO] Bits set: %llu of %llu\n", (unsigned long long)set, (unsigned long long)words * 64);
+  printf("\n");
+}
+
+CountingBloom *COUNTBLOOM_create(u32 keys, double false_positive_rate)
+{
+  if (0 == keys || !(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+  {
+    return NULL;
+  }
+  CountingBloom *filter = MM->malloc(sizeof(CountingBloom));
+  if (NULL == filter)
+  {
+    return NULL;
+  }
+  u32 counters_per_key = BLOOM_bitsPerKey(false_positive_rate);
+  filter->block_count_ = BLOOM_blocks(keys, counters_per_key, kBloomBlockCounters);
+  filter->hashes_ = BLOOM_hashes(counters_per_key);
+  filter->length_ = 0;
+  filter->counters_ = FILEMAP_pagesAlloc((u64)filter->block_count_ * CACHE_LINE_SIZE);
+  if (NULL == filter->counters_)
+  {
+    MM->free(filter);
+    return NULL;
+  }
+  filter->ops_ = &counting_bloom_ops;
+  return filter;
+}
+
+s16 COUNTBLOOM_destroy(CountingBloom *filter)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  FILEMAP_pagesFree(filter->counters_, (u64)filter->block_count_ * CACHE_LINE_SIZE);
+  MM->free(filter);
+  return kErrorCode_Ok;
+}
+
+s16 COUNTBLOOM_reset(CountingBloom *filter)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  memset(filter->counters_, 0, (u64)filter->block_count_ * CACHE_LINE_SIZE);
+  filter->length_ = 0;
+  return kErrorCode_Ok;
+}
+
+u32 COUNTBLOOM_length(CountingBloom *filter)
+{
+  if (NULL == filter)
+  {
+    return 0;
+  }
+  return filter->length_;
+}
+
+u64 COUNTBLOOM_memory(CountingBloom *filter)
+{
+  if (NULL == filter)
+  {
+    return 0;
+  }
+  return (u64)filter->block_count_ * CACHE_LINE_SIZE;
+}
+
+// Block of the counters of a key
+static u8 *COUNTBLOOM_block(CountingBloom *filter, u64 hash)
+{
+  return filter->counters_ + (u64)BLOOM_block(hash, filter->block_count_) * CACHE_LINE_SIZE;
+}
+
+static boolean COUNTBLOOM_check(CountingBloom *filter, u64 hash)
+{
+  const u8 *block = COUNTBLOOM_block(filter, hash);
+  for (u16 i = 0; i < filter->hashes_; ++i)
+  {
+    u32 c = BLOOM_slot(hash, i, kBloomCounterShift);
+    if (0 == ((block[c / 2] >> (c % 2 * 4)) & kBloomCounterMax))
+    {
+      return False;
+    }
+  }
+  return True;
+}
+
+s16 COUNTBLOOM_add(CountingBloom *filter, const void *data, u16 bytes)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_Null;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  u64 hash = BLOOM_hash(data, bytes);
+  u8 *block = COUNTBLOOM_block(filter, hash);
+  for (u16 i = 0; i < filter->hashes_; ++i)
+  {
+    u32 c = BLOOM_slot(hash, i, kBloomCounterShift);
+    u8 shift = (u8)(c % 2 * 4);
+    if (kBloomCounterMax != ((block[c / 2] >> shift) & kBloomCounterMax))
+    {
+      block[c / 2] += (u8)(1 << shift);
+    }
+  }
+  filter->length_++;
+  return kErrorCode_Ok;
+}
+
+boolean COUNTBLOOM_contains(CountingBloom *filter, const void *data, u16 bytes)
+{
+  if (NULL == filter || NULL == data || 0 == bytes)
+  {
+    return False;
+  }
+  return COUNTBLOOM_check(filter, BLOOM_hash(data, bytes));
+}
+
+s16 COUNTBLOOM_erase(CountingBloom *filter, const void *data, u16 bytes)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_Null;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  u64 hash = BLOOM_hash(data, bytes);
+  if (True != COUNTBLOOM_check(filter, hash))
+  {
+    return kErrorCode_KeyNotFound;
+  }
+  u8 *block = COUNTBLOOM_block(filter, hash);
+  for (u16 i = 0; i < filter->hashes_; ++i)
+  {
+    u32 c = BLOOM_slot(hash, i, kBloomCounterShift);
+    u8 shift = (u8)(c % 2 * 4);
+    // a saturated counter no longer knows how many keys it counts
+    if (kBloomCounterMax != ((block[c / 2] >> shift) & kBloomCounterMax))
+    {
+      block[c / 2] -= (u8)(1 << shift);
+    }
+  }
+  if (filter->length_ > 0)
+  {
+    filter->length_--;
+  }
+  return kErrorCode_Ok;
+}
+
+s16 COUNTBLOOM_addNode(CountingBloom *filter, MemoryNode *node)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (NULL == node)
+  {
+    return kErrorCode_Null;
+  }
+  return COUNTBLOOM_add(filter, node->data_, node->size_);
+}
+
+boolean COUNTBLOOM_containsNode(CountingBloom *filter, MemoryNode *node)
+{
+  if (NULL == node)
+  {
+    return False;
+  }
+  return COUNTBLOOM_contains(filter, node->data_, node->size_);
+}
+
+s16 COUNTBLOOM_eraseNode(CountingBloom *filter, MemoryNode *node)
+{
+  if (NULL == filter)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (NULL == node)
+  {
+    return kErrorCode_Null;
+  }
+  return COUNTBLOOM_erase(filter, node->data_, node->size_);
+}
+
+s16 COUNTBLOOM_merge(CountingBloom *filter, CountingBloom *other)
+{
+  if (NULL == filter || NULL == other)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (filter->block_count_ != other->block_count_ || filter->hashes_ != other->hashes_)
+  {
+    return kErrorCode_BloomShape;
+  }
+  u64 bytes = (u64)filter->block_count_ * CACHE_LINE_SIZE;
+  for (u64 i = 0; i < bytes; ++i)
+  {
+    u8 low = (filter->counters_[i] & kBloomCounterMax) + (other->counters_[i] & kBloomCounterMax);
+    u8 high = (filter->counters_[i] >> 4) + (other->counters_[i] >> 4);
+    low = low > kBloomCounterMax ? kBloomCounterMax : low;
+    high = high > kBloomCounterMax ? kBloomCounterMax : high;
+    filter->counters_[i] = (u8)(high << 4 | low);
+  }
+  filter->length_ += other->length_;
+  return kErrorCode_Ok;
+}
+
+s16 COUNTBLOOM_intersect(CountingBloom *filter, CountingBloom *other)
+{
+  if (NULL == filter || NULL == other)
+  {
+    return kErrorCode_BloomNull;
+  }
+  if (filter->block_count_ != other->block_count_ || filter->hashes_ != other->hashes_)
+  {
+    return kErrorCode_BloomShape;
+  }
+  u64 bytes = (u64)filter->block_count_ * CACHE_LINE_SIZE;
+  for (u64 i = 0; i < bytes; ++i)
+  {
+    u8 low = filter->counters_[i] & kBloomCounterMax;
+    u8 high = filter->counters_[i] >> 4;
+    u8 other_low = other->counters_[i] & kBloomCounterMax;
+    u8 other_high = other->counters_[i] >> 4;
+    low = other_low < low ? other_low : low;
+    high = other_high < high ? other_high : high;
+    filter->counters_[i] = (u8)(high << 4 | low);
+  }
+  if (other->length_ < filter->length_)
+  {
+    filter->length_ = other->length_;
+  }
+  return kErrorCode_Ok;
+}
+
+void COUNTBLOOM_print(CountingBloom *filter)
+{
+  if (NULL == filter)
+  {
+    return;
+  }
+  u64 bytes = (u64)filter->block_count_ * CACHE_LINE_SIZE;
+  u64 set = 0;
+  u64 saturated = 0;
+  for (u64 i = 0; i < bytes; ++i)
+  {
+    set += (0 != (filter->counters_[i] & kBloomCounterMax)) + (0 != (filter->counters_[i] >> 4));
+    saturated += (kBloomCounterMax == (filter->counters_[i] & kBloomCounterMax)) + (kBloomCounterMax == (filter->counters_[i] >> 4));
+  }
+  printf("[COUNTBLOOM INFO] Adress: %p\n", filter);
+  printf("[COUNTBLOOM INFO] Lenght: %u\n", filter->length_);
+  printf("[COUNTBLOOM INFO] Blocks: %u (%llu bytes)\n", filter->block_count_, (unsigned long long)bytes);
+  printf("[COUNTBLOOM INFO] Hashes: %d\n", filter->hashes_);
+  printf("[COUNTBLOOM INFO] Counters set: %llu of %llu, %llu saturated\n", (unsigned long long)set,
+         (unsigned long long)bytes * 2, (unsigned long long)saturated);
+  printf("\n");
+}
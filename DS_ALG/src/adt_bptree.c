@@ -0,0 +1,765 @@
+/**
+ * @file adt_bptree.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-19
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_bptree.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+// Arrays of a node
+#define NODE_KEY(tree, node, i) ((u8 *)((node) + 1) + (u32)(i) * (tree)->key_bytes_)
+#define LEAF_DATA(tree, node) ((void **)((u8 *)(node) + (tree)->leaf_data_offset_))
+#define LEAF_SIZE(tree, node) ((u16 *)((u8 *)(node) + (tree)->leaf_size_offset_))
+#define INNER_CHILD(tree, node) ((BPTreeNode **)((u8 *)(node) + (tree)->inner_child_offset_))
+
+static s16 BPTREE_destroy(BPTree *tree);
+static s16 BPTREE_softReset(BPTree *tree);
+static s16 BPTREE_reset(BPTree *tree);
+static u32 BPTREE_length(BPTree *tree);
+static boolean BPTREE_isEmpty(BPTree *tree);
+static s16 BPTREE_insert(BPTree *tree, const void *key, void *data, u16 bytes);
+static void *BPTREE_erase(BPTree *tree, const void *key);
+static void *BPTREE_find(BPTree *tree, const void *key);
+static s16 BPTREE_lowerBound(BPTree *tree, const void *key, BPTreeCursor *cursor);
+static s16 BPTREE_begin(BPTree *tree, BPTreeCursor *cursor);
+static s16 BPTREE_bulkLoad(BPTree *tree, Vector *sorted);
+static void BPTREE_print(BPTree *tree);
+
+struct bptree_ops_s bptree_ops = {
+    .destroy = BPTREE_destroy,
+    .softReset = BPTREE_softReset,
+    .reset = BPTREE_reset,
+    .length = BPTREE_length,
+    .isEmpty = BPTREE_isEmpty,
+    .insert = BPTREE_insert,
+    .erase = BPTREE_erase,
+    .find = BPTREE_find,
+    .lowerBound = BPTREE_lowerBound,
+    .begin = BPTREE_begin,
+    .bulkLoad = BPTREE_bulkLoad,
+    .print = BPTREE_print,
+};
+
+static s32 BPTREE_compareBytes(const void *a, const void *b, u16 bytes)
+{
+  return memcmp(a, b, bytes);
+}
+
+static u16 BPTREE_align(u32 offset)
+{
+  return (u16)((offset + sizeof(void *) - 1) & ~(u32)(sizeof(void *) - 1));
+}
+
+BPTree *BPTREE_create(u16 key_bytes, BPTreeCompare compare)
+{
+  if (0 == key_bytes || key_bytes > kBPTreeMaxKeyBytes)
+  {
+    return NULL;
+  }
+  BPTree *tree = MM->malloc(sizeof(BPTree));
+  if (NULL == tree)
+  {
+    return NULL;
+  }
+  tree->pool_ = POOL_create(kBPTreeNodeBytes, kBPTreeNodeBytes * kBPTreeSlabNodes);
+  if (NULL == tree->pool_)
+  {
+    MM->free(tree);
+    return NULL;
+  }
+  // The slots that fit after the header, leaving room for the alignment of
+  // the pointers, minus the one used while splitting
+  u32 room = kBPTreeNodeBytes - sizeof(BPTreeNode) - sizeof(void *);
+  u16 leaf_slots = (u16)(room / (key_bytes + sizeof(void *) + sizeof(u16)));
+  u16 inner_slots = (u16)((room - sizeof(void *)) / (key_bytes + sizeof(void *)));
+  tree->leaf_max_ = leaf_slots - 1;
+  tree->inner_max_ = inner_slots - 1;
+  tree->leaf_data_offset_ = BPTREE_align(sizeof(BPTreeNode) + (u32)leaf_slots * key_bytes);
+  tree->leaf_size_offset_ = tree->leaf_data_offset_ + leaf_slots * sizeof(void *);
+  tree->inner_child_offset_ = BPTREE_align(sizeof(BPTreeNode) + (u32)inner_slots * key_bytes);
+  tree->root_ = NULL;
+  tree->first_ = NULL;
+  tree->length_ = 0;
+  tree->key_bytes_ = key_bytes;
+  tree->height_ = 0;
+  tree->reserved_ = 0;
+  tree->reserve_ = NULL;
+  tree->compare_ = NULL == compare ? BPTREE_compareBytes : compare;
+  tree->ops_ = &bptree_ops;
+  return tree;
+}
+
+// Takes a node from the reserve filled by BPTREE_fillReserve
+static BPTreeNode *BPTREE_takeNode(BPTree *tree, boolean leaf)
+{
+  BPTreeNode *node = tree->reserve_;
+  tree->reserve_ = node->next_;
+  tree->reserved_--;
+  node->count_ = 0;
+  node->leaf_ = leaf;
+  node->next_ = NULL;
+  node->prev_ = NULL;
+  return node;
+}
+
+// An insertion splits at most one node per level and a new root
+static s16 BPTREE_fillReserve(BPTree *tree, u32 nodes)
+{
+  while (tree->reserved_ < nodes)
+  {
+    BPTreeNode *node = tree->pool_->ops_->alloc(tree->pool_);
+    if (NULL == node)
+    {
+      return kErrorCode_Memory;
+    }
+    node->next_ = tree->reserve_;
+    tree->reserve_ = node;
+    tree->reserved_++;
+  }
+  return kErrorCode_Ok;
+}
+
+// First position of a node whose key is not below key
+static u16 BPTREE_lowerIndex(BPTree *tree, BPTreeNode *node, const void *key)
+{
+  u16 low = 0;
+  u16 high = node->count_;
+  while (low < high)
+  {
+    u16 middle = (low + high) / 2;
+    if (tree->compare_(NODE_KEY(tree, node, middle), key, tree->key_bytes_) < 0)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// Child of an inner node whose subtree holds key: separators equal to the key go left
+static u16 BPTREE_childIndex(BPTree *tree, BPTreeNode *node, const void *key)
+{
+  u16 low = 0;
+  u16 high = node->count_;
+  while (low < high)
+  {
+    u16 middle = (low + high) / 2;
+    if (tree->compare_(NODE_KEY(tree, node, middle), key, tree->key_bytes_) <= 0)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+static BPTreeNode *BPTREE_findLeaf(BPTree *tree, const void *key)
+{
+  BPTreeNode *node = tree->root_;
+  while (NULL != node && !node->leaf_)
+  {
+    node = INNER_CHILD(tree, node)[BPTREE_childIndex(tree, node, key)];
+  }
+  return node;
+}
+
+// Moves count entries of a leaf from position from to position to
+static void BPTREE_moveEntries(BPTree *tree, BPTreeNode *dst, u16 to, BPTreeNode *src, u16 from, u16 count)
+{
+  memmove(NODE_KEY(tree, dst, to), NODE_KEY(tree, src, from), (u32)count * tree->key_bytes_);
+  memmove(LEAF_DATA(tree, dst) + to, LEAF_DATA(tree, src) + from, count * sizeof(void *));
+  memmove(LEAF_SIZE(tree, dst) + to, LEAF_SIZE(tree, src) + from, count * sizeof(u16));
+}
+
+// Moves count keys of an inner node, and the children at their right
+static void BPTREE_moveKeys(BPTree *tree, BPTreeNode *dst, u16 to, BPTreeNode *src, u16 from, u16 count)
+{
+  memmove(NODE_KEY(tree, dst, to), NODE_KEY(tree, src, from), (u32)count * tree->key_bytes_);
+  memmove(INNER_CHILD(tree, dst) + to + 1, INNER_CHILD(tree, src) + from + 1, count * sizeof(BPTreeNode *));
+}
+
+// Splits an overflowed leaf, the last leaf keeping leaf_max_ entries
+static BPTreeNode *BPTREE_splitLeaf(BPTree *tree, BPTreeNode *leaf, boolean append, u8 *separator)
+{
+  BPTreeNode *right = BPTREE_takeNode(tree, True);
+  u16 keep = True == append ? tree->leaf_max_ : leaf->count_ / 2;
+  right->count_ = leaf->count_ - keep;
+  BPTREE_moveEntries(tree, right, 0, leaf, keep, right->count_);
+  leaf->count_ = keep;
+  right->next_ = leaf->next_;
+  right->prev_ = leaf;
+  if (NULL != leaf->next_)
+  {
+    leaf->next_->prev_ = right;
+  }
+  leaf->next_ = right;
+  memcpy(separator, NODE_KEY(tree, right, 0), tree->key_bytes_);
+  return right;
+}
+
+// Splits an overflowed inner node, its middle key going up to the parent
+static BPTreeNode *BPTREE_splitInner(BPTree *tree, BPTreeNode *node, boolean append, u8 *separator)
+{
+  BPTreeNode *right = BPTREE_takeNode(tree, False);
+  // the last node of a level keeps all but one key, so the new one has two children
+  u16 middle = True == append ? node->count_ - 2 : node->count_ / 2;
+  right->count_ = node->count_ - middle - 1;
+  memcpy(separator, NODE_KEY(tree, node, middle), tree->key_bytes_);
+  INNER_CHILD(tree, right)[0] = INNER_CHILD(tree, node)[middle + 1];
+  BPTREE_moveKeys(tree, right, 0, node, middle + 1, right->count_);
+  node->count_ = middle;
+  return right;
+}
+
+// Inserts in the subtree of node. If node splits, returns its new right
+// sibling and separator receives the smallest key of the sibling
+static BPTreeNode *BPTREE_insertIn(BPTree *tree, BPTreeNode *node, const void *key, void *data, u16 bytes,
+                                   boolean rightmost, u8 *separator, s16 *error)
+{
+  if (node->leaf_)
+  {
+    u16 index = BPTREE_lowerIndex(tree, node, key);
+    if (index < node->count_ && 0 == tree->compare_(NODE_KEY(tree, node, index), key, tree->key_bytes_))
+    {
+      *error = kErrorCode_KeyExists;
+      return NULL;
+    }
+    BPTREE_moveEntries(tree, node, index + 1, node, index, node->count_ - index);
+    memcpy(NODE_KEY(tree, node, index), key, tree->key_bytes_);
+    LEAF_DATA(tree, node)[index] = data;
+    LEAF_SIZE(tree, node)[index] = bytes;
+    node->count_++;
+    *error = kErrorCode_Ok;
+    if (node->count_ <= tree->leaf_max_)
+    {
+      return NULL;
+    }
+    return BPTREE_splitLeaf(tree, node, NULL == node->next_ && index == node->count_ - 1, separator);
+  }
+
+  u16 index = BPTREE_childIndex(tree, node, key);
+  u8 child_separator[kBPTreeMaxKeyBytes];
+  rightmost = rightmost && index == node->count_;
+  BPTreeNode *split = BPTREE_insertIn(tree, INNER_CHILD(tree, node)[index], key, data, bytes,
+                                      rightmost, child_separator, error);
+  if (NULL == split)
+  {
+    return NULL;
+  }
+  BPTREE_moveKeys(tree, node, index + 1, node, index, node->count_ - index);
+  memcpy(NODE_KEY(tree, node, index), child_separator, tree->key_bytes_);
+  INNER_CHILD(tree, node)[index + 1] = split;
+  node->count_++;
+  if (node->count_ <= tree->inner_max_)
+  {
+    return NULL;
+  }
+  return BPTREE_splitInner(tree, node, rightmost, separator);
+}
+
+s16 BPTREE_insert(BPTree *tree, const void *key, void *data, u16 bytes)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_BPTreeNull;
+  }
+  if (NULL == key)
+  {
+    return kErrorCode_Null;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  if (kErrorCode_Ok != BPTREE_fillReserve(tree, tree->height_ + 1u))
+  {
+    return kErrorCode_Memory;
+  }
+  if (NULL == tree->root_)
+  {
+    tree->root_ = BPTREE_takeNode(tree, True);
+    tree->first_ = tree->root_;
+    tree->height_ = 1;
+  }
+  s16 error = kErrorCode_Ok;
+  u8 separator[kBPTreeMaxKeyBytes];
+  BPTreeNode *split = BPTREE_insertIn(tree, tree->root_, key, data, bytes, True, separator, &error);
+  if (NULL != split)
+  {
+    BPTreeNode *root = BPTREE_takeNode(tree, False);
+    root->count_ = 1;
+    memcpy(NODE_KEY(tree, root, 0), separator, tree->key_bytes_);
+    INNER_CHILD(tree, root)[0] = tree->root_;
+    INNER_CHILD(tree, root)[1] = split;
+    tree->root_ = root;
+    tree->height_++;
+  }
+  if (kErrorCode_Ok == error)
+  {
+    tree->length_++;
+  }
+  return error;
+}
+
+// Refills the child at index of an inner node, left below half full
+static void BPTREE_rebalance(BPTree *tree, BPTreeNode *node, u16 index)
+{
+  BPTreeNode **children = INNER_CHILD(tree, node);
+  BPTreeNode *child = children[index];
+  BPTreeNode *left = index > 0 ? children[index - 1] : NULL;
+  BPTreeNode *right = index < node->count_ ? children[index + 1] : NULL;
+  u16 minimum = child->leaf_ ? tree->leaf_max_ / 2 : tree->inner_max_ / 2;
+
+  if (NULL != left && left->count_ > minimum)
+  {
+    // the last entry of the left sibling becomes the first one of child
+    if (child->leaf_)
+    {
+      BPTREE_moveEntries(tree, child, 1, child, 0, child->count_);
+      BPTREE_moveEntries(tree, child, 0, left, left->count_ - 1, 1);
+      memcpy(NODE_KEY(tree, node, index - 1), NODE_KEY(tree, child, 0), tree->key_bytes_);
+    }
+    else
+    {
+      BPTREE_moveKeys(tree, child, 1, child, 0, child->count_);
+      INNER_CHILD(tree, child)[1] = INNER_CHILD(tree, child)[0];
+      memcpy(NODE_KEY(tree, child, 0), NODE_KEY(tree, node, index - 1), tree->key_bytes_);
+      INNER_CHILD(tree, child)[0] = INNER_CHILD(tree, left)[left->count_];
+      memcpy(NODE_KEY(tree, node, index - 1), NODE_KEY(tree, left, left->count_ - 1), tree->key_bytes_);
+    }
+    left->count_--;
+    child->count_++;
+    return;
+  }
+  if (NULL != right && right->count_ > minimum)
+  {
+    // the first entry of the right sibling becomes the last one of child
+    if (child->leaf_)
+    {
+      BPTREE_moveEntries(tree, child, child->count_, right, 0, 1);
+      BPTREE_moveEntries(tree, right, 0, right, 1, right->count_ - 1);
+      memcpy(NODE_KEY(tree, node, index), NODE_KEY(tree, right, 0), tree->key_bytes_);
+    }
+    else
+    {
+      memcpy(NODE_KEY(tree, child, child->count_), NODE_KEY(tree, node, index), tree->key_bytes_);
+      INNER_CHILD(tree, child)[child->count_ + 1] = INNER_CHILD(tree, right)[0];
+      memcpy(NODE_KEY(tree, node, index), NODE_KEY(tree, right, 0), tree->key_bytes_);
+      INNER_CHILD(tree, right)[0] = INNER_CHILD(tree, right)[1];
+      BPTREE_moveKeys(tree, right, 0, right, 1, right->count_ - 1);
+    }
+    right->count_--;
+    child->count_++;
+    return;
+  }
+
+  // both siblings at half: merge child with one of them, the right node into the left one
+  if (NULL != left)
+  {
+    right = child;
+    index--;
+  }
+  else
+  {
+    left = child;
+  }
+  if (NULL == right)
+  {
+    return;
+  }
+  if (left->leaf_)
+  {
+    BPTREE_moveEntries(tree, left, left->count_, right, 0, right->count_);
+    left->count_ += right->count_;
+    left->next_ = right->next_;
+    if (NULL != right->next_)
+    {
+      right->next_->prev_ = left;
+    }
+  }
+  else
+  {
+    memcpy(NODE_KEY(tree, left, left->count_), NODE_KEY(tree, node, index), tree->key_bytes_);
+    INNER_CHILD(tree, left)[left->count_ + 1] = INNER_CHILD(tree, right)[0];
+    BPTREE_moveKeys(tree, left, left->count_ + 1, right, 0, right->count_);
+    left->count_ += right->count_ + 1;
+  }
+  BPTREE_moveKeys(tree, node, index, node, index + 1, node->count_ - index - 1);
+  node->count_--;
+  tree->pool_->ops_->free(tree->pool_, right);
+}
+
+// Erases key from the subtree of node, returning its payload
+static void *BPTREE_eraseIn(BPTree *tree, BPTreeNode *node, const void *key)
+{
+  if (node->leaf_)
+  {
+    u16 index = BPTREE_lowerIndex(tree, node, key);
+    if (index >= node->count_ || 0 != tree->compare_(NODE_KEY(tree, node, index), key, tree->key_bytes_))
+    {
+      return NULL;
+    }
+    void *data = LEAF_DATA(tree, node)[index];
+    BPTREE_moveEntries(tree, node, index, node, index + 1, node->count_ - index - 1);
+    node->count_--;
+    return data;
+  }
+  u16 index = BPTREE_childIndex(tree, node, key);
+  BPTreeNode *child = INNER_CHILD(tree, node)[index];
+  void *data = BPTREE_eraseIn(tree, child, key);
+  if (NULL != data && child->count_ < (child->leaf_ ? tree->leaf_max_ / 2 : tree->inner_max_ / 2))
+  {
+    BPTREE_rebalance(tree, node, index);
+  }
+  return data;
+}
+
+void *BPTREE_erase(BPTree *tree, const void *key)
+{
+  if (NULL == tree || NULL == key || NULL == tree->root_)
+  {
+    return NULL;
+  }
+  void *data = BPTREE_eraseIn(tree, tree->root_, key);
+  if (NULL == data)
+  {
+    return NULL;
+  }
+  tree->length_--;
+  BPTreeNode *root = tree->root_;
+  if (0 == root->count_)
+  {
+    // an inner root left with one child gives its place to it, an empty leaf goes
+    tree->root_ = root->leaf_ ? NULL : INNER_CHILD(tree, root)[0];
+    tree->first_ = NULL == tree->root_ ? NULL : tree->first_;
+    tree->height_--;
+    tree->pool_->ops_->free(tree->pool_, root);
+  }
+  return data;
+}
+
+void *BPTREE_find(BPTree *tree, const void *key)
+{
+  if (NULL == tree || NULL == key)
+  {
+    return NULL;
+  }
+  BPTreeNode *leaf = BPTREE_findLeaf(tree, key);
+  if (NULL == leaf)
+  {
+    return NULL;
+  }
+  u16 index = BPTREE_lowerIndex(tree, leaf, key);
+  if (index >= leaf->count_ || 0 != tree->compare_(NODE_KEY(tree, leaf, index), key, tree->key_bytes_))
+  {
+    return NULL;
+  }
+  return LEAF_DATA(tree, leaf)[index];
+}
+
+s16 BPTREE_lowerBound(BPTree *tree, const void *key, BPTreeCursor *cursor)
+{
+  if (NULL != cursor)
+  {
+    cursor->leaf_ = NULL;
+    cursor->index_ = 0;
+    cursor->tree_ = tree;
+  }
+  if (NULL == tree)
+  {
+    return kErrorCode_BPTreeNull;
+  }
+  if (NULL == key || NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  BPTreeNode *leaf = BPTREE_findLeaf(tree, key);
+  if (NULL == leaf)
+  {
+    return kErrorCode_Ok;
+  }
+  u16 index = BPTREE_lowerIndex(tree, leaf, key);
+  // every key of the leaf is below: the bound is the first entry of the next one
+  if (index == leaf->count_)
+  {
+    leaf = leaf->next_;
+    index = 0;
+  }
+  cursor->leaf_ = leaf;
+  cursor->index_ = index;
+  return kErrorCode_Ok;
+}
+
+s16 BPTREE_begin(BPTree *tree, BPTreeCursor *cursor)
+{
+  if (NULL != cursor)
+  {
+    cursor->leaf_ = NULL;
+    cursor->index_ = 0;
+    cursor->tree_ = tree;
+  }
+  if (NULL == tree)
+  {
+    return kErrorCode_BPTreeNull;
+  }
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  cursor->leaf_ = tree->first_;
+  return kErrorCode_Ok;
+}
+
+// Smallest key of the subtree of node
+static const u8 *BPTREE_firstKey(BPTree *tree, BPTreeNode *node)
+{
+  while (!node->leaf_)
+  {
+    node = INNER_CHILD(tree, node)[0];
+  }
+  return NODE_KEY(tree, node, 0);
+}
+
+// Builds the level above the nodes chained through next_, returning its first node
+static BPTreeNode *BPTREE_buildLevel(BPTree *tree, BPTreeNode *first, u32 count, u32 *parents)
+{
+  u32 fanout = tree->inner_max_ + 1;
+  *parents = (count + fanout - 1) / fanout;
+  BPTreeNode *head = NULL;
+  BPTreeNode *previous = NULL;
+  BPTreeNode *child = first;
+  for (u32 p = 0; p < *parents; ++p)
+  {
+    BPTreeNode *parent = BPTREE_takeNode(tree, False);
+    // an even share of the children, the first parents taking the remainder
+    u32 children = count / *parents + (p < count % *parents ? 1 : 0);
+    for (u32 c = 0; c < children; ++c)
+    {
+      BPTreeNode *next = child->next_;
+      if (c > 0)
+      {
+        memcpy(NODE_KEY(tree, parent, c - 1), BPTREE_firstKey(tree, child), tree->key_bytes_);
+      }
+      INNER_CHILD(tree, parent)[c] = child;
+      // the leaves keep their links, the inner nodes only used them while building
+      if (!child->leaf_)
+      {
+        child->next_ = NULL;
+      }
+      child = next;
+    }
+    parent->count_ = (u16)(children - 1);
+    if (NULL == previous)
+    {
+      head = parent;
+    }
+    else
+    {
+      previous->next_ = parent;
+    }
+    previous = parent;
+  }
+  return head;
+}
+
+s16 BPTREE_bulkLoad(BPTree *tree, Vector *sorted)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_BPTreeNull;
+  }
+  if (NULL == sorted)
+  {
+    return kErrorCode_VectorNull;
+  }
+  if (0 != tree->length_)
+  {
+    return kErrorCode_KeyExists;
+  }
+  u32 count = sorted->tail_ - sorted->head_;
+  if (0 == count)
+  {
+    return kErrorCode_Ok;
+  }
+  MemoryNode *entries = sorted->storage_ + sorted->head_;
+  for (u32 i = 0; i < count; ++i)
+  {
+    if (NULL == entries[i].data_ || entries[i].size_ < tree->key_bytes_)
+    {
+      return kErrorCode_SizeMismatch;
+    }
+    if (i > 0 && tree->compare_(entries[i - 1].data_, entries[i].data_, tree->key_bytes_) >= 0)
+    {
+      return kErrorCode_KeyOrder;
+    }
+  }
+
+  // every node of every level is taken before the first one is written
+  u32 leaves = (count + tree->leaf_max_ - 1) / tree->leaf_max_;
+  u32 nodes = leaves;
+  for (u32 level = leaves; level > 1;)
+  {
+    level = (level + tree->inner_max_) / (tree->inner_max_ + 1);
+    nodes += level;
+  }
+  if (kErrorCode_Ok != BPTREE_fillReserve(tree, nodes))
+  {
+    return kErrorCode_Memory;
+  }
+
+  BPTreeNode *previous = NULL;
+  u32 entry = 0;
+  for (u32 l = 0; l < leaves; ++l)
+  {
+    BPTreeNode *leaf = BPTREE_takeNode(tree, True);
+    u16 fill = (u16)(count / leaves + (l < count % leaves ? 1 : 0));
+    for (u16 i = 0; i < fill; ++i, ++entry)
+    {
+      memcpy(NODE_KEY(tree, leaf, i), entries[entry].data_, tree->key_bytes_);
+      LEAF_DATA(tree, leaf)[i] = entries[entry].data_;
+      LEAF_SIZE(tree, leaf)[i] = entries[entry].size_;
+    }
+    leaf->count_ = fill;
+    leaf->prev_ = previous;
+    if (NULL == previous)
+    {
+      tree->first_ = leaf;
+    }
+    else
+    {
+      previous->next_ = leaf;
+    }
+    previous = leaf;
+  }
+  tree->root_ = tree->first_;
+  tree->height_ = 1;
+  for (u32 level = leaves; level > 1; tree->height_++)
+  {
+    tree->root_ = BPTREE_buildLevel(tree, tree->root_, level, &level);
+  }
+  tree->length_ = count;
+  sorted->ops_->softReset(sorted);
+  return kErrorCode_Ok;
+}
+
+// Empties the tree, the payloads freed or not
+static s16 BPTREE_empty(BPTree *tree, boolean free_data)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_BPTreeNull;
+  }
+  if (True == free_data)
+  {
+    for (BPTreeNode *leaf = tree->first_; NULL != leaf; leaf = leaf->next_)
+    {
+      for (u16 i = 0; i < leaf->count_; ++i)
+      {
+        MM->free(LEAF_DATA(tree, leaf)[i]);
+      }
+    }
+  }
+  tree->pool_->ops_->reset(tree->pool_);
+  tree->root_ = NULL;
+  tree->first_ = NULL;
+  tree->length_ = 0;
+  tree->height_ = 0;
+  tree->reserve_ = NULL;
+  tree->reserved_ = 0;
+  return kErrorCode_Ok;
+}
+
+s16 BPTREE_destroy(BPTree *tree)
+{
+  if (NULL == tree)
+  {
+    return kErrorCode_BPTreeNull;
+  }
+  BPTREE_empty(tree, True);
+  tree->pool_->ops_->destroy(tree->pool_);
+  MM->free(tree);
+  return kErrorCode_Ok;
+}
+
+s16 BPTREE_softReset(BPTree *tree)
+{
+  return BPTREE_empty(tree, False);
+}
+
+s16 BPTREE_reset(BPTree *tree)
+{
+  return BPTREE_empty(tree, True);
+}
+
+u32 BPTREE_length(BPTree *tree)
+{
+  if (NULL == tree)
+  {
+    return 0;
+  }
+  return tree->length_;
+}
+
+boolean BPTREE_isEmpty(BPTree *tree)
+{
+  if (NULL == tree)
+  {
+    return False;
+  }
+  return 0 == tree->length_ ? True : False;
+}
+
+void BPTREE_print(BPTree *tree)
+{
+  if (NULL == tree)
+  {
+    return;
+  }
+  printf("[BPTREE INFO] Adress: %p\n", tree);
+  printf("[BPTREE INFO] Lenght: %u\n", tree->length_);
+  printf("[BPTREE INFO] Height: %d\n", tree->height_);
+  printf("[BPTREE INFO] Key size: %d, %d entries per leaf, %d children per inner node\n",
+         tree->key_bytes_, tree->leaf_max_, tree->inner_max_ + 1);
+  printf("[BPTREE INFO] Nodes: %u\n", tree->pool_->ops_->live(tree->pool_) - tree->reserved_);
+  u32 position = 0;
+  for (BPTreeNode *leaf = tree->first_; NULL != leaf; leaf = leaf->next_)
+  {
+    for (u16 i = 0; i < leaf->count_; ++i, ++position)
+    {
+      printf(" [BPTREE INFO] Entry #%u\n", position);
+      printf("  [ENTRY INFO] Key:");
+      for (u16 j = 0; j < tree->key_bytes_; j++)
+      {
+        printf(" %02x", NODE_KEY(tree, leaf, i)[j]);
+      }
+      printf("\n");
+      printf("  [ENTRY INFO] Size: %d\n", LEAF_SIZE(tree, leaf)[i]);
+      printf("  [ENTRY INFO] Data content:");
+      for (u16 j = 0; j < LEAF_SIZE(tree, leaf)[i]; j++)
+      {
+        printf("%c", *((char *)LEAF_DATA(tree, leaf)[i] + j));
+      }
+      printf("\n");
+    }
+  }
+  printf("\n");
+}
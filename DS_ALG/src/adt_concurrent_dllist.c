@@ -0,0 +1,795 @@
+/**
+ * @file adt_concurrent_dllist.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-29
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_concurrent_dllist.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static MemoryNode* ConcurrentDLList_next(MemoryNode* node);
+static s16 ConcurrentDLList_setNext(MemoryNode* node, MemoryNode* next);
+static s16 ConcurrentDLList_destroy(DLList* list);
+static s16 ConcurrentDLList_reset(DLList* list);
+static s16 ConcurrentDLList_softReset(DLList* list);
+static s16 ConcurrentDLList_resize(DLList* list, u16 new_capacity);
+static u16 ConcurrentDLList_capacity(DLList* list);
+static u16 ConcurrentDLList_length(DLList* list);
+static boolean ConcurrentDLList_isEmpty(DLList* list);
+static boolean ConcurrentDLList_isFull(DLList* list);
+static void* ConcurrentDLList_first(DLList* list);
+static void* ConcurrentDLList_last(DLList* list);
+static void* ConcurrentDLList_at(DLList* list, u16 index);
+static s16 ConcurrentDLList_insertFirst(DLList* list, void* data, u16 size);
+static s16 ConcurrentDLList_insertLast(DLList* list, void* data, u16 size);
+static s16 ConcurrentDLList_insertAt(DLList* list, void* data, u16 size, u16 index);
+static void* ConcurrentDLList_extractFirst(DLList* list);
+static void* ConcurrentDLList_extractLast(DLList* list);
+static void* ConcurrentDLList_extractAt(DLList* list, u16 index);
+static s16 ConcurrentDLList_concat(DLList* list, DLList* other_list);
+static s16 ConcurrentDLList_traverse(DLList* list, void (*callback)(MemoryNode*));
+static s16 ConcurrentDLList_traverseEx(DLList* list, boolean (*callback)(MemoryNode*, void*), void* context);
+static s16 ConcurrentDLList_begin(DLList* list, Cursor* cursor);
+static s16 ConcurrentDLList_rbegin(DLList* list, Cursor* cursor);
+static s16 ConcurrentDLList_rotate(DLList* list, s16 n);
+static void ConcurrentDLList_print(DLList* list);
+
+// ConcurrentDLList's API Definitions, same surface as the DLList
+struct dllist_ops_s concurrent_dllist_ops = { .next = ConcurrentDLList_next,
+                                              .setNext = ConcurrentDLList_setNext,
+                                              .destroy = ConcurrentDLList_destroy,
+                                              .reset = ConcurrentDLList_reset,
+                                              .softReset = ConcurrentDLList_softReset,
+                                              .resize = ConcurrentDLList_resize,
+                                              .capacity = ConcurrentDLList_capacity,
+                                              .length = ConcurrentDLList_length,
+                                              .isEmpty = ConcurrentDLList_isEmpty,
+                                              .isFull = ConcurrentDLList_isFull,
+                                              .first = ConcurrentDLList_first,
+                                              .last = ConcurrentDLList_last,
+                                              .at = ConcurrentDLList_at,
+                                              .insertFirst = ConcurrentDLList_insertFirst,
+                                              .insertLast = ConcurrentDLList_insertLast,
+                                              .insertAt = ConcurrentDLList_insertAt,
+                                              .extractFirst = ConcurrentDLList_extractFirst,
+                                              .extractLast = ConcurrentDLList_extractLast,
+                                              .extractAt = ConcurrentDLList_extractAt,
+                                              .concat = ConcurrentDLList_concat,
+                                              .traverse = ConcurrentDLList_traverse,
+                                              .traverseEx = ConcurrentDLList_traverseEx,
+                                              .begin = ConcurrentDLList_begin,
+                                              .rbegin = ConcurrentDLList_rbegin,
+                                              .rotate = ConcurrentDLList_rotate,
+                                              // the sentinels end every walk: no round-robin cursor
+                                              .cycle = ConcurrentDLList_begin,
+                                              .print = ConcurrentDLList_print,
+};
+
+#define NODE_LOCK(node) mtx_lock(&((ConcurrentDLListNode*)(node))->lock_)
+#define NODE_TRYLOCK(node) (thrd_success == mtx_trylock(&((ConcurrentDLListNode*)(node))->lock_))
+#define NODE_UNLOCK(node) mtx_unlock(&((ConcurrentDLListNode*)(node))->lock_)
+
+static MemoryNode* ConcurrentDLList_newNode(void* data, u16 size)
+{
+    ConcurrentDLListNode* node = MM->malloc(sizeof(ConcurrentDLListNode));
+    if (NULL == node)
+    {
+        return NULL;
+    }
+    MEMNODE_createLite(&node->node_);
+    node->node_.data_ = data;
+    node->node_.size_ = size;
+    mtx_init(&node->lock_, mtx_plain);
+    return &node->node_;
+}
+
+static void ConcurrentDLList_freeNode(MemoryNode* node)
+{
+    mtx_destroy(&((ConcurrentDLListNode*)node)->lock_);
+    MM->free(node);
+}
+
+// Takes a slot of the capacity before linking a node
+static boolean ConcurrentDLList_reserve(ConcurrentDLList* clist)
+{
+    u16 length = atomic_load_explicit(&clist->length_, memory_order_relaxed);
+    do
+    {
+        if (length >= atomic_load_explicit(&clist->capacity_, memory_order_relaxed))
+        {
+            return False;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&clist->length_, &length, length + 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+    return True;
+}
+
+// Links node between prev and next, both locked by the caller
+static void ConcurrentDLList_link(MemoryNode* prev, MemoryNode* node, MemoryNode* next)
+{
+    node->prev_ = prev;
+    node->next_ = next;
+    prev->next_ = node;
+    next->prev_ = node;
+}
+
+// Unlinks node, locked by the caller with both neighbours; the caller frees it
+static void* ConcurrentDLList_unlink(ConcurrentDLList* clist, MemoryNode* node)
+{
+    void* data = node->data_;
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    atomic_fetch_sub_explicit(&clist->length_, 1, memory_order_relaxed);
+    return data;
+}
+
+// Hand-over-hand walk from the head: returns the node at index, locked,
+// or the last node (maybe the head sentinel) if the list is shorter
+static MemoryNode* ConcurrentDLList_lockAt(DLList* list, u16 index, boolean* found)
+{
+    MemoryNode* current = list->head_;
+    NODE_LOCK(current);
+    for (u32 i = 0; i <= index; i++)
+    {
+        MemoryNode* next = current->next_;
+        if (next == list->tail_)
+        {
+            *found = False;
+            return current;
+        }
+        NODE_LOCK(next);
+        NODE_UNLOCK(current);
+        current = next;
+    }
+    *found = True;
+    return current;
+}
+
+DLList* ConcurrentDLList_create(u16 capacity)
+{
+    if (0 == capacity)
+    {
+        return NULL;
+    }
+    ConcurrentDLList* clist = MM->malloc(sizeof(ConcurrentDLList));
+    if (NULL == clist)
+    {
+        return NULL;
+    }
+    clist->list_.head_ = ConcurrentDLList_newNode(NULL, 0);
+    clist->list_.tail_ = ConcurrentDLList_newNode(NULL, 0);
+    if (NULL == clist->list_.head_ || NULL == clist->list_.tail_)
+    {
+        if (NULL != clist->list_.head_)
+            ConcurrentDLList_freeNode(clist->list_.head_);
+        if (NULL != clist->list_.tail_)
+            ConcurrentDLList_freeNode(clist->list_.tail_);
+        MM->free(clist);
+        return NULL;
+    }
+    clist->list_.head_->next_ = clist->list_.tail_;
+    clist->list_.tail_->prev_ = clist->list_.head_;
+    clist->list_.length_ = 0;
+    clist->list_.capacity_ = capacity;
+    clist->list_.ops_ = &concurrent_dllist_ops;
+    atomic_init(&clist->length_, 0);
+    atomic_init(&clist->capacity_, capacity);
+    return &clist->list_;
+}
+
+MemoryNode* ConcurrentDLList_next(MemoryNode* node)
+{
+    if (NULL == node || NULL == node->next_)
+    {
+        return NULL;
+    }
+    // the sentinels are the only nodes without data
+    if (NULL == node->next_->data_)
+    {
+        return NULL;
+    }
+    return node->next_;
+}
+
+s16 ConcurrentDLList_setNext(MemoryNode* node, MemoryNode* next)
+{
+    if (NULL == node || NULL == next)
+    {
+        return kErrorCode_NodeNull;
+    }
+    node->next_ = next;
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_destroy(DLList* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    ConcurrentDLList_reset(list);
+    ConcurrentDLList_freeNode(list->head_);
+    ConcurrentDLList_freeNode(list->tail_);
+    MM->free(list);
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_reset(DLList* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    void* data;
+    while (NULL != (data = ConcurrentDLList_extractFirst(list)))
+    {
+        MM->free(data);
+    }
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_softReset(DLList* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    // frees the nodes, the payloads still belong to whoever inserted them
+    while (NULL != ConcurrentDLList_extractFirst(list));
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_resize(DLList* list, u16 new_capacity)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (0 == new_capacity)
+    {
+        return kErrorCode_InvalidIndex;
+    }
+    ConcurrentDLList* clist = (ConcurrentDLList*)list;
+    atomic_store_explicit(&clist->capacity_, new_capacity, memory_order_relaxed);
+    list->capacity_ = new_capacity;
+    // the elements that don't fit anymore are lost, as in the DLList
+    while (atomic_load_explicit(&clist->length_, memory_order_relaxed) > new_capacity)
+    {
+        void* data = ConcurrentDLList_extractLast(list);
+        if (NULL == data)
+        {
+            break;
+        }
+        MM->free(data);
+    }
+    return kErrorCode_Ok;
+}
+
+u16 ConcurrentDLList_capacity(DLList* list)
+{
+    if (NULL == list)
+    {
+        return 0;
+    }
+    return atomic_load_explicit(&((ConcurrentDLList*)list)->capacity_, memory_order_relaxed);
+}
+
+u16 ConcurrentDLList_length(DLList* list)
+{
+    if (NULL == list)
+    {
+        return 0;
+    }
+    return atomic_load_explicit(&((ConcurrentDLList*)list)->length_, memory_order_relaxed);
+}
+
+boolean ConcurrentDLList_isEmpty(DLList* list)
+{
+    return 0 == ConcurrentDLList_length(list);
+}
+
+boolean ConcurrentDLList_isFull(DLList* list)
+{
+    if (NULL == list)
+    {
+        return False;
+    }
+    return ConcurrentDLList_length(list) >= ConcurrentDLList_capacity(list);
+}
+
+void* ConcurrentDLList_first(DLList* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    NODE_LOCK(list->head_);
+    // NULL when next_ is the tail sentinel
+    void* data = list->head_->next_->data_;
+    NODE_UNLOCK(list->head_);
+    return data;
+}
+
+void* ConcurrentDLList_last(DLList* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    // nobody can free tail_->prev_ without locking tail_
+    NODE_LOCK(list->tail_);
+    void* data = list->tail_->prev_->data_;
+    NODE_UNLOCK(list->tail_);
+    return data;
+}
+
+void* ConcurrentDLList_at(DLList* list, u16 index)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    boolean found;
+    MemoryNode* node = ConcurrentDLList_lockAt(list, index, &found);
+    void* data = True == found ? node->data_ : NULL;
+    NODE_UNLOCK(node);
+    return data;
+}
+
+s16 ConcurrentDLList_insertFirst(DLList* list, void* data, u16 size)
+{
+    return ConcurrentDLList_insertAt(list, data, size, 0);
+}
+
+s16 ConcurrentDLList_insertLast(DLList* list, void* data, u16 size)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (NULL == data)
+    {
+        return kErrorCode_DataNull;
+    }
+    ConcurrentDLList* clist = (ConcurrentDLList*)list;
+    if (False == ConcurrentDLList_reserve(clist))
+    {
+        return kErrorCode_NotEnoughCapacity;
+    }
+    MemoryNode* node = ConcurrentDLList_newNode(data, size);
+    if (NULL == node)
+    {
+        atomic_fetch_sub_explicit(&clist->length_, 1, memory_order_relaxed);
+        return kErrorCode_NodeNull;
+    }
+    MemoryNode* prev;
+    for (;;)
+    {
+        NODE_LOCK(list->tail_);
+        prev = list->tail_->prev_;
+        // backwards against the lock order: only try, never wait
+        if (NODE_TRYLOCK(prev))
+        {
+            break;
+        }
+        NODE_UNLOCK(list->tail_);
+        thrd_yield();
+    }
+    ConcurrentDLList_link(prev, node, list->tail_);
+    NODE_UNLOCK(prev);
+    NODE_UNLOCK(list->tail_);
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_insertAt(DLList* list, void* data, u16 size, u16 index)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (NULL == data)
+    {
+        return kErrorCode_DataNull;
+    }
+    ConcurrentDLList* clist = (ConcurrentDLList*)list;
+    if (False == ConcurrentDLList_reserve(clist))
+    {
+        return kErrorCode_NotEnoughCapacity;
+    }
+    MemoryNode* node = ConcurrentDLList_newNode(data, size);
+    if (NULL == node)
+    {
+        atomic_fetch_sub_explicit(&clist->length_, 1, memory_order_relaxed);
+        return kErrorCode_NodeNull;
+    }
+    // the new node goes after the node at index - 1 (or the last one)
+    MemoryNode* prev = list->head_;
+    NODE_LOCK(prev);
+    if (0 != index)
+    {
+        boolean found;
+        NODE_UNLOCK(prev);
+        prev = ConcurrentDLList_lockAt(list, index - 1, &found);
+    }
+    MemoryNode* next = prev->next_;
+    NODE_LOCK(next);
+    ConcurrentDLList_link(prev, node, next);
+    NODE_UNLOCK(next);
+    NODE_UNLOCK(prev);
+    return kErrorCode_Ok;
+}
+
+void* ConcurrentDLList_extractFirst(DLList* list)
+{
+    return ConcurrentDLList_extractAt(list, 0);
+}
+
+void* ConcurrentDLList_extractLast(DLList* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    MemoryNode* node;
+    MemoryNode* prev;
+    for (;;)
+    {
+        NODE_LOCK(list->tail_);
+        node = list->tail_->prev_;
+        if (node == list->head_)
+        {
+            NODE_UNLOCK(list->tail_);
+            return NULL;
+        }
+        if (NODE_TRYLOCK(node))
+        {
+            // node->prev_ can't change while node is locked
+            prev = node->prev_;
+            if (NODE_TRYLOCK(prev))
+            {
+                break;
+            }
+            NODE_UNLOCK(node);
+        }
+        NODE_UNLOCK(list->tail_);
+        thrd_yield();
+    }
+    void* data = ConcurrentDLList_unlink((ConcurrentDLList*)list, node);
+    NODE_UNLOCK(prev);
+    NODE_UNLOCK(node);
+    NODE_UNLOCK(list->tail_);
+    ConcurrentDLList_freeNode(node);
+    return data;
+}
+
+void* ConcurrentDLList_extractAt(DLList* list, u16 index)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    MemoryNode* prev = list->head_;
+    NODE_LOCK(prev);
+    if (0 != index)
+    {
+        boolean found;
+        NODE_UNLOCK(prev);
+        prev = ConcurrentDLList_lockAt(list, index - 1, &found);
+        if (False == found)
+        {
+            NODE_UNLOCK(prev);
+            return NULL;
+        }
+    }
+    MemoryNode* node = prev->next_;
+    if (node == list->tail_)
+    {
+        NODE_UNLOCK(prev);
+        return NULL;
+    }
+    NODE_LOCK(node);
+    MemoryNode* next = node->next_;
+    NODE_LOCK(next);
+    void* data = ConcurrentDLList_unlink((ConcurrentDLList*)list, node);
+    NODE_UNLOCK(next);
+    NODE_UNLOCK(node);
+    NODE_UNLOCK(prev);
+    ConcurrentDLList_freeNode(node);
+    return data;
+}
+
+// Gives back the chain of copies of a concat that can't finish, with the
+// node and payload of the copy that failed
+static void ConcurrentDLList_freeCopies(MemoryNode* copies, MemoryNode* copy, u8* data)
+{
+    while (NULL != copies)
+    {
+        MemoryNode* next = copies->next_;
+        MM->free(copies->data_);
+        MM->free(copies);
+        copies = next;
+    }
+    if (NULL != copy)
+        MM->free(copy);
+    if (NULL != data)
+        MM->free(data);
+}
+
+// Appends a copy of the payload of node to the chain of copies, or gives
+// the whole chain back if it can't be allocated
+static s16 ConcurrentDLList_appendCopy(MemoryNode* node, MemoryNode** copies, MemoryNode** copies_tail)
+{
+    MemoryNode* copy = MEMNODE_create();
+    u8* data = MM->malloc(node->size_);
+    if (NULL == copy || NULL == data)
+    {
+        ConcurrentDLList_freeCopies(*copies, copy, data);
+        return kErrorCode_Memory;
+    }
+    memcpy(data, node->data_, node->size_);
+    copy->data_ = data;
+    copy->size_ = node->size_;
+    if (NULL == *copies)
+        *copies = copy;
+    else
+        (*copies_tail)->next_ = copy;
+    *copies_tail = copy;
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_concat(DLList* list, DLList* other_list)
+{
+    if (NULL == list || NULL == other_list)
+    {
+        return kErrorCode_ListNull;
+    }
+    // copy the payloads first and insert them afterwards, so no lock of
+    // other_list is held while list is locked (they may be the same list)
+    MemoryNode* copies = NULL;
+    MemoryNode* copies_tail = NULL;
+    if (&concurrent_dllist_ops == other_list->ops_)
+    {
+        MemoryNode* current = other_list->head_;
+        NODE_LOCK(current);
+        while (current->next_ != other_list->tail_)
+        {
+            MemoryNode* next = current->next_;
+            NODE_LOCK(next);
+            NODE_UNLOCK(current);
+            if (kErrorCode_Ok != ConcurrentDLList_appendCopy(next, &copies, &copies_tail))
+            {
+                NODE_UNLOCK(next);
+                return kErrorCode_Memory;
+            }
+            current = next;
+        }
+        NODE_UNLOCK(current);
+    }
+    else
+    {
+        // a plain DLList keeps its first element in head_ itself, and a
+        // circular one links its tail back to it: walk length nodes
+        u16 length = other_list->ops_->length(other_list);
+        MemoryNode* node = other_list->head_;
+        for (u16 i = 0; i < length && NULL != node; ++i, node = node->next_)
+        {
+            if (kErrorCode_Ok != ConcurrentDLList_appendCopy(node, &copies, &copies_tail))
+            {
+                return kErrorCode_Memory;
+            }
+        }
+    }
+
+    ConcurrentDLList* clist = (ConcurrentDLList*)list;
+    u16 capacity = atomic_fetch_add_explicit(&clist->capacity_, other_list->ops_->capacity(other_list),
+                                             memory_order_relaxed);
+    list->capacity_ = capacity + other_list->ops_->capacity(other_list);
+    while (NULL != copies)
+    {
+        MemoryNode* next = copies->next_;
+        s16 error = ConcurrentDLList_insertLast(list, copies->data_, copies->size_);
+        if (kErrorCode_Ok != error)
+        {
+            ConcurrentDLList_freeCopies(copies, NULL, NULL);
+            return error;
+        }
+        MM->free(copies);
+        copies = next;
+    }
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_traverse(DLList* list, void (*callback)(MemoryNode*))
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    MemoryNode* current = list->head_;
+    NODE_LOCK(current);
+    if (current->next_ == list->tail_)
+    {
+        NODE_UNLOCK(current);
+        return kErrorCode_StorageNull;
+    }
+    for (MemoryNode* next = current->next_; next != list->tail_; next = current->next_)
+    {
+        NODE_LOCK(next);
+        NODE_UNLOCK(current);
+        current = next;
+        callback(current);
+    }
+    NODE_UNLOCK(current);
+    return kErrorCode_Ok;
+}
+
+// Same hand-over-hand walk, the callback runs with its node locked
+s16 ConcurrentDLList_traverseEx(DLList* list, boolean (*callback)(MemoryNode*, void*), void* context)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (NULL == callback)
+    {
+        return kErrorCode_Null;
+    }
+    MemoryNode* current = list->head_;
+    NODE_LOCK(current);
+    for (MemoryNode* next = current->next_; next != list->tail_; next = current->next_)
+    {
+        NODE_LOCK(next);
+        NODE_UNLOCK(current);
+        current = next;
+        if (True != callback(current, context))
+        {
+            break;
+        }
+    }
+    NODE_UNLOCK(current);
+    return kErrorCode_Ok;
+}
+
+// Cursors take no locks: they skip the sentinels but are only safe while no
+// other thread inserts or extracts
+s16 ConcurrentDLList_begin(DLList* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, False);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (list->head_->next_ != list->tail_)
+    {
+        CURSOR_init(cursor, list->head_->next_, list->tail_->prev_, 0, False);
+    }
+    return kErrorCode_Ok;
+}
+
+s16 ConcurrentDLList_rbegin(DLList* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, True);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (list->head_->next_ != list->tail_)
+    {
+        CURSOR_init(cursor, list->tail_->prev_, list->head_->next_, 0, True);
+    }
+    return kErrorCode_Ok;
+}
+
+// Moves the first node behind the last one, without freeing it: it is
+// unlinked under the head locks and linked again under the tail locks. While
+// it is detached nobody else can reach it, so holding its lock in between
+// can't deadlock
+static void ConcurrentDLList_rotateOne(DLList* list)
+{
+    NODE_LOCK(list->head_);
+    MemoryNode* node = list->head_->next_;
+    if (node == list->tail_)
+    {
+        NODE_UNLOCK(list->head_);
+        return;
+    }
+    NODE_LOCK(node);
+    MemoryNode* next = node->next_;
+    if (next == list->tail_)
+    {
+        // a single node is already in place
+        NODE_UNLOCK(node);
+        NODE_UNLOCK(list->head_);
+        return;
+    }
+    NODE_LOCK(next);
+    list->head_->next_ = next;
+    next->prev_ = list->head_;
+    NODE_UNLOCK(next);
+    NODE_UNLOCK(list->head_);
+    MemoryNode* prev;
+    for (;;)
+    {
+        NODE_LOCK(list->tail_);
+        prev = list->tail_->prev_;
+        if (NODE_TRYLOCK(prev))
+        {
+            break;
+        }
+        NODE_UNLOCK(list->tail_);
+        thrd_yield();
+    }
+    ConcurrentDLList_link(prev, node, list->tail_);
+    NODE_UNLOCK(prev);
+    NODE_UNLOCK(list->tail_);
+    NODE_UNLOCK(node);
+}
+
+s16 ConcurrentDLList_rotate(DLList* list, s16 n)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    u16 length = ConcurrentDLList_length(list);
+    if (length < 2)
+    {
+        return kErrorCode_Ok;
+    }
+    // one node at a time, so other threads keep working in between
+    u16 steps = (u16)(((s32)n % length + length) % length);
+    for (u16 i = 0; i < steps; i++)
+    {
+        ConcurrentDLList_rotateOne(list);
+    }
+    return kErrorCode_Ok;
+}
+
+void ConcurrentDLList_print(DLList* list)
+{
+    if (NULL == list)
+    {
+        printf("\t[ConcurrentDLList Info] Address: NULL\n");
+        return;
+    }
+    printf("\t[ConcurrentDLList Info] Address: %p\n", list);
+    printf("\t[ConcurrentDLList Info] Length: %d\n", ConcurrentDLList_length(list));
+    printf("\t[ConcurrentDLList Info] Capacity: %d\n", ConcurrentDLList_capacity(list));
+    MemoryNode* current = list->head_;
+    NODE_LOCK(current);
+    u16 i = 0;
+    for (MemoryNode* next = current->next_; next != list->tail_; next = current->next_)
+    {
+        NODE_LOCK(next);
+        NODE_UNLOCK(current);
+        current = next;
+        printf("\t\t[ConcurrentDLList Info] Node #%d\n", i++);
+        printf("\t\t\t[Node Info] Address: %p\n", current);
+        printf("\t\t\t[Node Info] Size: %d\n", current->size_);
+        printf("\t\t\t[Node Info] Data Content: ");
+        u8* data_byte = current->data_;
+        for (u16 j = 0; j < current->size_; j++)
+        {
+            printf("%c", data_byte[j]);
+        }
+        printf("\n");
+    }
+    NODE_UNLOCK(current);
+}
@@ -0,0 +1,655 @@
+/**
+ * @file adt_deque.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-12
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_deque.h"
+#include "common_def.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+// Static prototipes
+static s16 DEQUE_destroy(Deque *deque);
+static s16 DEQUE_softReset(Deque *deque);
+static s16 DEQUE_reset(Deque *deque);
+static s16 DEQUE_resize(Deque *deque, u16 new_capacity);
+static u16 DEQUE_capacity(Deque *deque);
+static u16 DEQUE_length(Deque *deque);
+static boolean DEQUE_isEmpty(Deque *deque);
+static boolean DEQUE_isFull(Deque *deque);
+static void* DEQUE_first(Deque *deque);
+static void* DEQUE_last(Deque *deque);
+static void* DEQUE_at(Deque *deque, u16 position);
+static s16 DEQUE_insertFirst(Deque *deque, void *data, u16 bytes);
+static s16 DEQUE_insertLast(Deque *deque, void *data, u16 bytes);
+static s16 DEQUE_insertAt(Deque *deque, void *data, u16 bytes, u16 position);
+static void* DEQUE_extractFirst(Deque *deque);
+static void* DEQUE_extractLast(Deque *deque);
+static void* DEQUE_extractAt(Deque *deque, u16 position);
+static s16 DEQUE_concat(Deque *deque, Deque *deque_src);
+static s16 DEQUE_traverse(Deque *deque, void (*callback)(MemoryNode *));
+static s16 DEQUE_traverseEx(Deque *deque, boolean (*callback)(MemoryNode *, void *), void *context);
+static s16 DEQUE_begin(Deque *deque, Cursor *cursor);
+static void DEQUE_print(Deque *deque);
+
+// deque´s api definitions
+struct deque_ops_s deque_ops = {
+    .destroy = DEQUE_destroy,
+    .softReset = DEQUE_softReset,
+    .reset = DEQUE_reset,
+    .resize = DEQUE_resize,
+    .capacity = DEQUE_capacity,
+    .length = DEQUE_length,
+    .isEmpty = DEQUE_isEmpty,
+    .isFull = DEQUE_isFull,
+    .first = DEQUE_first,
+    .last = DEQUE_last,
+    .at = DEQUE_at,
+    .insertFirst = DEQUE_insertFirst,
+    .insertLast = DEQUE_insertLast,
+    .insertAt = DEQUE_insertAt,
+    .extractFirst = DEQUE_extractFirst,
+    .extractLast = DEQUE_extractLast,
+    .extractAt = DEQUE_extractAt,
+    .concat = DEQUE_concat,
+    .traverse = DEQUE_traverse,
+    .traverseEx = DEQUE_traverseEx,
+    .begin = DEQUE_begin,
+    .print = DEQUE_print,
+};
+
+// Node of the element at position, which must be below the length
+static MemoryNode *DEQUE_node(Deque *deque, u16 position)
+{
+  u32 index = (u32)deque->first_ + position;
+  u32 slot = ((u32)deque->block_first_ + (index >> kDequeBlockShift)) & (deque->map_capacity_ - 1);
+  return &deque->map_[slot][index & (kDequeBlockNodes - 1)];
+}
+
+// Returns the spare block, or a new one with its nodes initialized
+static MemoryNode *DEQUE_takeBlock(Deque *deque)
+{
+  MemoryNode *block = deque->spare_;
+  if (NULL != block)
+  {
+    deque->spare_ = NULL;
+    return block;
+  }
+  block = MM->malloc(sizeof(MemoryNode) * kDequeBlockNodes);
+  if (NULL == block)
+  {
+    return NULL;
+  }
+  for (u16 i = 0; i < kDequeBlockNodes; i++)
+  {
+    MEMNODE_createLite(&block[i]);
+  }
+  return block;
+}
+
+// Keeps the block as the spare one, so an end going back and forth over a
+// block boundary doesn't allocate on every crossing
+static void DEQUE_releaseBlock(Deque *deque, MemoryNode *block)
+{
+  if (NULL == deque->spare_)
+  {
+    deque->spare_ = block;
+  }
+  else
+  {
+    MM->free(block);
+  }
+}
+
+// Doubles the map, its blocks are moved to the first slots
+static s16 DEQUE_growMap(Deque *deque)
+{
+  u16 new_capacity = deque->map_capacity_ * 2;
+  MemoryNode **map = MM->malloc(sizeof(MemoryNode *) * new_capacity);
+  if (NULL == map)
+  {
+    return kErrorCode_Memory;
+  }
+  for (u16 i = 0; i < deque->blocks_; i++)
+  {
+    map[i] = deque->map_[(deque->block_first_ + i) & (deque->map_capacity_ - 1)];
+  }
+  MM->free(deque->map_);
+  deque->map_ = map;
+  deque->map_capacity_ = new_capacity;
+  deque->block_first_ = 0;
+  return kErrorCode_Ok;
+}
+
+// Common checks of the insertions
+static s16 DEQUE_checkInsert(Deque *deque, void *data, u16 bytes)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  if (deque->length_ >= deque->capacity_)
+  {
+    return kErrorCode_DequeFull;
+  }
+  return kErrorCode_Ok;
+}
+
+// Extracts every element, freeing their data or not, and releases the blocks
+static void DEQUE_empty(Deque *deque, boolean free_data)
+{
+  for (u16 i = 0; i < deque->length_; i++)
+  {
+    MemoryNode *node = DEQUE_node(deque, i);
+    if (True == free_data)
+    {
+      node->ops_->reset(node);
+    }
+    else
+    {
+      node->ops_->softReset(node);
+    }
+  }
+  for (u16 i = 0; i < deque->blocks_; i++)
+  {
+    DEQUE_releaseBlock(deque, deque->map_[(deque->block_first_ + i) & (deque->map_capacity_ - 1)]);
+  }
+  deque->first_ = 0;
+  deque->length_ = 0;
+  deque->block_first_ = 0;
+  deque->blocks_ = 0;
+}
+
+Deque* DEQUE_create(u16 capacity)
+{
+  if (0 == capacity)
+  {
+    return NULL;
+  }
+  Deque *deque = MM->malloc(sizeof(Deque));
+  if (NULL == deque)
+  {
+    return NULL;
+  }
+  deque->map_ = MM->malloc(sizeof(MemoryNode *) * kDequeMapInitial);
+  if (NULL == deque->map_)
+  {
+    MM->free(deque);
+    return NULL;
+  }
+  deque->first_ = 0;
+  deque->length_ = 0;
+  deque->capacity_ = capacity;
+  deque->block_first_ = 0;
+  deque->blocks_ = 0;
+  deque->map_capacity_ = kDequeMapInitial;
+  deque->spare_ = NULL;
+  deque->ops_ = &deque_ops;
+  return deque;
+}
+
+s16 DEQUE_destroy(Deque *deque)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL != deque->map_)
+  {
+    DEQUE_empty(deque, True);
+    MM->free(deque->map_);
+  }
+  if (NULL != deque->spare_)
+  {
+    MM->free(deque->spare_);
+  }
+  MM->free(deque);
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_softReset(Deque *deque)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  DEQUE_empty(deque, False);
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_reset(Deque *deque)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  DEQUE_empty(deque, True);
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_resize(Deque *deque, u16 new_capacity)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if (0 == new_capacity)
+  {
+    return kErrorCode_SizeZero;
+  }
+  while (deque->length_ > new_capacity)
+  {
+    MM->free(DEQUE_extractLast(deque));
+  }
+  deque->capacity_ = new_capacity;
+  return kErrorCode_Ok;
+}
+
+u16 DEQUE_capacity(Deque *deque)
+{
+  if (NULL == deque)
+  {
+    return 0;
+  }
+  return deque->capacity_;
+}
+
+u16 DEQUE_length(Deque *deque)
+{
+  if (NULL == deque)
+  {
+    return 0;
+  }
+  return deque->length_;
+}
+
+boolean DEQUE_isEmpty(Deque *deque)
+{
+  if (NULL != deque && 0 == deque->length_)
+  {
+    return True;
+  }
+  return False;
+}
+
+boolean DEQUE_isFull(Deque *deque)
+{
+  if (NULL != deque && deque->length_ >= deque->capacity_)
+  {
+    return True;
+  }
+  return False;
+}
+
+void *DEQUE_first(Deque *deque)
+{
+  if (NULL == deque || NULL == deque->map_ || 0 == deque->length_)
+  {
+    return NULL;
+  }
+  return DEQUE_node(deque, 0)->data_;
+}
+
+void *DEQUE_last(Deque *deque)
+{
+  if (NULL == deque || NULL == deque->map_ || 0 == deque->length_)
+  {
+    return NULL;
+  }
+  return DEQUE_node(deque, deque->length_ - 1)->data_;
+}
+
+void *DEQUE_at(Deque *deque, u16 position)
+{
+  if (NULL == deque || NULL == deque->map_ || position >= deque->length_)
+  {
+    return NULL;
+  }
+  return DEQUE_node(deque, position)->data_;
+}
+
+s16 DEQUE_insertFirst(Deque *deque, void *data, u16 bytes)
+{
+  s16 error = DEQUE_checkInsert(deque, data, bytes);
+  if (kErrorCode_Ok != error)
+  {
+    return error;
+  }
+  if (0 == deque->first_)
+  {
+    // the first block is full: a new one goes in the map slot before it
+    if (deque->blocks_ == deque->map_capacity_ && kErrorCode_Ok != DEQUE_growMap(deque))
+    {
+      return kErrorCode_Memory;
+    }
+    MemoryNode *block = DEQUE_takeBlock(deque);
+    if (NULL == block)
+    {
+      return kErrorCode_Memory;
+    }
+    deque->block_first_ = (deque->block_first_ + deque->map_capacity_ - 1) & (deque->map_capacity_ - 1);
+    deque->map_[deque->block_first_] = block;
+    deque->blocks_++;
+    deque->first_ = kDequeBlockNodes;
+  }
+  deque->first_--;
+  MemoryNode *node = DEQUE_node(deque, 0);
+  node->ops_->setData(node, data, bytes);
+  if (0 != deque->length_)
+  {
+    node->next_ = DEQUE_node(deque, 1);
+  }
+  deque->length_++;
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_insertLast(Deque *deque, void *data, u16 bytes)
+{
+  s16 error = DEQUE_checkInsert(deque, data, bytes);
+  if (kErrorCode_Ok != error)
+  {
+    return error;
+  }
+  if ((u32)deque->first_ + deque->length_ == (u32)deque->blocks_ << kDequeBlockShift)
+  {
+    // the last block is full: a new one goes in the map slot after it
+    if (deque->blocks_ == deque->map_capacity_ && kErrorCode_Ok != DEQUE_growMap(deque))
+    {
+      return kErrorCode_Memory;
+    }
+    MemoryNode *block = DEQUE_takeBlock(deque);
+    if (NULL == block)
+    {
+      return kErrorCode_Memory;
+    }
+    deque->map_[(deque->block_first_ + deque->blocks_) & (deque->map_capacity_ - 1)] = block;
+    deque->blocks_++;
+  }
+  MemoryNode *node = DEQUE_node(deque, deque->length_);
+  node->ops_->setData(node, data, bytes);
+  if (0 != deque->length_)
+  {
+    DEQUE_node(deque, deque->length_ - 1)->next_ = node;
+  }
+  deque->length_++;
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_insertAt(Deque *deque, void *data, u16 bytes, u16 position)
+{
+  s16 error = DEQUE_checkInsert(deque, data, bytes);
+  if (kErrorCode_Ok != error)
+  {
+    return error;
+  }
+  if (position >= deque->length_)
+  {
+    return DEQUE_insertLast(deque, data, bytes);
+  }
+  if (position < deque->length_ / 2)
+  {
+    // the first element is duplicated at the front, the ones before position move back
+    MemoryNode *first = DEQUE_node(deque, 0);
+    error = DEQUE_insertFirst(deque, first->data_, first->size_);
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    for (u16 i = 1; i < position; i++)
+    {
+      MemoryNode *next = DEQUE_node(deque, i + 1);
+      DEQUE_node(deque, i)->ops_->setData(DEQUE_node(deque, i), next->data_, next->size_);
+    }
+  }
+  else
+  {
+    // the last element is duplicated at the back, the ones after position move forward
+    MemoryNode *last = DEQUE_node(deque, deque->length_ - 1);
+    error = DEQUE_insertLast(deque, last->data_, last->size_);
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    for (u16 i = deque->length_ - 2; i > position; i--)
+    {
+      MemoryNode *prev = DEQUE_node(deque, i - 1);
+      DEQUE_node(deque, i)->ops_->setData(DEQUE_node(deque, i), prev->data_, prev->size_);
+    }
+  }
+  MemoryNode *node = DEQUE_node(deque, position);
+  node->ops_->setData(node, data, bytes);
+  return kErrorCode_Ok;
+}
+
+void *DEQUE_extractFirst(Deque *deque)
+{
+  if (NULL == deque || NULL == deque->map_ || 0 == deque->length_)
+  {
+    return NULL;
+  }
+  MemoryNode *node = DEQUE_node(deque, 0);
+  void *data = node->data_;
+  node->ops_->softReset(node);
+  deque->first_++;
+  deque->length_--;
+  if (kDequeBlockNodes == deque->first_)
+  {
+    DEQUE_releaseBlock(deque, deque->map_[deque->block_first_]);
+    deque->block_first_ = (deque->block_first_ + 1) & (deque->map_capacity_ - 1);
+    deque->blocks_--;
+    deque->first_ = 0;
+  }
+  return data;
+}
+
+void *DEQUE_extractLast(Deque *deque)
+{
+  if (NULL == deque || NULL == deque->map_ || 0 == deque->length_)
+  {
+    return NULL;
+  }
+  deque->length_--;
+  MemoryNode *node = DEQUE_node(deque, deque->length_);
+  void *data = node->data_;
+  node->ops_->softReset(node);
+  if ((u32)deque->first_ + deque->length_ == ((u32)deque->blocks_ - 1) << kDequeBlockShift)
+  {
+    // the last block is left empty
+    DEQUE_releaseBlock(deque, deque->map_[(deque->block_first_ + deque->blocks_ - 1) & (deque->map_capacity_ - 1)]);
+    deque->blocks_--;
+  }
+  return data;
+}
+
+void *DEQUE_extractAt(Deque *deque, u16 position)
+{
+  if (NULL == deque || NULL == deque->map_ || position >= deque->length_)
+  {
+    return NULL;
+  }
+  void *data = DEQUE_node(deque, position)->data_;
+  if (position < deque->length_ / 2)
+  {
+    for (u16 i = position; i > 0; i--)
+    {
+      MemoryNode *prev = DEQUE_node(deque, i - 1);
+      DEQUE_node(deque, i)->ops_->setData(DEQUE_node(deque, i), prev->data_, prev->size_);
+    }
+    DEQUE_extractFirst(deque);
+  }
+  else
+  {
+    for (u16 i = position; i < deque->length_ - 1; i++)
+    {
+      MemoryNode *next = DEQUE_node(deque, i + 1);
+      DEQUE_node(deque, i)->ops_->setData(DEQUE_node(deque, i), next->data_, next->size_);
+    }
+    DEQUE_extractLast(deque);
+  }
+  return data;
+}
+
+s16 DEQUE_concat(Deque *deque, Deque *deque_src)
+{
+  if (NULL == deque || NULL == deque_src)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_ || NULL == deque_src->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if ((u32)deque->capacity_ + deque_src->capacity_ > 0xFFFF)
+  {
+    return kErrorCode_NotEnoughCapacity;
+  }
+  deque->capacity_ += deque_src->capacity_;
+  // by length, deque_src may be deque itself
+  u16 length = deque_src->length_;
+  for (u16 i = 0; i < length; i++)
+  {
+    MemoryNode *src = DEQUE_node(deque_src, i);
+    void *copy = MM->malloc(src->size_);
+    if (NULL == copy)
+    {
+      return kErrorCode_Memory;
+    }
+    memcpy(copy, src->data_, src->size_);
+    s16 error = DEQUE_insertLast(deque, copy, src->size_);
+    if (kErrorCode_Ok != error)
+    {
+      MM->free(copy);
+      return error;
+    }
+  }
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_traverse(Deque *deque, void (*callback)(MemoryNode *))
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if (NULL == callback)
+  {
+    return kErrorCode_Null;
+  }
+  for (u16 i = 0; i < deque->length_; i++)
+  {
+    callback(DEQUE_node(deque, i));
+  }
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_traverseEx(Deque *deque, boolean (*callback)(MemoryNode *, void *), void *context)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if (NULL == callback)
+  {
+    return kErrorCode_Null;
+  }
+  for (u16 i = 0; i < deque->length_; i++)
+  {
+    if (True != callback(DEQUE_node(deque, i), context))
+    {
+      break;
+    }
+  }
+  return kErrorCode_Ok;
+}
+
+s16 DEQUE_begin(Deque *deque, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, False);
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == deque->map_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if (0 != deque->length_)
+  {
+    CURSOR_init(cursor, DEQUE_node(deque, 0), DEQUE_node(deque, deque->length_ - 1), 0, False);
+  }
+  return kErrorCode_Ok;
+}
+
+void DEQUE_print(Deque *deque)
+{
+  if (NULL == deque)
+  {
+    return;
+  }
+  printf("[DEQUE INFO] Adress: %p\n", deque);
+  printf("[DEQUE INFO] First: %d\n", deque->first_);
+  printf("[DEQUE INFO] Lenght: %d\n", deque->length_);
+  printf("[DEQUE INFO] Capacity: %d\n", deque->capacity_);
+  printf("[DEQUE INFO] Blocks: %d of %d map slots\n", deque->blocks_, deque->map_capacity_);
+  if (NULL == deque->map_)
+  {
+    return;
+  }
+  for (u16 i = 0; i < deque->length_; i++)
+  {
+    MemoryNode *node = DEQUE_node(deque, i);
+    printf(" [DEQUE INFO] Element #%d\n", i);
+    printf("  [NODE INFO] Adress: %p\n", node);
+    printf("  [NODE INFO] Size: %d\n", node->size_);
+    printf("  [NODE INFO] Data content:");
+    for (u16 j = 0; j < node->size_; j++)
+    {
+      printf("%c", *((char *)(node->data_) + j));
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
@@ -35,8 +35,27 @@ static void* DLList_extractLast(DLList* list);
 static void* DLList_extractAt(DLList* list, u16 index);
 static s16 DLList_concat(DLList* list, DLList* other_list);
 static s16 DLList_traverse(DLList* list, void (*callback)(MemoryNode*));
+static s16 DLList_traverseEx(DLList* list, boolean (*callback)(MemoryNode*, void*), void* context);
+static s16 DLList_begin(DLList* list, Cursor* cursor);
+static s16 DLList_rbegin(DLList* list, Cursor* cursor);
+static s16 DLList_rotate(DLList* list, s16 n);
+static s16 DLList_cycle(DLList* list, Cursor* cursor);
 static void DLList_print(DLList* list);
 
+static s16 DLList_circularDestroy(DLList* list);
+static s16 DLList_circularReset(DLList* list);
+static s16 DLList_circularResize(DLList* list, u16 new_capacity);
+static void* DLList_circularAt(DLList* list, u16 index);
+static s16 DLList_circularInsertFirst(DLList* list, void* data, u16 size);
+static s16 DLList_circularInsertLast(DLList* list, void* data, u16 size);
+static s16 DLList_circularInsertAt(DLList* list, void* data, u16 size, u16 index);
+static void* DLList_circularExtractFirst(DLList* list);
+static void* DLList_circularExtractLast(DLList* list);
+static void* DLList_circularExtractAt(DLList* list, u16 index);
+static s16 DLList_circularConcat(DLList* list, DLList* other_list);
+static s16 DLList_circularTraverse(DLList* list, void (*callback)(MemoryNode*));
+static s16 DLList_circularTraverseEx(DLList* list, boolean (*callback)(MemoryNode*, void*), void* context);
+
 // DLList's API Definitions
 struct dllist_ops_s dllist_ops = { .next = DLList_next,
                                              .destroy = DLList_destroy,
@@ -58,9 +77,65 @@ struct dllist_ops_s dllist_ops = { .next = DLList_next,
                                              .extractAt = DLList_extractAt,
                                              .concat = DLList_concat,
                                              .traverse = DLList_traverse,
+                                             .traverseEx = DLList_traverseEx,
+                                             .begin = DLList_begin,
+                                             .rbegin = DLList_rbegin,
+                                             .rotate = DLList_rotate,
+                                             .cycle = DLList_cycle,
+                                             .print = DLList_print,
+};
+
+// Circular DLLists: the tail links back to the head and the head to the
+// tail. The ops that walk or relink the nodes open the ring, reuse the ones
+// above and close it again
+struct dllist_ops_s dllist_circular_ops = { .next = DLList_next,
+                                             .destroy = DLList_circularDestroy,
+                                             .reset = DLList_circularReset,
+                                             .softReset = DLList_circularReset,
+                                             .resize = DLList_circularResize,
+                                             .capacity = DLList_capacity,
+                                             .length = DLList_lenght,
+                                             .isEmpty = DLList_isEmpty,
+                                             .isFull = DLList_isFull,
+                                             .first = DLList_first,
+                                             .last = DLList_last,
+                                             .at = DLList_circularAt,
+                                             .insertFirst = DLList_circularInsertFirst,
+                                             .insertLast = DLList_circularInsertLast,
+                                             .insertAt = DLList_circularInsertAt,
+                                             .extractFirst = DLList_circularExtractFirst,
+                                             .extractLast = DLList_circularExtractLast,
+                                             .extractAt = DLList_circularExtractAt,
+                                             .concat = DLList_circularConcat,
+                                             .traverse = DLList_circularTraverse,
+                                             .traverseEx = DLList_circularTraverseEx,
+                                             .begin = DLList_begin,
+                                             .rbegin = DLList_rbegin,
+                                             .rotate = DLList_rotate,
+                                             .cycle = DLList_cycle,
                                              .print = DLList_print,
 };
 
+// Links the ends to each other in a circular DLList, or to NULL otherwise
+static void DLList_close(DLList* list)
+{
+    if (NULL != list->tail_)
+    {
+        boolean circular = &dllist_circular_ops == list->ops_;
+        list->tail_->next_ = True == circular ? list->head_ : NULL;
+        list->head_->prev_ = True == circular ? list->tail_ : NULL;
+    }
+}
+
+static void DLList_open(DLList* list)
+{
+    if (NULL != list->tail_)
+    {
+        list->tail_->next_ = NULL;
+        list->head_->prev_ = NULL;
+    }
+}
+
 DLList* DLList_create(u16 capacity)
 {
     if (0 >= capacity)
@@ -82,6 +157,16 @@ DLList* DLList_create(u16 capacity)
 
 }
 
+DLList* DLList_createCircular(u16 capacity)
+{
+    DLList* list_ = DLList_create(capacity);
+    if (NULL != list_)
+    {
+        list_->ops_ = &dllist_circular_ops;
+    }
+    return list_;
+}
+
 MemoryNode* DLList_next(MemoryNode* node)
 {
     if (NULL == node)
@@ -99,29 +184,7 @@ s16 DLList_destroy(DLList* list) {
         return kErrorCode_ListNull;
     }
 
-    if (DLList_isEmpty(list))
-    {
-        //MM->free(list->head_);
-        //MM->free(list->tail_);
-        MM->free(list);
-
-        return kErrorCode_Ok;
-    }
-
-    MemoryNode* aux = list->head_;
-    MemoryNode* aux_next = aux->next_;
-    while (NULL != aux)
-    {
-        //aux->ops_->free(aux->data_);
-       // aux->ops_->free(aux);
-        aux = aux_next;
-        if (NULL != aux) {
-            aux_next = aux->next_;
-        }
-    }
-
-    MM->free(list->head_);
-    MM->free(list->tail_);
+    DLList_reset(list);
     MM->free(list);
 
     return kErrorCode_Ok;
@@ -203,21 +266,23 @@ s16 DLList_resize(DLList* list, u16 new_capacity)
     list->length_ = list->capacity_;
     MemoryNode* current_node = list->head_;
 
-    for (u16 i = 0; i < list->capacity_; i++)
+    // the nodes after the new capacity are lost
+    for (u16 i = 1; i < list->capacity_; i++)
     {
         current_node = current_node->next_;
     }
     list->tail_ = current_node;
+    current_node = current_node->next_;
     list->tail_->next_ = NULL;
-  
-    MemoryNode* aux = current_node->next_;
-    for (aux; NULL != aux; aux->next_)
+
+    while (NULL != current_node)
     {
-        current_node->ops_->free(current_node);
+        MemoryNode* aux = current_node->next_;
+        MM->free(current_node->data_);
+        MM->free(current_node);
         current_node = aux;
-        aux = aux->next_;
     }
-    
+
     return kErrorCode_Ok;
 }
 
@@ -358,6 +423,7 @@ s16 DLList_insertFirst(DLList* list, void* data, u16 size)
     {
         //check if have enought capacity
         node->next_ = list->head_;
+        list->head_->prev_ = node;
         list->head_ = node;
         list->length_++;
     }
@@ -423,29 +489,26 @@ s16 DLList_insertAt(DLList* list, void* data, u16 size, u16 index)
     {
         return DLList_insertLast(list, data, size);
     }
-    MemoryNode* node = MEMNODE_create();
-    if (NULL == node)
-    {
-        return kErrorCode_NodeNull;
-    }
-    node->ops_->setData(node, data, size);
-    node->next_ = NULL;
-    node->prev_ = NULL;
     // insert first
     if (index == 0)
     {
-        return DLList_insertFirst(list, node->data_, node->size_);
+        return DLList_insertFirst(list, data, size);
     }
     // insert last
     if (index >= list->length_)
     {
-        return DLList_insertLast(list, node->data_, node->size_);
+        return DLList_insertLast(list, data, size);
     }
-    u16 mid = list->length_/2;
-    MemoryNode* current_node = MEMNODE_create();
-    if(NULL == current_node){
-        return kErrorCode_Null;
+    MemoryNode* node = MEMNODE_create();
+    if (NULL == node)
+    {
+        return kErrorCode_NodeNull;
     }
+    node->ops_->setData(node, data, size);
+    node->next_ = NULL;
+    node->prev_ = NULL;
+    u16 mid = list->length_/2;
+    MemoryNode* current_node;
     if(index <= mid){
         // Insert node in index
         current_node = list->head_;
@@ -456,7 +519,8 @@ s16 DLList_insertAt(DLList* list, void* data, u16 size, u16 index)
     }else{
         current_node = list->tail_;
       
-        for (u16 i = list->length_ - 1; i > index; i--)
+        // stop at index - 1, the new node goes after it
+        for (u16 i = list->length_ - 1; i >= index; i--)
         {
             current_node = current_node->prev_;
         }
@@ -488,9 +552,19 @@ void* DLList_extractFirst(DLList* list)
     }
 
     MemoryNode* node_to_extract = list->head_;
+    void* data = node_to_extract->data_;
     list->head_ = list->head_->next_;
     list->length_--;
-    return node_to_extract->data_;
+    if (NULL == list->head_)
+    {
+        list->tail_ = NULL;
+    }
+    else
+    {
+        list->head_->prev_ = NULL;
+    }
+    MM->free(node_to_extract);
+    return data;
 }
 
 void* DLList_extractLast(DLList* list)
@@ -507,23 +581,22 @@ void* DLList_extractLast(DLList* list)
     }
 
     MemoryNode* last_node = list->tail_;
-    MemoryNode* aux = list->head_;
+    void* data = last_node->data_;
 
-    while (aux->next_ != last_node && aux != last_node)
-    {
-        aux = aux->next_;
-    }
-
-    list->tail_ = aux;
-    list->tail_->next_ = NULL;
+    list->tail_ = last_node->prev_;
     list->length_--;
     if (DLList_isEmpty(list))
     {
         list->head_ = NULL;
         list->tail_ = NULL;
     }
+    else
+    {
+        list->tail_->next_ = NULL;
+    }
+    MM->free(last_node);
 
-    return last_node->data_;
+    return data;
 }
 
 
@@ -545,22 +618,22 @@ void* DLList_extractAt(DLList* list, u16 index)
     {
         return DLList_extractFirst(list);
     }
-    if (index == list->length_)
+    if (index == list->length_ - 1)
     {
         return DLList_extractLast(list);
     }
-     MemoryNode* node = MEMNODE_create();
-    if (NULL == node) return kErrorCode_DataNull;
     MemoryNode* aux = list->head_;
     for (u16 i = 0; i < index - 1; i++)
     {
         aux = aux->next_;
     }
-    node = aux->next_;
-    aux->next_ = aux->next_->next_;
+    MemoryNode* node = aux->next_;
+    void* data = node->data_;
+    aux->next_ = node->next_;
     aux->next_->prev_ = aux;
     list->length_--;
-    return node->data_;
+    MM->free(node);
+    return data;
 
  /*   if (NULL == list)
     {
@@ -629,7 +702,8 @@ s16 DLList_concat(DLList* list, DLList* next_list)
 
     MemoryNode* current_list = next_list->head_;
 
-    while (NULL != current_list) {
+    // walked by length, the source may be circular
+    for (u16 i = 0; i < next_list->length_; i++) {
 
         MemoryNode* new_node = MM->malloc(sizeof(MemoryNode));
         if (new_node == NULL) {
@@ -652,11 +726,13 @@ s16 DLList_concat(DLList* list, DLList* next_list)
         new_node->next_ = NULL;
 
         if (NULL == list->head_) {
+            new_node->prev_ = NULL;
             list->head_ = new_node;
             list->tail_ = new_node;
         }
         else {
             
+            new_node->prev_ = list->tail_;
             list->tail_->next_ = new_node;
             list->tail_ = new_node;
         }
@@ -692,6 +768,260 @@ s16 DLList_traverse(DLList* list, void(*callback)(MemoryNode*))
     return kErrorCode_Ok;
 }
 
+s16 DLList_traverseEx(DLList* list, boolean (*callback)(MemoryNode*, void*), void* context)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (NULL == callback)
+    {
+        return kErrorCode_Null;
+    }
+    MemoryNode* current_node = list->head_;
+    while (NULL != current_node && True == callback(current_node, context))
+    {
+        current_node = current_node->next_;
+    }
+
+    return kErrorCode_Ok;
+}
+
+s16 DLList_begin(DLList* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, False);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    CURSOR_init(cursor, list->head_, list->tail_, 0, False);
+
+    return kErrorCode_Ok;
+}
+
+s16 DLList_rbegin(DLList* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, True);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    CURSOR_init(cursor, list->tail_, list->head_, 0, True);
+
+    return kErrorCode_Ok;
+}
+
+s16 DLList_rotate(DLList* list, s16 n)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (list->length_ < 2)
+    {
+        return kErrorCode_Ok;
+    }
+    u16 steps = (u16)(((s32)n % list->length_ + list->length_) % list->length_);
+    if (0 == steps)
+    {
+        return kErrorCode_Ok;
+    }
+    list->tail_->next_ = list->head_;
+    list->head_->prev_ = list->tail_;
+    // the shorter way round the ring
+    if (steps <= list->length_ / 2)
+    {
+        for (u16 i = 0; i < steps; i++)
+        {
+            list->head_ = list->head_->next_;
+        }
+    }
+    else
+    {
+        for (u16 i = steps; i < list->length_; i++)
+        {
+            list->head_ = list->head_->prev_;
+        }
+    }
+    list->tail_ = list->head_->prev_;
+    DLList_close(list);
+
+    return kErrorCode_Ok;
+}
+
+s16 DLList_cycle(DLList* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, False);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    // without a last node the cursor follows next_ round the ring
+    CURSOR_init(cursor, list->head_, &dllist_circular_ops == list->ops_ ? NULL : list->tail_, 0, False);
+
+    return kErrorCode_Ok;
+}
+
+s16 DLList_circularDestroy(DLList* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    return DLList_destroy(list);
+}
+
+s16 DLList_circularReset(DLList* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    return DLList_reset(list);
+}
+
+s16 DLList_circularResize(DLList* list, u16 new_capacity)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_resize(list, new_capacity);
+    DLList_close(list);
+    return error;
+}
+
+void* DLList_circularAt(DLList* list, u16 index)
+{
+    if (NULL == list || index >= list->length_)
+    {
+        return NULL;
+    }
+    return DLList_at(list, index);
+}
+
+s16 DLList_circularInsertFirst(DLList* list, void* data, u16 size)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_insertFirst(list, data, size);
+    DLList_close(list);
+    return error;
+}
+
+s16 DLList_circularInsertLast(DLList* list, void* data, u16 size)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_insertLast(list, data, size);
+    DLList_close(list);
+    return error;
+}
+
+s16 DLList_circularInsertAt(DLList* list, void* data, u16 size, u16 index)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_insertAt(list, data, size, index);
+    DLList_close(list);
+    return error;
+}
+
+void* DLList_circularExtractFirst(DLList* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    DLList_open(list);
+    void* data = DLList_extractFirst(list);
+    DLList_close(list);
+    return data;
+}
+
+void* DLList_circularExtractLast(DLList* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    DLList_open(list);
+    void* data = DLList_extractLast(list);
+    DLList_close(list);
+    return data;
+}
+
+void* DLList_circularExtractAt(DLList* list, u16 index)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    DLList_open(list);
+    void* data = DLList_extractAt(list, index);
+    DLList_close(list);
+    return data;
+}
+
+s16 DLList_circularConcat(DLList* list, DLList* other_list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_concat(list, other_list);
+    DLList_close(list);
+    return error;
+}
+
+s16 DLList_circularTraverse(DLList* list, void (*callback)(MemoryNode*))
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_traverse(list, callback);
+    DLList_close(list);
+    return error;
+}
+
+s16 DLList_circularTraverseEx(DLList* list, boolean (*callback)(MemoryNode*, void*), void* context)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    DLList_open(list);
+    s16 error = DLList_traverseEx(list, callback, context);
+    DLList_close(list);
+    return error;
+}
 
 void DLList_print(DLList* list)
 {
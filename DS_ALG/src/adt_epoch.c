@@ -0,0 +1,380 @@
+/**
+ * @file adt_epoch.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-15
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "common_def.h"
+#include "adt_epoch.h"
+#include "aligned_memory.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 EPOCH_destroy(EpochDomain *domain);
+static EpochRecord *EPOCH_registerThread(EpochDomain *domain);
+static s16 EPOCH_unregisterThread(EpochRecord *record);
+static s16 EPOCH_pin(EpochRecord *record);
+static s16 EPOCH_unpin(EpochRecord *record);
+static s16 EPOCH_retire(EpochRecord *record, void *ptr, void (*free_fn)(void *ptr));
+static boolean EPOCH_tryAdvance(EpochDomain *domain);
+static u32 EPOCH_collect(EpochRecord *record);
+static u32 EPOCH_epoch(EpochDomain *domain);
+static u32 EPOCH_pending(EpochRecord *record);
+static void EPOCH_print(EpochDomain *domain);
+
+static u32 EPOCH_freeBucket(EpochRecord *record, EpochBucket *bucket);
+
+struct epoch_ops_s epoch_ops = {
+    .destroy = EPOCH_destroy,
+    .registerThread = EPOCH_registerThread,
+    .unregisterThread = EPOCH_unregisterThread,
+    .pin = EPOCH_pin,
+    .unpin = EPOCH_unpin,
+    .retire = EPOCH_retire,
+    .tryAdvance = EPOCH_tryAdvance,
+    .collect = EPOCH_collect,
+    .epoch = EPOCH_epoch,
+    .pending = EPOCH_pending,
+    .print = EPOCH_print,
+};
+
+#define EPOCH_PINNED(epoch) (((epoch) << 1) | 1)
+#define EPOCH_IS_PINNED(state) (0 != ((state) & 1))
+#define EPOCH_OF(state) ((state) >> 1)
+
+static void EPOCH_freeWithMM(void *ptr)
+{
+  MM->free(ptr);
+}
+
+EpochDomain *EPOCH_create(u16 batch_size)
+{
+  if (0 == batch_size)
+  {
+    return NULL;
+  }
+  EpochDomain *domain = ALIGNED_malloc(sizeof(EpochDomain));
+  if (NULL == domain)
+  {
+    return NULL;
+  }
+  atomic_init(&domain->epoch_, 0);
+  atomic_init(&domain->records_, NULL);
+  atomic_init(&domain->freed_, 0);
+  domain->batch_size_ = batch_size;
+  domain->ops_ = &epoch_ops;
+  return domain;
+}
+
+s16 EPOCH_destroy(EpochDomain *domain)
+{
+  if (NULL == domain)
+  {
+    return kErrorCode_EpochNull;
+  }
+  EpochRecord *record = atomic_load_explicit(&domain->records_, memory_order_acquire);
+  while (NULL != record)
+  {
+    EpochRecord *next = atomic_load_explicit(&record->next_, memory_order_relaxed);
+    // no thread is left: every pending pointer can go
+    for (u16 i = 0; i < 3; i++)
+    {
+      EPOCH_freeBucket(record, &record->buckets_[i]);
+    }
+    while (NULL != record->free_chunks_)
+    {
+      EpochChunk *chunk = record->free_chunks_;
+      record->free_chunks_ = chunk->next_;
+      MM->free(chunk);
+    }
+    ALIGNED_free(record);
+    record = next;
+  }
+  ALIGNED_free(domain);
+  return kErrorCode_Ok;
+}
+
+EpochRecord *EPOCH_registerThread(EpochDomain *domain)
+{
+  if (NULL == domain)
+  {
+    return NULL;
+  }
+  EpochRecord *record = atomic_load_explicit(&domain->records_, memory_order_acquire);
+  for (; NULL != record; record = atomic_load_explicit(&record->next_, memory_order_acquire))
+  {
+    boolean expected = False;
+    if (False == atomic_load_explicit(&record->in_use_, memory_order_relaxed) &&
+        atomic_compare_exchange_strong_explicit(&record->in_use_, &expected, True,
+                                                memory_order_acquire, memory_order_relaxed))
+    {
+      return record;
+    }
+  }
+
+  record = ALIGNED_malloc(sizeof(EpochRecord));
+  if (NULL == record)
+  {
+    return NULL;
+  }
+  atomic_init(&record->state_, 0);
+  atomic_init(&record->in_use_, True);
+  record->domain_ = domain;
+  record->pin_depth_ = 0;
+  record->pending_ = 0;
+  record->retired_since_collect_ = 0;
+  for (u16 i = 0; i < 3; i++)
+  {
+    record->buckets_[i].epoch_ = 0;
+    record->buckets_[i].count_ = 0;
+    record->buckets_[i].chunks_ = NULL;
+  }
+  record->free_chunks_ = NULL;
+  // records are only ever prepended, readers walk the list without locks
+  EpochRecord *head = atomic_load_explicit(&domain->records_, memory_order_relaxed);
+  do
+  {
+    atomic_init(&record->next_, head);
+  } while (!atomic_compare_exchange_weak_explicit(&domain->records_, &head, record,
+                                                  memory_order_release, memory_order_relaxed));
+  return record;
+}
+
+s16 EPOCH_unregisterThread(EpochRecord *record)
+{
+  if (NULL == record)
+  {
+    return kErrorCode_EpochNull;
+  }
+  if (0 != record->pin_depth_)
+  {
+    return kErrorCode_EpochPinned;
+  }
+  while (0 != record->pending_)
+  {
+    EPOCH_tryAdvance(record->domain_);
+    if (0 == EPOCH_collect(record))
+    {
+      thrd_yield();
+    }
+  }
+  atomic_store_explicit(&record->in_use_, False, memory_order_release);
+  return kErrorCode_Ok;
+}
+
+s16 EPOCH_pin(EpochRecord *record)
+{
+  if (NULL == record)
+  {
+    return kErrorCode_EpochNull;
+  }
+  if (0 != record->pin_depth_++)
+  {
+    return kErrorCode_Ok;
+  }
+  // too much garbage: help reclamation before touching shared nodes again.
+  // Waiting here is safe because this thread does not hold the epoch back.
+  u32 max_pending = (u32)record->domain_->batch_size_ * kEpochMaxPendingBatches;
+  while (record->pending_ >= max_pending)
+  {
+    EPOCH_tryAdvance(record->domain_);
+    if (0 == EPOCH_collect(record))
+    {
+      thrd_yield();
+    }
+  }
+  u32 epoch = atomic_load_explicit(&record->domain_->epoch_, memory_order_relaxed);
+  atomic_store_explicit(&record->state_, EPOCH_PINNED(epoch), memory_order_relaxed);
+  // the pin must be visible before any shared node is read
+  atomic_thread_fence(memory_order_seq_cst);
+  return kErrorCode_Ok;
+}
+
+s16 EPOCH_unpin(EpochRecord *record)
+{
+  if (NULL == record)
+  {
+    return kErrorCode_EpochNull;
+  }
+  if (0 == record->pin_depth_)
+  {
+    return kErrorCode_EpochNotPinned;
+  }
+  if (0 == --record->pin_depth_)
+  {
+    atomic_store_explicit(&record->state_, 0, memory_order_release);
+  }
+  return kErrorCode_Ok;
+}
+
+s16 EPOCH_retire(EpochRecord *record, void *ptr, void (*free_fn)(void *ptr))
+{
+  if (NULL == record)
+  {
+    return kErrorCode_EpochNull;
+  }
+  if (NULL == ptr)
+  {
+    return kErrorCode_DataNull;
+  }
+  // read after the unlink: every thread that may still see ptr is pinned
+  // in this epoch or an older one
+  u32 epoch = atomic_load_explicit(&record->domain_->epoch_, memory_order_seq_cst);
+  EpochBucket *bucket = &record->buckets_[epoch % 3];
+  if (bucket->epoch_ != epoch)
+  {
+    // the bucket holds epoch - 3 or older, which is already safe
+    EPOCH_freeBucket(record, bucket);
+    bucket->epoch_ = epoch;
+  }
+  EpochChunk *chunk = bucket->chunks_;
+  if (NULL == chunk || kEpochChunkItems == chunk->count_)
+  {
+    chunk = record->free_chunks_;
+    if (NULL != chunk)
+    {
+      record->free_chunks_ = chunk->next_;
+    }
+    else
+    {
+      chunk = MM->malloc(sizeof(EpochChunk));
+      if (NULL == chunk)
+      {
+        return kErrorCode_Memory;
+      }
+    }
+    chunk->count_ = 0;
+    chunk->next_ = bucket->chunks_;
+    bucket->chunks_ = chunk;
+  }
+  chunk->items_[chunk->count_].ptr_ = ptr;
+  chunk->items_[chunk->count_].free_ = NULL != free_fn ? free_fn : EPOCH_freeWithMM;
+  chunk->count_++;
+  bucket->count_++;
+  record->pending_++;
+
+  if (++record->retired_since_collect_ >= record->domain_->batch_size_)
+  {
+    record->retired_since_collect_ = 0;
+    EPOCH_tryAdvance(record->domain_);
+    EPOCH_collect(record);
+  }
+  return kErrorCode_Ok;
+}
+
+boolean EPOCH_tryAdvance(EpochDomain *domain)
+{
+  if (NULL == domain)
+  {
+    return False;
+  }
+  u32 epoch = atomic_load_explicit(&domain->epoch_, memory_order_seq_cst);
+  EpochRecord *record = atomic_load_explicit(&domain->records_, memory_order_acquire);
+  for (; NULL != record; record = atomic_load_explicit(&record->next_, memory_order_acquire))
+  {
+    u32 state = atomic_load_explicit(&record->state_, memory_order_seq_cst);
+    if (EPOCH_IS_PINNED(state) && EPOCH_PINNED(epoch) != state)
+    {
+      return False;
+    }
+  }
+  // losing the CAS means somebody else advanced it: just as good
+  atomic_compare_exchange_strong_explicit(&domain->epoch_, &epoch, epoch + 1,
+                                          memory_order_seq_cst, memory_order_relaxed);
+  return True;
+}
+
+// Frees every pointer of the bucket and keeps its chunks for later retires
+u32 EPOCH_freeBucket(EpochRecord *record, EpochBucket *bucket)
+{
+  u32 freed = bucket->count_;
+  EpochChunk *chunk = bucket->chunks_;
+  while (NULL != chunk)
+  {
+    EpochChunk *next = chunk->next_;
+    for (u16 i = 0; i < chunk->count_; i++)
+    {
+      chunk->items_[i].free_(chunk->items_[i].ptr_);
+    }
+    chunk->next_ = record->free_chunks_;
+    record->free_chunks_ = chunk;
+    chunk = next;
+  }
+  bucket->chunks_ = NULL;
+  bucket->count_ = 0;
+  record->pending_ -= freed;
+  if (0 != freed)
+  {
+    atomic_fetch_add_explicit(&record->domain_->freed_, freed, memory_order_relaxed);
+  }
+  return freed;
+}
+
+u32 EPOCH_collect(EpochRecord *record)
+{
+  if (NULL == record)
+  {
+    return 0;
+  }
+  u32 epoch = atomic_load_explicit(&record->domain_->epoch_, memory_order_acquire);
+  u32 freed = 0;
+  for (u16 i = 0; i < 3; i++)
+  {
+    EpochBucket *bucket = &record->buckets_[i];
+    if (0 != bucket->count_ && epoch - bucket->epoch_ >= 2)
+    {
+      freed += EPOCH_freeBucket(record, bucket);
+    }
+  }
+  return freed;
+}
+
+u32 EPOCH_epoch(EpochDomain *domain)
+{
+  if (NULL == domain)
+  {
+    return 0;
+  }
+  return atomic_load_explicit(&domain->epoch_, memory_order_relaxed);
+}
+
+u32 EPOCH_pending(EpochRecord *record)
+{
+  if (NULL == record)
+  {
+    return 0;
+  }
+  return record->pending_;
+}
+
+void EPOCH_print(EpochDomain *domain)
+{
+  if (NULL == domain)
+  {
+    printf("\t[EpochDomain Info] Address: NULL\n");
+    return;
+  }
+  printf("\t[EpochDomain Info] Address: %p\n", domain);
+  printf("\t[EpochDomain Info] Epoch: %u\n", atomic_load(&domain->epoch_));
+  printf("\t[EpochDomain Info] Batch size: %d\n", domain->batch_size_);
+  printf("\t[EpochDomain Info] Freed: %llu\n", (unsigned long long)atomic_load(&domain->freed_));
+  u16 n = 0;
+  EpochRecord *record = atomic_load(&domain->records_);
+  for (; NULL != record; record = atomic_load(&record->next_))
+  {
+    u32 state = atomic_load(&record->state_);
+    printf("\t\t[EpochDomain Info] Record #%d: %p\n", n++, record);
+    printf("\t\t\t[Record Info] In use: %s\n", atomic_load(&record->in_use_) ? "yes" : "no");
+    if (EPOCH_IS_PINNED(state))
+      printf("\t\t\t[Record Info] Pinned in epoch %u\n", EPOCH_OF(state));
+    else
+      printf("\t\t\t[Record Info] Not pinned\n");
+    printf("\t\t\t[Record Info] Pending: %u\n", record->pending_);
+  }
+}
@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common_def.h"
 #include "adt_memory_node.h"
@@ -35,7 +36,26 @@ static void* LIST_extractLast(List* list);
 static void* LIST_extractAt(List* list, u16 index);
 static s16 LIST_concat(List* list, List* other_list);
 static s16 LIST_traverse(List* list, void (*callback)(MemoryNode*));
+static s16 LIST_traverseEx(List* list, boolean (*callback)(MemoryNode*, void*), void* context);
+static s16 LIST_begin(List* list, Cursor* cursor);
+static s16 LIST_rotate(List* list, s16 n);
+static s16 LIST_cycle(List* list, Cursor* cursor);
 static void LIST_print(List* list);
+static s16 LIST_arenaDestroy(List* list);
+
+static s16 LIST_circularDestroy(List* list);
+static s16 LIST_circularReset(List* list);
+static s16 LIST_circularResize(List* list, u16 new_capacity);
+static void* LIST_circularAt(List* list, u16 index);
+static s16 LIST_circularInsertFirst(List* list, void* data, u16 size);
+static s16 LIST_circularInsertLast(List* list, void* data, u16 size);
+static s16 LIST_circularInsertAt(List* list, void* data, u16 size, u16 index);
+static void* LIST_circularExtractFirst(List* list);
+static void* LIST_circularExtractLast(List* list);
+static void* LIST_circularExtractAt(List* list, u16 index);
+static s16 LIST_circularConcat(List* list, List* other_list);
+static s16 LIST_circularTraverse(List* list, void (*callback)(MemoryNode*));
+static s16 LIST_circularTraverseEx(List* list, boolean (*callback)(MemoryNode*, void*), void* context);
 
 // List's API Definitions
 struct list_ops_s list_ops = { .next = LIST_next,
@@ -58,9 +78,175 @@ struct list_ops_s list_ops = { .next = LIST_next,
                                              .extractAt = LIST_extractAt,
                                              .concat = LIST_concat,
                                              .traverse = LIST_traverse,
+                                             .traverseEx = LIST_traverseEx,
+                                             .begin = LIST_begin,
+                                             .rotate = LIST_rotate,
+                                             .cycle = LIST_cycle,
                                              .print = LIST_print,
 };
 
+// Same operations for the lists living in an arena: nothing is freed
+struct list_ops_s list_arena_ops = { .next = LIST_next,
+                                             .destroy = LIST_arenaDestroy,
+                                             .reset = LIST_reset,
+                                             .softReset = LIST_softReset,
+                                             .resize = LIST_resize,
+                                             .capacity = LIST_capacity,
+                                             .length = LIST_lenght,
+                                             .isEmpty = LIST_isEmpty,
+                                             .isFull = LIST_isFull,
+                                             .first = LIST_first,
+                                             .last = LIST_last,
+                                             .at = LIST_at,
+                                             .insertFirst = LIST_insertFirst,
+                                             .insertLast = LIST_insertLast,
+                                             .insertAt = LIST_insertAt,
+                                             .extractFirst = LIST_extractFirst,
+                                             .extractLast = LIST_extractLast,
+                                             .extractAt = LIST_extractAt,
+                                             .concat = LIST_concat,
+                                             .traverse = LIST_traverse,
+                                             .traverseEx = LIST_traverseEx,
+                                             .begin = LIST_begin,
+                                             .rotate = LIST_rotate,
+                                             .cycle = LIST_cycle,
+                                             .print = LIST_print,
+};
+
+// Same operations for the lists of shared payloads: concat takes new
+// references instead of copies
+struct list_ops_s list_shared_ops = { .next = LIST_next,
+                                             .destroy = LIST_destroy,
+                                             .reset = LIST_reset,
+                                             .softReset = LIST_softReset,
+                                             .resize = LIST_resize,
+                                             .capacity = LIST_capacity,
+                                             .length = LIST_lenght,
+                                             .isEmpty = LIST_isEmpty,
+                                             .isFull = LIST_isFull,
+                                             .first = LIST_first,
+                                             .last = LIST_last,
+                                             .at = LIST_at,
+                                             .insertFirst = LIST_insertFirst,
+                                             .insertLast = LIST_insertLast,
+                                             .insertAt = LIST_insertAt,
+                                             .extractFirst = LIST_extractFirst,
+                                             .extractLast = LIST_extractLast,
+                                             .extractAt = LIST_extractAt,
+                                             .concat = LIST_concat,
+                                             .traverse = LIST_traverse,
+                                             .traverseEx = LIST_traverseEx,
+                                             .begin = LIST_begin,
+                                             .rotate = LIST_rotate,
+                                             .cycle = LIST_cycle,
+                                             .print = LIST_print,
+};
+
+// Circular lists: the tail links back to the head. The ops that walk or
+// relink the nodes open the ring, reuse the ones above and close it again
+struct list_ops_s list_circular_ops = { .next = LIST_next,
+                                             .destroy = LIST_circularDestroy,
+                                             .reset = LIST_circularReset,
+                                             .softReset = LIST_circularReset,
+                                             .resize = LIST_circularResize,
+                                             .capacity = LIST_capacity,
+                                             .length = LIST_lenght,
+                                             .isEmpty = LIST_isEmpty,
+                                             .isFull = LIST_isFull,
+                                             .first = LIST_first,
+                                             .last = LIST_last,
+                                             .at = LIST_circularAt,
+                                             .insertFirst = LIST_circularInsertFirst,
+                                             .insertLast = LIST_circularInsertLast,
+                                             .insertAt = LIST_circularInsertAt,
+                                             .extractFirst = LIST_circularExtractFirst,
+                                             .extractLast = LIST_circularExtractLast,
+                                             .extractAt = LIST_circularExtractAt,
+                                             .concat = LIST_circularConcat,
+                                             .traverse = LIST_circularTraverse,
+                                             .traverseEx = LIST_circularTraverseEx,
+                                             .begin = LIST_begin,
+                                             .rotate = LIST_rotate,
+                                             .cycle = LIST_cycle,
+                                             .print = LIST_print,
+};
+
+// List created by LIST_createInArena
+typedef struct arena_list_s {
+    List list_;
+    Arena* arena_;
+} ArenaList;
+
+static void* LIST_alloc(List* list, u32 bytes)
+{
+    if (&list_arena_ops == list->ops_)
+    {
+        Arena* arena = ((ArenaList*)list)->arena_;
+        return arena->ops_->alloc(arena, bytes);
+    }
+    return MM->malloc(bytes);
+}
+
+static void LIST_free(List* list, void* ptr)
+{
+    // arena memory goes back with the arena reset
+    if (&list_arena_ops != list->ops_)
+    {
+        MM->free(ptr);
+    }
+}
+
+// A list of shared payloads drops references instead of freeing them
+static void LIST_freeData(List* list, void* data)
+{
+    if (&list_shared_ops == list->ops_)
+    {
+        MEMNODE_release(data);
+    }
+    else
+    {
+        LIST_free(list, data);
+    }
+}
+
+// Links the tail to the head in a circular list, or to NULL otherwise
+static void LIST_close(List* list)
+{
+    if (NULL != list->tail_)
+    {
+        list->tail_->next_ = &list_circular_ops == list->ops_ ? list->head_ : NULL;
+    }
+}
+
+static void LIST_open(List* list)
+{
+    if (NULL != list->tail_)
+    {
+        list->tail_->next_ = NULL;
+    }
+}
+
+static MemoryNode* LIST_newNode(List* list, void* data, u16 size)
+{
+    MemoryNode* node = LIST_alloc(list, sizeof(MemoryNode));
+    if (NULL == node)
+    {
+        return NULL;
+    }
+    if (&list_shared_ops == list->ops_)
+    {
+        MEMNODE_createLiteShared(node);
+    }
+    else
+    {
+        MEMNODE_createLite(node);
+    }
+    node->next_ = NULL;
+    node->prev_ = NULL;
+    node->ops_->setData(node, data, size);
+    return node;
+}
+
 List* LIST_create(u16 capacity)
 {
     if (0 >= capacity)
@@ -82,6 +268,47 @@ List* LIST_create(u16 capacity)
 
 }
 
+List* LIST_createShared(u16 capacity)
+{
+    List* list_ = LIST_create(capacity);
+    if (NULL != list_)
+    {
+        list_->ops_ = &list_shared_ops;
+    }
+    return list_;
+}
+
+List* LIST_createCircular(u16 capacity)
+{
+    List* list_ = LIST_create(capacity);
+    if (NULL != list_)
+    {
+        list_->ops_ = &list_circular_ops;
+    }
+    return list_;
+}
+
+List* LIST_createInArena(u16 capacity, Arena* arena)
+{
+    if (0 == capacity || NULL == arena)
+    {
+        return NULL;
+    }
+    ArenaList* arena_list = arena->ops_->alloc(arena, sizeof(ArenaList));
+    if (NULL == arena_list)
+    {
+        return NULL;
+    }
+    List* list_ = &arena_list->list_;
+    list_->head_ = NULL;
+    list_->tail_ = NULL;
+    list_->capacity_ = capacity;
+    list_->length_ = 0;
+    list_->ops_ = &list_arena_ops;
+    arena_list->arena_ = arena;
+    return list_;
+}
+
 MemoryNode* LIST_next(MemoryNode* node)
 {
     if (NULL == node)
@@ -101,7 +328,6 @@ s16 LIST_setNext(MemoryNode* node, MemoryNode* next)
     return kErrorCode_Ok;
 }
 
-/*Comprobar si es correcto*/
 s16 LIST_destroy(List* list) {
 
     if (NULL == list)
@@ -109,59 +335,25 @@ s16 LIST_destroy(List* list) {
         return kErrorCode_ListNull;
     }
 
-    if (LIST_isEmpty(list))
-    {
-        //MM->free(list->head_);
-        //MM->free(list->tail_);
-        MM->free(list);
-
-        return kErrorCode_Ok;
-    }
-
-    MemoryNode* aux = list->head_;
-    MemoryNode* aux_next = aux->next_;
-    while (NULL != aux)
-    {
-        //aux->ops_->free(aux->data_);
-       // aux->ops_->free(aux);
-        aux = aux_next;
-        if (NULL != aux) {
-            aux_next = aux->next_;
-        }
-    }
-
-    MM->free(list->head_);
-    MM->free(list->tail_);
+    LIST_reset(list);
     MM->free(list);
 
     return kErrorCode_Ok;
 }
 
-s16 LIST_softReset(List* list)
+s16 LIST_arenaDestroy(List* list)
 {
     if (NULL == list)
     {
         return kErrorCode_ListNull;
     }
-
-    // delete all nodes
-    MemoryNode* current_node = list->head_;
-    MemoryNode* next_node = current_node->next_;
-
-    while (NULL != current_node)
-    {
-        //next_node = current_node->next_;
-        MM->free(current_node->data_);
-        MM->free(current_node);
-        current_node = next_node;
-    }
-    list->head_ = NULL;
-    list->tail_ = NULL;
-    list->length_ = 0;
-
     return kErrorCode_Ok;
+}
 
-
+s16 LIST_softReset(List* list)
+{
+    // the nodes own their payloads, so a soft reset frees the same as reset
+    return LIST_reset(list);
 }
 
 s16 LIST_reset(List* list)
@@ -176,9 +368,9 @@ s16 LIST_reset(List* list)
 
     while (NULL != current_node)
     {
-        MM->free(list->head_->data_);
+        LIST_freeData(list, list->head_->data_);
         current_node = list->head_->next_;
-        MM->free(list->head_);
+        LIST_free(list, list->head_);
         list->head_ = current_node;
     }
     list->head_ = NULL;
@@ -200,34 +392,31 @@ s16 LIST_resize(List* list, u16 new_capacity)
         return kErrorCode_InvalidIndex;
     }
 
-    if (list->length_ == new_capacity)
-    {
-        return kErrorCode_Ok;
-    }
     list->capacity_ = new_capacity;
 
-    if (new_capacity > list->length_)
+    if (new_capacity >= list->length_)
     {
         return kErrorCode_Ok;
     }
-    list->length_ = list->capacity_;
+    // the nodes after the new capacity are lost
     MemoryNode* current_node = list->head_;
-
-    for (u16 i = 0; i < list->capacity_; i++)
+    for (u16 i = 1; i < new_capacity; i++)
     {
         current_node = current_node->next_;
     }
     list->tail_ = current_node;
+    current_node = current_node->next_;
     list->tail_->next_ = NULL;
-  
-    MemoryNode* aux = current_node->next_;
-    for (aux; NULL != aux; aux->next_)
+    list->length_ = new_capacity;
+
+    while (NULL != current_node)
     {
-        current_node->ops_->free(current_node);
+        MemoryNode* aux = current_node->next_;
+        LIST_freeData(list, current_node->data_);
+        LIST_free(list, current_node);
         current_node = aux;
-        aux = aux->next_;
     }
-    
+
     return kErrorCode_Ok;
 }
 
@@ -338,12 +527,11 @@ s16 LIST_insertFirst(List* list, void* data, u16 size)
     {
         return kErrorCode_NotEnoughCapacity;
     }
-    MemoryNode* node = MEMNODE_create();
+    MemoryNode* node = LIST_newNode(list, data, size);
     if (NULL == node)
     {
         return kErrorCode_NodeNull;
     }
-    node->ops_->setData(node, data, size);
      //check if the list is empty
     if (LIST_isEmpty(list))
     {
@@ -371,12 +559,11 @@ s16 LIST_insertLast(List* list, void* data, u16 size)
     {
         return kErrorCode_NotEnoughCapacity;
     }
-    MemoryNode* node = MEMNODE_create();
+    MemoryNode* node = LIST_newNode(list, data, size);
     if (node == NULL)
     {
         return kErrorCode_NodeNull;
     }
-    node->ops_->setData(node, data, size);
     //node->size_ = size;
     //node->data_ = data;
     //check if the list is empty
@@ -419,25 +606,21 @@ s16 LIST_insertAt(List* list, void* data, u16 size, u16 index)
     {
         return list->ops_->insertLast(list, data, size);
     }
-    MemoryNode* node = MEMNODE_create();
-    if (NULL == node)
-    {
-        return kErrorCode_NodeNull;
-    }
-    node->ops_->setData(node, data, size);
-    //node->size_ = size;
-    //node->data_ = data;
-
     // insert first
     if (index == 0)
     {
-        return LIST_insertFirst(list, node->data_, node->size_);
+        return LIST_insertFirst(list, data, size);
     }
 
     // insert last
     if (index == list->length_)
     {
-        return LIST_insertLast(list, node->data_, node->size_);
+        return LIST_insertLast(list, data, size);
+    }
+    MemoryNode* node = LIST_newNode(list, data, size);
+    if (NULL == node)
+    {
+        return kErrorCode_NodeNull;
     }
 
     // Insert node in index
@@ -468,9 +651,16 @@ void* LIST_extractFirst(List* list)
     }
 
     MemoryNode* node_to_extract = list->head_;
+    void* data = node_to_extract->data_;
     list->head_ = list->head_->next_;
     list->length_--;
-    return node_to_extract->data_;
+    if (LIST_isEmpty(list))
+    {
+        list->tail_ = NULL;
+    }
+    // the payload goes back to the caller, only the node is released
+    LIST_free(list, node_to_extract);
+    return data;
 }
 
 void* LIST_extractLast(List* list)
@@ -487,6 +677,7 @@ void* LIST_extractLast(List* list)
     }
 
     MemoryNode* last_node = list->tail_;
+    void* data = last_node->data_;
     MemoryNode* aux = list->head_;
 
     while (aux->next_ != last_node && aux != last_node)
@@ -502,8 +693,9 @@ void* LIST_extractLast(List* list)
         list->head_ = NULL;
         list->tail_ = NULL;
     }
+    LIST_free(list, last_node);
 
-    return last_node->data_;
+    return data;
 }
 
 
@@ -548,6 +740,14 @@ void* LIST_extractAt(List* list, u16 index)
     {
         return NULL;
     }
+    if (0 == index)
+    {
+        return LIST_extractFirst(list);
+    }
+    if (index == list->length_ - 1)
+    {
+        return LIST_extractLast(list);
+    }
     MemoryNode* node;
     MemoryNode* aux = list->head_;
     for (u16 i = 0; i < index - 1; i++)
@@ -557,10 +757,24 @@ void* LIST_extractAt(List* list, u16 index)
     node = aux->next_;
     aux->next_ = aux->next_->next_;
     list->length_--;
-    return node->data_;
+    void* data = node->data_;
+    LIST_free(list, node);
+    return data;
 }
 
 
+// Gives back a chain of nodes ended by NULL, with their payloads
+static void LIST_freeChain(List* list, MemoryNode* node)
+{
+    while (NULL != node)
+    {
+        MemoryNode* next = node->next_;
+        LIST_freeData(list, node->data_);
+        LIST_free(list, node);
+        node = next;
+    }
+}
+
 s16 LIST_concat(List* list, List* next_list)
 {
     if (list == NULL || next_list == NULL)
@@ -573,43 +787,58 @@ s16 LIST_concat(List* list, List* next_list)
         return kErrorCode_Ok;
     }
 
+    // the copies are linked in a chain of their own and spliced onto the
+    // tail once all of them exist, so a failure leaves list as it was
+    MemoryNode* chain = NULL;
+    MemoryNode* chain_tail = NULL;
     MemoryNode* current_list = next_list->head_;
 
-    while (NULL != current_list) {
+    // walked by length, the source may be circular
+    for (u16 i = 0; i < next_list->length_; i++) {
 
-        MemoryNode* new_node = MM->malloc(sizeof(MemoryNode));
-        if (new_node == NULL) {
-            MM->free(new_node);
-            return kErrorCode_StorageNull;
+        u8* tmp = NULL;
+        if (&list_shared_ops == list->ops_ && &memory_node_shared_ops == current_list->ops_)
+        {
+            tmp = MEMNODE_retain(current_list->data_);
         }
-
-        u8* tmp = MM->malloc(current_list->size_);
-        if (NULL == tmp) {
-            return kErrorCode_Null;
+        else
+        {
+            // a shared list gets a shared copy of a payload that isn't shared
+            tmp = &list_shared_ops == list->ops_ ? MEMNODE_sharedAlloc(current_list->size_) :
+                LIST_alloc(list, current_list->size_);
+            if (NULL == tmp) {
+                LIST_freeChain(list, chain);
+                return kErrorCode_Null;
+            }
+            memcpy(tmp, current_list->data_, current_list->size_);
         }
 
-        u8* aux = (u8*)current_list->data_;
-        for (s32 i = 0; i < current_list->size_; i++) {
-            tmp[i] = aux[i];
+        MemoryNode* new_node = LIST_newNode(list, tmp, current_list->size_);
+        if (new_node == NULL) {
+            LIST_freeData(list, tmp);
+            LIST_freeChain(list, chain);
+            return kErrorCode_StorageNull;
         }
 
-        new_node->data_ = tmp;
-        new_node->size_ = current_list->size_;
-        new_node->next_ = NULL;
-
-        if (NULL == list->head_) {
-            list->head_ = new_node;
-            list->tail_ = new_node;
+        if (NULL == chain) {
+            chain = new_node;
         }
         else {
-            
-            list->tail_->next_ = new_node;
-            list->tail_ = new_node;
+            chain_tail->next_ = new_node;
         }
+        chain_tail = new_node;
 
         current_list = current_list->next_;
     }
 
+    if (NULL == list->head_) {
+        list->head_ = chain;
+    }
+    else {
+        list->tail_->next_ = chain;
+    }
+    list->tail_ = chain_tail;
+
     list->length_ += next_list->length_;
     list->capacity_ += next_list->capacity_;
 
@@ -638,6 +867,238 @@ s16 LIST_traverse(List* list, void(*callback)(MemoryNode*))
     return kErrorCode_Ok;
 }
 
+s16 LIST_traverseEx(List* list, boolean (*callback)(MemoryNode*, void*), void* context)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (NULL == callback)
+    {
+        return kErrorCode_Null;
+    }
+    MemoryNode* current_node = list->head_;
+    while (NULL != current_node && True == callback(current_node, context))
+    {
+        current_node = current_node->next_;
+    }
+
+    return kErrorCode_Ok;
+}
+
+s16 LIST_begin(List* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, False);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    CURSOR_init(cursor, list->head_, list->tail_, 0, False);
+
+    return kErrorCode_Ok;
+}
+
+s16 LIST_rotate(List* list, s16 n)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    if (list->length_ < 2)
+    {
+        return kErrorCode_Ok;
+    }
+    u16 steps = (u16)(((s32)n % list->length_ + list->length_) % list->length_);
+    if (0 == steps)
+    {
+        return kErrorCode_Ok;
+    }
+    // the new tail is the node steps positions after the old one
+    list->tail_->next_ = list->head_;
+    for (u16 i = 0; i < steps; i++)
+    {
+        list->tail_ = list->tail_->next_;
+    }
+    list->head_ = list->tail_->next_;
+    LIST_close(list);
+
+    return kErrorCode_Ok;
+}
+
+s16 LIST_cycle(List* list, Cursor* cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, 0, False);
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    // without a last node the cursor follows next_ round the ring
+    CURSOR_init(cursor, list->head_, &list_circular_ops == list->ops_ ? NULL : list->tail_, 0, False);
+
+    return kErrorCode_Ok;
+}
+
+s16 LIST_circularDestroy(List* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    return LIST_destroy(list);
+}
+
+s16 LIST_circularReset(List* list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    return LIST_reset(list);
+}
+
+s16 LIST_circularResize(List* list, u16 new_capacity)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    s16 error = LIST_resize(list, new_capacity);
+    LIST_close(list);
+    return error;
+}
+
+void* LIST_circularAt(List* list, u16 index)
+{
+    if (NULL == list || index >= list->length_)
+    {
+        return NULL;
+    }
+    return LIST_at(list, index);
+}
+
+s16 LIST_circularInsertFirst(List* list, void* data, u16 size)
+{
+    s16 error = LIST_insertFirst(list, data, size);
+    if (kErrorCode_Ok == error)
+    {
+        LIST_close(list);
+    }
+    return error;
+}
+
+s16 LIST_circularInsertLast(List* list, void* data, u16 size)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    s16 error = LIST_insertLast(list, data, size);
+    LIST_close(list);
+    return error;
+}
+
+s16 LIST_circularInsertAt(List* list, void* data, u16 size, u16 index)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    s16 error = LIST_insertAt(list, data, size, index);
+    LIST_close(list);
+    return error;
+}
+
+void* LIST_circularExtractFirst(List* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    LIST_open(list);
+    void* data = LIST_extractFirst(list);
+    if (NULL == list->tail_)
+    {
+        list->head_ = NULL;
+    }
+    LIST_close(list);
+    return data;
+}
+
+void* LIST_circularExtractLast(List* list)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    void* data = LIST_extractLast(list);
+    LIST_close(list);
+    return data;
+}
+
+void* LIST_circularExtractAt(List* list, u16 index)
+{
+    if (NULL == list)
+    {
+        return NULL;
+    }
+    LIST_open(list);
+    void* data = LIST_extractAt(list, index);
+    if (NULL == list->tail_)
+    {
+        list->head_ = NULL;
+    }
+    LIST_close(list);
+    return data;
+}
+
+s16 LIST_circularConcat(List* list, List* other_list)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    s16 error = LIST_concat(list, other_list);
+    LIST_close(list);
+    return error;
+}
+
+s16 LIST_circularTraverse(List* list, void (*callback)(MemoryNode*))
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    s16 error = LIST_traverse(list, callback);
+    LIST_close(list);
+    return error;
+}
+
+s16 LIST_circularTraverseEx(List* list, boolean (*callback)(MemoryNode*, void*), void* context)
+{
+    if (NULL == list)
+    {
+        return kErrorCode_ListNull;
+    }
+    LIST_open(list);
+    s16 error = LIST_traverseEx(list, callback, context);
+    LIST_close(list);
+    return error;
+}
 
 void LIST_print(List* list)
 {
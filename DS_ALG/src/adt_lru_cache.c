@@ -0,0 +1,449 @@
+/**
+ * @file adt_lru_cache.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-26
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_lru_cache.h"
+#include "file_map.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 LRUCACHE_destroy(LRUCache *cache);
+static s16 LRUCACHE_softReset(LRUCache *cache);
+static s16 LRUCACHE_reset(LRUCache *cache);
+static u32 LRUCACHE_length(LRUCache *cache);
+static u64 LRUCACHE_bytes(LRUCache *cache);
+static void *LRUCACHE_get(LRUCache *cache, const void *key);
+static void *LRUCACHE_peek(LRUCache *cache, const void *key);
+static s16 LRUCACHE_put(LRUCache *cache, const void *key, void *data, u16 bytes);
+static void *LRUCACHE_erase(LRUCache *cache, const void *key);
+static s16 LRUCACHE_setBudget(LRUCache *cache, u64 budget);
+static s16 LRUCACHE_begin(LRUCache *cache, Cursor *cursor);
+static void LRUCACHE_print(LRUCache *cache);
+
+struct lru_cache_ops_s lru_cache_ops = {
+    .destroy = LRUCACHE_destroy,
+    .softReset = LRUCACHE_softReset,
+    .reset = LRUCACHE_reset,
+    .length = LRUCACHE_length,
+    .bytes = LRUCACHE_bytes,
+    .get = LRUCACHE_get,
+    .peek = LRUCACHE_peek,
+    .put = LRUCACHE_put,
+    .erase = LRUCACHE_erase,
+    .setBudget = LRUCACHE_setBudget,
+    .begin = LRUCACHE_begin,
+    .print = LRUCACHE_print,
+};
+
+LRUCache *LRUCACHE_create(u16 key_bytes, u64 budget, LRUCacheEvict evict, void *context)
+{
+  if (0 == key_bytes || key_bytes > kLRUCacheMaxKeyBytes || 0 == budget)
+  {
+    return NULL;
+  }
+  LRUCache *cache = MM->malloc(sizeof(LRUCache));
+  if (NULL == cache)
+  {
+    return NULL;
+  }
+  cache->pool_ = POOL_create(sizeof(LRUCacheEntry) + key_bytes, kLRUCacheSlabBytes);
+  cache->buckets_ = FILEMAP_pagesAlloc(kLRUCacheInitialBuckets * sizeof(LRUCacheEntry *));
+  if (NULL == cache->pool_ || NULL == cache->buckets_)
+  {
+    if (NULL != cache->pool_)
+    {
+      cache->pool_->ops_->destroy(cache->pool_);
+    }
+    MM->free(cache);
+    return NULL;
+  }
+  cache->first_ = NULL;
+  cache->last_ = NULL;
+  cache->bucket_mask_ = kLRUCacheInitialBuckets - 1;
+  cache->length_ = 0;
+  cache->bytes_ = 0;
+  cache->budget_ = budget;
+  cache->key_bytes_ = key_bytes;
+  cache->evict_ = evict;
+  cache->context_ = context;
+  cache->ops_ = &lru_cache_ops;
+  return cache;
+}
+
+// FNV-1a of a key
+static u32 LRUCACHE_hash(const u8 *key, u16 bytes)
+{
+  u32 hash = 2166136261u;
+  for (u16 i = 0; i < bytes; ++i)
+  {
+    hash = (hash ^ key[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static LRUCacheEntry *LRUCACHE_lookup(LRUCache *cache, const void *key, u32 hash)
+{
+  LRUCacheEntry *entry = cache->buckets_[hash & cache->bucket_mask_];
+  while (NULL != entry && (entry->hash_ != hash || 0 != memcmp(entry->key_, key, cache->key_bytes_)))
+  {
+    entry = entry->chain_;
+  }
+  return entry;
+}
+
+// Takes an entry out of its bucket
+static void LRUCACHE_unchain(LRUCache *cache, LRUCacheEntry *entry)
+{
+  LRUCacheEntry **link = &cache->buckets_[entry->hash_ & cache->bucket_mask_];
+  while (*link != entry)
+  {
+    link = &(*link)->chain_;
+  }
+  *link = entry->chain_;
+}
+
+// Takes an entry out of the recency list
+static void LRUCACHE_unlink(LRUCache *cache, LRUCacheEntry *entry)
+{
+  MemoryNode *prev = entry->node_.prev_;
+  MemoryNode *next = entry->node_.next_;
+  if (NULL == prev)
+  {
+    cache->first_ = (LRUCacheEntry *)next;
+  }
+  else
+  {
+    prev->next_ = next;
+  }
+  if (NULL == next)
+  {
+    cache->last_ = (LRUCacheEntry *)prev;
+  }
+  else
+  {
+    next->prev_ = prev;
+  }
+}
+
+// Links an entry as the most recently used
+static void LRUCACHE_pushFront(LRUCache *cache, LRUCacheEntry *entry)
+{
+  entry->node_.prev_ = NULL;
+  if (NULL == cache->first_)
+  {
+    entry->node_.next_ = NULL;
+    cache->last_ = entry;
+  }
+  else
+  {
+    entry->node_.next_ = &cache->first_->node_;
+    cache->first_->node_.prev_ = &entry->node_;
+  }
+  cache->first_ = entry;
+}
+
+// Hands a payload the cache lets go to the callback, or frees it
+static void LRUCACHE_drop(LRUCache *cache, LRUCacheEntry *entry)
+{
+  if (NULL != cache->evict_)
+  {
+    cache->evict_(entry->key_, &entry->node_, cache->context_);
+  }
+  else
+  {
+    MM->free(entry->node_.data_);
+  }
+}
+
+// Drops the least recently used entries until bytes more fit in the budget
+static void LRUCACHE_evict(LRUCache *cache, u64 bytes)
+{
+  while (NULL != cache->last_ && cache->bytes_ + bytes > cache->budget_)
+  {
+    LRUCacheEntry *entry = cache->last_;
+    LRUCACHE_unlink(cache, entry);
+    LRUCACHE_unchain(cache, entry);
+    cache->bytes_ -= entry->node_.size_;
+    cache->length_--;
+    LRUCACHE_drop(cache, entry);
+    cache->pool_->ops_->free(cache->pool_, entry);
+  }
+}
+
+// Doubles the buckets. If the OS has no pages the chains just get longer
+static void LRUCACHE_grow(LRUCache *cache)
+{
+  u32 buckets = (cache->bucket_mask_ + 1) * 2;
+  LRUCacheEntry **table = FILEMAP_pagesAlloc((u64)buckets * sizeof(LRUCacheEntry *));
+  if (NULL == table)
+  {
+    return;
+  }
+  for (u32 i = 0; i <= cache->bucket_mask_; ++i)
+  {
+    LRUCacheEntry *entry = cache->buckets_[i];
+    while (NULL != entry)
+    {
+      LRUCacheEntry *next = entry->chain_;
+      entry->chain_ = table[entry->hash_ & (buckets - 1)];
+      table[entry->hash_ & (buckets - 1)] = entry;
+      entry = next;
+    }
+  }
+  FILEMAP_pagesFree(cache->buckets_, (u64)(cache->bucket_mask_ + 1) * sizeof(LRUCacheEntry *));
+  cache->buckets_ = table;
+  cache->bucket_mask_ = buckets - 1;
+}
+
+s16 LRUCACHE_put(LRUCache *cache, const void *key, void *data, u16 bytes)
+{
+  if (NULL == cache)
+  {
+    return kErrorCode_LRUCacheNull;
+  }
+  if (NULL == key)
+  {
+    return kErrorCode_Null;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  if (bytes > cache->budget_)
+  {
+    return kErrorCode_NotEnoughCapacity;
+  }
+  u32 hash = LRUCACHE_hash(key, cache->key_bytes_);
+  LRUCacheEntry *entry = LRUCACHE_lookup(cache, key, hash);
+  if (NULL != entry)
+  {
+    // the entry is moved to the front first, so it is never the one evicted
+    LRUCACHE_unlink(cache, entry);
+    LRUCACHE_pushFront(cache, entry);
+    cache->bytes_ -= entry->node_.size_;
+    // putting the cached payload again only updates its size
+    if (entry->node_.data_ != data)
+    {
+      LRUCACHE_drop(cache, entry);
+    }
+    LRUCACHE_evict(cache, bytes);
+    entry->node_.ops_->setData(&entry->node_, data, bytes);
+    cache->bytes_ += bytes;
+    return kErrorCode_Ok;
+  }
+
+  entry = cache->pool_->ops_->alloc(cache->pool_);
+  if (NULL == entry)
+  {
+    return kErrorCode_Memory;
+  }
+  LRUCACHE_evict(cache, bytes);
+  MEMNODE_createLite(&entry->node_);
+  entry->node_.ops_->setData(&entry->node_, data, bytes);
+  entry->hash_ = hash;
+  memcpy(entry->key_, key, cache->key_bytes_);
+  entry->chain_ = cache->buckets_[hash & cache->bucket_mask_];
+  cache->buckets_[hash & cache->bucket_mask_] = entry;
+  LRUCACHE_pushFront(cache, entry);
+  cache->bytes_ += bytes;
+  cache->length_++;
+  if (cache->length_ > cache->bucket_mask_)
+  {
+    LRUCACHE_grow(cache);
+  }
+  return kErrorCode_Ok;
+}
+
+void *LRUCACHE_get(LRUCache *cache, const void *key)
+{
+  if (NULL == cache || NULL == key)
+  {
+    return NULL;
+  }
+  LRUCacheEntry *entry = LRUCACHE_lookup(cache, key, LRUCACHE_hash(key, cache->key_bytes_));
+  if (NULL == entry)
+  {
+    return NULL;
+  }
+  if (entry != cache->first_)
+  {
+    LRUCACHE_unlink(cache, entry);
+    LRUCACHE_pushFront(cache, entry);
+  }
+  return entry->node_.data_;
+}
+
+void *LRUCACHE_peek(LRUCache *cache, const void *key)
+{
+  if (NULL == cache || NULL == key)
+  {
+    return NULL;
+  }
+  LRUCacheEntry *entry = LRUCACHE_lookup(cache, key, LRUCACHE_hash(key, cache->key_bytes_));
+  return NULL == entry ? NULL : entry->node_.data_;
+}
+
+void *LRUCACHE_erase(LRUCache *cache, const void *key)
+{
+  if (NULL == cache || NULL == key)
+  {
+    return NULL;
+  }
+  LRUCacheEntry *entry = LRUCACHE_lookup(cache, key, LRUCACHE_hash(key, cache->key_bytes_));
+  if (NULL == entry)
+  {
+    return NULL;
+  }
+  LRUCACHE_unlink(cache, entry);
+  LRUCACHE_unchain(cache, entry);
+  cache->bytes_ -= entry->node_.size_;
+  cache->length_--;
+  void *data = entry->node_.data_;
+  cache->pool_->ops_->free(cache->pool_, entry);
+  return data;
+}
+
+s16 LRUCACHE_setBudget(LRUCache *cache, u64 budget)
+{
+  if (NULL == cache)
+  {
+    return kErrorCode_LRUCacheNull;
+  }
+  if (0 == budget)
+  {
+    return kErrorCode_SizeZero;
+  }
+  cache->budget_ = budget;
+  LRUCACHE_evict(cache, 0);
+  return kErrorCode_Ok;
+}
+
+s16 LRUCACHE_begin(LRUCache *cache, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, False);
+  if (NULL == cache)
+  {
+    return kErrorCode_LRUCacheNull;
+  }
+  if (NULL != cache->first_)
+  {
+    CURSOR_init(cursor, &cache->first_->node_, &cache->last_->node_, 0, False);
+  }
+  return kErrorCode_Ok;
+}
+
+// Empties the cache: the payloads dropped, freed or kept by the owner
+static s16 LRUCACHE_empty(LRUCache *cache, boolean drop, boolean free_data)
+{
+  if (NULL == cache)
+  {
+    return kErrorCode_LRUCacheNull;
+  }
+  for (LRUCacheEntry *entry = cache->last_; NULL != entry; entry = (LRUCacheEntry *)entry->node_.prev_)
+  {
+    if (True == drop)
+    {
+      LRUCACHE_drop(cache, entry);
+    }
+    else if (True == free_data)
+    {
+      MM->free(entry->node_.data_);
+    }
+  }
+  memset(cache->buckets_, 0, (u64)(cache->bucket_mask_ + 1) * sizeof(LRUCacheEntry *));
+  cache->pool_->ops_->reset(cache->pool_);
+  cache->first_ = NULL;
+  cache->last_ = NULL;
+  cache->length_ = 0;
+  cache->bytes_ = 0;
+  return kErrorCode_Ok;
+}
+
+s16 LRUCACHE_destroy(LRUCache *cache)
+{
+  if (NULL == cache)
+  {
+    return kErrorCode_LRUCacheNull;
+  }
+  LRUCACHE_empty(cache, False, True);
+  FILEMAP_pagesFree(cache->buckets_, (u64)(cache->bucket_mask_ + 1) * sizeof(LRUCacheEntry *));
+  cache->pool_->ops_->destroy(cache->pool_);
+  MM->free(cache);
+  return kErrorCode_Ok;
+}
+
+s16 LRUCACHE_softReset(LRUCache *cache)
+{
+  return LRUCACHE_empty(cache, False, False);
+}
+
+s16 LRUCACHE_reset(LRUCache *cache)
+{
+  return LRUCACHE_empty(cache, True, True);
+}
+
+u32 LRUCACHE_length(LRUCache *cache)
+{
+  if (NULL == cache)
+  {
+    return 0;
+  }
+  return cache->length_;
+}
+
+u64 LRUCACHE_bytes(LRUCache *cache)
+{
+  if (NULL == cache)
+  {
+    return 0;
+  }
+  return cache->bytes_;
+}
+
+void LRUCACHE_print(LRUCache *cache)
+{
+  if (NULL == cache)
+  {
+    return;
+  }
+  printf("[LRUCACHE INFO] Adress: %p\n", cache);
+  printf("[LRUCACHE INFO] Lenght: %u\n", cache->length_);
+  printf("[LRUCACHE INFO] Bytes: %llu of %llu\n", (unsigned long long)cache->bytes_, (unsigned long long)cache->budget_);
+  printf("[LRUCACHE INFO] Buckets: %u\n", cache->bucket_mask_ + 1);
+  u32 position = 0;
+  for (LRUCacheEntry *entry = cache->first_; NULL != entry; entry = (LRUCacheEntry *)entry->node_.next_, ++position)
+  {
+    printf(" [LRUCACHE INFO] Entry #%u\n", position);
+    printf("  [ENTRY INFO] Key:");
+    for (u16 j = 0; j < cache->key_bytes_; j++)
+    {
+      printf(" %02x", entry->key_[j]);
+    }
+    printf("\n");
+    printf("  [ENTRY INFO] Size: %d\n", entry->node_.size_);
+    printf("  [ENTRY INFO] Data content:");
+    for (u16 j = 0; j < entry->node_.size_; j++)
+    {
+      printf("%c", *((char *)(entry->node_.data_) + j));
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
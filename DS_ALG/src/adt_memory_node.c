@@ -8,9 +8,11 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common_def.h"
 #include "adt_memory_node.h"
+#include "logger.h"
 
 #include "EDK_MemoryManager/edk_memory_manager.h"
 
@@ -36,6 +38,13 @@ static s16 LIST_setPrev(MemoryNode* node, MemoryNode* prev);
 
 static void MEMNODE_print(MemoryNode *node);
 
+static s16 MEMNODE_sharedReset(MemoryNode *node);
+static s16 MEMNODE_sharedFree(MemoryNode *node);
+static s16 MEMNODE_sharedMemSet(MemoryNode *node, u8 value);
+static s16 MEMNODE_sharedMemCopy(MemoryNode *node, void *src, u16 bytes);
+static s16 MEMNODE_sharedMemConcat(MemoryNode *node, void *src, u16 bytes);
+static s16 MEMNODE_sharedMemMask(MemoryNode *node, u8 mask);
+
 
 // Memory Node's API Definitions
 struct memory_node_ops_s memory_node_ops = { .data = MEMNODE_data,
@@ -54,13 +63,34 @@ struct memory_node_ops_s memory_node_ops = { .data = MEMNODE_data,
                                              .print = MEMNODE_print,
 };
 
+// Same operations for the nodes of shared payloads
+struct memory_node_ops_s memory_node_shared_ops = { .data = MEMNODE_data,
+                                            .setNext = LIST_setNext,
+                                            .setPrev = LIST_setPrev,
+                                             .size = MEMNODE_size,
+                                             .setData = MEMNODE_setData,
+                                             .reset = MEMNODE_sharedReset,
+                                             .softReset = MEMNODE_softReset,
+                                             .free = MEMNODE_sharedFree,
+                                             .softFree = MEMNODE_softFree,
+                                             .memSet = MEMNODE_sharedMemSet,
+                                             .memCopy = MEMNODE_sharedMemCopy,
+                                             .memConcat = MEMNODE_sharedMemConcat,
+                                             .memMask = MEMNODE_sharedMemMask,
+                                             .print = MEMNODE_print,
+};
+
+// Header of a shared payload, the data follows it
+typedef struct shared_payload_s {
+  u32 refs_;
+  u32 bytes_;
+} SharedPayload;
+
 // Memory Node Definitions
 MemoryNode* MEMNODE_create() {
   MemoryNode *node = MM->malloc(sizeof(MemoryNode));
   if (NULL == node) {
-#ifdef VERBOSE_
-    printf("Error: [%s] not enough memory available\n", __FUNCTION__);
-#endif
+    LOG_ERROR("[%s] not enough memory available", __FUNCTION__);
     return NULL;
   }
   MEMNODE_initWithoutCheck(node);
@@ -85,9 +115,7 @@ s16 MEMNODE_createFromRef(MemoryNode **node) {
   *node = MEMNODE_create();
   if(NULL == *node)
   {
-    #ifdef VERBOSE_
-    printf("Error: [%s] not enough memory available\n", __FUNCTION__);
-    #endif
+    LOG_ERROR("[%s] not enough memory available", __FUNCTION__);
   }
   MEMNODE_initWithoutCheck(*node);
   return kErrorCode_Ok;
@@ -96,6 +124,8 @@ s16 MEMNODE_createFromRef(MemoryNode **node) {
 s16 MEMNODE_initWithoutCheck(MemoryNode *node) {
   node->data_ = NULL;
   node->size_ = 0;
+  node->next_ = NULL;
+  node->prev_ = NULL;
   node->ops_ = &memory_node_ops;
   return kErrorCode_Ok;
 }
@@ -123,9 +153,7 @@ void* MEMNODE_data(MemoryNode *node)
 { // returns a reference to data_
   if(NULL == node)
   {
-  #ifdef VERBOSE_
-    printf("Error: [%s] not enough memory available\n", __FUNCTION__);
-  #endif
+    LOG_ERROR("[%s] not enough memory available", __FUNCTION__);
     return NULL;
   } 
   return node->data_;
@@ -134,9 +162,7 @@ void* MEMNODE_data(MemoryNode *node)
 u16	MEMNODE_size(MemoryNode *node) { 
   if (NULL == node)
   {
-  #ifdef VERBOSE_
-    printf("Error: [%s] not enough memory available\n", __FUNCTION__);
-  #endif
+    LOG_ERROR("[%s] not enough memory available", __FUNCTION__);
     return 0;
   }
   return node->size_;
@@ -262,7 +288,7 @@ s16 MEMNODE_memCopy(MemoryNode* node, void* src, u16 bytes)
     }
     for (int i = 0; i < bytes; i++)
     {
-        aux2[i] = aux;
+        aux2[i] = aux[i];
     }
     node->data_ = aux2;
     node->size_ = bytes;
@@ -348,3 +374,219 @@ void MEMNODE_print(MemoryNode *node)
   printf("\n");
   return kErrorCode_Ok;
 }
+
+s16 MEMNODE_createLiteShared(MemoryNode *node)
+{
+  if (NULL == node) {
+    return kErrorCode_Memory;
+  }
+  node->data_ = NULL;
+  node->size_ = 0;
+  node->ops_ = &memory_node_shared_ops;
+  return kErrorCode_Ok;
+}
+
+static SharedPayload* MEMNODE_header(void *data)
+{
+  return (SharedPayload*)data - 1;
+}
+
+void* MEMNODE_sharedAlloc(u16 bytes)
+{
+  if (0 == bytes || bytes > 0xFFFF - sizeof(SharedPayload)) {
+    return NULL;
+  }
+  SharedPayload *payload = MM->malloc(sizeof(SharedPayload) + bytes);
+  if (NULL == payload) {
+    return NULL;
+  }
+  payload->refs_ = 1;
+  payload->bytes_ = bytes;
+  return payload + 1;
+}
+
+void* MEMNODE_retain(void *data)
+{
+  if (NULL == data) {
+    return NULL;
+  }
+  MEMNODE_header(data)->refs_++;
+  return data;
+}
+
+s16 MEMNODE_release(void *data)
+{
+  if (NULL == data) {
+    return kErrorCode_DataNull;
+  }
+  SharedPayload *payload = MEMNODE_header(data);
+  if (0 == --payload->refs_) {
+    MM->free(payload);
+  }
+  return kErrorCode_Ok;
+}
+
+u32 MEMNODE_references(void *data)
+{
+  if (NULL == data) {
+    return 0;
+  }
+  return MEMNODE_header(data)->refs_;
+}
+
+s16 MEMNODE_share(MemoryNode *node, MemoryNode *src)
+{
+  if (NULL == node || NULL == src) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == src->data_) {
+    return kErrorCode_DataNull;
+  }
+  void *data = NULL;
+  if (&memory_node_shared_ops == src->ops_) {
+    data = MEMNODE_retain(src->data_);
+  } else {
+    data = MEMNODE_sharedAlloc(src->size_);
+    if (NULL == data) {
+      return kErrorCode_Memory;
+    }
+    memcpy(data, src->data_, src->size_);
+  }
+  if (NULL != node->data_ && &memory_node_shared_ops == node->ops_) {
+    MEMNODE_release(node->data_);
+  }
+  node->ops_ = &memory_node_shared_ops;
+  node->data_ = data;
+  node->size_ = src->size_;
+  return kErrorCode_Ok;
+}
+
+// Replaces the payload of the node by a private copy if it is shared.
+// Returns False if the copy can't be allocated.
+static boolean MEMNODE_unshare(MemoryNode *node)
+{
+  if (1 == MEMNODE_references(node->data_)) {
+    return True;
+  }
+  void *copy = MEMNODE_sharedAlloc(node->size_);
+  if (NULL == copy) {
+    return False;
+  }
+  memcpy(copy, node->data_, node->size_);
+  MEMNODE_release(node->data_);
+  node->data_ = copy;
+  return True;
+}
+
+s16 MEMNODE_sharedReset(MemoryNode *node)
+{
+  if (NULL == node) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == node->data_) {
+    return kErrorCode_DataNull;
+  }
+  MEMNODE_release(node->data_);
+  node->data_ = NULL;
+  node->size_ = 0;
+  return kErrorCode_Ok;
+}
+
+s16 MEMNODE_sharedFree(MemoryNode *node)
+{
+  if (NULL == node) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL != node->data_) {
+    MEMNODE_release(node->data_);
+  }
+  MM->free(node);
+  return kErrorCode_Ok;
+}
+
+s16 MEMNODE_sharedMemSet(MemoryNode *node, u8 value)
+{
+  if (NULL == node) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == node->data_) {
+    return kErrorCode_DataNull;
+  }
+  if (0 == node->size_) {
+    return kErrorCode_SizeZero;
+  }
+  if (True != MEMNODE_unshare(node)) {
+    return kErrorCode_Memory;
+  }
+  memset(node->data_, value, node->size_);
+  return kErrorCode_Ok;
+}
+
+s16 MEMNODE_sharedMemCopy(MemoryNode *node, void *src, u16 bytes)
+{
+  if (NULL == node) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == src) {
+    return kErrorCode_Null;
+  }
+  if (0 == bytes) {
+    return kErrorCode_SizeZero;
+  }
+  // the old payload stays with the other nodes, a new one is always needed
+  void *copy = MEMNODE_sharedAlloc(bytes);
+  if (NULL == copy) {
+    return kErrorCode_Memory;
+  }
+  memcpy(copy, src, bytes);
+  if (NULL != node->data_) {
+    MEMNODE_release(node->data_);
+  }
+  node->data_ = copy;
+  node->size_ = bytes;
+  return kErrorCode_Ok;
+}
+
+s16 MEMNODE_sharedMemConcat(MemoryNode *node, void *src, u16 bytes)
+{
+  if (NULL == node) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == node->data_) {
+    return kErrorCode_DataNull;
+  }
+  if (NULL == src) {
+    return kErrorCode_Null;
+  }
+  if ((u32)node->size_ + bytes > 0xFFFF - sizeof(SharedPayload)) {
+    return kErrorCode_Memory;
+  }
+  u8 *concat = MEMNODE_sharedAlloc(node->size_ + bytes);
+  if (NULL == concat) {
+    return kErrorCode_Memory;
+  }
+  memcpy(concat, node->data_, node->size_);
+  memcpy(concat + node->size_, src, bytes);
+  MEMNODE_release(node->data_);
+  node->data_ = concat;
+  node->size_ += bytes;
+  return kErrorCode_Ok;
+}
+
+s16 MEMNODE_sharedMemMask(MemoryNode *node, u8 mask)
+{
+  if (NULL == node) {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == node->data_) {
+    return kErrorCode_DataNull;
+  }
+  if (True != MEMNODE_unshare(node)) {
+    return kErrorCode_Memory;
+  }
+  u8 *aux = (u8*)node->data_;
+  for (u16 i = 0; i < node->size_; i++) {
+    aux[i] &= mask;
+  }
+  return kErrorCode_Ok;
+}
@@ -0,0 +1,277 @@
+/**
+ * @file adt_memory_stack.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-06-12
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_memory_stack.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 MEMSTACK_destroy(MemoryStack *stack);
+static s16 MEMSTACK_reset(MemoryStack *stack);
+static void *MEMSTACK_alloc(MemoryStack *stack, MemoryStackSide side, u32 bytes);
+static MemoryStackMarker MEMSTACK_marker(MemoryStack *stack, MemoryStackSide side);
+static s16 MEMSTACK_freeToMarker(MemoryStack *stack, MemoryStackSide side, MemoryStackMarker marker);
+static s16 MEMSTACK_checkGuards(MemoryStack *stack);
+static u32 MEMSTACK_used(MemoryStack *stack);
+static u32 MEMSTACK_highWater(MemoryStack *stack);
+static void MEMSTACK_print(MemoryStack *stack);
+
+struct memory_stack_ops_s memory_stack_ops = {
+    .destroy = MEMSTACK_destroy,
+    .reset = MEMSTACK_reset,
+    .alloc = MEMSTACK_alloc,
+    .marker = MEMSTACK_marker,
+    .freeToMarker = MEMSTACK_freeToMarker,
+    .checkGuards = MEMSTACK_checkGuards,
+    .used = MEMSTACK_used,
+    .highWater = MEMSTACK_highWater,
+    .print = MEMSTACK_print,
+};
+
+#define MEMSTACK_ALIGN(value) (((value) + kMemoryStackAlignment - 1) & ~(uintptr_t)(kMemoryStackAlignment - 1))
+
+#ifdef DEBUG
+// Written before every allocation in debug builds. Keeps the payload aligned.
+typedef struct memory_stack_header_s
+{
+  u32 bytes_;
+  u32 padding_;
+} MemoryStackHeader;
+
+// header + payload + padding + guard bytes
+static u32 MEMSTACK_blockSize(u32 bytes)
+{
+  return (u32)(sizeof(MemoryStackHeader) + MEMSTACK_ALIGN(bytes) + kMemoryStackGuardBytes);
+}
+
+// Walks the allocations stored in [from, to) and checks the bytes between
+// the end of each payload and the next header.
+static s16 MEMSTACK_checkRange(MemoryStack *stack, u32 from, u32 to)
+{
+  s16 error = kErrorCode_Ok;
+  while (from < to)
+  {
+    MemoryStackHeader *header = (MemoryStackHeader *)(stack->base_ + from);
+    u32 block_size = MEMSTACK_blockSize(header->bytes_);
+    if (block_size > to - from)
+    {
+      // the header itself was overwritten, nothing left to walk
+      return kErrorCode_MemoryStackGuard;
+    }
+    u8 *guard = (u8 *)(header + 1) + header->bytes_;
+    u8 *end = stack->base_ + from + block_size;
+    for (; guard < end; ++guard)
+    {
+      if (kMemoryStackGuardValue != *guard)
+      {
+        error = kErrorCode_MemoryStackGuard;
+        break;
+      }
+    }
+    from += block_size;
+  }
+  return error;
+}
+#else
+static u32 MEMSTACK_blockSize(u32 bytes)
+{
+  return (u32)MEMSTACK_ALIGN(bytes);
+}
+#endif
+
+MemoryStack *MEMSTACK_create(u32 capacity)
+{
+  capacity &= ~(u32)(kMemoryStackAlignment - 1);
+  if (0 == capacity || capacity > kMemoryStackMaxCapacity)
+  {
+    return NULL;
+  }
+  MemoryStack *stack = MM->malloc(sizeof(MemoryStack));
+  if (NULL == stack)
+  {
+    return NULL;
+  }
+  stack->block_ = MM->malloc(capacity + kMemoryStackAlignment);
+  if (NULL == stack->block_)
+  {
+    MM->free(stack);
+    return NULL;
+  }
+  stack->base_ = (u8 *)MEMSTACK_ALIGN((uintptr_t)stack->block_);
+  stack->capacity_ = capacity;
+  stack->low_ = 0;
+  stack->high_ = capacity;
+  stack->high_water_ = 0;
+  stack->ops_ = &memory_stack_ops;
+  return stack;
+}
+
+s16 MEMSTACK_destroy(MemoryStack *stack)
+{
+  if (NULL == stack)
+  {
+    return kErrorCode_MemoryStackNull;
+  }
+  MM->free(stack->block_);
+  MM->free(stack);
+  return kErrorCode_Ok;
+}
+
+s16 MEMSTACK_reset(MemoryStack *stack)
+{
+  if (NULL == stack)
+  {
+    return kErrorCode_MemoryStackNull;
+  }
+  stack->low_ = 0;
+  stack->high_ = stack->capacity_;
+  return kErrorCode_Ok;
+}
+
+void *MEMSTACK_alloc(MemoryStack *stack, MemoryStackSide side, u32 bytes)
+{
+  if (NULL == stack || 0 == bytes || bytes > stack->capacity_)
+  {
+    return NULL;
+  }
+  u32 block_size = MEMSTACK_blockSize(bytes);
+  if (block_size > stack->high_ - stack->low_)
+  {
+    return NULL;
+  }
+  u32 offset;
+  if (kMemoryStackSide_Low == side)
+  {
+    offset = stack->low_;
+    stack->low_ += block_size;
+  }
+  else
+  {
+    stack->high_ -= block_size;
+    offset = stack->high_;
+  }
+  u32 used = stack->low_ + (stack->capacity_ - stack->high_);
+  if (used > stack->high_water_)
+  {
+    stack->high_water_ = used;
+  }
+#ifdef DEBUG
+  MemoryStackHeader *header = (MemoryStackHeader *)(stack->base_ + offset);
+  header->bytes_ = bytes;
+  header->padding_ = 0;
+  memset((u8 *)(header + 1) + bytes, kMemoryStackGuardValue,
+         block_size - sizeof(MemoryStackHeader) - bytes);
+  return header + 1;
+#else
+  return stack->base_ + offset;
+#endif
+}
+
+MemoryStackMarker MEMSTACK_marker(MemoryStack *stack, MemoryStackSide side)
+{
+  if (NULL == stack)
+  {
+    return 0;
+  }
+  return kMemoryStackSide_Low == side ? stack->low_ : stack->high_;
+}
+
+s16 MEMSTACK_freeToMarker(MemoryStack *stack, MemoryStackSide side, MemoryStackMarker marker)
+{
+  if (NULL == stack)
+  {
+    return kErrorCode_MemoryStackNull;
+  }
+  u32 from;
+  u32 to;
+  if (kMemoryStackSide_Low == side)
+  {
+    if (marker > stack->low_)
+    {
+      return kErrorCode_MemoryStackMarker;
+    }
+    from = marker;
+    to = stack->low_;
+    stack->low_ = marker;
+  }
+  else
+  {
+    if (marker < stack->high_ || marker > stack->capacity_)
+    {
+      return kErrorCode_MemoryStackMarker;
+    }
+    from = stack->high_;
+    to = marker;
+    stack->high_ = marker;
+  }
+#ifdef DEBUG
+  s16 error = MEMSTACK_checkRange(stack, from, to);
+  memset(stack->base_ + from, kMemoryStackFreedValue, to - from);
+  return error;
+#else
+  (void)from;
+  (void)to;
+  return kErrorCode_Ok;
+#endif
+}
+
+s16 MEMSTACK_checkGuards(MemoryStack *stack)
+{
+  if (NULL == stack)
+  {
+    return kErrorCode_MemoryStackNull;
+  }
+#ifdef DEBUG
+  s16 error = MEMSTACK_checkRange(stack, 0, stack->low_);
+  if (kErrorCode_Ok == error)
+  {
+    error = MEMSTACK_checkRange(stack, stack->high_, stack->capacity_);
+  }
+  return error;
+#else
+  return kErrorCode_Ok;
+#endif
+}
+
+u32 MEMSTACK_used(MemoryStack *stack)
+{
+  if (NULL == stack)
+  {
+    return 0;
+  }
+  return stack->low_ + (stack->capacity_ - stack->high_);
+}
+
+u32 MEMSTACK_highWater(MemoryStack *stack)
+{
+  if (NULL == stack)
+  {
+    return 0;
+  }
+  return stack->high_water_;
+}
+
+void MEMSTACK_print(MemoryStack *stack)
+{
+  if (NULL == stack)
+  {
+    printf("\t[Memory Stack Info] Address: NULL\n");
+    return;
+  }
+  printf("\t[Memory Stack Info] Address: %p\n", stack);
+  printf("\t[Memory Stack Info] Capacity: %u bytes\n", stack->capacity_);
+  printf("\t[Memory Stack Info] Low side: %u bytes\n", stack->low_);
+  printf("\t[Memory Stack Info] High side: %u bytes\n", stack->capacity_ - stack->high_);
+  printf("\t[Memory Stack Info] Free: %u bytes, high-water mark: %u bytes\n",
+         stack->high_ - stack->low_, stack->high_water_);
+}
@@ -33,6 +33,8 @@ static void* Mh_VECTOR_extractLast(Mh_Vector* vector);//
 static void* Mh_VECTOR_extractAt(Mh_Vector* vector, u16 position);//
 static s16 Mh_VECTOR_concat(Mh_Vector* vector, Mh_Vector *vector_src);
 static s16 Mh_VECTOR_traverse(Mh_Vector* vector, void (*callback)(MemoryNode *));//
+static s16 Mh_VECTOR_traverseEx(Mh_Vector* vector, boolean (*callback)(MemoryNode *, void *), void *context);
+static s16 Mh_VECTOR_begin(Mh_Vector* vector, Cursor *cursor);
 static void Mh_VECTOR_print(Mh_Vector* vector);
 
 // vector´s api definitions
@@ -56,6 +58,8 @@ struct mh_vector_ops_s vector_ops = {
     .extractAt = Mh_VECTOR_extractAt,
     .concat = Mh_VECTOR_concat,
     .traverse = Mh_VECTOR_traverse,
+    .traverseEx = Mh_VECTOR_traverseEx,
+    .begin = Mh_VECTOR_begin,
     .print = Mh_VECTOR_print,
 };
 
@@ -454,6 +458,54 @@ s16 Mh_VECTOR_traverse(Mh_Vector *vector, void (*callback)(MemoryNode *))
   return kErrorCode_Ok;
 }
 
+s16 Mh_VECTOR_traverseEx(Mh_Vector *vector, boolean (*callback)(MemoryNode *, void *), void *context)
+{
+  if(NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  if(NULL == vector->storage_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if(NULL == callback)
+  {
+    return kErrorCode_Null;
+  }
+  for(u16 i = vector->head_; i < vector->tail_; i++)
+  {
+    if(True != callback(&vector->storage_[i], context))
+    {
+      break;
+    }
+  }
+
+  return kErrorCode_Ok;
+}
+
+s16 Mh_VECTOR_begin(Mh_Vector *vector, Cursor *cursor)
+{
+  if(NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 1, False);
+  if(NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  if(NULL == vector->storage_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if(vector->tail_ > vector->head_)
+  {
+    CURSOR_init(cursor, &vector->storage_[vector->head_], &vector->storage_[vector->tail_ - 1], 1, False);
+  }
+
+  return kErrorCode_Ok;
+}
+
 s16 Mh_VECTOR_resize(Mh_Vector *vector, u16 new_capacity)
 {
   if(NULL == vector)
@@ -0,0 +1,713 @@
+/**
+ * @file adt_mpmc_queue.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-08
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_mpmc_queue.h"
+#include "aligned_memory.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+// Bounded queue
+static s16 MPMCQUEUE_destroy(MPMCQueue *qu);
+static s16 MPMCQUEUE_reset(MPMCQueue *qu);
+static u16 MPMCQUEUE_capacity(MPMCQueue *qu);
+static u16 MPMCQUEUE_length(MPMCQueue *qu);
+static boolean MPMCQUEUE_isEmpty(MPMCQueue *qu);
+static boolean MPMCQUEUE_isFull(MPMCQueue *qu);
+static s16 MPMCQUEUE_enqueue(MPMCQueue *qu, void *data, u16 bytes);
+static void *MPMCQUEUE_dequeue(MPMCQueue *qu);
+static s16 MPMCQUEUE_tryEnqueue(MPMCQueue *qu, void *data, u16 bytes);
+static void *MPMCQUEUE_tryDequeue(MPMCQueue *qu);
+static void MPMCQUEUE_print(MPMCQueue *qu);
+
+// Unbounded segmented queue
+static s16 MPMCSEGQUEUE_destroy(MPMCSegQueue *qu);
+static u32 MPMCSEGQUEUE_length(MPMCSegQueue *qu);
+static boolean MPMCSEGQUEUE_isEmpty(MPMCSegQueue *qu);
+static s16 MPMCSEGQUEUE_enqueue(MPMCSegQueue *qu, void *data, u16 bytes);
+static void *MPMCSEGQUEUE_dequeue(MPMCSegQueue *qu);
+static s16 MPMCSEGQUEUE_tryEnqueue(MPMCSegQueue *qu, void *data, u16 bytes);
+static void *MPMCSEGQUEUE_tryDequeue(MPMCSegQueue *qu);
+static void MPMCSEGQUEUE_print(MPMCSegQueue *qu);
+
+static MPMCSegment *MPMCSEGQUEUE_allocSegment(MPMCSegQueue *qu);
+static void MPMCSEGQUEUE_poolSegment(MPMCSegQueue *qu, MPMCSegment *seg);
+static MPMCSegment *MPMCSEGQUEUE_acquire(MPMCSegQueue *qu, _Atomic(MPMCSegment *) *src);
+static void MPMCSEGQUEUE_release(MPMCSegQueue *qu, MPMCSegment *seg);
+
+struct mpmc_queue_ops_s mpmc_queue_ops = {
+    .destroy = MPMCQUEUE_destroy,
+    .reset = MPMCQUEUE_reset,
+    .capacity = MPMCQUEUE_capacity,
+    .length = MPMCQUEUE_length,
+    .isEmpty = MPMCQUEUE_isEmpty,
+    .isFull = MPMCQUEUE_isFull,
+    .enqueue = MPMCQUEUE_enqueue,
+    .dequeue = MPMCQUEUE_dequeue,
+    .tryEnqueue = MPMCQUEUE_tryEnqueue,
+    .tryDequeue = MPMCQUEUE_tryDequeue,
+    .print = MPMCQUEUE_print,
+};
+
+struct mpmc_seg_queue_ops_s mpmc_seg_queue_ops = {
+    .destroy = MPMCSEGQUEUE_destroy,
+    .length = MPMCSEGQUEUE_length,
+    .isEmpty = MPMCSEGQUEUE_isEmpty,
+    .enqueue = MPMCSEGQUEUE_enqueue,
+    .dequeue = MPMCSEGQUEUE_dequeue,
+    .tryEnqueue = MPMCSEGQUEUE_tryEnqueue,
+    .tryDequeue = MPMCSEGQUEUE_tryDequeue,
+    .print = MPMCSEGQUEUE_print,
+};
+
+// Marks a slot whose payload has been taken (or that a consumer gave up on)
+static u8 kSlotTaken;
+#define SLOT_TAKEN ((void *)&kSlotTaken)
+
+// Flags kept in the top bits of MPMCSegment::refs_
+#define SEGMENT_RETIRED 0x80000000u
+#define SEGMENT_POOLED 0x40000000u
+
+/*
+  ____                        _          _
+ |  _ \                      | |        | |
+ | |_) | ___  _   _ _ __   __| | ___  __| |
+ |  _ < / _ \| | | | '_ \ / _` |/ _ \/ _` |
+ | |_) | (_) | |_| | | | | (_| |  __/ (_| |
+ |____/ \___/ \__,_|_| |_|\__,_|\___|\__,_|
+*/
+
+MPMCQueue *MPMCQUEUE_create(u16 capacity)
+{
+  if (0 == capacity || capacity > 0x8000)
+  {
+    return NULL;
+  }
+  u32 ring_size = 2;
+  while (ring_size < capacity)
+  {
+    ring_size <<= 1;
+  }
+
+  MPMCQueue *qu = ALIGNED_malloc(sizeof(MPMCQueue));
+  if (NULL == qu)
+  {
+    return NULL;
+  }
+  qu->storage_ = ALIGNED_malloc(sizeof(MPMCCell) * ring_size);
+  if (NULL == qu->storage_)
+  {
+    ALIGNED_free(qu);
+    return NULL;
+  }
+  for (u32 i = 0; i < ring_size; i++)
+  {
+    atomic_init(&qu->storage_[i].sequence_, i);
+    qu->storage_[i].size_ = 0;
+    qu->storage_[i].data_ = NULL;
+  }
+  atomic_init(&qu->enqueue_pos_, 0);
+  atomic_init(&qu->dequeue_pos_, 0);
+  qu->mask_ = ring_size - 1;
+  qu->capacity_ = ring_size;
+  qu->ops_ = &mpmc_queue_ops;
+  return qu;
+}
+
+s16 MPMCQUEUE_destroy(MPMCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return kErrorCode_QueueNull;
+  }
+  if (NULL != qu->storage_)
+  {
+    MPMCQUEUE_reset(qu);
+    ALIGNED_free(qu->storage_);
+  }
+  ALIGNED_free(qu);
+  return kErrorCode_Ok;
+}
+
+s16 MPMCQUEUE_reset(MPMCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return kErrorCode_QueueNull;
+  }
+  void *data = MPMCQUEUE_tryDequeue(qu);
+  while (NULL != data)
+  {
+    MM->free(data);
+    data = MPMCQUEUE_tryDequeue(qu);
+  }
+  return kErrorCode_Ok;
+}
+
+u16 MPMCQUEUE_capacity(MPMCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return 0;
+  }
+  return (u16)qu->capacity_;
+}
+
+u16 MPMCQUEUE_length(MPMCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return 0;
+  }
+  u32 dequeue_pos = atomic_load_explicit(&qu->dequeue_pos_, memory_order_acquire);
+  u32 enqueue_pos = atomic_load_explicit(&qu->enqueue_pos_, memory_order_acquire);
+  s32 length = (s32)(enqueue_pos - dequeue_pos);
+  if (length < 0)
+  {
+    return 0;
+  }
+  return length > (s32)qu->capacity_ ? (u16)qu->capacity_ : (u16)length;
+}
+
+boolean MPMCQUEUE_isEmpty(MPMCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return True;
+  }
+  return 0 == MPMCQUEUE_length(qu) ? True : False;
+}
+
+boolean MPMCQUEUE_isFull(MPMCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return False;
+  }
+  return MPMCQUEUE_length(qu) >= qu->capacity_ ? True : False;
+}
+
+s16 MPMCQUEUE_tryEnqueue(MPMCQueue *qu, void *data, u16 bytes)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return kErrorCode_QueueNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  MPMCCell *cell;
+  u32 pos = atomic_load_explicit(&qu->enqueue_pos_, memory_order_relaxed);
+  for (;;)
+  {
+    cell = &qu->storage_[pos & qu->mask_];
+    u32 sequence = atomic_load_explicit(&cell->sequence_, memory_order_acquire);
+    s32 diff = (s32)(sequence - pos);
+    if (0 == diff)
+    {
+      // the slot is free for this lap: claim the position
+      if (atomic_compare_exchange_weak_explicit(&qu->enqueue_pos_, &pos, pos + 1,
+                                                memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      // the consumer of the previous lap has not released the slot yet
+      return kErrorCode_QueueFull;
+    }
+    else
+    {
+      pos = atomic_load_explicit(&qu->enqueue_pos_, memory_order_relaxed);
+    }
+  }
+  cell->data_ = data;
+  cell->size_ = bytes;
+  atomic_store_explicit(&cell->sequence_, pos + 1, memory_order_release);
+  return kErrorCode_Ok;
+}
+
+void *MPMCQUEUE_tryDequeue(MPMCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return NULL;
+  }
+  MPMCCell *cell;
+  u32 pos = atomic_load_explicit(&qu->dequeue_pos_, memory_order_relaxed);
+  for (;;)
+  {
+    cell = &qu->storage_[pos & qu->mask_];
+    u32 sequence = atomic_load_explicit(&cell->sequence_, memory_order_acquire);
+    s32 diff = (s32)(sequence - (pos + 1));
+    if (0 == diff)
+    {
+      if (atomic_compare_exchange_weak_explicit(&qu->dequeue_pos_, &pos, pos + 1,
+                                                memory_order_relaxed, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      return NULL;
+    }
+    else
+    {
+      pos = atomic_load_explicit(&qu->dequeue_pos_, memory_order_relaxed);
+    }
+  }
+  void *data = cell->data_;
+  cell->data_ = NULL;
+  cell->size_ = 0;
+  // the slot becomes free for the producer of the next lap
+  atomic_store_explicit(&cell->sequence_, pos + qu->mask_ + 1, memory_order_release);
+  return data;
+}
+
+s16 MPMCQUEUE_enqueue(MPMCQueue *qu, void *data, u16 bytes)
+{
+  s16 error = MPMCQUEUE_tryEnqueue(qu, data, bytes);
+  while (kErrorCode_QueueFull == error)
+  {
+    thrd_yield();
+    error = MPMCQUEUE_tryEnqueue(qu, data, bytes);
+  }
+  return error;
+}
+
+void *MPMCQUEUE_dequeue(MPMCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return NULL;
+  }
+  void *data = MPMCQUEUE_tryDequeue(qu);
+  while (NULL == data)
+  {
+    thrd_yield();
+    data = MPMCQUEUE_tryDequeue(qu);
+  }
+  return data;
+}
+
+void MPMCQUEUE_print(MPMCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    printf("\t[MPMCQueue Info] Address: NULL\n");
+    return;
+  }
+  u32 dequeue_pos = atomic_load_explicit(&qu->dequeue_pos_, memory_order_acquire);
+  u32 enqueue_pos = atomic_load_explicit(&qu->enqueue_pos_, memory_order_acquire);
+  printf("\t[MPMCQueue Info] Address: %p\n", qu);
+  printf("\t[MPMCQueue Info] Dequeue position: %u\n", dequeue_pos);
+  printf("\t[MPMCQueue Info] Enqueue position: %u\n", enqueue_pos);
+  printf("\t[MPMCQueue Info] Length: %d\n", MPMCQUEUE_length(qu));
+  printf("\t[MPMCQueue Info] Capacity: %u\n", qu->capacity_);
+  if (NULL == qu->storage_)
+  {
+    return;
+  }
+  for (u32 i = dequeue_pos; i != enqueue_pos; i++)
+  {
+    MPMCCell *cell = &qu->storage_[i & qu->mask_];
+    printf("\t\t[MPMCQueue Info] Slot #%u\n", i & qu->mask_);
+    printf("\t\t\t[Cell Info] Size: %d\n", cell->size_);
+    printf("\t\t\t[Cell Info] Data Content: ");
+    u8 *data_byte = cell->data_;
+    for (u16 j = 0; NULL != data_byte && j < cell->size_; j++)
+    {
+      printf("%c", data_byte[j]);
+    }
+    printf("\n");
+  }
+}
+
+/*
+   _____                                 _           _
+  / ____|                               | |         | |
+ | (___   ___  __ _ _ __ ___   ___ _ __ | |_ ___  __| |
+  \___ \ / _ \/ _` | '_ ` _ \ / _ \ '_ \| __/ _ \/ _` |
+  ____) |  __/ (_| | | | | | |  __/ | | | ||  __/ (_| |
+ |_____/ \___|\__, |_| |_| |_|\___|_| |_|\__\___|\__,_|
+               __/ |
+              |___/
+*/
+
+MPMCSegQueue *MPMCSEGQUEUE_create(u16 segment_capacity)
+{
+  if (0 == segment_capacity)
+  {
+    return NULL;
+  }
+  MPMCSegQueue *qu = ALIGNED_malloc(sizeof(MPMCSegQueue));
+  if (NULL == qu)
+  {
+    return NULL;
+  }
+  if (thrd_success != mtx_init(&qu->pool_mutex_, mtx_plain))
+  {
+    ALIGNED_free(qu);
+    return NULL;
+  }
+  qu->pool_ = NULL;
+  qu->segment_capacity_ = segment_capacity;
+
+  MPMCSegment *first = MPMCSEGQUEUE_allocSegment(qu);
+  if (NULL == first)
+  {
+    mtx_destroy(&qu->pool_mutex_);
+    ALIGNED_free(qu);
+    return NULL;
+  }
+  first->index_ = 0;
+  atomic_init(&qu->head_, first);
+  atomic_init(&qu->tail_, first);
+  qu->ops_ = &mpmc_seg_queue_ops;
+  return qu;
+}
+
+// Takes a segment from the pool (or from MM) and leaves it empty
+MPMCSegment *MPMCSEGQUEUE_allocSegment(MPMCSegQueue *qu)
+{
+  mtx_lock(&qu->pool_mutex_);
+  MPMCSegment *seg = qu->pool_;
+  if (NULL != seg)
+  {
+    qu->pool_ = seg->pool_next_;
+  }
+  mtx_unlock(&qu->pool_mutex_);
+
+  if (NULL == seg)
+  {
+    seg = ALIGNED_malloc(sizeof(MPMCSegment));
+    if (NULL == seg)
+    {
+      return NULL;
+    }
+    seg->slots_ = ALIGNED_malloc(sizeof(void *) * qu->segment_capacity_);
+    if (NULL == seg->slots_)
+    {
+      ALIGNED_free(seg);
+      return NULL;
+    }
+    atomic_init(&seg->refs_, 0);
+  }
+  else
+  {
+    // a late thread may still be bumping the counter of the old life:
+    // only the flags are cleared, its increment/decrement pair stays balanced
+    atomic_fetch_and_explicit(&seg->refs_, ~(SEGMENT_RETIRED | SEGMENT_POOLED), memory_order_relaxed);
+  }
+  for (u16 i = 0; i < qu->segment_capacity_; i++)
+  {
+    atomic_init(&seg->slots_[i], NULL);
+  }
+  atomic_init(&seg->enqueue_idx_, 0);
+  atomic_init(&seg->dequeue_idx_, 0);
+  atomic_init(&seg->next_, NULL);
+  seg->pool_next_ = NULL;
+  seg->index_ = 0;
+  return seg;
+}
+
+void MPMCSEGQUEUE_poolSegment(MPMCSegQueue *qu, MPMCSegment *seg)
+{
+  mtx_lock(&qu->pool_mutex_);
+  seg->pool_next_ = qu->pool_;
+  qu->pool_ = seg;
+  mtx_unlock(&qu->pool_mutex_);
+}
+
+// Takes a reference on the segment pointed by head_ or tail_. The counter is
+// bumped before checking that the segment is still linked there, so once
+// this returns the segment cannot go back to the pool until released.
+MPMCSegment *MPMCSEGQUEUE_acquire(MPMCSegQueue *qu, _Atomic(MPMCSegment *) *src)
+{
+  for (;;)
+  {
+    MPMCSegment *seg = atomic_load_explicit(src, memory_order_seq_cst);
+    atomic_fetch_add_explicit(&seg->refs_, 1, memory_order_seq_cst);
+    if (seg == atomic_load_explicit(src, memory_order_seq_cst))
+    {
+      return seg;
+    }
+    MPMCSEGQUEUE_release(qu, seg);
+  }
+}
+
+// The last reference of a retired segment pools it. The flag is set with a
+// CAS because late acquirers can make the count touch zero more than once.
+void MPMCSEGQUEUE_release(MPMCSegQueue *qu, MPMCSegment *seg)
+{
+  u32 refs = atomic_fetch_sub_explicit(&seg->refs_, 1, memory_order_acq_rel) - 1;
+  if (SEGMENT_RETIRED != refs)
+  {
+    return;
+  }
+  if (atomic_compare_exchange_strong_explicit(&seg->refs_, &refs, SEGMENT_RETIRED | SEGMENT_POOLED,
+                                              memory_order_acq_rel, memory_order_relaxed))
+  {
+    MPMCSEGQUEUE_poolSegment(qu, seg);
+  }
+}
+
+s16 MPMCSEGQUEUE_tryEnqueue(MPMCSegQueue *qu, void *data, u16 bytes)
+{
+  if (NULL == qu)
+  {
+    return kErrorCode_QueueNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  for (;;)
+  {
+    MPMCSegment *tail = MPMCSEGQUEUE_acquire(qu, &qu->tail_);
+    u32 idx = atomic_fetch_add_explicit(&tail->enqueue_idx_, 1, memory_order_acq_rel);
+    if (idx < qu->segment_capacity_)
+    {
+      void *expected = NULL;
+      boolean stored = atomic_compare_exchange_strong_explicit(&tail->slots_[idx], &expected, data,
+                                                               memory_order_release, memory_order_relaxed);
+      MPMCSEGQUEUE_release(qu, tail);
+      if (stored)
+      {
+        return kErrorCode_Ok;
+      }
+      // a consumer gave up on this slot before we wrote it, take another one
+      continue;
+    }
+    // the segment is full: link a new one or help the tail forward
+    MPMCSegment *next = atomic_load_explicit(&tail->next_, memory_order_acquire);
+    if (NULL == next)
+    {
+      MPMCSegment *seg = MPMCSEGQUEUE_allocSegment(qu);
+      if (NULL == seg)
+      {
+        MPMCSEGQUEUE_release(qu, tail);
+        return kErrorCode_Memory;
+      }
+      atomic_store_explicit(&seg->slots_[0], data, memory_order_relaxed);
+      atomic_store_explicit(&seg->enqueue_idx_, 1, memory_order_relaxed);
+      seg->index_ = tail->index_ + 1;
+      MPMCSegment *expected = NULL;
+      if (atomic_compare_exchange_strong_explicit(&tail->next_, &expected, seg,
+                                                  memory_order_seq_cst, memory_order_relaxed))
+      {
+        expected = tail;
+        atomic_compare_exchange_strong_explicit(&qu->tail_, &expected, seg,
+                                                memory_order_seq_cst, memory_order_relaxed);
+        MPMCSEGQUEUE_release(qu, tail);
+        return kErrorCode_Ok;
+      }
+      // another producer linked first; the segment was never published
+      MPMCSEGQUEUE_poolSegment(qu, seg);
+    }
+    else
+    {
+      MPMCSegment *expected = tail;
+      atomic_compare_exchange_strong_explicit(&qu->tail_, &expected, next,
+                                              memory_order_seq_cst, memory_order_relaxed);
+    }
+    MPMCSEGQUEUE_release(qu, tail);
+  }
+}
+
+s16 MPMCSEGQUEUE_enqueue(MPMCSegQueue *qu, void *data, u16 bytes)
+{
+  return MPMCSEGQUEUE_tryEnqueue(qu, data, bytes);
+}
+
+void *MPMCSEGQUEUE_tryDequeue(MPMCSegQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return NULL;
+  }
+  for (;;)
+  {
+    MPMCSegment *head = MPMCSEGQUEUE_acquire(qu, &qu->head_);
+    u32 dequeue_idx = atomic_load_explicit(&head->dequeue_idx_, memory_order_acquire);
+    u32 enqueue_idx = atomic_load_explicit(&head->enqueue_idx_, memory_order_acquire);
+    if (dequeue_idx >= enqueue_idx &&
+        NULL == atomic_load_explicit(&head->next_, memory_order_acquire))
+    {
+      MPMCSEGQUEUE_release(qu, head);
+      return NULL;
+    }
+    u32 idx = atomic_fetch_add_explicit(&head->dequeue_idx_, 1, memory_order_acq_rel);
+    if (idx >= qu->segment_capacity_)
+    {
+      // the segment is drained, move on to the next one
+      MPMCSegment *next = atomic_load_explicit(&head->next_, memory_order_acquire);
+      if (NULL == next)
+      {
+        MPMCSEGQUEUE_release(qu, head);
+        return NULL;
+      }
+      MPMCSegment *expected = head;
+      if (atomic_compare_exchange_strong_explicit(&qu->head_, &expected, next,
+                                                  memory_order_seq_cst, memory_order_relaxed))
+      {
+        // a lagging tail must not keep pointing to a retired segment
+        expected = head;
+        atomic_compare_exchange_strong_explicit(&qu->tail_, &expected, next,
+                                                memory_order_seq_cst, memory_order_relaxed);
+        // our own reference is still counted: release() below pools it
+        // unless somebody else is still working on the segment
+        atomic_fetch_or_explicit(&head->refs_, SEGMENT_RETIRED, memory_order_seq_cst);
+      }
+      MPMCSEGQUEUE_release(qu, head);
+      continue;
+    }
+    void *data = atomic_exchange_explicit(&head->slots_[idx], SLOT_TAKEN, memory_order_acq_rel);
+    MPMCSEGQUEUE_release(qu, head);
+    if (NULL == data)
+    {
+      // the producer of this slot is late: it will see the mark and retry
+      continue;
+    }
+    return data;
+  }
+}
+
+void *MPMCSEGQUEUE_dequeue(MPMCSegQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return NULL;
+  }
+  void *data = MPMCSEGQUEUE_tryDequeue(qu);
+  while (NULL == data)
+  {
+    thrd_yield();
+    data = MPMCSEGQUEUE_tryDequeue(qu);
+  }
+  return data;
+}
+
+// Full segments between head and tail are counted through index_
+u32 MPMCSEGQUEUE_length(MPMCSegQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return 0;
+  }
+  MPMCSegment *head = MPMCSEGQUEUE_acquire(qu, &qu->head_);
+  MPMCSegment *tail = MPMCSEGQUEUE_acquire(qu, &qu->tail_);
+  u32 dequeue_idx = atomic_load_explicit(&head->dequeue_idx_, memory_order_acquire);
+  u32 enqueue_idx = atomic_load_explicit(&tail->enqueue_idx_, memory_order_acquire);
+  if (dequeue_idx > qu->segment_capacity_)
+  {
+    dequeue_idx = qu->segment_capacity_;
+  }
+  if (enqueue_idx > qu->segment_capacity_)
+  {
+    enqueue_idx = qu->segment_capacity_;
+  }
+  u32 length = 0;
+  if (tail->index_ >= head->index_)
+  {
+    u32 total = (tail->index_ - head->index_) * qu->segment_capacity_ + enqueue_idx;
+    length = total > dequeue_idx ? total - dequeue_idx : 0;
+  }
+  MPMCSEGQUEUE_release(qu, tail);
+  MPMCSEGQUEUE_release(qu, head);
+  return length;
+}
+
+boolean MPMCSEGQUEUE_isEmpty(MPMCSegQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return True;
+  }
+  return 0 == MPMCSEGQUEUE_length(qu) ? True : False;
+}
+
+static void MPMCSEGQUEUE_freeSegment(MPMCSegment *seg)
+{
+  ALIGNED_free(seg->slots_);
+  ALIGNED_free(seg);
+}
+
+s16 MPMCSEGQUEUE_destroy(MPMCSegQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return kErrorCode_QueueNull;
+  }
+  MPMCSegment *seg = atomic_load_explicit(&qu->head_, memory_order_acquire);
+  while (NULL != seg)
+  {
+    MPMCSegment *next = atomic_load_explicit(&seg->next_, memory_order_acquire);
+    for (u16 i = 0; i < qu->segment_capacity_; i++)
+    {
+      void *data = atomic_load_explicit(&seg->slots_[i], memory_order_relaxed);
+      if (NULL != data && SLOT_TAKEN != data)
+      {
+        MM->free(data);
+      }
+    }
+    MPMCSEGQUEUE_freeSegment(seg);
+    seg = next;
+  }
+  seg = qu->pool_;
+  while (NULL != seg)
+  {
+    MPMCSegment *next = seg->pool_next_;
+    MPMCSEGQUEUE_freeSegment(seg);
+    seg = next;
+  }
+  mtx_destroy(&qu->pool_mutex_);
+  ALIGNED_free(qu);
+  return kErrorCode_Ok;
+}
+
+void MPMCSEGQUEUE_print(MPMCSegQueue *qu)
+{
+  if (NULL == qu)
+  {
+    printf("\t[MPMCSegQueue Info] Address: NULL\n");
+    return;
+  }
+  printf("\t[MPMCSegQueue Info] Address: %p\n", qu);
+  printf("\t[MPMCSegQueue Info] Length: %u\n", MPMCSEGQUEUE_length(qu));
+  printf("\t[MPMCSegQueue Info] Segment capacity: %d\n", qu->segment_capacity_);
+  u16 pooled = 0;
+  for (MPMCSegment *seg = qu->pool_; NULL != seg; seg = seg->pool_next_)
+  {
+    pooled++;
+  }
+  printf("\t[MPMCSegQueue Info] Pooled segments: %d\n", pooled);
+  u16 n = 0;
+  MPMCSegment *seg = atomic_load_explicit(&qu->head_, memory_order_acquire);
+  while (NULL != seg)
+  {
+    printf("\t\t[MPMCSegQueue Info] Segment #%d: %p\n", n++, seg);
+    printf("\t\t\t[Segment Info] Enqueue index: %u\n", atomic_load(&seg->enqueue_idx_));
+    printf("\t\t\t[Segment Info] Dequeue index: %u\n", atomic_load(&seg->dequeue_idx_));
+    seg = atomic_load_explicit(&seg->next_, memory_order_acquire);
+  }
+}
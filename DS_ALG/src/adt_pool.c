@@ -0,0 +1,188 @@
+/**
+ * @file adt_pool.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-19
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_pool.h"
+#include "file_map.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 POOL_destroy(Pool *pool);
+static s16 POOL_reset(Pool *pool);
+static void *POOL_alloc(Pool *pool);
+static s16 POOL_free(Pool *pool, void *object);
+static u32 POOL_live(Pool *pool);
+static u64 POOL_capacity(Pool *pool);
+static void POOL_print(Pool *pool);
+
+struct pool_ops_s pool_ops = {
+    .destroy = POOL_destroy,
+    .reset = POOL_reset,
+    .alloc = POOL_alloc,
+    .free = POOL_free,
+    .live = POOL_live,
+    .capacity = POOL_capacity,
+    .print = POOL_print,
+};
+
+Pool *POOL_create(u32 object_bytes, u32 slab_bytes)
+{
+  if (0 == object_bytes)
+  {
+    return NULL;
+  }
+  // room for the free list link, and every object aligned
+  object_bytes = object_bytes < sizeof(void *) ? sizeof(void *) : object_bytes;
+  object_bytes = (object_bytes + kPoolAlignment - 1) & ~(u32)(kPoolAlignment - 1);
+  if (slab_bytes < CACHE_LINE_SIZE || slab_bytes - CACHE_LINE_SIZE < object_bytes)
+  {
+    return NULL;
+  }
+  Pool *pool = MM->malloc(sizeof(Pool));
+  if (NULL == pool)
+  {
+    return NULL;
+  }
+  pool->free_ = NULL;
+  pool->first_ = NULL;
+  pool->current_ = NULL;
+  pool->slab_used_ = slab_bytes;
+  pool->object_bytes_ = object_bytes;
+  pool->slab_bytes_ = slab_bytes;
+  pool->live_ = 0;
+  pool->ops_ = &pool_ops;
+  return pool;
+}
+
+s16 POOL_destroy(Pool *pool)
+{
+  if (NULL == pool)
+  {
+    return kErrorCode_PoolNull;
+  }
+  PoolSlab *slab = pool->first_;
+  while (NULL != slab)
+  {
+    PoolSlab *next = slab->next_;
+    FILEMAP_pagesFree(slab, pool->slab_bytes_);
+    slab = next;
+  }
+  MM->free(pool);
+  return kErrorCode_Ok;
+}
+
+s16 POOL_reset(Pool *pool)
+{
+  if (NULL == pool)
+  {
+    return kErrorCode_PoolNull;
+  }
+  pool->free_ = NULL;
+  pool->current_ = pool->first_;
+  pool->slab_used_ = NULL == pool->first_ ? pool->slab_bytes_ : CACHE_LINE_SIZE;
+  pool->live_ = 0;
+  return kErrorCode_Ok;
+}
+
+void *POOL_alloc(Pool *pool)
+{
+  if (NULL == pool)
+  {
+    return NULL;
+  }
+  void *object = pool->free_;
+  if (NULL != object)
+  {
+    pool->free_ = *(void **)object;
+    pool->live_++;
+    return object;
+  }
+  if (pool->slab_bytes_ - pool->slab_used_ < pool->object_bytes_)
+  {
+    // slabs kept by a reset are carved again before asking the OS for a new one
+    PoolSlab *slab = NULL == pool->current_ ? NULL : pool->current_->next_;
+    if (NULL == slab)
+    {
+      slab = FILEMAP_pagesAlloc(pool->slab_bytes_);
+      if (NULL == slab)
+      {
+        return NULL;
+      }
+      slab->next_ = NULL;
+      if (NULL == pool->current_)
+      {
+        pool->first_ = slab;
+      }
+      else
+      {
+        pool->current_->next_ = slab;
+      }
+    }
+    pool->current_ = slab;
+    pool->slab_used_ = CACHE_LINE_SIZE;
+  }
+  object = (u8 *)pool->current_ + pool->slab_used_;
+  pool->slab_used_ += pool->object_bytes_;
+  pool->live_++;
+  return object;
+}
+
+s16 POOL_free(Pool *pool, void *object)
+{
+  if (NULL == pool)
+  {
+    return kErrorCode_PoolNull;
+  }
+  if (NULL == object)
+  {
+    return kErrorCode_Null;
+  }
+  *(void **)object = pool->free_;
+  pool->free_ = object;
+  pool->live_--;
+  return kErrorCode_Ok;
+}
+
+u32 POOL_live(Pool *pool)
+{
+  if (NULL == pool)
+  {
+    return 0;
+  }
+  return pool->live_;
+}
+
+u64 POOL_capacity(Pool *pool)
+{
+  if (NULL == pool)
+  {
+    return 0;
+  }
+  u64 capacity = 0;
+  for (PoolSlab *slab = pool->first_; NULL != slab; slab = slab->next_)
+  {
+    capacity += pool->slab_bytes_;
+  }
+  return capacity;
+}
+
+void POOL_print(Pool *pool)
+{
+  if (NULL == pool)
+  {
+    printf("\t[Pool Info] Address: NULL\n");
+    return;
+  }
+  printf("\t[Pool Info] Address: %p\n", pool);
+  printf("\t[Pool Info] Object size: %u, slab size: %u\n", pool->object_bytes_, pool->slab_bytes_);
+  printf("\t[Pool Info] %u objects in use, %llu bytes of slabs\n", pool->live_,
+         (unsigned long long)POOL_capacity(pool));
+}
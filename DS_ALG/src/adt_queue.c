@@ -6,6 +6,23 @@
  * @version 1.0
  */
 
+// fileno, truncate and off_t are POSIX, not C11
+#ifndef _WIN32
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 #include "common_def.h"
 
 #include "adt_queue.h"
@@ -24,7 +41,16 @@ static void* dequeue(Queue* qu);//extract first
 static void* QUEUE_back(Queue* qu);//last
 static void* QUEUE_front(Queue* qu);//first
 static s16 QUEUE_concat(Queue* qu, Queue* qu_src);
+static s16 QUEUE_traverseEx(Queue* qu, boolean (*callback)(MemoryNode*, void*), void* context);
+static s16 QUEUE_begin(Queue* qu, Cursor* cursor);
 static void QUEUE_print(Queue* stack);
+static s16 QUEUE_sync(Queue* qu);
+static s16 QUEUE_durableDestroy(Queue* qu);
+static s16 QUEUE_durableReset(Queue* qu);
+static s16 QUEUE_durableEnqueue(Queue* qu, void* data, u16 bytes);
+static void* QUEUE_durableDequeue(Queue* qu);
+static s16 QUEUE_durableConcat(Queue* qu, Queue* qu_src);
+static s16 QUEUE_durableSync(Queue* qu);
 
 struct queue_ops_s queue_ops = {
 
@@ -40,12 +66,36 @@ struct queue_ops_s queue_ops = {
 								.back = QUEUE_back,
 								.front = QUEUE_front,
 								.concat = QUEUE_concat,
+								.traverseEx = QUEUE_traverseEx,
+								.begin = QUEUE_begin,
+								.print = QUEUE_print,
+								.sync = QUEUE_sync,
+};
+
+// Same operations for the durable queues: the changes are logged
+struct queue_ops_s queue_durable_ops = {
+
+								.destroy = QUEUE_durableDestroy,
+								.reset = QUEUE_durableReset,
+								.resize = QUEUE_resize,
+								.capacity = QUEUE_capacity,
+								.length = QUEUE_lenght,
+								.isEmpty = QUEUE_isEmpty,
+								.isFull = QUEUE_isFull,
+								.enqueue = QUEUE_durableEnqueue,
+								.dequeue = QUEUE_durableDequeue,
+								.back = QUEUE_back,
+								.front = QUEUE_front,
+								.concat = QUEUE_durableConcat,
+								.traverseEx = QUEUE_traverseEx,
+								.begin = QUEUE_begin,
 								.print = QUEUE_print,
+								.sync = QUEUE_durableSync,
 };
 
 Queue* QUEUE_create(u16 capacity)
 {
-	Queue* qu = (Queue*)malloc(sizeof(Queue));
+	Queue* qu = (Queue*)MM->malloc(sizeof(Queue));
 	if (NULL == qu) 
 	{
 		return NULL;
@@ -53,7 +103,7 @@ Queue* QUEUE_create(u16 capacity)
 	qu->storage_ = LIST_create(capacity);
 	if (NULL == qu->storage_)
 	{
-		free(qu);
+		MM->free(qu);
 		return NULL;
 	}
 	qu->ops_ = &queue_ops;
@@ -68,6 +118,7 @@ s16 QUEUE_destroy(Queue* qu)
 		return kErrorCode_QueueNull;
 	}
 	qu->storage_->ops_->destroy(qu->storage_);
+	MM->free(qu);
 	return kErrorCode_Ok;
 }
 
@@ -95,8 +146,7 @@ u16 QUEUE_capacity(Queue* qu)
 	{
 		return 0;
 	}
-	qu->storage_->ops_->capacity(qu->storage_);
-	return kErrorCode_Ok;
+	return qu->storage_->ops_->capacity(qu->storage_);
 }
 u16 QUEUE_lenght(Queue* qu)
 {
@@ -104,8 +154,7 @@ u16 QUEUE_lenght(Queue* qu)
 	{
 		return 0;
 	}
-	qu->storage_->ops_->length(qu->storage_);
-	return kErrorCode_Ok;
+	return qu->storage_->ops_->length(qu->storage_);
 }
 boolean QUEUE_isEmpty(Queue* qu) 
 {
@@ -169,6 +218,29 @@ s16 QUEUE_concat(Queue* qu, Queue* qu_src)
 	qu->storage_->ops_->concat(qu->storage_, qu_src->storage_);
 	return kErrorCode_Ok;
 }
+// The front is the head of the storage list
+s16 QUEUE_traverseEx(Queue* qu, boolean (*callback)(MemoryNode*, void*), void* context)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		return kErrorCode_QueueNull;
+	}
+	return qu->storage_->ops_->traverseEx(qu->storage_, callback, context);
+}
+
+s16 QUEUE_begin(Queue* qu, Cursor* cursor)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		if (NULL != cursor)
+		{
+			CURSOR_init(cursor, NULL, NULL, 0, False);
+		}
+		return kErrorCode_QueueNull;
+	}
+	return qu->storage_->ops_->begin(qu->storage_, cursor);
+}
+
 void QUEUE_print(Queue* qu)
 {
 	if (NULL == qu || NULL == qu->storage_)
@@ -177,4 +249,516 @@ void QUEUE_print(Queue* qu)
 	}
 	qu->storage_->ops_->print(qu->storage_);
 	return kErrorCode_Ok;
-}
\ No newline at end of file
+}
+
+s16 QUEUE_sync(Queue* qu)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		return kErrorCode_QueueNull;
+	}
+	return kErrorCode_Ok;
+}
+
+#define kDurableMetaMagic 0x4154454D // "META" read as a little endian u32
+
+typedef enum
+{
+	kDurableRecord_Enqueue = 1,
+	kDurableRecord_Ack = 2,
+} DurableRecordType;
+
+// Header of every record of the log, followed by bytes_ of payload
+typedef struct durable_record_s
+{
+	u32 checksum_; // of the rest of the header and the payload
+	u16 bytes_;
+	u16 type_;
+	u64 sequence_; // enqueue: sequence of the element, ack: first sequence not consumed
+} DurableRecord;
+
+typedef struct durable_meta_s
+{
+	u32 magic_;
+	u32 first_segment_;
+	u64 acked_;
+} DurableMeta;
+
+// Bytes of a file name: the path and the longest suffix, ".4294967295.log"
+#define kDurableQueueNameMax (kDurableQueuePathMax + 16)
+
+// Queue created by QUEUE_openDurable
+typedef struct durable_queue_s
+{
+	Queue queue_;
+	FILE* log_;
+	char path_[kDurableQueuePathMax];
+	u32 first_segment_; // oldest segment on disk
+	u32 segment_; // segment being appended
+	u32 segment_bytes_;
+	u32 segment_limit_;
+	u64 segment_ends_[kDurableQueueSegments]; // sequence after each closed segment, oldest first
+	u16 closed_;
+	u64 next_sequence_;
+	u64 front_sequence_; // sequence of the front, every element below it is consumed
+	u16 batch_;
+	u16 pending_; // operations logged since the last fsync
+} DurableQueue;
+
+// FNV-1a over the header but the checksum, then the payload
+static u32 QUEUE_checksum(DurableRecord* record, const void* payload)
+{
+	u32 hash = 2166136261u;
+	const u8* bytes = (const u8*)record + sizeof(record->checksum_);
+	for (u32 i = 0; i < sizeof(DurableRecord) - sizeof(record->checksum_); ++i)
+	{
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+	bytes = (const u8*)payload;
+	for (u32 i = 0; i < record->bytes_; ++i)
+	{
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+	return hash;
+}
+
+static void QUEUE_segmentName(DurableQueue* dq, u32 segment, char* name)
+{
+	snprintf(name, kDurableQueueNameMax, "%s.%08u.log", dq->path_, segment);
+}
+
+static s16 QUEUE_fsync(FILE* file)
+{
+	if (0 != fflush(file))
+	{
+		return kErrorCode_File;
+	}
+#ifdef _WIN32
+	return 0 == _commit(_fileno(file)) ? kErrorCode_Ok : kErrorCode_File;
+#else
+	return 0 == fsync(fileno(file)) ? kErrorCode_Ok : kErrorCode_File;
+#endif
+}
+
+// Cuts a file to its first bytes, to drop the torn tail of a segment
+static s16 QUEUE_truncateFile(const char* name, u64 bytes)
+{
+#ifdef _WIN32
+	int fd = _open(name, _O_RDWR | _O_BINARY);
+	if (fd < 0)
+	{
+		return kErrorCode_File;
+	}
+	int result = _chsize_s(fd, (__int64)bytes);
+	_close(fd);
+	return 0 == result ? kErrorCode_Ok : kErrorCode_File;
+#else
+	return 0 == truncate(name, (off_t)bytes) ? kErrorCode_Ok : kErrorCode_File;
+#endif
+}
+
+static s16 QUEUE_logSync(DurableQueue* dq)
+{
+	dq->pending_ = 0;
+	return QUEUE_fsync(dq->log_);
+}
+
+static s16 QUEUE_openSegment(DurableQueue* dq)
+{
+	char name[kDurableQueueNameMax];
+	QUEUE_segmentName(dq, dq->segment_, name);
+	dq->log_ = fopen(name, "ab");
+	if (NULL == dq->log_)
+	{
+		return kErrorCode_File;
+	}
+	fseek(dq->log_, 0, SEEK_END);
+	dq->segment_bytes_ = (u32)ftell(dq->log_);
+	return kErrorCode_Ok;
+}
+
+// Appends a record, fsyncs once per batch and starts a new segment when full
+static s16 QUEUE_append(DurableQueue* dq, u16 type, u64 sequence, const void* data, u16 bytes)
+{
+	DurableRecord record = { .bytes_ = bytes, .type_ = type, .sequence_ = sequence };
+	record.checksum_ = QUEUE_checksum(&record, data);
+	if (1 != fwrite(&record, sizeof(record), 1, dq->log_) ||
+		(0 != bytes && 1 != fwrite(data, bytes, 1, dq->log_)))
+	{
+		return kErrorCode_File;
+	}
+	dq->segment_bytes_ += sizeof(record) + bytes;
+	if (++dq->pending_ >= dq->batch_ && kErrorCode_Ok != QUEUE_logSync(dq))
+	{
+		return kErrorCode_File;
+	}
+	if (dq->segment_bytes_ < dq->segment_limit_ || dq->closed_ >= kDurableQueueSegments)
+	{
+		return kErrorCode_Ok;
+	}
+	if (kErrorCode_Ok != QUEUE_logSync(dq))
+	{
+		return kErrorCode_File;
+	}
+	fclose(dq->log_);
+	dq->segment_ends_[dq->closed_++] = dq->next_sequence_;
+	dq->segment_++;
+	return QUEUE_openSegment(dq);
+}
+
+// Deletes the oldest segments whose elements were all consumed. The meta
+// file is rewritten before, so a replay never looks for them.
+static void QUEUE_truncateLog(DurableQueue* dq)
+{
+	u16 consumed = 0;
+	while (consumed < dq->closed_ && dq->segment_ends_[consumed] <= dq->front_sequence_)
+	{
+		consumed++;
+	}
+	if (0 == consumed || kErrorCode_Ok != QUEUE_logSync(dq))
+	{
+		return;
+	}
+	char name[kDurableQueueNameMax];
+	char temporal[kDurableQueueNameMax];
+	snprintf(name, sizeof(name), "%s.meta", dq->path_);
+	snprintf(temporal, sizeof(temporal), "%s.meta.tmp", dq->path_);
+	DurableMeta meta = { .magic_ = kDurableMetaMagic, .first_segment_ = dq->first_segment_ + consumed,
+		.acked_ = dq->front_sequence_ };
+	FILE* file = fopen(temporal, "wb");
+	if (NULL == file)
+	{
+		return;
+	}
+	boolean written = 1 == fwrite(&meta, sizeof(meta), 1, file) && kErrorCode_Ok == QUEUE_fsync(file) ? True : False;
+	fclose(file);
+#ifdef _WIN32
+	// rename doesn't replace files on Windows
+	remove(name);
+#endif
+	if (True != written || 0 != rename(temporal, name))
+	{
+		return;
+	}
+	for (u16 i = 0; i < consumed; ++i)
+	{
+		QUEUE_segmentName(dq, dq->first_segment_ + i, name);
+		remove(name);
+	}
+	dq->first_segment_ += consumed;
+	dq->closed_ -= consumed;
+	memmove(dq->segment_ends_, dq->segment_ends_ + consumed, dq->closed_ * sizeof(u64));
+}
+
+// Applies a valid record of the log to the queue in memory
+static boolean QUEUE_replayRecord(DurableQueue* dq, DurableRecord* record, void* payload)
+{
+	List* list = dq->queue_.storage_;
+	if (kDurableRecord_Ack == record->type_)
+	{
+		while (dq->front_sequence_ < record->sequence_ && True != list->ops_->isEmpty(list))
+		{
+			MM->free(list->ops_->extractFirst(list));
+			dq->front_sequence_++;
+		}
+		if (record->sequence_ > dq->front_sequence_)
+		{
+			dq->front_sequence_ = record->sequence_;
+		}
+		if (dq->front_sequence_ > dq->next_sequence_)
+		{
+			dq->next_sequence_ = dq->front_sequence_;
+		}
+		return True;
+	}
+	if (record->sequence_ < dq->front_sequence_)
+	{
+		// consumed, its segment was kept by a newer element
+		if (record->sequence_ >= dq->next_sequence_)
+		{
+			dq->next_sequence_ = record->sequence_ + 1;
+		}
+		MM->free(payload);
+		return True;
+	}
+	if (True == list->ops_->isEmpty(list) && record->sequence_ > dq->next_sequence_)
+	{
+		// the elements between were consumed and their segments deleted
+		dq->front_sequence_ = record->sequence_;
+		dq->next_sequence_ = record->sequence_;
+	}
+	if (record->sequence_ != dq->next_sequence_)
+	{
+		MM->free(payload);
+		return False;
+	}
+	if (True == list->ops_->isFull(list))
+	{
+		u16 capacity = list->ops_->capacity(list);
+		list->ops_->resize(list, capacity > 0x7FFF ? 0xFFFF : capacity * 2);
+	}
+	if (kErrorCode_Ok != list->ops_->insertLast(list, payload, record->bytes_))
+	{
+		MM->free(payload);
+		return False;
+	}
+	dq->next_sequence_++;
+	return True;
+}
+
+// Reads a segment until its end or its first bad record, returns the good bytes
+static u64 QUEUE_replaySegment(DurableQueue* dq, FILE* file)
+{
+	u64 good = 0;
+	DurableRecord record;
+	while (1 == fread(&record, sizeof(record), 1, file))
+	{
+		if (kDurableRecord_Enqueue != record.type_ && kDurableRecord_Ack != record.type_)
+		{
+			break;
+		}
+		// acks have no payload, enqueues always have one
+		if ((kDurableRecord_Ack == record.type_) != (0 == record.bytes_))
+		{
+			break;
+		}
+		void* payload = NULL;
+		if (0 != record.bytes_)
+		{
+			payload = MM->malloc(record.bytes_);
+			if (NULL == payload)
+			{
+				break;
+			}
+			if (1 != fread(payload, record.bytes_, 1, file))
+			{
+				MM->free(payload);
+				break;
+			}
+		}
+		if (record.checksum_ != QUEUE_checksum(&record, payload))
+		{
+			if (NULL != payload)
+			{
+				MM->free(payload);
+			}
+			break;
+		}
+		if (True != QUEUE_replayRecord(dq, &record, payload))
+		{
+			break;
+		}
+		good += sizeof(record) + record.bytes_;
+	}
+	return good;
+}
+
+static s16 QUEUE_replay(DurableQueue* dq)
+{
+	char name[kDurableQueueNameMax];
+	snprintf(name, sizeof(name), "%s.meta", dq->path_);
+	DurableMeta meta = { .magic_ = kDurableMetaMagic, .first_segment_ = 0, .acked_ = 0 };
+	FILE* file = fopen(name, "rb");
+	if (NULL != file)
+	{
+		if (1 != fread(&meta, sizeof(meta), 1, file) || kDurableMetaMagic != meta.magic_)
+		{
+			fclose(file);
+			return kErrorCode_File;
+		}
+		fclose(file);
+	}
+	dq->first_segment_ = meta.first_segment_;
+	dq->front_sequence_ = meta.acked_;
+	dq->next_sequence_ = meta.acked_;
+	dq->segment_ = meta.first_segment_;
+	u64 good = 0;
+	boolean found = False;
+	for (u32 segment = meta.first_segment_;; ++segment)
+	{
+		QUEUE_segmentName(dq, segment, name);
+		file = fopen(name, "rb");
+		if (NULL == file)
+		{
+			break;
+		}
+		if (True == found)
+		{
+			// the previous segment is closed
+			if (dq->closed_ >= kDurableQueueSegments)
+			{
+				fclose(file);
+				return kErrorCode_File;
+			}
+			dq->segment_ends_[dq->closed_++] = dq->next_sequence_;
+		}
+		good = QUEUE_replaySegment(dq, file);
+		fclose(file);
+		dq->segment_ = segment;
+		found = True;
+	}
+	// appends go on after the last good record of the last segment
+	QUEUE_segmentName(dq, dq->segment_, name);
+	if (True == found && kErrorCode_Ok != QUEUE_truncateFile(name, good))
+	{
+		return kErrorCode_File;
+	}
+	return QUEUE_openSegment(dq);
+}
+
+Queue* QUEUE_openDurable(const char* path, u16 capacity, u16 batch, u32 segment_bytes)
+{
+	if (NULL == path || 0 == capacity || 0 == batch || 0 == segment_bytes ||
+		strlen(path) >= kDurableQueuePathMax - 16)
+	{
+		return NULL;
+	}
+	DurableQueue* dq = MM->malloc(sizeof(DurableQueue));
+	if (NULL == dq)
+	{
+		return NULL;
+	}
+	dq->queue_.storage_ = LIST_create(capacity);
+	if (NULL == dq->queue_.storage_)
+	{
+		MM->free(dq);
+		return NULL;
+	}
+	dq->queue_.ops_ = &queue_durable_ops;
+	dq->log_ = NULL;
+	strcpy(dq->path_, path);
+	dq->first_segment_ = 0;
+	dq->segment_ = 0;
+	dq->segment_bytes_ = 0;
+	dq->segment_limit_ = segment_bytes;
+	dq->closed_ = 0;
+	dq->next_sequence_ = 0;
+	dq->front_sequence_ = 0;
+	dq->batch_ = batch;
+	dq->pending_ = 0;
+	if (kErrorCode_Ok != QUEUE_replay(dq))
+	{
+		dq->queue_.storage_->ops_->destroy(dq->queue_.storage_);
+		MM->free(dq);
+		return NULL;
+	}
+	return &dq->queue_;
+}
+
+s16 QUEUE_durableDestroy(Queue* qu)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		return kErrorCode_QueueNull;
+	}
+	DurableQueue* dq = (DurableQueue*)qu;
+	s16 error = QUEUE_logSync(dq);
+	fclose(dq->log_);
+	// the payloads are the copies made by enqueue
+	qu->storage_->ops_->destroy(qu->storage_);
+	MM->free(dq);
+	return error;
+}
+
+s16 QUEUE_durableReset(Queue* qu)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		return kErrorCode_QueueNull;
+	}
+	while (True != qu->storage_->ops_->isEmpty(qu->storage_))
+	{
+		void* data = QUEUE_durableDequeue(qu);
+		if (NULL == data)
+		{
+			return kErrorCode_File;
+		}
+		MM->free(data);
+	}
+	return kErrorCode_Ok;
+}
+
+s16 QUEUE_durableEnqueue(Queue* qu, void* data, u16 bytes)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		return kErrorCode_QueueNull;
+	}
+	if (NULL == data)
+	{
+		return kErrorCode_DataNull;
+	}
+	if (0 == bytes)
+	{
+		return kErrorCode_BytesZero;
+	}
+	if (True == qu->storage_->ops_->isFull(qu->storage_))
+	{
+		return kErrorCode_QueueFull;
+	}
+	DurableQueue* dq = (DurableQueue*)qu;
+	void* copy = MM->malloc(bytes);
+	if (NULL == copy)
+	{
+		return kErrorCode_Memory;
+	}
+	memcpy(copy, data, bytes);
+	s16 error = QUEUE_append(dq, kDurableRecord_Enqueue, dq->next_sequence_, copy, bytes);
+	if (kErrorCode_Ok == error)
+	{
+		error = qu->storage_->ops_->insertLast(qu->storage_, copy, bytes);
+	}
+	if (kErrorCode_Ok != error)
+	{
+		MM->free(copy);
+		return error;
+	}
+	dq->next_sequence_++;
+	return kErrorCode_Ok;
+}
+
+void* QUEUE_durableDequeue(Queue* qu)
+{
+	if (NULL == qu || NULL == qu->storage_ || True == qu->storage_->ops_->isEmpty(qu->storage_))
+	{
+		return NULL;
+	}
+	DurableQueue* dq = (DurableQueue*)qu;
+	// the element is only consumed once its acknowledged offset is logged
+	if (kErrorCode_Ok != QUEUE_append(dq, kDurableRecord_Ack, dq->front_sequence_ + 1, NULL, 0))
+	{
+		return NULL;
+	}
+	dq->front_sequence_++;
+	void* data = qu->storage_->ops_->extractFirst(qu->storage_);
+	QUEUE_truncateLog(dq);
+	return data;
+}
+
+s16 QUEUE_durableConcat(Queue* qu, Queue* qu_src)
+{
+	if (NULL == qu || NULL == qu->storage_ || NULL == qu_src)
+	{
+		return kErrorCode_QueueNull;
+	}
+	Cursor cursor;
+	for (qu_src->ops_->begin(qu_src, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		MemoryNode* node = CURSOR_node(&cursor);
+		s16 error = QUEUE_durableEnqueue(qu, node->data_, node->size_);
+		if (kErrorCode_Ok != error)
+		{
+			return error;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 QUEUE_durableSync(Queue* qu)
+{
+	if (NULL == qu || NULL == qu->storage_)
+	{
+		return kErrorCode_QueueNull;
+	}
+	return QUEUE_logSync((DurableQueue*)qu);
+}
@@ -0,0 +1,429 @@
+/**
+ * @file adt_skiplist.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-21
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_skiplist.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 SKIPLIST_destroy(SkipList *list);
+static s16 SKIPLIST_softReset(SkipList *list);
+static s16 SKIPLIST_reset(SkipList *list);
+static u32 SKIPLIST_length(SkipList *list);
+static boolean SKIPLIST_isEmpty(SkipList *list);
+static void *SKIPLIST_first(SkipList *list);
+static void *SKIPLIST_last(SkipList *list);
+static s16 SKIPLIST_insert(SkipList *list, void *data, u16 bytes);
+static void *SKIPLIST_erase(SkipList *list, const void *data, u16 bytes);
+static void *SKIPLIST_find(SkipList *list, const void *data, u16 bytes);
+static s16 SKIPLIST_lowerBound(SkipList *list, const void *data, u16 bytes, Cursor *cursor);
+static s16 SKIPLIST_begin(SkipList *list, Cursor *cursor);
+static s16 SKIPLIST_rbegin(SkipList *list, Cursor *cursor);
+static void SKIPLIST_print(SkipList *list);
+
+struct skiplist_ops_s skiplist_ops = {
+    .destroy = SKIPLIST_destroy,
+    .softReset = SKIPLIST_softReset,
+    .reset = SKIPLIST_reset,
+    .length = SKIPLIST_length,
+    .isEmpty = SKIPLIST_isEmpty,
+    .first = SKIPLIST_first,
+    .last = SKIPLIST_last,
+    .insert = SKIPLIST_insert,
+    .erase = SKIPLIST_erase,
+    .find = SKIPLIST_find,
+    .lowerBound = SKIPLIST_lowerBound,
+    .begin = SKIPLIST_begin,
+    .rbegin = SKIPLIST_rbegin,
+    .print = SKIPLIST_print,
+};
+
+static s32 SKIPLIST_compareBytes(const void *a, u16 a_bytes, const void *b, u16 b_bytes)
+{
+  s32 order = memcmp(a, b, a_bytes < b_bytes ? a_bytes : b_bytes);
+  if (0 != order)
+  {
+    return order;
+  }
+  return (s32)a_bytes - (s32)b_bytes;
+}
+
+SkipList *SKIPLIST_create(SkipListCompare compare)
+{
+  SkipList *list = MM->malloc(sizeof(SkipList));
+  if (NULL == list)
+  {
+    return NULL;
+  }
+  list->head_ = MM->malloc(sizeof(SkipListNode) + kSkipListMaxLevel * sizeof(SkipListNode *));
+  if (NULL == list->head_)
+  {
+    MM->free(list);
+    return NULL;
+  }
+  MEMNODE_createLite(&list->head_->node_);
+  list->head_->height_ = kSkipListMaxLevel;
+  for (u16 i = 0; i < kSkipListMaxLevel; ++i)
+  {
+    list->head_->forward_[i] = NULL;
+    list->pools_[i] = NULL;
+  }
+  list->tail_ = NULL;
+  list->length_ = 0;
+  list->level_ = 1;
+  list->seed_ = 0x9E3779B97F4A7C15ull;
+  list->compare_ = NULL == compare ? SKIPLIST_compareBytes : compare;
+  list->ops_ = &skiplist_ops;
+  return list;
+}
+
+// Height of a new tower: one level, plus one for every two zero bits (xorshift64)
+static u16 SKIPLIST_randomHeight(SkipList *list)
+{
+  u64 x = list->seed_;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  list->seed_ = x;
+  u16 height = 1;
+  while (height < kSkipListMaxLevel && 0 == (x & 3))
+  {
+    height++;
+    x >>= 2;
+  }
+  return height;
+}
+
+static s32 SKIPLIST_compareNode(SkipList *list, SkipListNode *node, const void *data, u16 bytes)
+{
+  return list->compare_(node->node_.data_, node->node_.size_, data, bytes);
+}
+
+// Walks down from the top level to the first element not below data,
+// leaving in update the last tower of each level before it
+static SkipListNode *SKIPLIST_search(SkipList *list, const void *data, u16 bytes, SkipListNode **update)
+{
+  SkipListNode *node = list->head_;
+  for (s16 level = list->level_ - 1; level >= 0; --level)
+  {
+    SkipListNode *next = node->forward_[level];
+    while (NULL != next && SKIPLIST_compareNode(list, next, data, bytes) < 0)
+    {
+      node = next;
+      next = node->forward_[level];
+    }
+    if (NULL != update)
+    {
+      update[level] = node;
+    }
+  }
+  return node->forward_[0];
+}
+
+s16 SKIPLIST_insert(SkipList *list, void *data, u16 bytes)
+{
+  if (NULL == list)
+  {
+    return kErrorCode_SkipListNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  SkipListNode *update[kSkipListMaxLevel];
+  SkipListNode *found = SKIPLIST_search(list, data, bytes, update);
+  if (NULL != found && 0 == SKIPLIST_compareNode(list, found, data, bytes))
+  {
+    return kErrorCode_KeyExists;
+  }
+
+  u16 height = SKIPLIST_randomHeight(list);
+  Pool *pool = list->pools_[height - 1];
+  if (NULL == pool)
+  {
+    pool = POOL_create(sizeof(SkipListNode) + height * sizeof(SkipListNode *), kSkipListSlabBytes);
+    if (NULL == pool)
+    {
+      return kErrorCode_Memory;
+    }
+    list->pools_[height - 1] = pool;
+  }
+  SkipListNode *node = pool->ops_->alloc(pool);
+  if (NULL == node)
+  {
+    return kErrorCode_Memory;
+  }
+  MEMNODE_createLite(&node->node_);
+  node->node_.ops_->setData(&node->node_, data, bytes);
+  node->height_ = height;
+  for (u16 level = list->level_; level < height; ++level)
+  {
+    update[level] = list->head_;
+  }
+  if (height > list->level_)
+  {
+    list->level_ = height;
+  }
+
+  // bottom level first: a tower is in the list once its predecessor points to it
+  for (u16 level = 0; level < height; ++level)
+  {
+    node->forward_[level] = update[level]->forward_[level];
+    update[level]->forward_[level] = node;
+  }
+  SkipListNode *next = node->forward_[0];
+  node->node_.next_ = NULL == next ? NULL : &next->node_;
+  node->node_.prev_ = update[0] == list->head_ ? NULL : &update[0]->node_;
+  update[0]->node_.next_ = &node->node_;
+  if (NULL == next)
+  {
+    list->tail_ = node;
+  }
+  else
+  {
+    next->node_.prev_ = &node->node_;
+  }
+  list->length_++;
+  return kErrorCode_Ok;
+}
+
+void *SKIPLIST_erase(SkipList *list, const void *data, u16 bytes)
+{
+  if (NULL == list || NULL == data)
+  {
+    return NULL;
+  }
+  SkipListNode *update[kSkipListMaxLevel];
+  SkipListNode *node = SKIPLIST_search(list, data, bytes, update);
+  if (NULL == node || 0 != SKIPLIST_compareNode(list, node, data, bytes))
+  {
+    return NULL;
+  }
+  for (u16 level = 0; level < node->height_; ++level)
+  {
+    update[level]->forward_[level] = node->forward_[level];
+  }
+  SkipListNode *next = node->forward_[0];
+  update[0]->node_.next_ = node->node_.next_;
+  if (NULL == next)
+  {
+    list->tail_ = update[0] == list->head_ ? NULL : update[0];
+  }
+  else
+  {
+    next->node_.prev_ = node->node_.prev_;
+  }
+  while (list->level_ > 1 && NULL == list->head_->forward_[list->level_ - 1])
+  {
+    list->level_--;
+  }
+  list->length_--;
+  void *element = node->node_.data_;
+  list->pools_[node->height_ - 1]->ops_->free(list->pools_[node->height_ - 1], node);
+  return element;
+}
+
+void *SKIPLIST_find(SkipList *list, const void *data, u16 bytes)
+{
+  if (NULL == list || NULL == data)
+  {
+    return NULL;
+  }
+  SkipListNode *node = SKIPLIST_search(list, data, bytes, NULL);
+  if (NULL == node || 0 != SKIPLIST_compareNode(list, node, data, bytes))
+  {
+    return NULL;
+  }
+  return node->node_.data_;
+}
+
+s16 SKIPLIST_lowerBound(SkipList *list, const void *data, u16 bytes, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, False);
+  if (NULL == list)
+  {
+    return kErrorCode_SkipListNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_Null;
+  }
+  SkipListNode *node = SKIPLIST_search(list, data, bytes, NULL);
+  if (NULL != node)
+  {
+    CURSOR_init(cursor, &node->node_, &list->tail_->node_, 0, False);
+  }
+  return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_begin(SkipList *list, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, False);
+  if (NULL == list)
+  {
+    return kErrorCode_SkipListNull;
+  }
+  if (NULL != list->tail_)
+  {
+    CURSOR_init(cursor, &list->head_->forward_[0]->node_, &list->tail_->node_, 0, False);
+  }
+  return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_rbegin(SkipList *list, Cursor *cursor)
+{
+  if (NULL == cursor)
+  {
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 0, True);
+  if (NULL == list)
+  {
+    return kErrorCode_SkipListNull;
+  }
+  if (NULL != list->tail_)
+  {
+    CURSOR_init(cursor, &list->tail_->node_, &list->head_->forward_[0]->node_, 0, True);
+  }
+  return kErrorCode_Ok;
+}
+
+void *SKIPLIST_first(SkipList *list)
+{
+  if (NULL == list || NULL == list->head_->forward_[0])
+  {
+    return NULL;
+  }
+  return list->head_->forward_[0]->node_.data_;
+}
+
+void *SKIPLIST_last(SkipList *list)
+{
+  if (NULL == list || NULL == list->tail_)
+  {
+    return NULL;
+  }
+  return list->tail_->node_.data_;
+}
+
+// Empties the list, the payloads freed or not
+static s16 SKIPLIST_empty(SkipList *list, boolean free_data)
+{
+  if (NULL == list)
+  {
+    return kErrorCode_SkipListNull;
+  }
+  if (True == free_data)
+  {
+    for (SkipListNode *node = list->head_->forward_[0]; NULL != node; node = node->forward_[0])
+    {
+      MM->free(node->node_.data_);
+    }
+  }
+  for (u16 i = 0; i < kSkipListMaxLevel; ++i)
+  {
+    list->head_->forward_[i] = NULL;
+    if (NULL != list->pools_[i])
+    {
+      list->pools_[i]->ops_->reset(list->pools_[i]);
+    }
+  }
+  list->head_->node_.next_ = NULL;
+  list->tail_ = NULL;
+  list->length_ = 0;
+  list->level_ = 1;
+  return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_destroy(SkipList *list)
+{
+  if (NULL == list)
+  {
+    return kErrorCode_SkipListNull;
+  }
+  SKIPLIST_empty(list, True);
+  for (u16 i = 0; i < kSkipListMaxLevel; ++i)
+  {
+    if (NULL != list->pools_[i])
+    {
+      list->pools_[i]->ops_->destroy(list->pools_[i]);
+    }
+  }
+  MM->free(list->head_);
+  MM->free(list);
+  return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_softReset(SkipList *list)
+{
+  return SKIPLIST_empty(list, False);
+}
+
+s16 SKIPLIST_reset(SkipList *list)
+{
+  return SKIPLIST_empty(list, True);
+}
+
+u32 SKIPLIST_length(SkipList *list)
+{
+  if (NULL == list)
+  {
+    return 0;
+  }
+  return list->length_;
+}
+
+boolean SKIPLIST_isEmpty(SkipList *list)
+{
+  if (NULL == list)
+  {
+    return False;
+  }
+  return 0 == list->length_ ? True : False;
+}
+
+void SKIPLIST_print(SkipList *list)
+{
+  if (NULL == list)
+  {
+    return;
+  }
+  printf("[SKIPLIST INFO] Adress: %p\n", list);
+  printf("[SKIPLIST INFO] Lenght: %u\n", list->length_);
+  printf("[SKIPLIST INFO] Levels: %d\n", list->level_);
+  u32 position = 0;
+  for (SkipListNode *node = list->head_->forward_[0]; NULL != node; node = node->forward_[0], ++position)
+  {
+    printf(" [SKIPLIST INFO] Element #%u, height %d\n", position, node->height_);
+    printf("  [NODE INFO] Adress: %p\n", &node->node_);
+    printf("  [NODE INFO] Size: %d\n", node->node_.size_);
+    printf("  [NODE INFO] Data content:");
+    for (u16 j = 0; j < node->node_.size_; j++)
+    {
+      printf("%c", *((char *)(node->node_.data_) + j));
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
@@ -0,0 +1,375 @@
+/**
+ * @file adt_snapshot_vector.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-22
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_snapshot_vector.h"
+#include "aligned_memory.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 SNAPSHOTVECTOR_destroy(SnapshotVector *vector);
+static EpochRecord *SNAPSHOTVECTOR_registerReader(SnapshotVector *vector);
+static s16 SNAPSHOTVECTOR_unregisterReader(EpochRecord *reader);
+static const SnapshotVersion *SNAPSHOTVECTOR_acquire(SnapshotVector *vector, EpochRecord *reader);
+static s16 SNAPSHOTVECTOR_release(SnapshotVector *vector, EpochRecord *reader);
+static u16 SNAPSHOTVECTOR_length(const SnapshotVersion *version);
+static void *SNAPSHOTVECTOR_at(const SnapshotVersion *version, u16 position);
+static s16 SNAPSHOTVECTOR_insertFirst(SnapshotVector *vector, void *data, u16 bytes);
+static s16 SNAPSHOTVECTOR_insertLast(SnapshotVector *vector, void *data, u16 bytes);
+static s16 SNAPSHOTVECTOR_insertAt(SnapshotVector *vector, void *data, u16 bytes, u16 position);
+static s16 SNAPSHOTVECTOR_setAt(SnapshotVector *vector, void *data, u16 bytes, u16 position);
+static s16 SNAPSHOTVECTOR_removeAt(SnapshotVector *vector, u16 position);
+static u32 SNAPSHOTVECTOR_version(SnapshotVector *vector);
+static void SNAPSHOTVECTOR_print(SnapshotVector *vector);
+
+static void SNAPSHOTVECTOR_beginWrite(SnapshotVector *vector);
+static void SNAPSHOTVECTOR_endWrite(SnapshotVector *vector);
+static SnapshotVersion *SNAPSHOTVECTOR_newVersion(const SnapshotVersion *src, u16 capacity);
+static void SNAPSHOTVECTOR_publish(SnapshotVector *vector, SnapshotVersion *old_version,
+                                   SnapshotVersion *new_version, void *old_data);
+
+struct snapshot_vector_ops_s snapshot_vector_ops = {
+    .destroy = SNAPSHOTVECTOR_destroy,
+    .registerReader = SNAPSHOTVECTOR_registerReader,
+    .unregisterReader = SNAPSHOTVECTOR_unregisterReader,
+    .acquire = SNAPSHOTVECTOR_acquire,
+    .release = SNAPSHOTVECTOR_release,
+    .length = SNAPSHOTVECTOR_length,
+    .at = SNAPSHOTVECTOR_at,
+    .insertFirst = SNAPSHOTVECTOR_insertFirst,
+    .insertLast = SNAPSHOTVECTOR_insertLast,
+    .insertAt = SNAPSHOTVECTOR_insertAt,
+    .setAt = SNAPSHOTVECTOR_setAt,
+    .removeAt = SNAPSHOTVECTOR_removeAt,
+    .version = SNAPSHOTVECTOR_version,
+    .print = SNAPSHOTVECTOR_print,
+};
+
+SnapshotVector *SNAPSHOTVECTOR_create(u16 capacity)
+{
+  if (0 == capacity || capacity > kSnapshotVectorMaxCapacity)
+  {
+    return NULL;
+  }
+  SnapshotVector *vector = ALIGNED_malloc(sizeof(SnapshotVector));
+  if (NULL == vector)
+  {
+    return NULL;
+  }
+  vector->domain_ = EPOCH_create(kSnapshotVectorBatchSize);
+  if (NULL == vector->domain_)
+  {
+    ALIGNED_free(vector);
+    return NULL;
+  }
+  vector->writer_record_ = vector->domain_->ops_->registerThread(vector->domain_);
+  SnapshotVersion *first = SNAPSHOTVECTOR_newVersion(NULL, capacity);
+  if (NULL == vector->writer_record_ || NULL == first)
+  {
+    if (NULL != first)
+    {
+      MM->free(first);
+    }
+    vector->domain_->ops_->destroy(vector->domain_);
+    ALIGNED_free(vector);
+    return NULL;
+  }
+  mtx_init(&vector->writer_mutex_, mtx_plain);
+  atomic_init(&vector->current_, first);
+  vector->ops_ = &snapshot_vector_ops;
+  return vector;
+}
+
+// Writers pin too: pin waits while too many versions are pending, which
+// keeps memory bounded however fast the writes come
+void SNAPSHOTVECTOR_beginWrite(SnapshotVector *vector)
+{
+  mtx_lock(&vector->writer_mutex_);
+  vector->domain_->ops_->pin(vector->writer_record_);
+}
+
+void SNAPSHOTVECTOR_endWrite(SnapshotVector *vector)
+{
+  vector->domain_->ops_->unpin(vector->writer_record_);
+  mtx_unlock(&vector->writer_mutex_);
+}
+
+// Copies the nodes of src (if any) in a new, unpublished version
+SnapshotVersion *SNAPSHOTVECTOR_newVersion(const SnapshotVersion *src, u16 capacity)
+{
+  SnapshotVersion *version = MM->malloc(sizeof(SnapshotVersion) + sizeof(MemoryNode) * capacity);
+  if (NULL == version)
+  {
+    return NULL;
+  }
+  version->storage_ = (MemoryNode *)(version + 1);
+  version->capacity_ = capacity;
+  version->length_ = 0;
+  version->number_ = 0;
+  if (NULL != src)
+  {
+    // shallow copy: the payloads are shared, never duplicated
+    memcpy(version->storage_, src->storage_, sizeof(MemoryNode) * src->length_);
+    version->length_ = src->length_;
+    version->number_ = src->number_ + 1;
+  }
+  for (u16 i = version->length_; i < capacity; i++)
+  {
+    MEMNODE_createLite(&version->storage_[i]);
+  }
+  return version;
+}
+
+// Makes new_version visible and retires what no later version can reach
+void SNAPSHOTVECTOR_publish(SnapshotVector *vector, SnapshotVersion *old_version,
+                            SnapshotVersion *new_version, void *old_data)
+{
+  atomic_store_explicit(&vector->current_, new_version, memory_order_release);
+  EpochDomain *domain = vector->domain_;
+  domain->ops_->retire(vector->writer_record_, old_version, NULL);
+  if (NULL != old_data)
+  {
+    domain->ops_->retire(vector->writer_record_, old_data, NULL);
+  }
+}
+
+s16 SNAPSHOTVECTOR_destroy(SnapshotVector *vector)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  SnapshotVersion *version = atomic_load_explicit(&vector->current_, memory_order_acquire);
+  for (u16 i = 0; i < version->length_; i++)
+  {
+    version->storage_[i].ops_->reset(&version->storage_[i]);
+  }
+  MM->free(version);
+  // frees the retired versions and payloads too
+  vector->domain_->ops_->destroy(vector->domain_);
+  mtx_destroy(&vector->writer_mutex_);
+  ALIGNED_free(vector);
+  return kErrorCode_Ok;
+}
+
+EpochRecord *SNAPSHOTVECTOR_registerReader(SnapshotVector *vector)
+{
+  if (NULL == vector)
+  {
+    return NULL;
+  }
+  return vector->domain_->ops_->registerThread(vector->domain_);
+}
+
+s16 SNAPSHOTVECTOR_unregisterReader(EpochRecord *reader)
+{
+  if (NULL == reader)
+  {
+    return kErrorCode_EpochNull;
+  }
+  return reader->domain_->ops_->unregisterThread(reader);
+}
+
+const SnapshotVersion *SNAPSHOTVECTOR_acquire(SnapshotVector *vector, EpochRecord *reader)
+{
+  if (NULL == vector || NULL == reader)
+  {
+    return NULL;
+  }
+  // readers never retire, so pin never waits
+  vector->domain_->ops_->pin(reader);
+  return atomic_load_explicit(&vector->current_, memory_order_acquire);
+}
+
+s16 SNAPSHOTVECTOR_release(SnapshotVector *vector, EpochRecord *reader)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  return vector->domain_->ops_->unpin(reader);
+}
+
+u16 SNAPSHOTVECTOR_length(const SnapshotVersion *version)
+{
+  if (NULL == version)
+  {
+    return 0;
+  }
+  return version->length_;
+}
+
+void *SNAPSHOTVECTOR_at(const SnapshotVersion *version, u16 position)
+{
+  if (NULL == version || position >= version->length_)
+  {
+    return NULL;
+  }
+  return version->storage_[position].data_;
+}
+
+s16 SNAPSHOTVECTOR_insertFirst(SnapshotVector *vector, void *data, u16 bytes)
+{
+  return SNAPSHOTVECTOR_insertAt(vector, data, bytes, 0);
+}
+
+s16 SNAPSHOTVECTOR_insertLast(SnapshotVector *vector, void *data, u16 bytes)
+{
+  return SNAPSHOTVECTOR_insertAt(vector, data, bytes, kSnapshotVectorMaxCapacity);
+}
+
+s16 SNAPSHOTVECTOR_insertAt(SnapshotVector *vector, void *data, u16 bytes, u16 position)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  SNAPSHOTVECTOR_beginWrite(vector);
+  SnapshotVersion *old_version = atomic_load_explicit(&vector->current_, memory_order_relaxed);
+  u16 capacity = old_version->capacity_;
+  if (old_version->length_ == capacity)
+  {
+    if (kSnapshotVectorMaxCapacity == capacity)
+    {
+      SNAPSHOTVECTOR_endWrite(vector);
+      return kErrorCode_VectorFull;
+    }
+    capacity = capacity > kSnapshotVectorMaxCapacity / 2 ? kSnapshotVectorMaxCapacity : capacity * 2;
+  }
+  SnapshotVersion *new_version = SNAPSHOTVECTOR_newVersion(old_version, capacity);
+  if (NULL == new_version)
+  {
+    SNAPSHOTVECTOR_endWrite(vector);
+    return kErrorCode_Memory;
+  }
+  if (position > new_version->length_)
+  {
+    position = new_version->length_;
+  }
+  memmove(&new_version->storage_[position + 1], &new_version->storage_[position],
+          sizeof(MemoryNode) * (new_version->length_ - position));
+  MEMNODE_createLite(&new_version->storage_[position]);
+  new_version->storage_[position].data_ = data;
+  new_version->storage_[position].size_ = bytes;
+  new_version->length_++;
+  SNAPSHOTVECTOR_publish(vector, old_version, new_version, NULL);
+  SNAPSHOTVECTOR_endWrite(vector);
+  return kErrorCode_Ok;
+}
+
+s16 SNAPSHOTVECTOR_setAt(SnapshotVector *vector, void *data, u16 bytes, u16 position)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  SNAPSHOTVECTOR_beginWrite(vector);
+  SnapshotVersion *old_version = atomic_load_explicit(&vector->current_, memory_order_relaxed);
+  if (position >= old_version->length_)
+  {
+    SNAPSHOTVECTOR_endWrite(vector);
+    return kErrorCode_PositionMismatch;
+  }
+  SnapshotVersion *new_version = SNAPSHOTVECTOR_newVersion(old_version, old_version->capacity_);
+  if (NULL == new_version)
+  {
+    SNAPSHOTVECTOR_endWrite(vector);
+    return kErrorCode_Memory;
+  }
+  void *old_data = new_version->storage_[position].data_;
+  new_version->storage_[position].data_ = data;
+  new_version->storage_[position].size_ = bytes;
+  SNAPSHOTVECTOR_publish(vector, old_version, new_version, old_data);
+  SNAPSHOTVECTOR_endWrite(vector);
+  return kErrorCode_Ok;
+}
+
+s16 SNAPSHOTVECTOR_removeAt(SnapshotVector *vector, u16 position)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  SNAPSHOTVECTOR_beginWrite(vector);
+  SnapshotVersion *old_version = atomic_load_explicit(&vector->current_, memory_order_relaxed);
+  if (position >= old_version->length_)
+  {
+    SNAPSHOTVECTOR_endWrite(vector);
+    return kErrorCode_PositionMismatch;
+  }
+  SnapshotVersion *new_version = SNAPSHOTVECTOR_newVersion(old_version, old_version->capacity_);
+  if (NULL == new_version)
+  {
+    SNAPSHOTVECTOR_endWrite(vector);
+    return kErrorCode_Memory;
+  }
+  void *old_data = new_version->storage_[position].data_;
+  new_version->length_--;
+  memmove(&new_version->storage_[position], &new_version->storage_[position + 1],
+          sizeof(MemoryNode) * (new_version->length_ - position));
+  MEMNODE_createLite(&new_version->storage_[new_version->length_]);
+  SNAPSHOTVECTOR_publish(vector, old_version, new_version, old_data);
+  SNAPSHOTVECTOR_endWrite(vector);
+  return kErrorCode_Ok;
+}
+
+u32 SNAPSHOTVECTOR_version(SnapshotVector *vector)
+{
+  if (NULL == vector)
+  {
+    return 0;
+  }
+  return atomic_load_explicit(&vector->current_, memory_order_acquire)->number_;
+}
+
+void SNAPSHOTVECTOR_print(SnapshotVector *vector)
+{
+  if (NULL == vector)
+  {
+    return;
+  }
+  SnapshotVersion *version = atomic_load(&vector->current_);
+  printf("[SNAPSHOT VECTOR INFO] Adress: %p\n", vector);
+  printf("[SNAPSHOT VECTOR INFO] Version: %u (%p)\n", version->number_, version);
+  printf("[SNAPSHOT VECTOR INFO] Lenght: %d\n", version->length_);
+  printf("[SNAPSHOT VECTOR INFO] Capacity: %d\n", version->capacity_);
+  printf("[SNAPSHOT VECTOR INFO] Pending frees: %u\n", vector->domain_->ops_->pending(vector->writer_record_));
+  for (u16 i = 0; i < version->length_; i++)
+  {
+    printf(" [SNAPSHOT VECTOR INFO] Storage #%d\n", i);
+    printf("  [NODE INFO] Adress: %p\n", version->storage_[i].data_);
+    printf("  [NODE INFO] Size: %d\n", version->storage_[i].size_);
+    printf("  [NODE INFO] Data content:");
+    for (u16 j = 0; j < version->storage_[i].size_; j++)
+    {
+      printf("%c", *((char *)(version->storage_[i].data_) + j));
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
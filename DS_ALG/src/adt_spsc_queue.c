@@ -0,0 +1,277 @@
+/**
+ * @file adt_spsc_queue.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-06
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_spsc_queue.h"
+#include "aligned_memory.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 SPSCQUEUE_destroy(SPSCQueue *qu);
+static s16 SPSCQUEUE_reset(SPSCQueue *qu);
+static u16 SPSCQUEUE_capacity(SPSCQueue *qu);
+static u16 SPSCQUEUE_length(SPSCQueue *qu);
+static boolean SPSCQUEUE_isEmpty(SPSCQueue *qu);
+static boolean SPSCQUEUE_isFull(SPSCQueue *qu);
+static s16 SPSCQUEUE_enqueue(SPSCQueue *qu, void *data, u16 bytes);
+static void *SPSCQUEUE_dequeue(SPSCQueue *qu);
+static void *SPSCQUEUE_back(SPSCQueue *qu);
+static void *SPSCQUEUE_front(SPSCQueue *qu);
+static void SPSCQUEUE_print(SPSCQueue *qu);
+
+struct spsc_queue_ops_s spsc_queue_ops = {
+    .destroy = SPSCQUEUE_destroy,
+    .reset = SPSCQUEUE_reset,
+    .capacity = SPSCQUEUE_capacity,
+    .length = SPSCQUEUE_length,
+    .isEmpty = SPSCQUEUE_isEmpty,
+    .isFull = SPSCQUEUE_isFull,
+    .enqueue = SPSCQUEUE_enqueue,
+    .dequeue = SPSCQUEUE_dequeue,
+    .back = SPSCQUEUE_back,
+    .front = SPSCQUEUE_front,
+    .print = SPSCQUEUE_print,
+};
+
+SPSCQueue *SPSCQUEUE_create(u16 capacity)
+{
+  if (0 == capacity || capacity > 0x8000)
+  {
+    return NULL;
+  }
+  u32 ring_size = 1;
+  while (ring_size < capacity)
+  {
+    ring_size <<= 1;
+  }
+
+  SPSCQueue *qu = ALIGNED_malloc(sizeof(SPSCQueue));
+  if (NULL == qu)
+  {
+    return NULL;
+  }
+  qu->storage_ = ALIGNED_malloc(sizeof(MemoryNode) * ring_size);
+  if (NULL == qu->storage_)
+  {
+    ALIGNED_free(qu);
+    return NULL;
+  }
+  for (u32 i = 0; i < ring_size; i++)
+  {
+    MEMNODE_createLite(&qu->storage_[i]);
+  }
+  atomic_init(&qu->head_, 0);
+  atomic_init(&qu->tail_, 0);
+  qu->cached_head_ = 0;
+  qu->cached_tail_ = 0;
+  qu->mask_ = ring_size - 1;
+  qu->capacity_ = ring_size;
+  qu->ops_ = &spsc_queue_ops;
+
+  return qu;
+}
+
+s16 SPSCQUEUE_destroy(SPSCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return kErrorCode_QueueNull;
+  }
+  if (NULL != qu->storage_)
+  {
+    SPSCQUEUE_reset(qu);
+    ALIGNED_free(qu->storage_);
+  }
+  ALIGNED_free(qu);
+  return kErrorCode_Ok;
+}
+
+s16 SPSCQUEUE_reset(SPSCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return kErrorCode_QueueNull;
+  }
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_relaxed);
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_relaxed);
+  for (u32 i = head; i != tail; i++)
+  {
+    MemoryNode *node = &qu->storage_[i & qu->mask_];
+    if (NULL != node->data_)
+    {
+      node->ops_->reset(node);
+    }
+  }
+  atomic_store_explicit(&qu->head_, 0, memory_order_relaxed);
+  atomic_store_explicit(&qu->tail_, 0, memory_order_relaxed);
+  qu->cached_head_ = 0;
+  qu->cached_tail_ = 0;
+  return kErrorCode_Ok;
+}
+
+u16 SPSCQUEUE_capacity(SPSCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return 0;
+  }
+  return (u16)qu->capacity_;
+}
+
+u16 SPSCQUEUE_length(SPSCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return 0;
+  }
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_acquire);
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_acquire);
+  return (u16)(tail - head);
+}
+
+boolean SPSCQUEUE_isEmpty(SPSCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return True;
+  }
+  return 0 == SPSCQUEUE_length(qu) ? True : False;
+}
+
+boolean SPSCQUEUE_isFull(SPSCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    return False;
+  }
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_acquire);
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_acquire);
+  return (tail - head) >= qu->capacity_ ? True : False;
+}
+
+s16 SPSCQUEUE_enqueue(SPSCQueue *qu, void *data, u16 bytes)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return kErrorCode_QueueNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  // tail_ is only written by this thread, so a relaxed load is enough
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_relaxed);
+  if (tail - qu->cached_head_ >= qu->capacity_)
+  {
+    qu->cached_head_ = atomic_load_explicit(&qu->head_, memory_order_acquire);
+    if (tail - qu->cached_head_ >= qu->capacity_)
+    {
+      return kErrorCode_QueueFull;
+    }
+  }
+  MemoryNode *node = &qu->storage_[tail & qu->mask_];
+  node->data_ = data;
+  node->size_ = bytes;
+  // publishes the slot content to the consumer
+  atomic_store_explicit(&qu->tail_, tail + 1, memory_order_release);
+  return kErrorCode_Ok;
+}
+
+void *SPSCQUEUE_dequeue(SPSCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return NULL;
+  }
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_relaxed);
+  if (head == qu->cached_tail_)
+  {
+    qu->cached_tail_ = atomic_load_explicit(&qu->tail_, memory_order_acquire);
+    if (head == qu->cached_tail_)
+    {
+      return NULL;
+    }
+  }
+  MemoryNode *node = &qu->storage_[head & qu->mask_];
+  void *data = node->data_;
+  node->data_ = NULL;
+  node->size_ = 0;
+  // hands the slot back to the producer
+  atomic_store_explicit(&qu->head_, head + 1, memory_order_release);
+  return data;
+}
+
+void *SPSCQUEUE_back(SPSCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return NULL;
+  }
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_relaxed);
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_acquire);
+  if (head == tail)
+  {
+    return NULL;
+  }
+  return qu->storage_[(tail - 1) & qu->mask_].data_;
+}
+
+void *SPSCQUEUE_front(SPSCQueue *qu)
+{
+  if (NULL == qu || NULL == qu->storage_)
+  {
+    return NULL;
+  }
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_relaxed);
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_acquire);
+  if (head == tail)
+  {
+    return NULL;
+  }
+  return qu->storage_[head & qu->mask_].data_;
+}
+
+void SPSCQUEUE_print(SPSCQueue *qu)
+{
+  if (NULL == qu)
+  {
+    printf("\t[SPSCQueue Info] Address: NULL\n");
+    return;
+  }
+  u32 head = atomic_load_explicit(&qu->head_, memory_order_acquire);
+  u32 tail = atomic_load_explicit(&qu->tail_, memory_order_acquire);
+  printf("\t[SPSCQueue Info] Address: %p\n", qu);
+  printf("\t[SPSCQueue Info] Head: %u\n", head);
+  printf("\t[SPSCQueue Info] Tail: %u\n", tail);
+  printf("\t[SPSCQueue Info] Length: %u\n", tail - head);
+  printf("\t[SPSCQueue Info] Capacity: %u\n", qu->capacity_);
+  if (NULL == qu->storage_)
+  {
+    return;
+  }
+  for (u32 i = head; i != tail; i++)
+  {
+    MemoryNode *node = &qu->storage_[i & qu->mask_];
+    printf("\t\t[SPSCQueue Info] Slot #%u\n", i & qu->mask_);
+    printf("\t\t\t[Node Info] Size: %d\n", node->size_);
+    printf("\t\t\t[Node Info] Data Content: ");
+    u8 *data_byte = node->data_;
+    for (u16 j = 0; j < node->size_; j++)
+    {
+      printf("%c", data_byte[j]);
+    }
+    printf("\n");
+  }
+}
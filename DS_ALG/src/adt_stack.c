@@ -12,6 +12,8 @@
 #include "adt_stack.h"
 #include "common_def.h"
 
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
 static s16 STACK_destroy(Stack *stack);
 static s16 STACK_resize(Stack *stack, u16 new_size);
 static s16 STACK_reset(Stack *stack);
@@ -23,7 +25,10 @@ static s16 STACK_push(Stack *stack, void *data, u16 bytes);
 static void *STACK_pop(Stack *stack);
 static void *STACK_top(Stack *stack);
 static s16 STACK_concat(Stack *stack, Stack *stack_src);
+static s16 STACK_traverseEx(Stack *stack, boolean (*callback)(MemoryNode *, void *), void *context);
+static s16 STACK_begin(Stack *stack, Cursor *cursor);
 static void STACK_print(Stack *stack);
+static s16 STACK_scopedDestroy(Stack *stack);
 
 struct stack_ops_s stack_ops = {
     .destroy = STACK_destroy,
@@ -35,14 +40,34 @@ struct stack_ops_s stack_ops = {
     .isEmpty = STACK_isEmpty,
     .push = STACK_push,
     .pop = STACK_pop,
-    .top = STACK_pop,
+    .top = STACK_top,
     .concat = STACK_concat,
+    .traverseEx = STACK_traverseEx,
+    .begin = STACK_begin,
+    .print = STACK_print,
+};
+
+// Same operations for the stacks living in a memory stack: nothing is freed
+struct stack_ops_s stack_scoped_ops = {
+    .destroy = STACK_scopedDestroy,
+    .resize = STACK_resize,
+    .reset = STACK_reset,
+    .capacity = STACK_capacity,
+    .length = STACK_length,
+    .isFull = STACK_isFull,
+    .isEmpty = STACK_isEmpty,
+    .push = STACK_push,
+    .pop = STACK_pop,
+    .top = STACK_top,
+    .concat = STACK_concat,
+    .traverseEx = STACK_traverseEx,
+    .begin = STACK_begin,
     .print = STACK_print,
 };
 
 Stack *STACK_create(u16 capacity)
 {
-    Stack* stack = (Stack*)malloc(sizeof(Stack));
+    Stack* stack = (Stack*)MM->malloc(sizeof(Stack));
     if (NULL == stack)
     {
         return NULL;
@@ -50,7 +75,7 @@ Stack *STACK_create(u16 capacity)
     stack->storage_ = VECTOR_create(capacity);
     if (NULL == stack->storage_)
     {
-        free(stack);
+        MM->free(stack);
         return NULL;
     }
     stack->ops_ = &stack_ops;
@@ -58,6 +83,35 @@ Stack *STACK_create(u16 capacity)
     return stack;
 }
 
+Stack *STACK_createInMemoryStack(u16 capacity, MemoryStack *memory_stack, MemoryStackSide side)
+{
+    if (0 == capacity || NULL == memory_stack)
+    {
+        return NULL;
+    }
+    Stack *stack = memory_stack->ops_->alloc(memory_stack, side, sizeof(Stack));
+    if (NULL == stack)
+    {
+        return NULL;
+    }
+    stack->storage_ = VECTOR_createInMemoryStack(capacity, memory_stack, side);
+    if (NULL == stack->storage_)
+    {
+        return NULL;
+    }
+    stack->ops_ = &stack_scoped_ops;
+    return stack;
+}
+
+s16 STACK_scopedDestroy(Stack *stack)
+{
+    if (NULL == stack || NULL == stack->storage_)
+    {
+        return kErrorCode_StackNull;
+    }
+    return kErrorCode_Ok;
+}
+
 s16 STACK_destroy(Stack* stack)
 {
     if (NULL == stack || NULL == stack->storage_)
@@ -65,6 +119,7 @@ s16 STACK_destroy(Stack* stack)
         return kErrorCode_StackNull;
     }
     stack->storage_->ops_->destroy(stack->storage_);
+    MM->free(stack);
     return kErrorCode_Ok;
 }
 
@@ -167,6 +222,47 @@ s16 STACK_concat(Stack* stack, Stack* stack_src)
     return kErrorCode_Ok;
 }
 
+// The top is the last element of the storage, the walk goes down to the head
+s16 STACK_traverseEx(Stack *stack, boolean (*callback)(MemoryNode *, void *), void *context)
+{
+    if (NULL == stack || NULL == stack->storage_ || NULL == stack->storage_->storage_)
+    {
+        return kErrorCode_StackNull;
+    }
+    if (NULL == callback)
+    {
+        return kErrorCode_Null;
+    }
+    Vector *storage = stack->storage_;
+    for (u16 i = storage->tail_; i > storage->head_; --i)
+    {
+        if (True != callback(&storage->storage_[i - 1], context))
+        {
+            break;
+        }
+    }
+    return kErrorCode_Ok;
+}
+
+s16 STACK_begin(Stack *stack, Cursor *cursor)
+{
+    if (NULL == cursor)
+    {
+        return kErrorCode_Null;
+    }
+    CURSOR_init(cursor, NULL, NULL, -1, False);
+    if (NULL == stack || NULL == stack->storage_ || NULL == stack->storage_->storage_)
+    {
+        return kErrorCode_StackNull;
+    }
+    Vector *storage = stack->storage_;
+    if (storage->tail_ > storage->head_)
+    {
+        CURSOR_init(cursor, &storage->storage_[storage->tail_ - 1], &storage->storage_[storage->head_], -1, False);
+    }
+    return kErrorCode_Ok;
+}
+
 void STACK_print(Stack* stack)
 {
     if (NULL == stack || NULL == stack->storage_)
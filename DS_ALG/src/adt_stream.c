@@ -0,0 +1,371 @@
+/**
+ * @file adt_stream.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-07-15
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_stream.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 STREAM_destroy(Stream *stream);
+static s16 STREAM_next(Stream *stream, MemoryNode *node);
+static s16 STREAM_release(Stream *stream, MemoryNode *node);
+static s16 STREAM_releaseData(Stream *stream, void *data);
+static s16 STREAM_fill(Stream *stream, List *list);
+static s16 STREAM_releaseList(Stream *stream, List *list);
+static u16 STREAM_liveBlocks(Stream *stream);
+static u64 STREAM_position(Stream *stream);
+static void STREAM_print(Stream *stream);
+
+struct stream_ops_s stream_ops = {
+    .destroy = STREAM_destroy,
+    .next = STREAM_next,
+    .release = STREAM_release,
+    .releaseData = STREAM_releaseData,
+    .fill = STREAM_fill,
+    .releaseList = STREAM_releaseList,
+    .liveBlocks = STREAM_liveBlocks,
+    .position = STREAM_position,
+    .print = STREAM_print,
+};
+
+Stream *STREAM_create(const char *path, StreamMode mode, u32 block_size, u16 slice_size)
+{
+  if (NULL == path || 0 == block_size || 0 == slice_size ||
+      (kStreamMode_Read != mode && kStreamMode_Map != mode) ||
+      block_size > 0xFFFFFFFF - kStreamBlockAlignment)
+  {
+    return NULL;
+  }
+  Stream *stream = MM->malloc(sizeof(Stream));
+  if (NULL == stream)
+  {
+    return NULL;
+  }
+  stream->mode_ = mode;
+  stream->file_ = NULL;
+  stream->offset_ = 0;
+  stream->bytes_ = 0;
+  stream->block_size_ = (block_size + kStreamBlockAlignment - 1) / kStreamBlockAlignment * kStreamBlockAlignment;
+  stream->slice_size_ = slice_size;
+  stream->current_ = NULL;
+  stream->live_ = NULL;
+  stream->free_ = NULL;
+  stream->ops_ = &stream_ops;
+  if (kStreamMode_Read == mode)
+  {
+    stream->file_ = fopen(path, "rb");
+    if (NULL == stream->file_)
+    {
+      MM->free(stream);
+      return NULL;
+    }
+    // the blocks are the buffer, stdio would copy everything twice
+    setvbuf(stream->file_, NULL, _IONBF, 0);
+  }
+  else
+  {
+    if (kErrorCode_Ok != FILEMAP_open(&stream->map_, path))
+    {
+      MM->free(stream);
+      return NULL;
+    }
+    stream->bytes_ = stream->map_.bytes_;
+  }
+  return stream;
+}
+
+// Frees a block that is neither live nor recycled
+static void STREAM_freeBlock(Stream *stream, StreamBlock *block)
+{
+  if (kStreamMode_Read == stream->mode_)
+  {
+    FILEMAP_pagesFree(block->data_, stream->block_size_);
+  }
+  MM->free(block);
+}
+
+s16 STREAM_destroy(Stream *stream)
+{
+  if (NULL == stream)
+  {
+    return kErrorCode_StreamNull;
+  }
+  StreamBlock *lists[2] = {stream->live_, stream->free_};
+  for (u16 i = 0; i < 2; ++i)
+  {
+    StreamBlock *block = lists[i];
+    while (NULL != block)
+    {
+      StreamBlock *next = block->next_;
+      STREAM_freeBlock(stream, block);
+      block = next;
+    }
+  }
+  if (kStreamMode_Read == stream->mode_)
+  {
+    fclose(stream->file_);
+  }
+  else
+  {
+    FILEMAP_close(&stream->map_);
+  }
+  MM->free(stream);
+  return kErrorCode_Ok;
+}
+
+// Takes a recycled block, or a new one, and reads the next block of the file in it
+static s16 STREAM_readBlock(Stream *stream)
+{
+  if (kStreamMode_Map == stream->mode_ && stream->offset_ >= stream->bytes_)
+  {
+    return kErrorCode_StreamEnd;
+  }
+  StreamBlock *block = stream->free_;
+  if (NULL != block)
+  {
+    stream->free_ = block->next_;
+  }
+  else
+  {
+    block = MM->malloc(sizeof(StreamBlock));
+    if (NULL == block)
+    {
+      return kErrorCode_Memory;
+    }
+    block->data_ = NULL;
+    if (kStreamMode_Read == stream->mode_)
+    {
+      block->data_ = FILEMAP_pagesAlloc(stream->block_size_);
+      if (NULL == block->data_)
+      {
+        MM->free(block);
+        return kErrorCode_Memory;
+      }
+    }
+  }
+
+  if (kStreamMode_Read == stream->mode_)
+  {
+    block->bytes_ = (u32)fread(block->data_, 1, stream->block_size_, stream->file_);
+    if (0 == block->bytes_)
+    {
+      block->next_ = stream->free_;
+      stream->free_ = block;
+      return ferror(stream->file_) ? kErrorCode_File : kErrorCode_StreamEnd;
+    }
+  }
+  else
+  {
+    u64 remaining = stream->bytes_ - stream->offset_;
+    block->data_ = stream->map_.address_ + stream->offset_;
+    block->bytes_ = remaining < stream->block_size_ ? (u32)remaining : stream->block_size_;
+  }
+  stream->offset_ += block->bytes_;
+  block->cut_ = 0;
+  block->refs_ = 1; // the reference of the stream while it cuts the block
+  block->next_ = stream->live_;
+  stream->live_ = block;
+  stream->current_ = block;
+  return kErrorCode_Ok;
+}
+
+// Drops a reference of the block holding data, recycling it at zero
+static s16 STREAM_unref(Stream *stream, u8 *data)
+{
+  StreamBlock *previous = NULL;
+  StreamBlock *block = stream->live_;
+  while (NULL != block && (data < block->data_ || data >= block->data_ + block->bytes_))
+  {
+    previous = block;
+    block = block->next_;
+  }
+  if (NULL == block)
+  {
+    return kErrorCode_StreamSlice;
+  }
+  if (0 != --block->refs_)
+  {
+    return kErrorCode_Ok;
+  }
+  if (NULL == previous)
+  {
+    stream->live_ = block->next_;
+  }
+  else
+  {
+    previous->next_ = block->next_;
+  }
+  if (kStreamMode_Map == stream->mode_)
+  {
+    FILEMAP_drop(&stream->map_, (u64)(block->data_ - stream->map_.address_), block->bytes_);
+  }
+  block->next_ = stream->free_;
+  stream->free_ = block;
+  return kErrorCode_Ok;
+}
+
+s16 STREAM_next(Stream *stream, MemoryNode *node)
+{
+  if (NULL == stream)
+  {
+    return kErrorCode_StreamNull;
+  }
+  if (NULL == node)
+  {
+    return kErrorCode_NodeNull;
+  }
+  if (NULL == stream->current_)
+  {
+    s16 error = STREAM_readBlock(stream);
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+  }
+  StreamBlock *block = stream->current_;
+  u32 remaining = block->bytes_ - block->cut_;
+  node->data_ = block->data_ + block->cut_;
+  node->size_ = remaining < stream->slice_size_ ? (u16)remaining : stream->slice_size_;
+  block->cut_ += node->size_;
+  block->refs_++;
+  if (block->cut_ == block->bytes_)
+  {
+    stream->current_ = NULL;
+    STREAM_unref(stream, block->data_);
+  }
+  return kErrorCode_Ok;
+}
+
+s16 STREAM_release(Stream *stream, MemoryNode *node)
+{
+  if (NULL == stream)
+  {
+    return kErrorCode_StreamNull;
+  }
+  if (NULL == node)
+  {
+    return kErrorCode_NodeNull;
+  }
+  s16 error = STREAM_unref(stream, node->data_);
+  if (kErrorCode_Ok == error)
+  {
+    node->ops_->softReset(node);
+  }
+  return error;
+}
+
+s16 STREAM_releaseData(Stream *stream, void *data)
+{
+  if (NULL == stream)
+  {
+    return kErrorCode_StreamNull;
+  }
+  return STREAM_unref(stream, data);
+}
+
+s16 STREAM_fill(Stream *stream, List *list)
+{
+  if (NULL == stream)
+  {
+    return kErrorCode_StreamNull;
+  }
+  if (NULL == list)
+  {
+    return kErrorCode_ListNull;
+  }
+  boolean inserted = False;
+  while (True != list->ops_->isFull(list))
+  {
+    MemoryNode slice;
+    s16 error = STREAM_next(stream, &slice);
+    if (kErrorCode_StreamEnd == error && True == inserted)
+    {
+      return kErrorCode_Ok;
+    }
+    if (kErrorCode_Ok != error)
+    {
+      return error;
+    }
+    error = list->ops_->insertLast(list, slice.data_, slice.size_);
+    if (kErrorCode_Ok != error)
+    {
+      STREAM_unref(stream, slice.data_);
+      return error;
+    }
+    inserted = True;
+  }
+  return kErrorCode_Ok;
+}
+
+s16 STREAM_releaseList(Stream *stream, List *list)
+{
+  if (NULL == stream)
+  {
+    return kErrorCode_StreamNull;
+  }
+  if (NULL == list)
+  {
+    return kErrorCode_ListNull;
+  }
+  s16 result = kErrorCode_Ok;
+  while (True != list->ops_->isEmpty(list))
+  {
+    s16 error = STREAM_unref(stream, list->ops_->extractFirst(list));
+    if (kErrorCode_Ok != error)
+    {
+      result = error;
+    }
+  }
+  return result;
+}
+
+u16 STREAM_liveBlocks(Stream *stream)
+{
+  if (NULL == stream)
+  {
+    return 0;
+  }
+  u16 blocks = 0;
+  for (StreamBlock *block = stream->live_; NULL != block; block = block->next_)
+  {
+    blocks++;
+  }
+  return blocks;
+}
+
+u64 STREAM_position(Stream *stream)
+{
+  if (NULL == stream)
+  {
+    return 0;
+  }
+  if (NULL == stream->current_)
+  {
+    return stream->offset_;
+  }
+  return stream->offset_ - (stream->current_->bytes_ - stream->current_->cut_);
+}
+
+void STREAM_print(Stream *stream)
+{
+  if (NULL == stream)
+  {
+    return;
+  }
+  printf("    [Stream Info] %s mode, position: %llu, block size: %u, slice size: %d\n",
+         kStreamMode_Read == stream->mode_ ? "read" : "map", (unsigned long long)STREAM_position(stream),
+         stream->block_size_, stream->slice_size_);
+  for (StreamBlock *block = stream->live_; NULL != block; block = block->next_)
+  {
+    printf("    [Block Info] address: %p, bytes: %u, cut: %u, references: %u\n",
+           (void *)block->data_, block->bytes_, block->cut_, block->refs_);
+  }
+}
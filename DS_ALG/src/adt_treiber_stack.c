@@ -0,0 +1,273 @@
+/**
+ * @file adt_treiber_stack.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-10
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_treiber_stack.h"
+#include "aligned_memory.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 TREIBERSTACK_destroy(TreiberStack *stack);
+static s16 TREIBERSTACK_reset(TreiberStack *stack);
+static u16 TREIBERSTACK_capacity(TreiberStack *stack);
+static u16 TREIBERSTACK_length(TreiberStack *stack);
+static boolean TREIBERSTACK_isEmpty(TreiberStack *stack);
+static boolean TREIBERSTACK_isFull(TreiberStack *stack);
+static s16 TREIBERSTACK_push(TreiberStack *stack, void *data, u16 bytes);
+static void *TREIBERSTACK_pop(TreiberStack *stack);
+static void *TREIBERSTACK_top(TreiberStack *stack);
+static void TREIBERSTACK_print(TreiberStack *stack);
+
+struct treiber_stack_ops_s treiber_stack_ops = {
+    .destroy = TREIBERSTACK_destroy,
+    .reset = TREIBERSTACK_reset,
+    .capacity = TREIBERSTACK_capacity,
+    .length = TREIBERSTACK_length,
+    .isEmpty = TREIBERSTACK_isEmpty,
+    .isFull = TREIBERSTACK_isFull,
+    .push = TREIBERSTACK_push,
+    .pop = TREIBERSTACK_pop,
+    .top = TREIBERSTACK_top,
+    .print = TREIBERSTACK_print,
+};
+
+// Tagged head word: | tag (32) | length (16) | first node index (16) |
+#define kTreiberNullIndex 0xFFFF
+#define TAGGED_INDEX(word) ((u16)((word) & 0xFFFF))
+#define TAGGED_LENGTH(word) ((u16)(((word) >> 16) & 0xFFFF))
+#define TAGGED_TAG(word) ((u32)((word) >> 32))
+#define TAGGED_MAKE(index, length, tag) \
+  (((u64)(u32)(tag) << 32) | ((u64)(u16)(length) << 16) | (u64)(u16)(index))
+
+// Pops the first node index of a tagged list, kTreiberNullIndex if empty
+static u16 TREIBERSTACK_popIndex(TreiberStack *stack, _Atomic u64 *list)
+{
+  u64 old = atomic_load_explicit(list, memory_order_acquire);
+  for (;;)
+  {
+    u16 index = TAGGED_INDEX(old);
+    if (kTreiberNullIndex == index)
+    {
+      return kTreiberNullIndex;
+    }
+    // may read a recycled node: the tag makes the CAS fail in that case
+    u16 next = atomic_load_explicit(&stack->nodes_[index].next_, memory_order_relaxed);
+    u64 desired = TAGGED_MAKE(next, TAGGED_LENGTH(old) - 1, TAGGED_TAG(old) + 1);
+    if (atomic_compare_exchange_weak_explicit(list, &old, desired,
+                                              memory_order_acquire, memory_order_acquire))
+    {
+      return index;
+    }
+  }
+}
+
+static void TREIBERSTACK_pushIndex(TreiberStack *stack, _Atomic u64 *list, u16 index)
+{
+  u64 old = atomic_load_explicit(list, memory_order_relaxed);
+  for (;;)
+  {
+    atomic_store_explicit(&stack->nodes_[index].next_, TAGGED_INDEX(old), memory_order_relaxed);
+    u64 desired = TAGGED_MAKE(index, TAGGED_LENGTH(old) + 1, TAGGED_TAG(old) + 1);
+    if (atomic_compare_exchange_weak_explicit(list, &old, desired,
+                                              memory_order_release, memory_order_relaxed))
+    {
+      return;
+    }
+  }
+}
+
+TreiberStack *TREIBERSTACK_create(u16 capacity)
+{
+  if (0 == capacity || kTreiberNullIndex == capacity)
+  {
+    return NULL;
+  }
+  TreiberStack *stack = ALIGNED_malloc(sizeof(TreiberStack));
+  if (NULL == stack)
+  {
+    return NULL;
+  }
+  stack->nodes_ = ALIGNED_malloc(sizeof(TreiberNode) * capacity);
+  if (NULL == stack->nodes_)
+  {
+    ALIGNED_free(stack);
+    return NULL;
+  }
+  // every node starts in the free list, in order
+  for (u16 i = 0; i < capacity; i++)
+  {
+    atomic_init(&stack->nodes_[i].data_, NULL);
+    stack->nodes_[i].size_ = 0;
+    atomic_init(&stack->nodes_[i].next_, (u16)(i + 1 < capacity ? i + 1 : kTreiberNullIndex));
+  }
+  atomic_init(&stack->head_, TAGGED_MAKE(kTreiberNullIndex, 0, 0));
+  atomic_init(&stack->free_, TAGGED_MAKE(0, capacity, 0));
+  stack->capacity_ = capacity;
+  stack->ops_ = &treiber_stack_ops;
+  return stack;
+}
+
+s16 TREIBERSTACK_destroy(TreiberStack *stack)
+{
+  if (NULL == stack)
+  {
+    return kErrorCode_StackNull;
+  }
+  if (NULL != stack->nodes_)
+  {
+    TREIBERSTACK_reset(stack);
+    ALIGNED_free(stack->nodes_);
+  }
+  ALIGNED_free(stack);
+  return kErrorCode_Ok;
+}
+
+s16 TREIBERSTACK_reset(TreiberStack *stack)
+{
+  if (NULL == stack || NULL == stack->nodes_)
+  {
+    return kErrorCode_StackNull;
+  }
+  void *data = TREIBERSTACK_pop(stack);
+  while (NULL != data)
+  {
+    MM->free(data);
+    data = TREIBERSTACK_pop(stack);
+  }
+  return kErrorCode_Ok;
+}
+
+u16 TREIBERSTACK_capacity(TreiberStack *stack)
+{
+  if (NULL == stack)
+  {
+    return 0;
+  }
+  return stack->capacity_;
+}
+
+u16 TREIBERSTACK_length(TreiberStack *stack)
+{
+  if (NULL == stack)
+  {
+    return 0;
+  }
+  return TAGGED_LENGTH(atomic_load_explicit(&stack->head_, memory_order_relaxed));
+}
+
+boolean TREIBERSTACK_isEmpty(TreiberStack *stack)
+{
+  if (NULL == stack)
+  {
+    return True;
+  }
+  return 0 == TREIBERSTACK_length(stack) ? True : False;
+}
+
+boolean TREIBERSTACK_isFull(TreiberStack *stack)
+{
+  if (NULL == stack)
+  {
+    return False;
+  }
+  return TREIBERSTACK_length(stack) >= stack->capacity_ ? True : False;
+}
+
+s16 TREIBERSTACK_push(TreiberStack *stack, void *data, u16 bytes)
+{
+  if (NULL == stack || NULL == stack->nodes_)
+  {
+    return kErrorCode_StackNull;
+  }
+  if (NULL == data)
+  {
+    return kErrorCode_SrcNull;
+  }
+  if (0 == bytes)
+  {
+    return kErrorCode_BytesZero;
+  }
+  u16 index = TREIBERSTACK_popIndex(stack, &stack->free_);
+  if (kTreiberNullIndex == index)
+  {
+    return kErrorCode_StackFull;
+  }
+  TreiberNode *node = &stack->nodes_[index];
+  atomic_store_explicit(&node->data_, data, memory_order_relaxed);
+  node->size_ = bytes;
+  TREIBERSTACK_pushIndex(stack, &stack->head_, index);
+  return kErrorCode_Ok;
+}
+
+void *TREIBERSTACK_pop(TreiberStack *stack)
+{
+  if (NULL == stack || NULL == stack->nodes_)
+  {
+    return NULL;
+  }
+  u16 index = TREIBERSTACK_popIndex(stack, &stack->head_);
+  if (kTreiberNullIndex == index)
+  {
+    return NULL;
+  }
+  TreiberNode *node = &stack->nodes_[index];
+  void *data = atomic_load_explicit(&node->data_, memory_order_relaxed);
+  atomic_store_explicit(&node->data_, NULL, memory_order_relaxed);
+  node->size_ = 0;
+  TREIBERSTACK_pushIndex(stack, &stack->free_, index);
+  return data;
+}
+
+void *TREIBERSTACK_top(TreiberStack *stack)
+{
+  if (NULL == stack || NULL == stack->nodes_)
+  {
+    return NULL;
+  }
+  u16 index = TAGGED_INDEX(atomic_load_explicit(&stack->head_, memory_order_acquire));
+  if (kTreiberNullIndex == index)
+  {
+    return NULL;
+  }
+  return atomic_load_explicit(&stack->nodes_[index].data_, memory_order_relaxed);
+}
+
+void TREIBERSTACK_print(TreiberStack *stack)
+{
+  if (NULL == stack)
+  {
+    printf("\t[TreiberStack Info] Address: NULL\n");
+    return;
+  }
+  u64 head = atomic_load(&stack->head_);
+  printf("\t[TreiberStack Info] Address: %p\n", stack);
+  printf("\t[TreiberStack Info] Length: %d\n", TAGGED_LENGTH(head));
+  printf("\t[TreiberStack Info] Capacity: %d\n", stack->capacity_);
+  printf("\t[TreiberStack Info] Head tag: %u\n", TAGGED_TAG(head));
+  if (NULL == stack->nodes_)
+  {
+    return;
+  }
+  for (u16 index = TAGGED_INDEX(head); kTreiberNullIndex != index;
+       index = atomic_load(&stack->nodes_[index].next_))
+  {
+    TreiberNode *node = &stack->nodes_[index];
+    printf("\t\t[TreiberStack Info] Node #%d\n", index);
+    printf("\t\t\t[Node Info] Size: %d\n", node->size_);
+    printf("\t\t\t[Node Info] Data Content: ");
+    u8 *data_byte = atomic_load(&node->data_);
+    for (u16 j = 0; NULL != data_byte && j < node->size_; j++)
+    {
+      printf("%c", data_byte[j]);
+    }
+    printf("\n");
+  }
+}
@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "adt_vector.h"
 #include "common_def.h"
@@ -33,7 +34,11 @@ static void* VECTOR_extractLast(Vector* vector);//
 static void* VECTOR_extractAt(Vector* vector, u16 position);//
 static s16 VECTOR_concat(Vector* vector, Vector *vector_src);
 static s16 VECTOR_traverse(Vector* vector, void (*callback)(MemoryNode *));//
+static s16 VECTOR_traverseEx(Vector* vector, boolean (*callback)(MemoryNode *, void *), void *context);
+static s16 VECTOR_begin(Vector* vector, Cursor *cursor);
 static void VECTOR_print(Vector* vector);
+static s16 VECTOR_scopedDestroy(Vector* vector);
+static s16 VECTOR_scopedReset(Vector* vector);
 
 // vector´s api definitions
 struct vector_ops_s vector_ops = {
@@ -56,9 +61,159 @@ struct vector_ops_s vector_ops = {
     .extractAt = VECTOR_extractAt,
     .concat = VECTOR_concat,
     .traverse = VECTOR_traverse,
+    .traverseEx = VECTOR_traverseEx,
+    .begin = VECTOR_begin,
     .print = VECTOR_print,
 };
 
+// Same operations for the vectors living in an arena or a memory stack:
+// nothing is freed, the memory goes back with the allocator
+struct vector_ops_s vector_scoped_ops = {
+    .destroy = VECTOR_scopedDestroy,
+    .softReset = VECTOR_softReset,
+    .reset = VECTOR_scopedReset,
+    .resize = VECTOR_resize,
+    .capacity = VECTOR_capacity,
+    .length = VECTOR_length,
+    .isEmpty = VECTOR_isEmpty,
+    .isFull = VECTOR_isFull,
+    .first = VECTOR_first,
+    .last = VECTOR_last,
+    .at = VECTOR_at,
+    .insertFirst = VECTOR_insertFirst,
+    .insertLast = VECTOR_insertLast,
+    .insertAt = VECTOR_insertAt,
+    .extractFirst = VECTOR_extractFirst,
+    .extractLast = VECTOR_extractLast,
+    .extractAt = VECTOR_extractAt,
+    .concat = VECTOR_concat,
+    .traverse = VECTOR_traverse,
+    .traverseEx = VECTOR_traverseEx,
+    .begin = VECTOR_begin,
+    .print = VECTOR_print,
+};
+
+// Same operations for the vectors of shared payloads: concat takes new
+// references instead of copies
+struct vector_ops_s vector_shared_ops = {
+    .destroy = VECTOR_destroy,
+    .softReset = VECTOR_softReset,
+    .reset = VECTOR_reset,
+    .resize = VECTOR_resize,
+    .capacity = VECTOR_capacity,
+    .length = VECTOR_length,
+    .isEmpty = VECTOR_isEmpty,
+    .isFull = VECTOR_isFull,
+    .first = VECTOR_first,
+    .last = VECTOR_last,
+    .at = VECTOR_at,
+    .insertFirst = VECTOR_insertFirst,
+    .insertLast = VECTOR_insertLast,
+    .insertAt = VECTOR_insertAt,
+    .extractFirst = VECTOR_extractFirst,
+    .extractLast = VECTOR_extractLast,
+    .extractAt = VECTOR_extractAt,
+    .concat = VECTOR_concat,
+    .traverse = VECTOR_traverse,
+    .traverseEx = VECTOR_traverseEx,
+    .begin = VECTOR_begin,
+    .print = VECTOR_print,
+};
+
+// Vector created by VECTOR_createInArena or VECTOR_createInMemoryStack.
+// alloc_ takes the memory from allocator_.
+typedef struct scoped_vector_s {
+  Vector vector_;
+  void *allocator_;
+  void *(*alloc_)(void *allocator, u32 bytes);
+} ScopedVector;
+
+static void *VECTOR_alloc(Vector *vector, u32 bytes)
+{
+  if (&vector_scoped_ops == vector->ops_)
+  {
+    ScopedVector *scoped = (ScopedVector *)vector;
+    return scoped->alloc_(scoped->allocator_, bytes);
+  }
+  return MM->malloc(bytes);
+}
+
+static void VECTOR_free(Vector *vector, void *ptr)
+{
+  // scoped memory goes back with the arena reset or the freeToMarker
+  if (&vector_scoped_ops != vector->ops_)
+  {
+    MM->free(ptr);
+  }
+}
+
+// The nodes of a vector of shared payloads drop references instead of freeing
+static void VECTOR_initNode(Vector *vector, MemoryNode *node)
+{
+  if (&vector_shared_ops == vector->ops_)
+  {
+    MEMNODE_createLiteShared(node);
+  }
+  else
+  {
+    MEMNODE_createLite(node);
+  }
+}
+
+static void VECTOR_freeData(Vector *vector, void *data)
+{
+  if (&vector_shared_ops == vector->ops_)
+  {
+    MEMNODE_release(data);
+  }
+  else
+  {
+    VECTOR_free(vector, data);
+  }
+}
+
+static void *VECTOR_arenaAlloc(void *arena, u32 bytes)
+{
+  return ((Arena *)arena)->ops_->alloc(arena, bytes);
+}
+
+static void *VECTOR_memoryStackLowAlloc(void *stack, u32 bytes)
+{
+  return ((MemoryStack *)stack)->ops_->alloc(stack, kMemoryStackSide_Low, bytes);
+}
+
+static void *VECTOR_memoryStackHighAlloc(void *stack, u32 bytes)
+{
+  return ((MemoryStack *)stack)->ops_->alloc(stack, kMemoryStackSide_High, bytes);
+}
+
+static Vector *VECTOR_createScoped(u16 capacity, void *allocator,
+                                   void *(*alloc)(void *allocator, u32 bytes))
+{
+  ScopedVector *scoped = alloc(allocator, sizeof(ScopedVector));
+  if (NULL == scoped)
+  {
+    return NULL;
+  }
+  Vector *vector_ = &scoped->vector_;
+  vector_->storage_ = alloc(allocator, sizeof(MemoryNode) * capacity);
+  if (NULL == vector_->storage_)
+  {
+    return NULL;
+  }
+  for (int i = 0; i < capacity; i++)
+  {
+    MEMNODE_createLite(&vector_->storage_[i]);
+  }
+  vector_->head_ = 0;
+  vector_->tail_ = 0;
+  vector_->capacity_ = capacity;
+  vector_->ops_ = &vector_scoped_ops;
+  scoped->allocator_ = allocator;
+  scoped->alloc_ = alloc;
+  return vector_;
+}
+
 Vector *VECTOR_create(u16 capacity)
 {
   if(0 >= capacity)
@@ -87,6 +242,59 @@ Vector *VECTOR_create(u16 capacity)
   return vector_;
 }
 
+Vector *VECTOR_createShared(u16 capacity)
+{
+  Vector *vector_ = VECTOR_create(capacity);
+  if (NULL == vector_)
+  {
+    return NULL;
+  }
+  vector_->ops_ = &vector_shared_ops;
+  for (int i = 0; i < capacity; i++)
+  {
+    MEMNODE_createLiteShared(&vector_->storage_[i]);
+  }
+  return vector_;
+}
+
+Vector *VECTOR_createInArena(u16 capacity, Arena *arena)
+{
+  if (0 == capacity || NULL == arena)
+  {
+    return NULL;
+  }
+  return VECTOR_createScoped(capacity, arena, VECTOR_arenaAlloc);
+}
+
+Vector *VECTOR_createInMemoryStack(u16 capacity, MemoryStack *stack, MemoryStackSide side)
+{
+  if (0 == capacity || NULL == stack)
+  {
+    return NULL;
+  }
+  return VECTOR_createScoped(capacity, stack, kMemoryStackSide_Low == side ?
+                             VECTOR_memoryStackLowAlloc : VECTOR_memoryStackHighAlloc);
+}
+
+s16 VECTOR_scopedDestroy(Vector *vector)
+{
+  if (NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  return kErrorCode_Ok;
+}
+
+s16 VECTOR_scopedReset(Vector *vector)
+{
+  s16 error = VECTOR_softReset(vector);
+  if (kErrorCode_Ok == error)
+  {
+    vector->head_ = 0;
+  }
+  return error;
+}
+
 s16 VECTOR_destroy(Vector* vector)
 {
   if(NULL == vector)
@@ -311,7 +519,7 @@ void *VECTOR_extractFirst(Vector *vector)
     return NULL;
   }
   void* tmp = vector->storage_[vector->head_].data_;
-  for(int i = vector->head_; i < vector->tail_; i++)
+  for(int i = vector->head_; i < vector->tail_ - 1; i++)
   {
     vector->storage_[i].ops_->setData(&vector->storage_[i], vector->storage_[i + 1].data_, vector->storage_[i + 1].size_);
   }
@@ -364,7 +572,7 @@ void *VECTOR_extractAt(Vector *vector, u16 position)
 
   void *tmp = vector->storage_[position].data_;
 
-  for (int i = position; i < vector->tail_; i++)
+  for (int i = position; i < vector->tail_ - 1; i++)
   {
     vector->storage_[i].ops_->setData(&vector->storage_[i], vector->storage_[i + 1].data_, vector->storage_[i + 1].size_);
   }
@@ -421,7 +629,7 @@ void *VECTOR_at(Vector *vector, u16 position)
   {
     return NULL;
   }
-  if (position >= vector->tail_ || position >=vector->capacity_ || position <= vector->head_)
+  if (position >= vector->tail_ || position >=vector->capacity_ || position < vector->head_)
   {
     return NULL;
   }
@@ -447,7 +655,7 @@ s16 VECTOR_traverse(Vector *vector, void (*callback)(MemoryNode *))
   return kErrorCode_Ok;
 }
 
-s16 VECTOR_resize(Vector *vector, u16 new_capacity)
+s16 VECTOR_traverseEx(Vector *vector, boolean (*callback)(MemoryNode *, void *), void *context)
 {
   if(NULL == vector)
   {
@@ -457,52 +665,101 @@ s16 VECTOR_resize(Vector *vector, u16 new_capacity)
   {
     return kErrorCode_StorageNull;
   }
+  if(NULL == callback)
+  {
+    return kErrorCode_Null;
+  }
+  for(u16 i = vector->head_; i < vector->tail_; i++)
+  {
+    if(True != callback(&vector->storage_[i], context))
+    {
+      break;
+    }
+  }
 
-  if(0 == new_capacity)
+  return kErrorCode_Ok;
+}
+
+s16 VECTOR_begin(Vector *vector, Cursor *cursor)
+{
+  if(NULL == cursor)
   {
-    return kErrorCode_SizeZero;
+    return kErrorCode_Null;
+  }
+  CURSOR_init(cursor, NULL, NULL, 1, False);
+  if(NULL == vector)
+  {
+    return kErrorCode_VectorNull;
+  }
+  if(NULL == vector->storage_)
+  {
+    return kErrorCode_StorageNull;
+  }
+  if(vector->tail_ > vector->head_)
+  {
+    CURSOR_init(cursor, &vector->storage_[vector->head_], &vector->storage_[vector->tail_ - 1], 1, False);
   }
 
-  MemoryNode *storage_tmp = (MemoryNode *)MM->malloc(sizeof(MemoryNode) * new_capacity);
+  return kErrorCode_Ok;
+}
 
-  if(NULL == storage_tmp)
+s16 VECTOR_resize(Vector *vector, u16 new_capacity)
+{
+  if(NULL == vector)
   {
     return kErrorCode_VectorNull;
   }
-  
+  if(NULL == vector->storage_)
+  {
+    return kErrorCode_StorageNull;
+  }
+
+  if(0 == new_capacity)
+  {
+    return kErrorCode_SizeZero;
+  }
+
   if(new_capacity == vector->capacity_)
   {
     return kErrorCode_Ok;
   }
+
+  MemoryNode *storage_tmp = (MemoryNode *)VECTOR_alloc(vector, sizeof(MemoryNode) * new_capacity);
+
+  if(NULL == storage_tmp)
+  {
+    return kErrorCode_VectorNull;
+  }
   //copy of storage in temporal storage with resize
   if(new_capacity > vector->capacity_)
   {
     for(int i = 0; i < vector->tail_; i++)
     {
-      MEMNODE_createLite(&storage_tmp[i]);
+      VECTOR_initNode(vector, &storage_tmp[i]);
       storage_tmp[i].ops_->setData(&storage_tmp[i], vector->storage_[i].data_, vector->storage_[i].size_);
     }
 
     for(int i = vector->tail_; i < new_capacity; i++)
     {
-      MEMNODE_createLite(&storage_tmp[i]);
+      VECTOR_initNode(vector, &storage_tmp[i]);
     } 
   }else if(new_capacity < vector->capacity_)
   {
     for (int i = 0; i < new_capacity; i++)
     {
-      MEMNODE_createLite(&storage_tmp[i]);
+      VECTOR_initNode(vector, &storage_tmp[i]);
       storage_tmp[i].ops_->setData(&storage_tmp[i], vector->storage_[i].data_, vector->storage_[i].size_);
     }
 
     for(int i = new_capacity; i < vector->tail_; i++)
     {
-      storage_tmp->ops_->reset(&vector->storage_[i]);
+      VECTOR_freeData(vector, vector->storage_[i].data_);
+      storage_tmp->ops_->softReset(&vector->storage_[i]);
     }
     vector->tail_ = new_capacity;
   }
   //free old storage
-  MM->free(vector->storage_);
+  VECTOR_free(vector, vector->storage_);
 
 
   vector->capacity_ = new_capacity;
@@ -511,6 +768,16 @@ s16 VECTOR_resize(Vector *vector, u16 new_capacity)
   return kErrorCode_Ok;
 }
 
+// Gives back the payloads copied or shared into aux by a concat that can't finish, and aux
+static void VECTOR_concatUndo(Vector *vector, MemoryNode *aux, u16 first, u16 count)
+{
+  for (u16 i = first; i < first + count; i++)
+  {
+    VECTOR_freeData(vector, aux[i].data_);
+  }
+  VECTOR_free(vector, aux);
+}
+
 s16 VECTOR_concat(Vector* vector, Vector *vector_src)
 {
   if(NULL == vector || NULL == vector_src)
@@ -523,7 +790,7 @@ s16 VECTOR_concat(Vector* vector, Vector *vector_src)
     return kErrorCode_StorageNull;
   }
 
-  MemoryNode *aux = (MemoryNode *)MM->malloc(sizeof(MemoryNode) * (vector->capacity_ + vector_src->capacity_));
+  MemoryNode *aux = (MemoryNode *)VECTOR_alloc(vector, sizeof(MemoryNode) * (vector->capacity_ + vector_src->capacity_));
   if (NULL == aux)
   {
     return kErrorCode_NodeNull;
@@ -531,20 +798,42 @@ s16 VECTOR_concat(Vector* vector, Vector *vector_src)
   
   for (u16 i = 0; i < vector->tail_; i++)
   {
-    MEMNODE_createLite(&aux[i]);
+    VECTOR_initNode(vector, &aux[i]);
     aux[i].ops_->setData(&aux[i],vector->storage_[i].data_,vector->storage_[i].size_);
   }
   
   for(u16 i = 0; i < vector_src->tail_; i++)
   {
-    MEMNODE_createLite(&aux[i + vector->tail_]);
-    aux[i].ops_->memCopy(&aux[i + vector->tail_], vector_src->storage_[i].data_, vector_src->storage_[i].size_);
-   
+    VECTOR_initNode(vector, &aux[i + vector->tail_]);
+    if (&vector_shared_ops == vector->ops_)
+    {
+      // a new reference, or a shared copy of a payload that isn't shared
+      s16 error = MEMNODE_share(&aux[i + vector->tail_], &vector_src->storage_[i]);
+      if (kErrorCode_Ok != error)
+      {
+        VECTOR_concatUndo(vector, aux, vector->tail_, i);
+        return error;
+      }
+      continue;
+    }
+    void *copy = VECTOR_alloc(vector, vector_src->storage_[i].size_);
+    if (NULL == copy)
+    {
+      // the vector is left as it was
+      VECTOR_concatUndo(vector, aux, vector->tail_, i);
+      return kErrorCode_Memory;
+    }
+    memcpy(copy, vector_src->storage_[i].data_, vector_src->storage_[i].size_);
+    aux[i + vector->tail_].ops_->setData(&aux[i + vector->tail_], copy, vector_src->storage_[i].size_);
+  }
+  for (u32 i = vector->tail_ + vector_src->tail_; i < (u32)vector->capacity_ + vector_src->capacity_; i++)
+  {
+    VECTOR_initNode(vector, &aux[i]);
   }
     vector->capacity_ += vector_src->capacity_;
     vector->tail_ += vector_src->tail_;
 
-    MM->free(vector->storage_);
+    VECTOR_free(vector, vector->storage_);
 
     vector->storage_ = aux;
 
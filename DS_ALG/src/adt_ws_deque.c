@@ -0,0 +1,266 @@
+/**
+ * @file adt_ws_deque.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-05-13
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_ws_deque.h"
+#include "aligned_memory.h"
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+static s16 WSDEQUE_destroy(WSDeque *deque);
+static u16 WSDEQUE_capacity(WSDeque *deque);
+static u16 WSDEQUE_length(WSDeque *deque);
+static boolean WSDEQUE_isEmpty(WSDeque *deque);
+static s16 WSDEQUE_push(WSDeque *deque, void *task);
+static void *WSDEQUE_pop(WSDeque *deque);
+static void *WSDEQUE_steal(WSDeque *deque);
+static void WSDEQUE_print(WSDeque *deque);
+
+static WSDequeArray *WSDEQUE_createArray(u32 capacity);
+static void WSDEQUE_destroyArray(WSDequeArray *array);
+
+struct ws_deque_ops_s ws_deque_ops = {
+    .destroy = WSDEQUE_destroy,
+    .capacity = WSDEQUE_capacity,
+    .length = WSDEQUE_length,
+    .isEmpty = WSDEQUE_isEmpty,
+    .push = WSDEQUE_push,
+    .pop = WSDEQUE_pop,
+    .steal = WSDEQUE_steal,
+    .print = WSDEQUE_print,
+};
+
+WSDequeArray *WSDEQUE_createArray(u32 capacity)
+{
+  WSDequeArray *array = MM->malloc(sizeof(WSDequeArray));
+  if (NULL == array)
+  {
+    return NULL;
+  }
+  array->slots_ = ALIGNED_malloc(sizeof(_Atomic(void *)) * capacity);
+  if (NULL == array->slots_)
+  {
+    MM->free(array);
+    return NULL;
+  }
+  for (u32 i = 0; i < capacity; i++)
+  {
+    atomic_init(&array->slots_[i], NULL);
+  }
+  array->capacity_ = capacity;
+  array->mask_ = capacity - 1;
+  array->previous_ = NULL;
+  return array;
+}
+
+void WSDEQUE_destroyArray(WSDequeArray *array)
+{
+  while (NULL != array)
+  {
+    WSDequeArray *previous = array->previous_;
+    ALIGNED_free(array->slots_);
+    MM->free(array);
+    array = previous;
+  }
+}
+
+WSDeque *WSDEQUE_create(u16 capacity)
+{
+  if (0 == capacity || capacity > kWSDequeMaxCapacity)
+  {
+    return NULL;
+  }
+  u32 array_size = 1;
+  while (array_size < capacity)
+  {
+    array_size <<= 1;
+  }
+  WSDeque *deque = ALIGNED_malloc(sizeof(WSDeque));
+  if (NULL == deque)
+  {
+    return NULL;
+  }
+  WSDequeArray *array = WSDEQUE_createArray(array_size);
+  if (NULL == array)
+  {
+    ALIGNED_free(deque);
+    return NULL;
+  }
+  atomic_init(&deque->top_, 0);
+  atomic_init(&deque->bottom_, 0);
+  atomic_init(&deque->array_, array);
+  deque->ops_ = &ws_deque_ops;
+  return deque;
+}
+
+s16 WSDEQUE_destroy(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  WSDEQUE_destroyArray(atomic_load_explicit(&deque->array_, memory_order_relaxed));
+  ALIGNED_free(deque);
+  return kErrorCode_Ok;
+}
+
+u16 WSDEQUE_capacity(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    return 0;
+  }
+  return (u16)atomic_load_explicit(&deque->array_, memory_order_relaxed)->capacity_;
+}
+
+u16 WSDEQUE_length(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    return 0;
+  }
+  s64 bottom = atomic_load_explicit(&deque->bottom_, memory_order_relaxed);
+  s64 top = atomic_load_explicit(&deque->top_, memory_order_relaxed);
+  return bottom > top ? (u16)(bottom - top) : 0;
+}
+
+boolean WSDEQUE_isEmpty(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    return True;
+  }
+  return 0 == WSDEQUE_length(deque) ? True : False;
+}
+
+s16 WSDEQUE_push(WSDeque *deque, void *task)
+{
+  if (NULL == deque)
+  {
+    return kErrorCode_DequeNull;
+  }
+  if (NULL == task)
+  {
+    return kErrorCode_SrcNull;
+  }
+  s64 bottom = atomic_load_explicit(&deque->bottom_, memory_order_relaxed);
+  s64 top = atomic_load_explicit(&deque->top_, memory_order_acquire);
+  WSDequeArray *array = atomic_load_explicit(&deque->array_, memory_order_relaxed);
+  if (bottom - top > (s64)array->mask_)
+  {
+    if (array->capacity_ >= kWSDequeMaxCapacity)
+    {
+      return kErrorCode_DequeFull;
+    }
+    WSDequeArray *bigger = WSDEQUE_createArray(array->capacity_ << 1);
+    if (NULL == bigger)
+    {
+      return kErrorCode_Memory;
+    }
+    for (s64 i = top; i < bottom; i++)
+    {
+      void *pending = atomic_load_explicit(&array->slots_[i & array->mask_], memory_order_relaxed);
+      atomic_store_explicit(&bigger->slots_[i & bigger->mask_], pending, memory_order_relaxed);
+    }
+    bigger->previous_ = array;
+    atomic_store_explicit(&deque->array_, bigger, memory_order_release);
+    array = bigger;
+  }
+  atomic_store_explicit(&array->slots_[bottom & array->mask_], task, memory_order_relaxed);
+  // the task must be visible before a thief can see the new bottom
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&deque->bottom_, bottom + 1, memory_order_relaxed);
+  return kErrorCode_Ok;
+}
+
+void *WSDEQUE_pop(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    return NULL;
+  }
+  s64 bottom = atomic_load_explicit(&deque->bottom_, memory_order_relaxed) - 1;
+  WSDequeArray *array = atomic_load_explicit(&deque->array_, memory_order_relaxed);
+  atomic_store_explicit(&deque->bottom_, bottom, memory_order_relaxed);
+  // reserve the bottom slot before looking at top_: pairs with the fence in steal
+  atomic_thread_fence(memory_order_seq_cst);
+  s64 top = atomic_load_explicit(&deque->top_, memory_order_relaxed);
+  if (top > bottom)
+  {
+    // empty
+    atomic_store_explicit(&deque->bottom_, bottom + 1, memory_order_relaxed);
+    return NULL;
+  }
+  void *task = atomic_load_explicit(&array->slots_[bottom & array->mask_], memory_order_relaxed);
+  if (top == bottom)
+  {
+    // last task: race the thieves for it
+    if (!atomic_compare_exchange_strong_explicit(&deque->top_, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+    {
+      task = NULL;
+    }
+    atomic_store_explicit(&deque->bottom_, bottom + 1, memory_order_relaxed);
+  }
+  return task;
+}
+
+void *WSDEQUE_steal(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    return NULL;
+  }
+  s64 top = atomic_load_explicit(&deque->top_, memory_order_acquire);
+  atomic_thread_fence(memory_order_seq_cst);
+  s64 bottom = atomic_load_explicit(&deque->bottom_, memory_order_acquire);
+  if (top >= bottom)
+  {
+    return NULL;
+  }
+  WSDequeArray *array = atomic_load_explicit(&deque->array_, memory_order_acquire);
+  void *task = atomic_load_explicit(&array->slots_[top & array->mask_], memory_order_relaxed);
+  if (!atomic_compare_exchange_strong_explicit(&deque->top_, &top, top + 1,
+                                               memory_order_seq_cst, memory_order_relaxed))
+  {
+    // another thief or the owner took it
+    return NULL;
+  }
+  return task;
+}
+
+void WSDEQUE_print(WSDeque *deque)
+{
+  if (NULL == deque)
+  {
+    printf("\t[WSDeque Info] Address: NULL\n");
+    return;
+  }
+  s64 top = atomic_load(&deque->top_);
+  s64 bottom = atomic_load(&deque->bottom_);
+  WSDequeArray *array = atomic_load(&deque->array_);
+  u16 retired = 0;
+  for (WSDequeArray *old = array->previous_; NULL != old; old = old->previous_)
+  {
+    retired++;
+  }
+  printf("\t[WSDeque Info] Address: %p\n", deque);
+  printf("\t[WSDeque Info] Top: %lld\n", (long long)top);
+  printf("\t[WSDeque Info] Bottom: %lld\n", (long long)bottom);
+  printf("\t[WSDeque Info] Length: %d\n", WSDEQUE_length(deque));
+  printf("\t[WSDeque Info] Capacity: %u\n", array->capacity_);
+  printf("\t[WSDeque Info] Retired arrays: %d\n", retired);
+  for (s64 i = top; i < bottom; i++)
+  {
+    printf("\t\t[WSDeque Info] Slot #%u: %p\n", (u32)(i & array->mask_),
+           atomic_load(&array->slots_[i & array->mask_]));
+  }
+}
@@ -0,0 +1,128 @@
+// comparative_arena.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Request-style loop: every request creates a few Vectors and Lists, fills
+// them with small payloads, reads them and throws everything away. Compares
+// the containers on MM (one malloc per node and payload, destroy frees them
+// one by one) with the same containers created in an arena (bump allocation,
+// destroy is a no-op and one arena reset per request frees everything).
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_arena.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+
+#include "comparative_base.c"
+
+#define kContainers 4
+const u32 kRequests = 20000;
+const u16 kElements = 32;
+// header + alignment + chunk fit in one 8KB MM block
+const u32 kArenaChunkSize = 8192 - 64;
+
+static u64 checksum = 0;
+
+static void BENCH_sum(MemoryNode *node)
+{
+	checksum += *(u32 *)node->data_;
+}
+
+static void BENCH_requestMM()
+{
+	Vector *vectors[kContainers];
+	List *lists[kContainers];
+	for (u16 c = 0; c < kContainers; ++c)
+	{
+		vectors[c] = VECTOR_create(kElements);
+		lists[c] = LIST_create(kElements);
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			u32 *value = MM->malloc(sizeof(u32));
+			*value = i;
+			vectors[c]->ops_->insertLast(vectors[c], value, sizeof(u32));
+			value = MM->malloc(sizeof(u32));
+			*value = i;
+			lists[c]->ops_->insertLast(lists[c], value, sizeof(u32));
+		}
+	}
+	for (u16 c = 0; c < kContainers; ++c)
+	{
+		vectors[c]->ops_->traverse(vectors[c], BENCH_sum);
+		lists[c]->ops_->traverse(lists[c], BENCH_sum);
+		vectors[c]->ops_->destroy(vectors[c]);
+		lists[c]->ops_->destroy(lists[c]);
+	}
+}
+
+static void BENCH_requestArena(Arena *arena)
+{
+	Vector *vectors[kContainers];
+	List *lists[kContainers];
+	for (u16 c = 0; c < kContainers; ++c)
+	{
+		vectors[c] = VECTOR_createInArena(kElements, arena);
+		lists[c] = LIST_createInArena(kElements, arena);
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			u32 *value = arena->ops_->alloc(arena, sizeof(u32));
+			*value = i;
+			vectors[c]->ops_->insertLast(vectors[c], value, sizeof(u32));
+			value = arena->ops_->alloc(arena, sizeof(u32));
+			*value = i;
+			lists[c]->ops_->insertLast(lists[c], value, sizeof(u32));
+		}
+	}
+	for (u16 c = 0; c < kContainers; ++c)
+	{
+		vectors[c]->ops_->traverse(vectors[c], BENCH_sum);
+		lists[c]->ops_->traverse(lists[c], BENCH_sum);
+		vectors[c]->ops_->destroy(vectors[c]);
+		lists[c]->ops_->destroy(lists[c]);
+	}
+	arena->ops_->reset(arena);
+}
+
+int main()
+{
+	Arena *arena = ARENA_create(kArenaChunkSize);
+	if (NULL == arena)
+	{
+		printf("ERROR: cannot create the arena\n");
+		return -1;
+	}
+	// objects per request: containers, vector storages, list nodes and payloads
+	u64 objects = (u64)kRequests * kContainers * (2 + 1 + 3 * kElements);
+	printf("%d requests, %d Vectors and %d Lists of %d elements each\n",
+		kRequests, kContainers, kContainers, kElements);
+
+	checksum = 0;
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRequests; ++r)
+	{
+		BENCH_requestMM();
+	}
+	COMPARATIVE_printResult("MM containers (per object)", objects, COMPARATIVE_now() - time_start);
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+
+	checksum = 0;
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRequests; ++r)
+	{
+		BENCH_requestArena(arena);
+	}
+	COMPARATIVE_printResult("Arena containers (per object)", objects, COMPARATIVE_now() - time_start);
+	printf("    checksum %llu, arena capacity %u bytes\n", (unsigned long long)checksum,
+		arena->ops_->capacity(arena));
+
+	arena->ops_->destroy(arena);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
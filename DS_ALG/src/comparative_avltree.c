@@ -0,0 +1,258 @@
+// comparative_avltree.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// AVL tree against a sorted Vector and a sorted DLList: building them from
+// shuffled elements and reading elements by position (at). The Vector finds
+// the place with a binary search and moves every element after it, the
+// DLList walks to it; at is direct in the Vector, a walk in the DLList and
+// a descent by subtree counts in the tree. Their storage comes from the MM,
+// so they are compared at the sizes they reach. The tree alone then takes
+// 1M elements: inserts, lookups, at, rank and erasures. The payloads are
+// u32 in a static array.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_dllist.h"
+#include "adt_avltree.h"
+
+#include "comparative_base.c"
+
+#define kVectorElements kComparativeVectorElements
+#define kListElements kComparativeListElements
+#define kElements (1024 * 1024)
+const u32 kRounds = 100;
+
+static u32 values[kElements];
+static u32 order[kElements];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_shuffle(u32 count)
+{
+	for (u32 i = 0; i < count; ++i)
+	{
+		order[i] = i;
+	}
+	for (u32 i = count - 1; i > 0; --i)
+	{
+		u32 j = (u32)(((u64)rand() << 16 ^ (u64)rand()) % (i + 1));
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+}
+
+static s32 BENCH_compare(const void *a, u16 a_bytes, const void *b, u16 b_bytes)
+{
+	(void)a_bytes;
+	(void)b_bytes;
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Position of the first element of the sorted vector not below value
+static u16 BENCH_vectorPosition(Vector *vector, u32 value)
+{
+	u16 low = vector->head_;
+	u16 high = vector->tail_;
+	while (low < high)
+	{
+		u16 middle = (low + high) / 2;
+		if (*(u32 *)vector->ops_->at(vector, middle) < value)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+// Position of the first element of the sorted DLList not below value
+static u16 BENCH_listPosition(DLList *list, u32 value)
+{
+	Cursor cursor;
+	u16 position = 0;
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor) && *(u32 *)CURSOR_get(&cursor) < value;
+		CURSOR_next(&cursor))
+	{
+		++position;
+	}
+	return position;
+}
+
+// Builds the tree kRounds times from the first count shuffled elements, then reads them by position
+static void BENCH_tree(AVLTree *tree, u32 count)
+{
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		tree->ops_->softReset(tree);
+		for (u32 i = 0; i < count; ++i)
+		{
+			tree->ops_->insert(tree, &values[order[i]], sizeof(u32));
+		}
+	}
+	COMPARATIVE_printResult("AVL tree insert", (u64)kRounds * count, COMPARATIVE_now() - time_start);
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u32 i = 0; i < count; ++i)
+		{
+			checksum += *(u32 *)tree->ops_->at(tree, order[i]);
+		}
+	}
+	COMPARATIVE_printResult("AVL tree at", (u64)kRounds * count, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+static void BENCH_vector()
+{
+	printf("  %d elements, built %u times\n", kVectorElements, kRounds);
+	BENCH_shuffle(kVectorElements);
+	Vector *vector = VECTOR_create(kVectorElements);
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		vector->ops_->softReset(vector);
+		for (u32 i = 0; i < kVectorElements; ++i)
+		{
+			u32 *value = &values[order[i]];
+			vector->ops_->insertAt(vector, value, sizeof(u32), BENCH_vectorPosition(vector, *value));
+		}
+	}
+	COMPARATIVE_printResult("sorted Vector insert", (u64)kRounds * kVectorElements, COMPARATIVE_now() - time_start);
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u32 i = 0; i < kVectorElements; ++i)
+		{
+			checksum += *(u32 *)vector->ops_->at(vector, (u16)order[i]);
+		}
+	}
+	COMPARATIVE_printResult("sorted Vector at", (u64)kRounds * kVectorElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	vector->ops_->softReset(vector);
+	vector->ops_->destroy(vector);
+
+	AVLTree *tree = AVLTREE_create(BENCH_compare);
+	BENCH_tree(tree, kVectorElements);
+	tree->ops_->softReset(tree);
+	tree->ops_->destroy(tree);
+}
+
+static void BENCH_list()
+{
+	printf("  %d elements, built %u times\n", kListElements, kRounds);
+	BENCH_shuffle(kListElements);
+	DLList *dllist = DLList_create(kListElements);
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		while (NULL != dllist->ops_->extractFirst(dllist));
+		for (u32 i = 0; i < kListElements; ++i)
+		{
+			u32 *value = &values[order[i]];
+			dllist->ops_->insertAt(dllist, value, sizeof(u32), BENCH_listPosition(dllist, *value));
+		}
+	}
+	COMPARATIVE_printResult("sorted DLList insert", (u64)kRounds * kListElements, COMPARATIVE_now() - time_start);
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u32 i = 0; i < kListElements; ++i)
+		{
+			checksum += *(u32 *)dllist->ops_->at(dllist, (u16)order[i]);
+		}
+	}
+	COMPARATIVE_printResult("sorted DLList at", (u64)kRounds * kListElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+
+	AVLTree *tree = AVLTREE_create(BENCH_compare);
+	BENCH_tree(tree, kListElements);
+	tree->ops_->softReset(tree);
+	tree->ops_->destroy(tree);
+}
+
+static void BENCH_big()
+{
+	COMPARATIVE_printSizeNote("DLList", kListElements, kElements);
+	printf("  AVL tree, %u elements\n", kElements);
+	BENCH_shuffle(kElements);
+	AVLTree *tree = AVLTREE_create(BENCH_compare);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		tree->ops_->insert(tree, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("AVL tree insert shuffled", kElements, COMPARATIVE_now() - time_start);
+	printf("    height %d\n", tree->root_->height_);
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += *(u32 *)tree->ops_->find(tree, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("AVL tree find", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += *(u32 *)tree->ops_->at(tree, order[i]);
+	}
+	COMPARATIVE_printResult("AVL tree at", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += tree->ops_->rank(tree, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("AVL tree rank", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += *(u32 *)tree->ops_->erase(tree, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("AVL tree erase", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	tree->ops_->destroy(tree);
+}
+
+int main()
+{
+	srand(1);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+	}
+
+	BENCH_vector();
+	BENCH_list();
+	BENCH_big();
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
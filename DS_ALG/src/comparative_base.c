@@ -0,0 +1,63 @@
+// comparative_base.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Portable timing helpers shared by the comparative (benchmark) programs.
+// Included directly by each comparative_*.c, like test_base.c in the tests.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "EDK_MemoryManager/edk_platform_types.h"
+
+// Sizes of the generic ADTs in the benchmarks. The MM doesn't fail
+// gracefully, and its limits come from tools/edk_memory_configuration.cfg,
+// which the programs load: 10000 blocks of each size up to 64 KB and 100
+// of each from 128 KB to 1 MB. A DLList of 20000 nodes fits and a Vector of
+// MemoryNodes could reach 1 MB, about 26000 elements, so these sizes are
+// far below the MM: they keep the O(n) walks of the lists, repeated every
+// round, and the Vector copies within a short run.
+#define kComparativeListElements 256
+#define kComparativeVectorElements 1500
+
+// Returns a monotonic timestamp in microseconds: QueryPerformanceCounter on
+// Windows, CLOCK_MONOTONIC on POSIX. Without them (a strict C11 build that
+// hides clock_gettime) it falls back to the wall clock, which isn't monotonic
+double COMPARATIVE_now()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return counter.QuadPart * 1000000.0 / frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+#else
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+#endif
+}
+
+// Prints total time, time per operation and operations per second
+void COMPARATIVE_printResult(const char *name, u64 operations, double elapsed_us)
+{
+	double ns_per_op = operations > 0 ? (elapsed_us * 1000.0) / operations : 0.0;
+	double ops_per_sec = elapsed_us > 0.0 ? operations / (elapsed_us / 1000000.0) : 0.0;
+	printf("  %-44s %12.2f us  %10.2f ns/op  %14.0f ops/s\n", name, elapsed_us, ns_per_op, ops_per_sec);
+}
+
+// Says that the rows before and after it were measured at different sizes,
+// so their ns/op aren't like for like
+void COMPARATIVE_printSizeNote(const char *limited, u32 limited_elements, u32 elements)
+{
+	printf("  (sizes differ: the %s is limited by the MM to %u elements, the rows below take %u;\n"
+		   "   compare them only with the rows of the same size)\n", limited, limited_elements, elements);
+}
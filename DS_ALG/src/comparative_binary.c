@@ -0,0 +1,226 @@
+// comparative_binary.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Warm start from binary files: rebuilding a List with a read, an MM
+// allocation and an insertLast per element against BINARY_mmapLoadVector,
+// which only maps the file and points the nodes at it. The big run maps
+// kFiles files of 65535 u32 (the most a container holds), 1M elements. MM
+// can't hold a container that big, so the first file is written by hand and
+// the others are saves of it mapped.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_list.h"
+#include "adt_binary.h"
+#include "adt_cursor.h"
+
+#include "comparative_base.c"
+
+// the rebuilt list keeps an MM block per element, MM has a few hundred per class
+#define kSmallElements 128
+const u32 kRounds = 2000;
+// 16 * 65535 = 1048560 elements
+#define kFiles 16
+#define kBigElements 65535
+
+static u32 values[kBigElements];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_fileName(char *name, u16 index)
+{
+	sprintf(name, "comparative_binary_%d.bin", index);
+}
+
+// Same layout as BINARY_save, see adt_binary.h
+static void BENCH_writeFile(const char *path)
+{
+	FILE *file = fopen(path, "wb");
+	u64 offset = sizeof(BinaryHeader) + (kBigElements + 1) * sizeof(u64);
+	BinaryHeader header = {
+		.magic_ = kBinaryMagic,
+		.version_ = kBinaryVersion,
+		.count_ = kBigElements,
+		.bytes_ = offset + sizeof(values),
+	};
+	fwrite(&header, sizeof(header), 1, file);
+	for (u32 i = 0; i <= kBigElements; ++i, offset += sizeof(u32))
+	{
+		fwrite(&offset, sizeof(offset), 1, file);
+	}
+	fwrite(values, sizeof(values), 1, file);
+	fclose(file);
+}
+
+// What a startup did before the binary files: read every element and copy
+// it into an MM payload inserted in a List
+static List *BENCH_rebuild(const char *path)
+{
+	static u8 buffer[sizeof(BinaryHeader) + (kSmallElements + 1) * sizeof(u64) + kSmallElements * sizeof(u32)];
+	FILE *file = fopen(path, "rb");
+	if (NULL == file)
+	{
+		return NULL;
+	}
+	size_t bytes = fread(buffer, 1, sizeof(buffer), file);
+	fclose(file);
+	BinaryHeader *header = (BinaryHeader *)buffer;
+	u64 *offsets = (u64 *)(header + 1);
+	if (bytes < sizeof(BinaryHeader) || bytes != header->bytes_)
+	{
+		return NULL;
+	}
+	List *list = LIST_create(header->count_);
+	for (u16 i = 0; NULL != list && i < header->count_; ++i)
+	{
+		u16 size = (u16)(offsets[i + 1] - offsets[i]);
+		void *payload = MM->malloc(size);
+		memcpy(payload, buffer + offsets[i], size);
+		list->ops_->insertLast(list, payload, size);
+	}
+	return list;
+}
+
+static void BENCH_sum(Cursor *cursor)
+{
+	for (; True == CURSOR_valid(cursor); CURSOR_next(cursor))
+	{
+		u32 value;
+		memcpy(&value, CURSOR_get(cursor), sizeof(value));
+		checksum += value;
+	}
+}
+
+static void BENCH_small(List *source)
+{
+	char name[64];
+	u64 ops = (u64)kRounds * kSmallElements;
+	Cursor cursor;
+	BENCH_fileName(name, kFiles);
+	BINARY_saveList(source, name);
+	printf("  %d elements\n", kSmallElements);
+
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		List *list = BENCH_rebuild(name);
+		list->ops_->begin(list, &cursor);
+		BENCH_sum(&cursor);
+		list->ops_->destroy(list);
+	}
+	COMPARATIVE_printResult("read + MM alloc + insertLast + sum + destroy", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		Vector *vector = BINARY_mmapLoadVector(name);
+		vector->ops_->begin(vector, &cursor);
+		BENCH_sum(&cursor);
+		vector->ops_->destroy(vector);
+	}
+	COMPARATIVE_printResult("mmapLoadVector + sum + destroy", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	remove(name);
+}
+
+static void BENCH_big()
+{
+	char name[64];
+	u64 ops = (u64)kFiles * kBigElements;
+	Vector *vectors[kFiles];
+	Cursor cursor;
+	printf("  %d files of %d elements\n", kFiles, kBigElements);
+
+	BENCH_fileName(name, 0);
+	BENCH_writeFile(name);
+	vectors[0] = BINARY_mmapLoadVector(name);
+	if (NULL == vectors[0])
+	{
+		printf("ERROR: cannot map %s\n", name);
+		return;
+	}
+	double time_start = COMPARATIVE_now();
+	for (u16 f = 1; f < kFiles; ++f)
+	{
+		BENCH_fileName(name, f);
+		BINARY_saveVector(vectors[0], name);
+	}
+	COMPARATIVE_printResult("saveVector", ops - kBigElements, COMPARATIVE_now() - time_start);
+	vectors[0]->ops_->destroy(vectors[0]);
+
+	time_start = COMPARATIVE_now();
+	for (u16 f = 0; f < kFiles; ++f)
+	{
+		BENCH_fileName(name, f);
+		vectors[f] = BINARY_mmapLoadVector(name);
+	}
+	COMPARATIVE_printResult("mmapLoadVector (startup)", ops, COMPARATIVE_now() - time_start);
+
+	// the first walk pays the page faults of the mapping
+	time_start = COMPARATIVE_now();
+	for (u16 f = 0; f < kFiles; ++f)
+	{
+		vectors[f]->ops_->begin(vectors[f], &cursor);
+		BENCH_sum(&cursor);
+	}
+	COMPARATIVE_printResult("first cursor sum", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u16 f = 0; f < kFiles; ++f)
+	{
+		vectors[f]->ops_->begin(vectors[f], &cursor);
+		BENCH_sum(&cursor);
+	}
+	COMPARATIVE_printResult("second cursor sum", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u16 f = 0; f < kFiles; ++f)
+	{
+		vectors[f]->ops_->destroy(vectors[f]);
+		BENCH_fileName(name, f);
+		remove(name);
+	}
+	COMPARATIVE_printResult("destroy", ops, COMPARATIVE_now() - time_start);
+}
+
+int main()
+{
+	List *small = LIST_create(kSmallElements);
+	if (NULL == small)
+	{
+		printf("ERROR: cannot create the source list\n");
+		return -1;
+	}
+	for (u32 i = 0; i < kBigElements; ++i)
+	{
+		values[i] = i;
+	}
+	for (u16 i = 0; i < kSmallElements; ++i)
+	{
+		small->ops_->insertLast(small, &values[i], sizeof(u32));
+	}
+
+	BENCH_small(small);
+	BENCH_big();
+
+	while (NULL != small->ops_->extractFirst(small));
+	small->ops_->destroy(small);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
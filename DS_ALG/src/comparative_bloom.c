@@ -0,0 +1,258 @@
+// comparative_bloom.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Bloom filters: first as a pre-check before scanning a Vector and a DLList
+// for keys that are mostly missing, at the sizes the MM allows them. Then
+// the filters alone at 1M keys: add and lookups of keys added and not
+// added for a few false positive rates, with the rate measured and the
+// memory per key, the same with 64-byte keys, and the counting filter
+// with erasures.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_dllist.h"
+#include "adt_bloom.h"
+
+#include "comparative_base.c"
+
+#define kVectorElements kComparativeVectorElements
+#define kListElements kComparativeListElements
+#define kElements (1024 * 1024)
+#define kLongKeys (100 * 1000)
+#define kLongKeyBytes 64
+// one lookup of every ten is for a key in the container
+#define kLookups (100 * 1000)
+
+static u32 values[2 * kElements];
+static u8 long_keys[2 * kLongKeys][kLongKeyBytes];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_filter(double rate)
+{
+	printf("  BloomFilter, %u keys, rate %g\n", kElements, rate);
+	BloomFilter *filter = BLOOM_create(kElements, rate);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		filter->ops_->add(filter, &values[i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("BloomFilter add", kElements, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += filter->ops_->contains(filter, &values[i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("BloomFilter contains added", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = kElements; i < 2 * kElements; ++i)
+	{
+		checksum += filter->ops_->contains(filter, &values[i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("BloomFilter contains not added", kElements, COMPARATIVE_now() - time_start);
+	printf("    false positive rate %.5f, %.2f bits per key, %d hashes\n", (double)checksum / kElements,
+		   filter->ops_->memory(filter) * 8.0 / kElements, filter->hashes_);
+	checksum = 0;
+	filter->ops_->destroy(filter);
+}
+
+static void BENCH_longKeys()
+{
+	printf("  BloomFilter, %u keys of %d bytes, rate 0.01\n", kLongKeys, kLongKeyBytes);
+	BloomFilter *filter = BLOOM_create(kLongKeys, 0.01);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kLongKeys; ++i)
+	{
+		filter->ops_->add(filter, long_keys[i], kLongKeyBytes);
+	}
+	COMPARATIVE_printResult("BloomFilter add", kLongKeys, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = kLongKeys; i < 2 * kLongKeys; ++i)
+	{
+		checksum += filter->ops_->contains(filter, long_keys[i], kLongKeyBytes);
+	}
+	COMPARATIVE_printResult("BloomFilter contains not added", kLongKeys, COMPARATIVE_now() - time_start);
+	printf("    false positive rate %.5f\n", (double)checksum / kLongKeys);
+	checksum = 0;
+	filter->ops_->destroy(filter);
+}
+
+static void BENCH_counting(double rate)
+{
+	printf("  CountingBloom, %u keys, rate %g\n", kElements, rate);
+	CountingBloom *filter = COUNTBLOOM_create(kElements, rate);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		filter->ops_->add(filter, &values[i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("CountingBloom add", kElements, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = kElements; i < 2 * kElements; ++i)
+	{
+		checksum += filter->ops_->contains(filter, &values[i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("CountingBloom contains not added", kElements, COMPARATIVE_now() - time_start);
+	printf("    false positive rate %.5f, %.2f bits per key\n", (double)checksum / kElements,
+		   filter->ops_->memory(filter) * 8.0 / kElements);
+	checksum = 0;
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; i += 2)
+	{
+		checksum += kErrorCode_Ok == filter->ops_->erase(filter, &values[i], sizeof(u32)) ? 1 : 0;
+	}
+	COMPARATIVE_printResult("CountingBloom erase", kElements / 2, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	filter->ops_->destroy(filter);
+}
+
+// Looks up kLookups keys, one of every ten in the first count values
+static u32 BENCH_key(u32 i, u32 count)
+{
+	return 0 == i % 10 ? values[i % count] : values[kElements + i];
+}
+
+static void BENCH_vector()
+{
+	printf("  Vector, %d elements, %d lookups\n", kVectorElements, kLookups);
+	Vector *vector = VECTOR_create(kVectorElements);
+	BloomFilter *filter = BLOOM_create(kVectorElements, 0.01);
+	for (u32 i = 0; i < kVectorElements; ++i)
+	{
+		vector->ops_->insertLast(vector, &values[i], sizeof(u32));
+		filter->ops_->add(filter, &values[i], sizeof(u32));
+	}
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kLookups; ++i)
+	{
+		u32 key = BENCH_key(i, kVectorElements);
+		for (u16 j = 0; j < kVectorElements; ++j)
+		{
+			if (*(u32 *)vector->ops_->at(vector, j) == key)
+			{
+				++checksum;
+				break;
+			}
+		}
+	}
+	COMPARATIVE_printResult("Vector scan", kLookups, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kLookups; ++i)
+	{
+		u32 key = BENCH_key(i, kVectorElements);
+		if (True != filter->ops_->contains(filter, &key, sizeof(u32)))
+		{
+			continue;
+		}
+		for (u16 j = 0; j < kVectorElements; ++j)
+		{
+			if (*(u32 *)vector->ops_->at(vector, j) == key)
+			{
+				++checksum;
+				break;
+			}
+		}
+	}
+	COMPARATIVE_printResult("BloomFilter then Vector scan", kLookups, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	filter->ops_->destroy(filter);
+	vector->ops_->softReset(vector);
+	vector->ops_->destroy(vector);
+}
+
+// Tells if the DLList holds key, walking it from the front
+static boolean BENCH_listContains(DLList *list, u32 key)
+{
+	Cursor cursor;
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		if (*(u32 *)CURSOR_get(&cursor) == key)
+		{
+			return True;
+		}
+	}
+	return False;
+}
+
+static void BENCH_list()
+{
+	printf("  DLList, %d elements, %d lookups\n", kListElements, kLookups);
+	DLList *dllist = DLList_create(kListElements);
+	BloomFilter *filter = BLOOM_create(kListElements, 0.01);
+	for (u32 i = 0; i < kListElements; ++i)
+	{
+		dllist->ops_->insertLast(dllist, &values[i], sizeof(u32));
+		filter->ops_->add(filter, &values[i], sizeof(u32));
+	}
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kLookups; ++i)
+	{
+		checksum += BENCH_listContains(dllist, BENCH_key(i, kListElements));
+	}
+	COMPARATIVE_printResult("DLList scan", kLookups, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kLookups; ++i)
+	{
+		u32 key = BENCH_key(i, kListElements);
+		if (True == filter->ops_->contains(filter, &key, sizeof(u32)))
+		{
+			checksum += BENCH_listContains(dllist, key);
+		}
+	}
+	COMPARATIVE_printResult("BloomFilter then DLList scan", kLookups, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	filter->ops_->destroy(filter);
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+}
+
+int main()
+{
+	srand(1);
+	for (u32 i = 0; i < 2 * kElements; ++i)
+	{
+		values[i] = i;
+	}
+	for (u32 i = 0; i < 2 * kLongKeys; ++i)
+	{
+		for (u16 j = 0; j < kLongKeyBytes; ++j)
+		{
+			long_keys[i][j] = (u8)rand();
+		}
+	}
+
+	BENCH_vector();
+	BENCH_list();
+	COMPARATIVE_printSizeNote("DLList", kListElements, kElements);
+	BENCH_filter(0.01);
+	BENCH_filter(0.001);
+	BENCH_longKeys();
+	BENCH_counting(0.01);
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,229 @@
+// comparative_bptree.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// B+ tree against a sorted Vector. The tree takes 1M keys, shuffled and in
+// order, then answers lookups and range scans of 100 entries. The Vector
+// storage is a single MM block, so the sorted Vector (binary search plus
+// insertAt, which moves every element after the position) is compared with
+// the tree at the size it can reach; the tree is also built from it with
+// bulkLoad. Keys are big endian u64, payloads live in a static array.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_bptree.h"
+
+#include "comparative_base.c"
+
+#define kEntries (1024 * 1024)
+// elements a Vector of MemoryNodes holds in the largest MM block
+#define kVectorEntries 1500
+const u32 kScans = 100000;
+const u32 kScanLength = 100;
+const u32 kVectorRounds = 100;
+
+static u64 values[kEntries];
+static u32 order[kEntries];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static u64 BENCH_bigEndian(u64 value)
+{
+	u64 key = 0;
+	u8 *bytes = (u8 *)&key;
+	for (u16 i = 0; i < 8; ++i)
+	{
+		bytes[i] = (u8)(value >> (56 - 8 * i));
+	}
+	return key;
+}
+
+static void BENCH_shuffle(u32 count)
+{
+	for (u32 i = 0; i < count; ++i)
+	{
+		order[i] = i;
+	}
+	for (u32 i = count - 1; i > 0; --i)
+	{
+		u32 j = (u32)(((u64)rand() << 16 ^ (u64)rand()) % (i + 1));
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+}
+
+// Position of the first element of the sorted vector not below key
+static u16 BENCH_vectorLowerBound(Vector *vector, const u64 *key)
+{
+	u16 low = vector->head_;
+	u16 high = vector->tail_;
+	while (low < high)
+	{
+		u16 middle = (low + high) / 2;
+		if (memcmp(vector->ops_->at(vector, middle), key, sizeof(u64)) < 0)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+static void BENCH_treeScans(BPTree *tree, u32 entries, const char *label)
+{
+	BPTreeCursor cursor;
+	double time_start = COMPARATIVE_now();
+	for (u32 s = 0; s < kScans; ++s)
+	{
+		u64 from = values[order[s % entries]];
+		tree->ops_->lowerBound(tree, &from, &cursor);
+		for (u32 n = 0; n < kScanLength && True == BPTREE_cursorValid(&cursor); ++n, BPTREE_cursorNext(&cursor))
+		{
+			checksum += *(u64 *)BPTREE_cursorData(&cursor);
+		}
+	}
+	COMPARATIVE_printResult(label, (u64)kScans * kScanLength, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+static void BENCH_bigTree()
+{
+	printf("  B+ tree, %u entries\n", kEntries);
+	BPTree *tree = BPTREE_create(sizeof(u64), NULL);
+	BENCH_shuffle(kEntries);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		tree->ops_->insert(tree, &values[order[i]], &values[order[i]], sizeof(u64));
+	}
+	COMPARATIVE_printResult("B+ tree insert shuffled", kEntries, COMPARATIVE_now() - time_start);
+	printf("    height %d, %u nodes of %d bytes\n", tree->height_, tree->pool_->ops_->live(tree->pool_), kBPTreeNodeBytes);
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		checksum += *(u64 *)tree->ops_->find(tree, &values[order[i]]);
+	}
+	COMPARATIVE_printResult("B+ tree find shuffled", kEntries, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	BENCH_treeScans(tree, kEntries, "B+ tree scan 100 from a random key");
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		checksum += *(u64 *)tree->ops_->erase(tree, &values[order[i]]);
+	}
+	COMPARATIVE_printResult("B+ tree erase shuffled", kEntries, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		tree->ops_->insert(tree, &values[i], &values[i], sizeof(u64));
+	}
+	COMPARATIVE_printResult("B+ tree insert in order", kEntries, COMPARATIVE_now() - time_start);
+	printf("    height %d, %u nodes of %d bytes\n", tree->height_, tree->pool_->ops_->live(tree->pool_), kBPTreeNodeBytes);
+	BENCH_shuffle(kEntries);
+	BENCH_treeScans(tree, kEntries, "B+ tree scan 100, leaves filled");
+	tree->ops_->softReset(tree);
+	tree->ops_->destroy(tree);
+}
+
+static void BENCH_smallSet()
+{
+	char label[64];
+	printf("  %d entries, built %u times\n", kVectorEntries, kVectorRounds);
+	Vector *vector = VECTOR_create(kVectorEntries);
+	BPTree *tree = BPTREE_create(sizeof(u64), NULL);
+	BENCH_shuffle(kVectorEntries);
+
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kVectorRounds; ++r)
+	{
+		vector->ops_->softReset(vector);
+		for (u32 i = 0; i < kVectorEntries; ++i)
+		{
+			u64 *value = &values[order[i]];
+			vector->ops_->insertAt(vector, value, sizeof(u64), BENCH_vectorLowerBound(vector, value));
+		}
+	}
+	sprintf(label, "sorted Vector insert shuffled");
+	COMPARATIVE_printResult(label, (u64)kVectorRounds * kVectorEntries, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kVectorRounds; ++r)
+	{
+		tree->ops_->softReset(tree);
+		for (u32 i = 0; i < kVectorEntries; ++i)
+		{
+			tree->ops_->insert(tree, &values[order[i]], &values[order[i]], sizeof(u64));
+		}
+	}
+	COMPARATIVE_printResult("B+ tree insert shuffled", (u64)kVectorRounds * kVectorEntries, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 s = 0; s < kScans; ++s)
+	{
+		u64 *from = &values[order[s % kVectorEntries]];
+		u16 position = BENCH_vectorLowerBound(vector, from);
+		for (u32 n = 0; n < kScanLength && position < vector->tail_; ++n, ++position)
+		{
+			checksum += *(u64 *)vector->ops_->at(vector, position);
+		}
+	}
+	COMPARATIVE_printResult("sorted Vector scan 100 from a random key", (u64)kScans * kScanLength, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	BENCH_treeScans(tree, kVectorEntries, "B+ tree scan 100 from a random key");
+
+	// the sorted vector built above, loaded into an empty tree each round
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kVectorRounds; ++r)
+	{
+		tree->ops_->softReset(tree);
+		for (u32 i = 0; i < kVectorEntries; ++i)
+		{
+			vector->ops_->insertLast(vector, &values[i], sizeof(u64));
+		}
+		tree->ops_->bulkLoad(tree, vector);
+	}
+	COMPARATIVE_printResult("Vector insertLast + B+ tree bulkLoad", (u64)kVectorRounds * kVectorEntries, COMPARATIVE_now() - time_start);
+	printf("    height %d, %u leaves\n", tree->height_, (kVectorEntries + tree->leaf_max_ - 1) / tree->leaf_max_);
+
+	vector->ops_->softReset(vector);
+	vector->ops_->destroy(vector);
+	tree->ops_->softReset(tree);
+	tree->ops_->destroy(tree);
+}
+
+int main()
+{
+	srand(1);
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		values[i] = BENCH_bigEndian(i);
+	}
+
+	BENCH_bigTree();
+	BENCH_smallSet();
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
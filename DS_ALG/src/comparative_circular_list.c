@@ -0,0 +1,129 @@
+// comparative_circular_list.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Round-robin over the elements of a List and a DLList: moving the first
+// element behind the last one with extractFirst + insertLast (a node freed
+// and another one allocated per step), against rotate(1) of the circular
+// lists (relinking only) and the cursor of cycle (the list isn't modified).
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_list.h"
+#include "adt_dllist.h"
+#include "adt_cursor.h"
+
+#include "comparative_base.c"
+
+#define kElements 64
+const u32 kSteps = 2000000;
+
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+// One round-robin per ADT, through its ops_ table
+typedef s16 (*InsertFn)(void *container, void *data, u16 size);
+typedef void *(*ExtractFn)(void *container);
+typedef void *(*FirstFn)(void *container);
+typedef s16 (*RotateFn)(void *container, s16 n);
+typedef s16 (*CycleFn)(void *container, Cursor *cursor);
+
+typedef struct container_s
+{
+	const char *name_;
+	void *plain_;
+	void *circular_;
+	InsertFn insertLast;
+	ExtractFn extractFirst;
+	FirstFn first;
+	RotateFn rotate;
+	CycleFn cycle;
+} Container;
+
+static void BENCH_fill(Container *container, void *list)
+{
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		u32 *value = MM->malloc(sizeof(u32));
+		*value = i;
+		container->insertLast(list, value, sizeof(u32));
+	}
+}
+
+static void BENCH_roundRobin(Container *container)
+{
+	char label[64];
+	printf("  %s\n", container->name_);
+	BENCH_fill(container, container->plain_);
+	BENCH_fill(container, container->circular_);
+
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kSteps; ++i)
+	{
+		void *data = container->extractFirst(container->plain_);
+		checksum += *(u32 *)data;
+		container->insertLast(container->plain_, data, sizeof(u32));
+	}
+	sprintf(label, "%s extractFirst + insertLast", container->name_);
+	COMPARATIVE_printResult(label, kSteps, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kSteps; ++i)
+	{
+		checksum += *(u32 *)container->first(container->circular_);
+		container->rotate(container->circular_, 1);
+	}
+	sprintf(label, "%s circular rotate(1)", container->name_);
+	COMPARATIVE_printResult(label, kSteps, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	Cursor cursor;
+	container->cycle(container->circular_, &cursor);
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kSteps; ++i, CURSOR_next(&cursor))
+	{
+		checksum += *(u32 *)CURSOR_get(&cursor);
+	}
+	sprintf(label, "%s circular cycle cursor", container->name_);
+	COMPARATIVE_printResult(label, kSteps, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+int main()
+{
+	printf("%u round-robin steps over %u elements\n", kSteps, kElements);
+
+	List *list = LIST_create(kElements);
+	List *circular_list = LIST_createCircular(kElements);
+	Container list_container = {"List", list, circular_list, (InsertFn)list->ops_->insertLast,
+		(ExtractFn)list->ops_->extractFirst, (FirstFn)list->ops_->first, (RotateFn)circular_list->ops_->rotate,
+		(CycleFn)circular_list->ops_->cycle};
+	BENCH_roundRobin(&list_container);
+	list->ops_->destroy(list);
+	circular_list->ops_->destroy(circular_list);
+
+	DLList *dllist = DLList_create(kElements);
+	DLList *circular_dllist = DLList_createCircular(kElements);
+	Container dllist_container = {"DLList", dllist, circular_dllist, (InsertFn)dllist->ops_->insertLast,
+		(ExtractFn)dllist->ops_->extractFirst, (FirstFn)dllist->ops_->first, (RotateFn)circular_dllist->ops_->rotate,
+		(CycleFn)circular_dllist->ops_->cycle};
+	BENCH_roundRobin(&dllist_container);
+	dllist->ops_->destroy(dllist);
+	circular_dllist->ops_->destroy(circular_dllist);
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
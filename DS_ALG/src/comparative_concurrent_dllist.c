@@ -0,0 +1,156 @@
+// comparative_concurrent_dllist.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Mixed workload on a shared doubly linked list: every thread alternates
+// inserts and extracts at both ends and, once every kMiddlePeriod
+// operations, reads, inserts or extracts a few nodes away from the head.
+// Compares a DLList under one global mutex with the ConcurrentDLList (one
+// lock per node). Reports operations per second from 1 to 16 threads.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_dllist.h"
+#include "adt_concurrent_dllist.h"
+
+#include "comparative_base.c"
+
+#define kMaxThreads 16
+const u16 kListCapacity = 256;
+const u16 kPrefill = 64;
+const u32 kOpsPerThread = 100000;
+const u32 kMiddlePeriod = 16;
+const u16 kMiddleRange = 8;
+
+typedef struct bench_context_s {
+	DLList *list_;
+	boolean locked_;   // use mutex_ around every operation
+	mtx_t mutex_;
+} BenchContext;
+
+static BenchContext ctx;
+
+static u32 *BENCH_newValue(u32 value)
+{
+	u32 *data = MM->malloc(sizeof(u32));
+	*data = value;
+	return data;
+}
+
+static void BENCH_lock()
+{
+	if (True == ctx.locked_)
+		mtx_lock(&ctx.mutex_);
+}
+
+static void BENCH_unlock()
+{
+	if (True == ctx.locked_)
+		mtx_unlock(&ctx.mutex_);
+}
+
+static int BENCH_worker(void *arg)
+{
+	u32 seed = (u32)(uintptr_t)arg;
+	DLList *list = ctx.list_;
+	for (u32 i = 1; i <= kOpsPerThread; ++i)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		u32 choice = seed >> 16;
+		void *data = NULL;
+		u32 *value = NULL;
+		s16 error = kErrorCode_Ok;
+		BENCH_lock();
+		// inserts and extracts alternate, so the length stays near kPrefill
+		if (0 == i % kMiddlePeriod)
+		{
+			u16 index = (u16)(choice % kMiddleRange);
+			list->ops_->at(list, index);
+			if (0 == i % 2)
+			{
+				value = BENCH_newValue(i);
+				error = list->ops_->insertAt(list, value, sizeof(u32), index);
+			}
+			else
+			{
+				data = list->ops_->extractAt(list, index);
+			}
+		}
+		else
+		{
+			switch ((i % 2) * 2 + choice % 2)
+			{
+			case 0: value = BENCH_newValue(i); error = list->ops_->insertFirst(list, value, sizeof(u32)); break;
+			case 1: value = BENCH_newValue(i); error = list->ops_->insertLast(list, value, sizeof(u32)); break;
+			case 2: data = list->ops_->extractFirst(list); break;
+			default: data = list->ops_->extractLast(list); break;
+			}
+		}
+		BENCH_unlock();
+		if (kErrorCode_Ok != error)
+			MM->free(value);
+		if (NULL != data)
+			MM->free(data);
+	}
+	return 0;
+}
+
+void calculateTime(const char *name, DLList *list, boolean locked, u16 threads)
+{
+	ctx.list_ = list;
+	ctx.locked_ = locked;
+	for (u16 i = 0; i < kPrefill; ++i)
+	{
+		list->ops_->insertLast(list, BENCH_newValue(i), sizeof(u32));
+	}
+	thrd_t workers[kMaxThreads];
+	double time_start = COMPARATIVE_now();
+	for (u16 t = 0; t < threads; ++t)
+	{
+		thrd_create(&workers[t], BENCH_worker, (void *)(uintptr_t)(12345 + t));
+	}
+	for (u16 t = 0; t < threads; ++t)
+	{
+		thrd_join(workers[t], NULL);
+	}
+	double elapsed = COMPARATIVE_now() - time_start;
+	char label[64];
+	snprintf(label, sizeof(label), "%s %d threads", name, threads);
+	COMPARATIVE_printResult(label, (u64)threads * kOpsPerThread, elapsed);
+	printf("    %d elements left\n", list->ops_->length(list));
+	list->ops_->reset(list);
+}
+
+int main()
+{
+	mtx_init(&ctx.mutex_, mtx_plain);
+	DLList *locked = DLList_create(kListCapacity);
+	DLList *concurrent = ConcurrentDLList_create(kListCapacity);
+	if (NULL == locked || NULL == concurrent)
+	{
+		printf("ERROR: cannot create the lists\n");
+		return -1;
+	}
+
+	const u16 thread_counts[] = { 1, 2, 4, 8, 16 };
+	printf("%d operations per thread, 1 of every %d at the first %d nodes\n",
+		kOpsPerThread, kMiddlePeriod, kMiddleRange);
+	for (u16 i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i)
+	{
+		calculateTime("DLList + global mutex", locked, True, thread_counts[i]);
+		calculateTime("ConcurrentDLList", concurrent, False, thread_counts[i]);
+	}
+
+	locked->ops_->destroy(locked);
+	concurrent->ops_->destroy(concurrent);
+	mtx_destroy(&ctx.mutex_);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
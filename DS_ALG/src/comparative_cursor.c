@@ -0,0 +1,177 @@
+// comparative_cursor.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Per element cost of walking Vector, List and DLList with traverse (callback
+// + global accumulator), traverseEx (callback + context) and a cursor loop
+// (inline CURSOR_next/get), and the early exit of traverseEx when looking
+// for an element near the head. The payloads live in a static array.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_dllist.h"
+#include "adt_cursor.h"
+
+#include "comparative_base.c"
+
+// three lists of MemoryNodes alive at once, MM has a few hundred blocks per class
+#define kElements 128
+const u32 kRounds = 20000;
+// traverse can't stop, the searched element is near the head
+const u16 kSearched = kElements / 8;
+
+static u32 values[kElements];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_sum(MemoryNode *node)
+{
+	checksum += *(u32 *)node->data_;
+}
+
+static boolean BENCH_sumEx(MemoryNode *node, void *context)
+{
+	*(u64 *)context += *(u32 *)node->data_;
+	return True;
+}
+
+// traverse has no context nor exit, the result is kept in a global
+static void *searched = NULL;
+static u16 found = 0;
+static void BENCH_find(MemoryNode *node)
+{
+	if (node->data_ == searched)
+	{
+		found++;
+	}
+}
+
+static boolean BENCH_findEx(MemoryNode *node, void *context)
+{
+	if (node->data_ == context)
+	{
+		found++;
+		return False;
+	}
+	return True;
+}
+
+// One walk per ADT, through its ops_ table
+typedef s16 (*TraverseFn)(void *container, void (*callback)(MemoryNode *));
+typedef s16 (*TraverseExFn)(void *container, boolean (*callback)(MemoryNode *, void *), void *context);
+typedef s16 (*BeginFn)(void *container, Cursor *cursor);
+
+typedef struct container_s
+{
+	const char *name_;
+	void *container_;
+	TraverseFn traverse;
+	TraverseExFn traverseEx;
+	BeginFn begin;
+} Container;
+
+static void BENCH_walks(Container *container)
+{
+	u64 ops = (u64)kRounds * kElements;
+	char label[64];
+	printf("  %s\n", container->name_);
+
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		container->traverse(container->container_, BENCH_sum);
+	}
+	COMPARATIVE_printResult("traverse sum", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		container->traverseEx(container->container_, BENCH_sumEx, &checksum);
+	}
+	COMPARATIVE_printResult("traverseEx sum", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		Cursor cursor;
+		for (container->begin(container->container_, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+		{
+			checksum += *(u32 *)CURSOR_get(&cursor);
+		}
+	}
+	COMPARATIVE_printResult("cursor sum", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	searched = &values[kSearched];
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		container->traverse(container->container_, BENCH_find);
+	}
+	snprintf(label, sizeof(label), "traverse find element %d (per walk)", kSearched);
+	COMPARATIVE_printResult(label, kRounds, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		container->traverseEx(container->container_, BENCH_findEx, &values[kSearched]);
+	}
+	snprintf(label, sizeof(label), "traverseEx find element %d (per walk)", kSearched);
+	COMPARATIVE_printResult(label, kRounds, COMPARATIVE_now() - time_start);
+	printf("    found %d\n", found);
+	found = 0;
+}
+
+int main()
+{
+	Vector *vector = VECTOR_create(kElements);
+	List *list = LIST_create(kElements);
+	DLList *dllist = DLList_create(kElements);
+	if (NULL == vector || NULL == list || NULL == dllist)
+	{
+		printf("ERROR: cannot create the containers\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+		vector->ops_->insertLast(vector, &values[i], sizeof(u32));
+		list->ops_->insertLast(list, &values[i], sizeof(u32));
+		dllist->ops_->insertLast(dllist, &values[i], sizeof(u32));
+	}
+	printf("%d rounds over %d elements\n", kRounds, kElements);
+
+	Container containers[] = {
+		{ "Vector", vector, (TraverseFn)vector->ops_->traverse, (TraverseExFn)vector->ops_->traverseEx, (BeginFn)vector->ops_->begin },
+		{ "List", list, (TraverseFn)list->ops_->traverse, (TraverseExFn)list->ops_->traverseEx, (BeginFn)list->ops_->begin },
+		{ "DLList", dllist, (TraverseFn)dllist->ops_->traverse, (TraverseExFn)dllist->ops_->traverseEx, (BeginFn)dllist->ops_->begin },
+	};
+	for (u16 i = 0; i < sizeof(containers) / sizeof(containers[0]); ++i)
+	{
+		BENCH_walks(&containers[i]);
+	}
+
+	while (NULL != vector->ops_->extractLast(vector));
+	while (NULL != list->ops_->extractFirst(list));
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	vector->ops_->destroy(vector);
+	list->ops_->destroy(list);
+	dllist->ops_->destroy(dllist);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,126 @@
+// comparative_deque.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Deque against DLList: filling and emptying them through both ends (as a
+// queue each way and as a stack) and reading every element by position.
+// The DLList allocates and frees a node per element, the deque takes a
+// block every kDequeBlockNodes elements and reuses its spare one. at is a
+// walk from the nearest end in the DLList, a shift and a mask in the deque.
+// The payloads live in a static array.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_dllist.h"
+#include "adt_deque.h"
+
+#include "comparative_base.c"
+
+#define kElements kComparativeListElements
+const u32 kRounds = 4000;
+const u32 kAtRounds = 200;
+
+static u32 values[kElements];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+// Both ADTs through their ops_ tables
+typedef s16 (*InsertFn)(void *container, void *data, u16 bytes);
+typedef void *(*ExtractFn)(void *container);
+typedef void *(*AtFn)(void *container, u16 position);
+
+typedef struct container_s
+{
+	const char *name_;
+	void *container_;
+	InsertFn insertFirst;
+	InsertFn insertLast;
+	ExtractFn extractFirst;
+	ExtractFn extractLast;
+	AtFn at;
+} Container;
+
+static void BENCH_ends(Container *container, const char *name, InsertFn insert, ExtractFn extract)
+{
+	char label[64];
+	u64 ops = (u64)kRounds * kElements * 2;
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u32 i = 0; i < kElements; ++i)
+		{
+			insert(container->container_, &values[i], sizeof(u32));
+		}
+		for (u32 i = 0; i < kElements; ++i)
+		{
+			checksum += *(u32 *)extract(container->container_);
+		}
+	}
+	sprintf(label, "%s %s", container->name_, name);
+	COMPARATIVE_printResult(label, ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+static void BENCH_container(Container *container)
+{
+	char label[64];
+	printf("  %s\n", container->name_);
+	BENCH_ends(container, "insertLast + extractFirst", container->insertLast, container->extractFirst);
+	BENCH_ends(container, "insertFirst + extractLast", container->insertFirst, container->extractLast);
+	BENCH_ends(container, "insertLast + extractLast", container->insertLast, container->extractLast);
+
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		container->insertLast(container->container_, &values[i], sizeof(u32));
+	}
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kAtRounds; ++r)
+	{
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			checksum += *(u32 *)container->at(container->container_, i);
+		}
+	}
+	sprintf(label, "%s at", container->name_);
+	COMPARATIVE_printResult(label, (u64)kAtRounds * kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	while (NULL != container->extractFirst(container->container_));
+}
+
+int main()
+{
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+	}
+	printf("%u elements, filled and emptied %u times\n", kElements, kRounds);
+
+	DLList *dllist = DLList_create(kElements);
+	Container dllist_container = {"DLList", dllist, (InsertFn)dllist->ops_->insertFirst,
+		(InsertFn)dllist->ops_->insertLast, (ExtractFn)dllist->ops_->extractFirst,
+		(ExtractFn)dllist->ops_->extractLast, (AtFn)dllist->ops_->at};
+	BENCH_container(&dllist_container);
+	dllist->ops_->destroy(dllist);
+
+	Deque *deque = DEQUE_create(kElements);
+	Container deque_container = {"Deque", deque, (InsertFn)deque->ops_->insertFirst,
+		(InsertFn)deque->ops_->insertLast, (ExtractFn)deque->ops_->extractFirst,
+		(ExtractFn)deque->ops_->extractLast, (AtFn)deque->ops_->at};
+	BENCH_container(&deque_container);
+	deque->ops_->destroy(deque);
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
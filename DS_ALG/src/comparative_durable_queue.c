@@ -0,0 +1,134 @@
+// comparative_durable_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Throughput of the durable queue by group commit batch: logged operations
+// per fsync from 1 (every enqueue durable on return) to 512, against the
+// queue in memory doing the same copies. The queue is drained every time it
+// fills, so the dequeues, their acks and the deletion of the consumed
+// segments are timed too. The operation count is the first argument.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_queue.h"
+
+#include "comparative_base.c"
+
+const char *kLogFile = "comparative_durable_queue";
+const u32 kDefaultOperations = 20000;
+const u16 kCapacity = 200;
+const u16 kPayloadSize = 64;
+const u32 kSegmentBytes = 256 * 1024;
+const u16 kBatches[] = {1, 8, 64, 512};
+
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_removeLog()
+{
+	char name[64];
+	for (u32 i = 0; i < 1000; ++i)
+	{
+		sprintf(name, "%s.%08u.log", kLogFile, i);
+		remove(name);
+	}
+	sprintf(name, "%s.meta", kLogFile);
+	remove(name);
+}
+
+static void BENCH_drain(Queue *queue)
+{
+	void *data;
+	while (NULL != (data = queue->ops_->dequeue(queue)))
+	{
+		checksum += *(u32 *)data;
+		MM->free(data);
+	}
+}
+
+// The queue in memory copies the payloads too, like the durable one
+static void BENCH_memory(u32 operations)
+{
+	u8 payload[kPayloadSize];
+	memset(payload, 0, sizeof(payload));
+	Queue *queue = QUEUE_create(kCapacity);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < operations; ++i)
+	{
+		memcpy(payload, &i, sizeof(i));
+		void *copy = MM->malloc(kPayloadSize);
+		memcpy(copy, payload, kPayloadSize);
+		queue->ops_->enqueue(queue, copy, kPayloadSize);
+		if (True == queue->ops_->isFull(queue))
+		{
+			BENCH_drain(queue);
+		}
+	}
+	BENCH_drain(queue);
+	COMPARATIVE_printResult("memory: MM alloc + memcpy + enqueue", operations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	queue->ops_->destroy(queue);
+}
+
+static void BENCH_durable(u32 operations, u16 batch)
+{
+	char name[64];
+	u8 payload[kPayloadSize];
+	memset(payload, 0, sizeof(payload));
+	BENCH_removeLog();
+	Queue *queue = QUEUE_openDurable(kLogFile, kCapacity, batch, kSegmentBytes);
+	if (NULL == queue)
+	{
+		printf("ERROR: cannot open the log %s\n", kLogFile);
+		return;
+	}
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < operations; ++i)
+	{
+		memcpy(payload, &i, sizeof(i));
+		queue->ops_->enqueue(queue, payload, kPayloadSize);
+		if (True == queue->ops_->isFull(queue))
+		{
+			BENCH_drain(queue);
+		}
+	}
+	BENCH_drain(queue);
+	queue->ops_->sync(queue);
+	sprintf(name, "durable: enqueue, fsync every %d", batch);
+	COMPARATIVE_printResult(name, operations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	queue->ops_->destroy(queue);
+	BENCH_removeLog();
+}
+
+int main(int argc, char** argv)
+{
+	u32 operations = argc > 1 ? (u32)atoi(argv[1]) : kDefaultOperations;
+	if (0 == operations)
+	{
+		operations = kDefaultOperations;
+	}
+	printf("%u enqueues of %d bytes, drained every %d, segments of %u bytes\n", operations, kPayloadSize,
+		kCapacity, kSegmentBytes);
+
+	BENCH_memory(operations);
+	for (u16 i = 0; i < sizeof(kBatches) / sizeof(kBatches[0]); ++i)
+	{
+		BENCH_durable(operations, kBatches[i]);
+	}
+
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
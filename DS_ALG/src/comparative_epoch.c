@@ -0,0 +1,164 @@
+// comparative_epoch.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Stress of epoch-based reclamation: threads push and pop MM nodes on a
+// lock-free stack and retire every popped node instead of freeing it. Reports
+// throughput from 1 to 16 threads and the peak of live nodes (in the stack or
+// waiting to be freed), which must stay bounded however long the run is.
+// The reference is the same stack under a mutex freeing nodes right away.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_epoch.h"
+
+#include "comparative_base.c"
+
+#define kMaxThreads 16
+const u32 kOpsPerThread = 100000;
+const u16 kBurst = 4;
+const u16 kBatchSize = 8;
+
+typedef struct bench_node_s {
+	struct bench_node_s *next_;
+	u32 value_;
+} BenchNode;
+
+typedef struct bench_context_s {
+	EpochDomain *domain_;
+	_Atomic(BenchNode *) top_;
+	BenchNode *locked_top_;
+	mtx_t mutex_;
+	_Atomic u32 live_;
+	_Atomic u32 peak_live_;
+} BenchContext;
+
+static BenchContext ctx;
+
+static BenchNode *BENCH_allocNode(u32 value)
+{
+	BenchNode *node = MM->malloc(sizeof(BenchNode));
+	node->value_ = value;
+	u32 live = atomic_fetch_add_explicit(&ctx.live_, 1, memory_order_relaxed) + 1;
+	u32 peak = atomic_load_explicit(&ctx.peak_live_, memory_order_relaxed);
+	while (live > peak && !atomic_compare_exchange_weak(&ctx.peak_live_, &peak, live));
+	return node;
+}
+
+static void BENCH_freeNode(void *node)
+{
+	atomic_fetch_sub_explicit(&ctx.live_, 1, memory_order_relaxed);
+	MM->free(node);
+}
+
+static int BENCH_epochWorker(void *arg)
+{
+	(void)arg;
+	EpochRecord *record = ctx.domain_->ops_->registerThread(ctx.domain_);
+	for (u32 i = 0; i < kOpsPerThread; i += 2 * kBurst)
+	{
+		for (u16 b = 0; b < kBurst; ++b)
+		{
+			BenchNode *node = BENCH_allocNode(i + b);
+			node->next_ = atomic_load(&ctx.top_);
+			while (!atomic_compare_exchange_weak(&ctx.top_, &node->next_, node));
+		}
+		for (u16 b = 0; b < kBurst; ++b)
+		{
+			ctx.domain_->ops_->pin(record);
+			BenchNode *node = atomic_load(&ctx.top_);
+			// node->next_ is safe to read: nobody frees it while we are pinned
+			while (NULL != node && !atomic_compare_exchange_weak(&ctx.top_, &node, node->next_));
+			if (NULL != node)
+			{
+				ctx.domain_->ops_->retire(record, node, BENCH_freeNode);
+			}
+			ctx.domain_->ops_->unpin(record);
+		}
+	}
+	ctx.domain_->ops_->unregisterThread(record);
+	return 0;
+}
+
+static int BENCH_mutexWorker(void *arg)
+{
+	(void)arg;
+	for (u32 i = 0; i < kOpsPerThread; i += 2 * kBurst)
+	{
+		for (u16 b = 0; b < kBurst; ++b)
+		{
+			BenchNode *node = BENCH_allocNode(i + b);
+			mtx_lock(&ctx.mutex_);
+			node->next_ = ctx.locked_top_;
+			ctx.locked_top_ = node;
+			mtx_unlock(&ctx.mutex_);
+		}
+		for (u16 b = 0; b < kBurst; ++b)
+		{
+			mtx_lock(&ctx.mutex_);
+			BenchNode *node = ctx.locked_top_;
+			if (NULL != node)
+			{
+				ctx.locked_top_ = node->next_;
+			}
+			mtx_unlock(&ctx.mutex_);
+			if (NULL != node)
+			{
+				BENCH_freeNode(node);
+			}
+		}
+	}
+	return 0;
+}
+
+void calculateTime(const char *name, thrd_start_t worker, u16 threads)
+{
+	atomic_store(&ctx.live_, 0);
+	atomic_store(&ctx.peak_live_, 0);
+	thrd_t workers[kMaxThreads];
+	double time_start = COMPARATIVE_now();
+	for (u16 t = 0; t < threads; ++t)
+	{
+		thrd_create(&workers[t], worker, NULL);
+	}
+	for (u16 t = 0; t < threads; ++t)
+	{
+		thrd_join(workers[t], NULL);
+	}
+	double elapsed = COMPARATIVE_now() - time_start;
+	char label[64];
+	snprintf(label, sizeof(label), "%s %d threads", name, threads);
+	COMPARATIVE_printResult(label, (u64)threads * kOpsPerThread, elapsed);
+	printf("    peak live nodes %u (bound %u), %u left after the run\n", atomic_load(&ctx.peak_live_),
+		(u32)threads * (kBurst + kBatchSize * kEpochMaxPendingBatches), atomic_load(&ctx.live_));
+}
+
+int main()
+{
+	mtx_init(&ctx.mutex_, mtx_plain);
+	ctx.locked_top_ = NULL;
+	atomic_init(&ctx.top_, NULL);
+	atomic_init(&ctx.live_, 0);
+	atomic_init(&ctx.peak_live_, 0);
+
+	const u16 thread_counts[] = { 1, 2, 4, 8, 16 };
+	printf("%d push/pop operations per thread in bursts of %d (ops = push + pop)\n", kOpsPerThread, kBurst);
+	for (u16 i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i)
+	{
+		ctx.domain_ = EPOCH_create(kBatchSize);
+		calculateTime("Lock-free stack + epochs", BENCH_epochWorker, thread_counts[i]);
+		printf("    epoch reached %u\n", ctx.domain_->ops_->epoch(ctx.domain_));
+		ctx.domain_->ops_->destroy(ctx.domain_);
+		calculateTime("Mutex stack + MM->free", BENCH_mutexWorker, thread_counts[i]);
+	}
+	mtx_destroy(&ctx.mutex_);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,142 @@
+// comparative_facade.cpp
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// The C++ facade against the standard containers: fill + destroy,
+// std::accumulate and std::sort over ds::vector and std::vector (also with
+// ds::mm_allocator), fill + accumulate over ds::list, ds::dllist and
+// std::list, and the cost of a copy against a move.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <vector>
+
+#include "adt_facade.hpp"
+
+#include "comparative_base.c"
+
+// every ds element is a live MM payload block, and MM only has a few
+// hundred blocks per size class
+const u16 kElements = 128;
+const u32 kRounds = 2000;
+
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+// Fills a new container, sums it, sorts it backwards and destroys it
+template <typename Container>
+static void BENCH_vector(const char *fill_name, const char *sum_name, const char *sort_name)
+{
+	u64 ops = (u64)kRounds * kElements;
+	double fill = 0.0, sum = 0.0, sort = 0.0, time_start;
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		time_start = COMPARATIVE_now();
+		{
+			Container vector;
+			for (u16 i = 0; i < kElements; ++i)
+			{
+				vector.push_back(i);
+			}
+			fill += COMPARATIVE_now() - time_start;
+			time_start = COMPARATIVE_now();
+			checksum += std::accumulate(vector.begin(), vector.end(), (u64)0);
+			sum += COMPARATIVE_now() - time_start;
+			time_start = COMPARATIVE_now();
+			std::sort(vector.begin(), vector.end(), [](u32 a, u32 b) { return a > b; });
+			sort += COMPARATIVE_now() - time_start;
+			checksum += vector.front();
+			time_start = COMPARATIVE_now();
+		}
+		fill += COMPARATIVE_now() - time_start;
+	}
+	COMPARATIVE_printResult(fill_name, ops, fill);
+	COMPARATIVE_printResult(sum_name, ops, sum);
+	COMPARATIVE_printResult(sort_name, ops, sort);
+	BENCH_printChecksum();
+}
+
+template <typename Container>
+static void BENCH_list(const char *fill_name, const char *sum_name)
+{
+	u64 ops = (u64)kRounds * kElements;
+	double fill = 0.0, sum = 0.0, time_start;
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		time_start = COMPARATIVE_now();
+		{
+			Container list;
+			for (u16 i = 0; i < kElements; ++i)
+			{
+				list.push_back(i);
+			}
+			fill += COMPARATIVE_now() - time_start;
+			time_start = COMPARATIVE_now();
+			checksum += std::accumulate(list.begin(), list.end(), (u64)0);
+			sum += COMPARATIVE_now() - time_start;
+			time_start = COMPARATIVE_now();
+		}
+		fill += COMPARATIVE_now() - time_start;
+	}
+	COMPARATIVE_printResult(fill_name, ops, fill);
+	COMPARATIVE_printResult(sum_name, ops, sum);
+	BENCH_printChecksum();
+}
+
+// Copies are deep, moves only steal the C vector
+static void BENCH_copyMove()
+{
+	ds::vector<u32> source;
+	for (u16 i = 0; i < kElements; ++i)
+	{
+		source.push_back(i);
+	}
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		ds::vector<u32> copy(source);
+		checksum += copy.back();
+	}
+	COMPARATIVE_printResult("ds::vector copy (per container)", kRounds, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		ds::vector<u32> moved(std::move(source));
+		checksum += moved.back();
+		source = std::move(moved);
+	}
+	COMPARATIVE_printResult("ds::vector move + move back (per pair)", kRounds, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+int main()
+{
+	printf("%d rounds of %d u32 elements\n", kRounds, kElements);
+	BENCH_vector<ds::vector<u32>>("ds::vector push_back + destroy", "ds::vector std::accumulate",
+		"ds::vector std::sort");
+	BENCH_vector<std::vector<u32>>("std::vector push_back + destroy", "std::vector std::accumulate",
+		"std::vector std::sort");
+	BENCH_vector<std::vector<u32, ds::mm_allocator<u32>>>("std::vector<mm_allocator> push_back + destroy",
+		"std::vector<mm_allocator> std::accumulate", "std::vector<mm_allocator> std::sort");
+
+	BENCH_list<ds::list<u32>>("ds::list push_back + destroy", "ds::list std::accumulate");
+	BENCH_list<ds::dllist<u32>>("ds::dllist push_back + destroy", "ds::dllist std::accumulate");
+	BENCH_list<std::list<u32>>("std::list push_back + destroy", "std::list std::accumulate");
+
+	BENCH_copyMove();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
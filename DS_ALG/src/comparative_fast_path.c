@@ -0,0 +1,178 @@
+// comparative_fast_path.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Tight loops over the ops_ API and over the inline fast path: reading a
+// Vector with length + at, querying the ends of a List, DLList, Stack and
+// Queue, and appending to Vector, Stack and List. The payloads live in a
+// static array, only the containers touch MM.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_fast_path.h"
+
+#include "comparative_base.c"
+
+// three lists of MemoryNodes alive at once, MM has a few hundred blocks per class
+#define kElements 128
+const u32 kRounds = 8000;
+
+static u32 values[kElements];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_vectorReads(Vector *vector)
+{
+	u64 ops = (u64)kRounds * kElements;
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u16 i = 0; i < vector->ops_->length(vector); ++i)
+		{
+			checksum += *(u32 *)vector->ops_->at(vector, i);
+		}
+	}
+	COMPARATIVE_printResult("Vector ops_ length + at", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u16 i = 0; i < VECTOR_fastLength(vector); ++i)
+		{
+			checksum += *(u32 *)VECTOR_fastAt(vector, i);
+		}
+	}
+	COMPARATIVE_printResult("Vector fast length + at", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+static void BENCH_endReads(List *list, DLList *dllist, Stack *stack, Queue *queue)
+{
+	u64 ops = (u64)kRounds * kElements;
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			checksum += *(u32 *)list->ops_->first(list) + *(u32 *)list->ops_->last(list) +
+				*(u32 *)dllist->ops_->last(dllist) + *(u32 *)queue->ops_->front(queue) +
+				stack->ops_->length(stack) + list->ops_->length(list);
+		}
+	}
+	COMPARATIVE_printResult("ops_ first/last/front/length x6", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			checksum += *(u32 *)LIST_fastFirst(list) + *(u32 *)LIST_fastLast(list) +
+				*(u32 *)DLList_fastLast(dllist) + *(u32 *)QUEUE_fastFront(queue) +
+				STACK_fastLength(stack) + LIST_fastLength(list);
+		}
+	}
+	COMPARATIVE_printResult("fast first/last/front/length x6", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+static void BENCH_appends(Vector *vector, Stack *stack, List *list, boolean fast)
+{
+	double vector_time = 0.0, stack_time = 0.0, list_time = 0.0, time_start;
+	for (u32 r = 0; r < kRounds / 16; ++r)
+	{
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			if (True == fast)
+				VECTOR_fastInsertLast(vector, &values[i], sizeof(u32));
+			else
+				vector->ops_->insertLast(vector, &values[i], sizeof(u32));
+		}
+		vector_time += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			if (True == fast)
+				STACK_fastPush(stack, &values[i], sizeof(u32));
+			else
+				stack->ops_->push(stack, &values[i], sizeof(u32));
+		}
+		stack_time += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			if (True == fast)
+				LIST_fastInsertLast(list, &values[i], sizeof(u32));
+			else
+				list->ops_->insertLast(list, &values[i], sizeof(u32));
+		}
+		list_time += COMPARATIVE_now() - time_start;
+		// not timed: empty the containers, the payloads are not theirs
+		while (NULL != vector->ops_->extractLast(vector));
+		while (NULL != stack->ops_->pop(stack));
+		while (NULL != list->ops_->extractFirst(list));
+	}
+	u64 ops = (u64)(kRounds / 16) * kElements;
+	COMPARATIVE_printResult(True == fast ? "Vector fast insertLast" : "Vector ops_ insertLast", ops, vector_time);
+	COMPARATIVE_printResult(True == fast ? "Stack fast push" : "Stack ops_ push", ops, stack_time);
+	COMPARATIVE_printResult(True == fast ? "List fast insertLast" : "List ops_ insertLast", ops, list_time);
+}
+
+int main()
+{
+	Vector *vector = VECTOR_create(kElements);
+	List *list = LIST_create(kElements);
+	DLList *dllist = DLList_create(kElements);
+	Stack *stack = STACK_create(kElements);
+	Queue *queue = QUEUE_create(kElements);
+	if (NULL == vector || NULL == list || NULL == dllist || NULL == stack || NULL == queue)
+	{
+		printf("ERROR: cannot create the containers\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+	}
+	printf("%d rounds over %d elements\n", kRounds, kElements);
+
+	BENCH_appends(vector, stack, list, False);
+	BENCH_appends(vector, stack, list, True);
+
+	for (u16 i = 0; i < kElements; ++i)
+	{
+		vector->ops_->insertLast(vector, &values[i], sizeof(u32));
+		list->ops_->insertLast(list, &values[i], sizeof(u32));
+		dllist->ops_->insertLast(dllist, &values[i], sizeof(u32));
+		stack->ops_->push(stack, &values[i], sizeof(u32));
+		queue->ops_->enqueue(queue, &values[i], sizeof(u32));
+	}
+	BENCH_vectorReads(vector);
+	BENCH_endReads(list, dllist, stack, queue);
+
+	while (NULL != vector->ops_->extractLast(vector));
+	while (NULL != list->ops_->extractFirst(list));
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	while (NULL != stack->ops_->pop(stack));
+	while (NULL != queue->ops_->dequeue(queue));
+	vector->ops_->destroy(vector);
+	list->ops_->destroy(list);
+	dllist->ops_->destroy(dllist);
+	stack->ops_->destroy(stack);
+	queue->ops_->destroy(queue);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,132 @@
+// comparative_logger.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Cost per log call: fprintf to a file, formatting on the calling thread,
+// against the asynchronous logger, which only copies the arguments to the
+// ring of the thread, with one and four threads, and a LOG_DEBUG removed at
+// compile time. The threads log in bursts that fit in their rings. The time
+// until every record is written (flush and pauses between bursts included)
+// and the records dropped by full rings are shown next to the results.
+
+#define LOG_LEVEL kLogLevel_Info
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "logger.h"
+
+#include "comparative_base.c"
+
+const char *kLogFile = "comparative_logger.log";
+const u32 kRecords = 200000;
+const u32 kMaxThreads = 4;
+const u32 kBurst = kLogRingRecords / 2;
+
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+typedef struct
+{
+	u32 records;
+	double elapsed;
+} BenchWorker;
+
+// Logs in bursts of half a ring and waits for the flusher between them, so
+// the calls are timed without the drops of a ring always full
+static int BENCH_worker(void *arg)
+{
+	BenchWorker *worker = arg;
+	worker->elapsed = 0.0;
+	for (u32 i = 0; i < worker->records;)
+	{
+		double time_start = COMPARATIVE_now();
+		for (u32 burst = 0; burst < kBurst && i < worker->records; ++burst, ++i)
+		{
+			LOG_INFO("[%s] record %u of %u, value %f", __FUNCTION__, i, worker->records, i * 0.5);
+		}
+		worker->elapsed += COMPARATIVE_now() - time_start;
+		thrd_sleep(&(struct timespec){.tv_nsec = 10000000}, NULL);
+	}
+	return 0;
+}
+
+static void BENCH_fprintf()
+{
+	FILE *file = fopen(kLogFile, "wb");
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kRecords; ++i)
+	{
+		checksum += fprintf(file, "[INFO] [%s] record %u of %u, value %f\n", __FUNCTION__, i, kRecords, i * 0.5);
+	}
+	COMPARATIVE_printResult("fprintf", kRecords, COMPARATIVE_now() - time_start);
+	fclose(file);
+	BENCH_printChecksum();
+}
+
+static void BENCH_logger(u32 threads)
+{
+	char name[64];
+	thrd_t workers[4];
+	BenchWorker args[4];
+	FILE *file = fopen(kLogFile, "wb");
+	LOGGER_start(file);
+	double time_start = COMPARATIVE_now();
+	for (u32 t = 0; t < threads; ++t)
+	{
+		args[t].records = kRecords / threads;
+		thrd_create(&workers[t], BENCH_worker, &args[t]);
+	}
+	double elapsed = 0.0;
+	for (u32 t = 0; t < threads; ++t)
+	{
+		thrd_join(workers[t], NULL);
+		elapsed += args[t].elapsed;
+	}
+	LOGGER_flush();
+	double written = COMPARATIVE_now() - time_start;
+	sprintf(name, "LOG_INFO, %u threads", threads);
+	// time of the calls added up over the threads
+	COMPARATIVE_printResult(name, kRecords, elapsed);
+	printf("    %.2f ms until written, %u records dropped\n", written / 1000.0, LOGGER_dropped());
+	LOGGER_stop();
+	fclose(file);
+}
+
+static void BENCH_removed()
+{
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kRecords; ++i)
+	{
+		LOG_DEBUG("[%s] record %u of %u, value %f", __FUNCTION__, i, kRecords, i * 0.5);
+		checksum += i;
+	}
+	COMPARATIVE_printResult("LOG_DEBUG below LOG_LEVEL", kRecords, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+int main()
+{
+	printf("%u log calls of 4 arguments\n", kRecords);
+
+	BENCH_fprintf();
+	BENCH_logger(1);
+	BENCH_logger(kMaxThreads);
+	BENCH_removed();
+	remove(kLogFile);
+
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,181 @@
+// comparative_lru_cache.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// LRU cache against a DLList kept in order of use: hits, which move the
+// entry to the front, misses, and puts of new keys that evict the least
+// recently used. The DLList finds a key walking from the front and its
+// nodes come from the MM, so it is compared with the cache at
+// kComparativeListElements entries; the cache then takes 100k entries
+// alone. The payloads are u32 in a static array, which are also the keys.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_dllist.h"
+#include "adt_lru_cache.h"
+
+#include "comparative_base.c"
+
+#define kListEntries kComparativeListElements
+#define kEntries (100 * 1000)
+#define kOperations (1000 * 1000)
+
+static u32 values[2 * kEntries + kOperations];
+static u32 order[kEntries];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_shuffle(u32 count)
+{
+	for (u32 i = 0; i < count; ++i)
+	{
+		order[i] = i;
+	}
+	for (u32 i = count - 1; i > 0; --i)
+	{
+		u32 j = (u32)(((u64)rand() << 16 ^ (u64)rand()) % (i + 1));
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+}
+
+// The payloads are static, so the evicted ones are only counted
+static void BENCH_evict(const void *key, MemoryNode *node, void *context)
+{
+	(void)key;
+	(void)node;
+	(void)context;
+	checksum += 1;
+}
+
+// Hits on every key, misses on as many absent ones, and puts of new keys
+static void BENCH_cache(u32 entries)
+{
+	LRUCache *cache = LRUCACHE_create(sizeof(u32), (u64)entries * sizeof(u32), BENCH_evict, NULL);
+	for (u32 i = 0; i < entries; ++i)
+	{
+		cache->ops_->put(cache, &values[i], &values[i], sizeof(u32));
+	}
+
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kOperations; ++i)
+	{
+		checksum += *(u32 *)cache->ops_->get(cache, &values[order[i % entries]]);
+	}
+	COMPARATIVE_printResult("LRU cache get hit", kOperations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kOperations; ++i)
+	{
+		checksum += NULL == cache->ops_->get(cache, &values[entries + order[i % entries]]) ? 1 : 0;
+	}
+	COMPARATIVE_printResult("LRU cache get miss", kOperations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kOperations; ++i)
+	{
+		cache->ops_->put(cache, &values[entries + i], &values[entries + i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("LRU cache put evicting", kOperations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	printf("    %u entries, %u buckets\n", cache->ops_->length(cache), cache->bucket_mask_ + 1);
+
+	cache->ops_->softReset(cache);
+	cache->ops_->destroy(cache);
+}
+
+// Position of a key in the DLList, or its length if it is not there
+static u16 BENCH_listFind(DLList *list, u32 key)
+{
+	Cursor cursor;
+	u16 position = 0;
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor) && *(u32 *)CURSOR_get(&cursor) != key;
+		CURSOR_next(&cursor))
+	{
+		++position;
+	}
+	return position;
+}
+
+static void BENCH_list()
+{
+	printf("  %d entries\n", kListEntries);
+	BENCH_shuffle(kListEntries);
+	DLList *dllist = DLList_create(kListEntries);
+	for (u32 i = 0; i < kListEntries; ++i)
+	{
+		dllist->ops_->insertFirst(dllist, &values[i], sizeof(u32));
+	}
+
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kOperations; ++i)
+	{
+		u16 position = BENCH_listFind(dllist, values[order[i % kListEntries]]);
+		u32 *value = dllist->ops_->extractAt(dllist, position);
+		dllist->ops_->insertFirst(dllist, value, sizeof(u32));
+		checksum += *value;
+	}
+	COMPARATIVE_printResult("DLList get hit", kOperations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kOperations; ++i)
+	{
+		checksum += kListEntries == BENCH_listFind(dllist, values[kListEntries + order[i % kListEntries]]) ? 1 : 0;
+	}
+	COMPARATIVE_printResult("DLList get miss", kOperations, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kOperations; ++i)
+	{
+		// a put looks for the key before evicting
+		BENCH_listFind(dllist, values[kListEntries + i]);
+		dllist->ops_->extractLast(dllist);
+		dllist->ops_->insertFirst(dllist, &values[kListEntries + i], sizeof(u32));
+	}
+	COMPARATIVE_printResult("DLList put evicting", kOperations, COMPARATIVE_now() - time_start);
+
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+
+	BENCH_cache(kListEntries);
+}
+
+static void BENCH_big()
+{
+	COMPARATIVE_printSizeNote("DLList", kListEntries, kEntries);
+	printf("  LRU cache, %u entries\n", kEntries);
+	BENCH_shuffle(kEntries);
+	BENCH_cache(kEntries);
+}
+
+int main()
+{
+	srand(1);
+	for (u32 i = 0; i < 2 * kEntries + kOperations; ++i)
+	{
+		values[i] = i;
+	}
+
+	BENCH_list();
+	BENCH_big();
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,208 @@
+// comparative_mpmc_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Throughput and enqueue->dequeue latency of the MPMC queues against a Queue
+// wrapped in a mutex, for 1, 2, 4 and 8 producers (and as many consumers).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_queue.h"
+#include "adt_mpmc_queue.h"
+
+#include "comparative_base.c"
+
+#define kMessages 200000
+#define kMaxThreads 8
+const u16 kBoundedCapacity = 1024;
+const u16 kSegmentCapacity = 256;
+// Queue's List takes one MM block per node, keep it inside the 64B pool
+const u16 kLockedQueueCapacity = 64;
+
+typedef enum {
+	kQueueKind_Bounded,
+	kQueueKind_Segmented,
+	kQueueKind_Locked,
+} QueueKind;
+
+typedef struct bench_context_s {
+	QueueKind kind_;
+	MPMCQueue *bounded_;
+	MPMCSegQueue *segmented_;
+	Queue *locked_;
+	mtx_t mutex_;
+	u32 messages_per_producer_;
+	u32 total_messages_;
+	_Atomic u32 next_message_;
+	_Atomic u32 received_;
+	double latency_us_[kMaxThreads];
+} BenchContext;
+
+double send_time[kMessages + 1];
+
+static s16 BENCH_tryEnqueue(BenchContext *ctx, void *data)
+{
+	switch (ctx->kind_)
+	{
+	case kQueueKind_Bounded:
+		return ctx->bounded_->ops_->tryEnqueue(ctx->bounded_, data, sizeof(u32));
+	case kQueueKind_Segmented:
+		return ctx->segmented_->ops_->tryEnqueue(ctx->segmented_, data, sizeof(u32));
+	default:
+	{
+		s16 error = kErrorCode_QueueFull;
+		mtx_lock(&ctx->mutex_);
+		if (False == ctx->locked_->ops_->isFull(ctx->locked_))
+		{
+			error = ctx->locked_->ops_->enqueue(ctx->locked_, data, sizeof(u32));
+		}
+		mtx_unlock(&ctx->mutex_);
+		return error;
+	}
+	}
+}
+
+static void *BENCH_tryDequeue(BenchContext *ctx)
+{
+	switch (ctx->kind_)
+	{
+	case kQueueKind_Bounded:
+		return ctx->bounded_->ops_->tryDequeue(ctx->bounded_);
+	case kQueueKind_Segmented:
+		return ctx->segmented_->ops_->tryDequeue(ctx->segmented_);
+	default:
+	{
+		void *data = NULL;
+		mtx_lock(&ctx->mutex_);
+		if (False == ctx->locked_->ops_->isEmpty(ctx->locked_))
+		{
+			data = ctx->locked_->ops_->dequeue(ctx->locked_);
+		}
+		mtx_unlock(&ctx->mutex_);
+		return data;
+	}
+	}
+}
+
+static int BENCH_producer(void *arg)
+{
+	BenchContext *ctx = (BenchContext *)arg;
+	for (u32 i = 0; i < ctx->messages_per_producer_; ++i)
+	{
+		// message ids start at 1 so the payload is never NULL
+		u32 id = atomic_fetch_add_explicit(&ctx->next_message_, 1, memory_order_relaxed);
+		// the segmented queue never fills up: keep the same backlog as the ring
+		// so both are measured with the same number of messages in flight
+		if (kQueueKind_Segmented == ctx->kind_ && 0 == (i & 63))
+		{
+			while (ctx->segmented_->ops_->length(ctx->segmented_) > kBoundedCapacity)
+			{
+				thrd_yield();
+			}
+		}
+		send_time[id] = COMPARATIVE_now();
+		while (kErrorCode_Ok != BENCH_tryEnqueue(ctx, (void *)(uintptr_t)id))
+		{
+			thrd_yield();
+		}
+	}
+	return 0;
+}
+
+typedef struct consumer_arg_s {
+	BenchContext *ctx_;
+	u16 index_;
+} ConsumerArg;
+
+static int BENCH_consumer(void *arg)
+{
+	ConsumerArg *consumer = (ConsumerArg *)arg;
+	BenchContext *ctx = consumer->ctx_;
+	double latency = 0.0;
+	while (atomic_load_explicit(&ctx->received_, memory_order_relaxed) < ctx->total_messages_)
+	{
+		void *data = BENCH_tryDequeue(ctx);
+		if (NULL == data)
+		{
+			thrd_yield();
+			continue;
+		}
+		latency += COMPARATIVE_now() - send_time[(uintptr_t)data];
+		atomic_fetch_add_explicit(&ctx->received_, 1, memory_order_relaxed);
+	}
+	ctx->latency_us_[consumer->index_] = latency;
+	return 0;
+}
+
+void calculateTimeForQueue(QueueKind kind, u16 threads, const char *name)
+{
+	BenchContext ctx;
+	ctx.kind_ = kind;
+	ctx.bounded_ = NULL;
+	ctx.segmented_ = NULL;
+	ctx.locked_ = NULL;
+	switch (kind)
+	{
+	case kQueueKind_Bounded: ctx.bounded_ = MPMCQUEUE_create(kBoundedCapacity); break;
+	case kQueueKind_Segmented: ctx.segmented_ = MPMCSEGQUEUE_create(kSegmentCapacity); break;
+	default: ctx.locked_ = QUEUE_create(kLockedQueueCapacity); mtx_init(&ctx.mutex_, mtx_plain); break;
+	}
+	ctx.messages_per_producer_ = kMessages / threads;
+	ctx.total_messages_ = ctx.messages_per_producer_ * threads;
+	atomic_init(&ctx.next_message_, 1);
+	atomic_init(&ctx.received_, 0);
+
+	thrd_t producers[kMaxThreads];
+	thrd_t consumers[kMaxThreads];
+	ConsumerArg consumer_args[kMaxThreads];
+	double time_start = COMPARATIVE_now();
+	for (u16 i = 0; i < threads; ++i)
+	{
+		consumer_args[i].ctx_ = &ctx;
+		consumer_args[i].index_ = i;
+		thrd_create(&consumers[i], BENCH_consumer, &consumer_args[i]);
+		thrd_create(&producers[i], BENCH_producer, &ctx);
+	}
+	double latency = 0.0;
+	for (u16 i = 0; i < threads; ++i)
+	{
+		thrd_join(producers[i], NULL);
+		thrd_join(consumers[i], NULL);
+		latency += ctx.latency_us_[i];
+	}
+	double time_end = COMPARATIVE_now();
+
+	char label[64];
+	snprintf(label, sizeof(label), "%s %dP/%dC", name, threads, threads);
+	COMPARATIVE_printResult(label, ctx.total_messages_, time_end - time_start);
+	printf("    mean enqueue->dequeue latency %.2f us\n", latency / ctx.total_messages_);
+
+	switch (kind)
+	{
+	case kQueueKind_Bounded: ctx.bounded_->ops_->destroy(ctx.bounded_); break;
+	case kQueueKind_Segmented: ctx.segmented_->ops_->destroy(ctx.segmented_); break;
+	default: ctx.locked_->ops_->destroy(ctx.locked_); mtx_destroy(&ctx.mutex_); break;
+	}
+}
+
+int main()
+{
+	const u16 thread_counts[] = { 1, 2, 4, 8 };
+	printf("%d messages per run\n", kMessages);
+	for (u16 i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i)
+	{
+		calculateTimeForQueue(kQueueKind_Bounded, thread_counts[i], "MPMCQueue (bounded)");
+		calculateTimeForQueue(kQueueKind_Segmented, thread_counts[i], "MPMCSegQueue (segmented)");
+		calculateTimeForQueue(kQueueKind_Locked, thread_counts[i], "Queue + mutex");
+		printf("\n");
+	}
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
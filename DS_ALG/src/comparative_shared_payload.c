@@ -0,0 +1,123 @@
+// comparative_shared_payload.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// concat of Vector and List with 1 KB payloads: copying every payload into
+// the destination against the containers of shared payloads, which only take
+// a new reference to each one. The source holds kElements payloads of 1016
+// bytes (1024 with the header of a shared payload, one 1 KB block of the MM)
+// and the concat is repeated on a new destination every round. Only the concat is timed, the payload bytes it allocates are shown
+// next to the results, and extrapolated to 50k elements.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_memory_node.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_cursor.h"
+
+#include "comparative_base.c"
+
+const u16 kElements = 40;
+const u16 kPayloadSize = 1016;
+const u32 kRounds = 5000;
+const u32 kBigElements = 50000;
+
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_printMemory(u64 bytes_per_concat)
+{
+	printf("    %llu payload bytes per concat, %.1f MB for %u elements\n", (unsigned long long)bytes_per_concat,
+		(double)bytes_per_concat / kElements * kBigElements / (1024.0 * 1024.0), kBigElements);
+}
+
+static void *BENCH_payload(boolean shared, u16 i)
+{
+	u8 *data = True == shared ? MEMNODE_sharedAlloc(kPayloadSize) : MM->malloc(kPayloadSize);
+	memset(data, (u8)i, kPayloadSize);
+	return data;
+}
+
+static void BENCH_sum(Cursor *cursor)
+{
+	for (; True == CURSOR_valid(cursor); CURSOR_next(cursor))
+	{
+		checksum += ((u8 *)CURSOR_get(cursor))[kPayloadSize - 1];
+	}
+}
+
+static void BENCH_vector(boolean shared, const char *name)
+{
+	Vector *source = True == shared ? VECTOR_createShared(kElements) : VECTOR_create(kElements);
+	for (u16 i = 0; i < kElements; ++i)
+	{
+		source->ops_->insertLast(source, BENCH_payload(shared, i), kPayloadSize);
+	}
+	Cursor cursor;
+	double elapsed = 0.0;
+	for (u32 round = 0; round < kRounds; ++round)
+	{
+		Vector *vector = True == shared ? VECTOR_createShared(1) : VECTOR_create(1);
+		double time_start = COMPARATIVE_now();
+		vector->ops_->concat(vector, source);
+		elapsed += COMPARATIVE_now() - time_start;
+		vector->ops_->begin(vector, &cursor);
+		BENCH_sum(&cursor);
+		vector->ops_->destroy(vector);
+	}
+	COMPARATIVE_printResult(name, (u64)kRounds * kElements, elapsed);
+	BENCH_printMemory(True == shared ? 0 : (u64)kElements * kPayloadSize);
+	BENCH_printChecksum();
+	source->ops_->destroy(source);
+}
+
+static void BENCH_list(boolean shared, const char *name)
+{
+	List *source = True == shared ? LIST_createShared(kElements) : LIST_create(kElements);
+	for (u16 i = 0; i < kElements; ++i)
+	{
+		source->ops_->insertLast(source, BENCH_payload(shared, i), kPayloadSize);
+	}
+	Cursor cursor;
+	double elapsed = 0.0;
+	for (u32 round = 0; round < kRounds; ++round)
+	{
+		List *list = True == shared ? LIST_createShared(1) : LIST_create(1);
+		double time_start = COMPARATIVE_now();
+		list->ops_->concat(list, source);
+		elapsed += COMPARATIVE_now() - time_start;
+		list->ops_->begin(list, &cursor);
+		BENCH_sum(&cursor);
+		list->ops_->destroy(list);
+	}
+	COMPARATIVE_printResult(name, (u64)kRounds * kElements, elapsed);
+	BENCH_printMemory(True == shared ? 0 : (u64)kElements * kPayloadSize);
+	BENCH_printChecksum();
+	source->ops_->destroy(source);
+}
+
+int main()
+{
+	printf("concat of %d payloads of %d bytes, %u rounds\n", kElements, kPayloadSize, kRounds);
+
+	BENCH_vector(False, "Vector concat, copies");
+	BENCH_vector(True, "Vector concat, shared payloads");
+	BENCH_list(False, "List concat, copies");
+	BENCH_list(True, "List concat, shared payloads");
+
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,194 @@
+// comparative_skiplist.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Skip list against a sorted DLList. The DLList finds the place of each
+// element walking from the head and inserts it with insertAt, which walks
+// again from the nearest end; its nodes come from the MM, so it is compared
+// with the skip list at kComparativeListElements. The skip list alone then
+// takes 1M elements: inserts, lookups, walks of 100 from a random element
+// and erasures. The payloads are u32 in a static array.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_dllist.h"
+#include "adt_skiplist.h"
+
+#include "comparative_base.c"
+
+#define kListElements kComparativeListElements
+#define kElements (1024 * 1024)
+const u32 kRounds = 200;
+const u32 kScans = 100000;
+const u32 kScanLength = 100;
+
+static u32 values[kElements];
+static u32 order[kElements];
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_shuffle(u32 count)
+{
+	for (u32 i = 0; i < count; ++i)
+	{
+		order[i] = i;
+	}
+	for (u32 i = count - 1; i > 0; --i)
+	{
+		u32 j = (u32)(((u64)rand() << 16 ^ (u64)rand()) % (i + 1));
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+}
+
+static s32 BENCH_compare(const void *a, u16 a_bytes, const void *b, u16 b_bytes)
+{
+	(void)a_bytes;
+	(void)b_bytes;
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Position of the first element of the sorted DLList not below value
+static u16 BENCH_listPosition(DLList *list, u32 value)
+{
+	Cursor cursor;
+	u16 position = 0;
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor) && *(u32 *)CURSOR_get(&cursor) < value;
+		CURSOR_next(&cursor))
+	{
+		++position;
+	}
+	return position;
+}
+
+static void BENCH_small()
+{
+	printf("  %d elements, built %u times\n", kListElements, kRounds);
+	BENCH_shuffle(kListElements);
+	DLList *dllist = DLList_create(kListElements);
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		while (NULL != dllist->ops_->extractFirst(dllist));
+		for (u32 i = 0; i < kListElements; ++i)
+		{
+			u32 *value = &values[order[i]];
+			dllist->ops_->insertAt(dllist, value, sizeof(u32), BENCH_listPosition(dllist, *value));
+		}
+	}
+	COMPARATIVE_printResult("sorted DLList insert", (u64)kRounds * kListElements, COMPARATIVE_now() - time_start);
+
+	SkipList *list = SKIPLIST_create(BENCH_compare);
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		list->ops_->softReset(list);
+		for (u32 i = 0; i < kListElements; ++i)
+		{
+			list->ops_->insert(list, &values[order[i]], sizeof(u32));
+		}
+	}
+	COMPARATIVE_printResult("skip list insert", (u64)kRounds * kListElements, COMPARATIVE_now() - time_start);
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u32 i = 0; i < kListElements; ++i)
+		{
+			checksum += *(u32 *)dllist->ops_->at(dllist, BENCH_listPosition(dllist, values[order[i]]));
+		}
+	}
+	COMPARATIVE_printResult("sorted DLList find", (u64)kRounds * kListElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u32 i = 0; i < kListElements; ++i)
+		{
+			checksum += *(u32 *)list->ops_->find(list, &values[order[i]], sizeof(u32));
+		}
+	}
+	COMPARATIVE_printResult("skip list find", (u64)kRounds * kListElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+	list->ops_->softReset(list);
+	list->ops_->destroy(list);
+}
+
+static void BENCH_big()
+{
+	Cursor cursor;
+	COMPARATIVE_printSizeNote("DLList", kListElements, kElements);
+	printf("  skip list, %u elements\n", kElements);
+	BENCH_shuffle(kElements);
+	SkipList *list = SKIPLIST_create(BENCH_compare);
+	double time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		list->ops_->insert(list, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("skip list insert shuffled", kElements, COMPARATIVE_now() - time_start);
+	printf("    %d levels\n", list->level_);
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += *(u32 *)list->ops_->find(list, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("skip list find shuffled", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 s = 0; s < kScans; ++s)
+	{
+		list->ops_->lowerBound(list, &values[order[s]], sizeof(u32), &cursor);
+		for (u32 n = 0; n < kScanLength && True == CURSOR_valid(&cursor); ++n, CURSOR_next(&cursor))
+		{
+			checksum += *(u32 *)CURSOR_get(&cursor);
+		}
+	}
+	COMPARATIVE_printResult("skip list walk 100 from a random element", (u64)kScans * kScanLength, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+
+	time_start = COMPARATIVE_now();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		checksum += *(u32 *)list->ops_->erase(list, &values[order[i]], sizeof(u32));
+	}
+	COMPARATIVE_printResult("skip list erase shuffled", kElements, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	list->ops_->destroy(list);
+}
+
+int main()
+{
+	srand(1);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+	}
+
+	BENCH_small();
+	BENCH_big();
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,184 @@
+// comparative_snapshot_vector.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Read-mostly lookup table: reader threads look up random entries while one
+// writer keeps replacing entries. Compares a Vector under a global mutex
+// (every VECTOR_at locked) with the SnapshotVector, where readers acquire
+// the current version without locks. Reports lookups per second from 1 to
+// 16 readers and how many writes got in meanwhile.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_snapshot_vector.h"
+
+#include "comparative_base.c"
+
+#define kMaxReaders 16
+const u16 kTableSize = 256;
+const u32 kLookupsPerReader = 200000;
+// the writer replaces one entry every kWritePeriod lookups of a reader;
+// readers wait when it falls more than kMaxWriteLag writes behind
+const u32 kWritePeriod = 1000;
+const u32 kMaxWriteLag = 4;
+
+typedef struct bench_context_s {
+	Vector *locked_;
+	mtx_t mutex_;
+	SnapshotVector *snapshot_;
+	_Atomic u32 readers_left_;
+	_Atomic u32 write_tickets_;   // writes the readers asked for
+	_Atomic u64 checksum_;
+	_Atomic u32 writes_;
+} BenchContext;
+
+static BenchContext ctx;
+
+static u32 *BENCH_newValue(u32 value)
+{
+	u32 *data = MM->malloc(sizeof(u32));
+	*data = value;
+	return data;
+}
+
+static void BENCH_requestWrite()
+{
+	u32 tickets = atomic_fetch_add(&ctx.write_tickets_, 1) + 1;
+	while ((s32)(tickets - atomic_load(&ctx.writes_)) > (s32)kMaxWriteLag)
+	{
+		thrd_yield();
+	}
+}
+
+static int BENCH_lockedReader(void *arg)
+{
+	u32 seed = (u32)(uintptr_t)arg;
+	u64 sum = 0;
+	for (u32 i = 1; i <= kLookupsPerReader; ++i)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		mtx_lock(&ctx.mutex_);
+		sum += *(u32 *)ctx.locked_->ops_->at(ctx.locked_, (seed >> 16) % kTableSize);
+		mtx_unlock(&ctx.mutex_);
+		if (0 == i % kWritePeriod)
+			BENCH_requestWrite();
+	}
+	atomic_fetch_add(&ctx.checksum_, sum);
+	atomic_fetch_sub(&ctx.readers_left_, 1);
+	return 0;
+}
+
+static int BENCH_snapshotReader(void *arg)
+{
+	u32 seed = (u32)(uintptr_t)arg;
+	u64 sum = 0;
+	SnapshotVector *vector = ctx.snapshot_;
+	EpochRecord *reader = vector->ops_->registerReader(vector);
+	for (u32 i = 1; i <= kLookupsPerReader; ++i)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		const SnapshotVersion *version = vector->ops_->acquire(vector, reader);
+		sum += *(u32 *)vector->ops_->at(version, (seed >> 16) % kTableSize);
+		vector->ops_->release(vector, reader);
+		if (0 == i % kWritePeriod)
+			BENCH_requestWrite();
+	}
+	vector->ops_->unregisterReader(reader);
+	atomic_fetch_add(&ctx.checksum_, sum);
+	atomic_fetch_sub(&ctx.readers_left_, 1);
+	return 0;
+}
+
+// Runs on the main thread while the readers work
+static void BENCH_writer(boolean snapshot)
+{
+	u32 writes = 0;
+	while (0 != atomic_load(&ctx.readers_left_))
+	{
+		if (writes >= atomic_load(&ctx.write_tickets_))
+		{
+			thrd_yield();
+			continue;
+		}
+		u16 position = (u16)(writes % kTableSize);
+		u32 *data = BENCH_newValue(writes);
+		if (True == snapshot)
+		{
+			ctx.snapshot_->ops_->setAt(ctx.snapshot_, data, sizeof(u32), position);
+		}
+		else
+		{
+			mtx_lock(&ctx.mutex_);
+			void *old = ctx.locked_->ops_->extractAt(ctx.locked_, position);
+			ctx.locked_->ops_->insertAt(ctx.locked_, data, sizeof(u32), position);
+			mtx_unlock(&ctx.mutex_);
+			MM->free(old);
+		}
+		atomic_store(&ctx.writes_, ++writes);
+	}
+}
+
+void calculateTime(const char *name, thrd_start_t reader, boolean snapshot, u16 readers)
+{
+	atomic_store(&ctx.readers_left_, readers);
+	atomic_store(&ctx.write_tickets_, 0);
+	atomic_store(&ctx.writes_, 0);
+	atomic_store(&ctx.checksum_, 0);
+	thrd_t threads[kMaxReaders];
+	double time_start = COMPARATIVE_now();
+	for (u16 t = 0; t < readers; ++t)
+	{
+		thrd_create(&threads[t], reader, (void *)(uintptr_t)(12345 + t));
+	}
+	BENCH_writer(snapshot);
+	for (u16 t = 0; t < readers; ++t)
+	{
+		thrd_join(threads[t], NULL);
+	}
+	double elapsed = COMPARATIVE_now() - time_start;
+	char label[64];
+	snprintf(label, sizeof(label), "%s %d readers", name, readers);
+	COMPARATIVE_printResult(label, (u64)readers * kLookupsPerReader, elapsed);
+	printf("    %u writes during the run (checksum %llu)\n", atomic_load(&ctx.writes_),
+		(unsigned long long)atomic_load(&ctx.checksum_));
+}
+
+int main()
+{
+	mtx_init(&ctx.mutex_, mtx_plain);
+	ctx.locked_ = VECTOR_create(kTableSize);
+	ctx.snapshot_ = SNAPSHOTVECTOR_create(kTableSize);
+	if (NULL == ctx.locked_ || NULL == ctx.snapshot_)
+	{
+		printf("ERROR: cannot create the tables\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kTableSize; ++i)
+	{
+		ctx.locked_->ops_->insertLast(ctx.locked_, BENCH_newValue(i), sizeof(u32));
+		ctx.snapshot_->ops_->insertLast(ctx.snapshot_, BENCH_newValue(i), sizeof(u32));
+	}
+
+	const u16 reader_counts[] = { 1, 2, 4, 8, 16 };
+	printf("%d lookups per reader on %d entries, 1 write every %d lookups of a reader\n",
+		kLookupsPerReader, kTableSize, kWritePeriod);
+	for (u16 i = 0; i < sizeof(reader_counts) / sizeof(reader_counts[0]); ++i)
+	{
+		calculateTime("Vector + global mutex", BENCH_lockedReader, False, reader_counts[i]);
+		calculateTime("SnapshotVector", BENCH_snapshotReader, True, reader_counts[i]);
+	}
+
+	ctx.locked_->ops_->destroy(ctx.locked_);
+	ctx.snapshot_->ops_->destroy(ctx.snapshot_);
+	mtx_destroy(&ctx.mutex_);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,146 @@
+// comparative_spsc_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Messages per second from one producer thread to one consumer thread:
+// lock-free SPSCQueue against a Queue wrapped in a mutex.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_queue.h"
+#include "adt_spsc_queue.h"
+
+#include "comparative_base.c"
+
+const u32 kMessages = 1000000;
+// Both queues hold the same number of messages in flight, so the ring and
+// the locked Queue only differ in how they synchronize
+const u16 kQueueCapacity = 1024;
+
+typedef struct locked_queue_s {
+	Queue *queue_;
+	mtx_t mutex_;
+} LockedQueue;
+
+static int SPSC_producer(void *arg)
+{
+	SPSCQueue *qu = (SPSCQueue *)arg;
+	for (u32 i = 1; i <= kMessages; ++i)
+	{
+		while (kErrorCode_Ok != qu->ops_->enqueue(qu, (void *)(uintptr_t)i, sizeof(u32)))
+		{
+			thrd_yield();
+		}
+	}
+	return 0;
+}
+
+static int LOCKED_producer(void *arg)
+{
+	LockedQueue *lq = (LockedQueue *)arg;
+	for (u32 i = 1; i <= kMessages; ++i)
+	{
+		boolean pushed = False;
+		while (False == pushed)
+		{
+			mtx_lock(&lq->mutex_);
+			if (False == lq->queue_->ops_->isFull(lq->queue_))
+			{
+				pushed = kErrorCode_Ok == lq->queue_->ops_->enqueue(lq->queue_, (void *)(uintptr_t)i, sizeof(u32));
+			}
+			mtx_unlock(&lq->mutex_);
+			if (False == pushed)
+			{
+				thrd_yield();
+			}
+		}
+	}
+	return 0;
+}
+
+void calculateTimeSPSCQueue()
+{
+	SPSCQueue *qu = SPSCQUEUE_create(kQueueCapacity);
+	if (NULL == qu)
+	{
+		printf("ERROR: cannot create the SPSCQueue\n");
+		return;
+	}
+	thrd_t producer;
+	double time_start = COMPARATIVE_now();
+	thrd_create(&producer, SPSC_producer, qu);
+	u32 received = 0;
+	u64 checksum = 0;
+	while (received < kMessages)
+	{
+		void *data = qu->ops_->dequeue(qu);
+		if (NULL == data)
+		{
+			thrd_yield();
+			continue;
+		}
+		checksum += (uintptr_t)data;
+		received++;
+	}
+	thrd_join(producer, NULL);
+	double time_end = COMPARATIVE_now();
+	COMPARATIVE_printResult("SPSCQueue (lock-free ring)", kMessages, time_end - time_start);
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	qu->ops_->destroy(qu);
+}
+
+void calculateTimeLockedQueue()
+{
+	LockedQueue lq;
+	lq.queue_ = QUEUE_create(kQueueCapacity);
+	if (NULL == lq.queue_)
+	{
+		printf("ERROR: cannot create the Queue\n");
+		return;
+	}
+	mtx_init(&lq.mutex_, mtx_plain);
+	thrd_t producer;
+	double time_start = COMPARATIVE_now();
+	thrd_create(&producer, LOCKED_producer, &lq);
+	u32 received = 0;
+	u64 checksum = 0;
+	while (received < kMessages)
+	{
+		mtx_lock(&lq.mutex_);
+		void *data = NULL;
+		if (False == lq.queue_->ops_->isEmpty(lq.queue_))
+		{
+			data = lq.queue_->ops_->dequeue(lq.queue_);
+		}
+		mtx_unlock(&lq.mutex_);
+		if (NULL == data)
+		{
+			thrd_yield();
+			continue;
+		}
+		checksum += (uintptr_t)data;
+		received++;
+	}
+	thrd_join(producer, NULL);
+	double time_end = COMPARATIVE_now();
+	COMPARATIVE_printResult("Queue + mutex", kMessages, time_end - time_start);
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	mtx_destroy(&lq.mutex_);
+	lq.queue_->ops_->destroy(lq.queue_);
+}
+
+int main()
+{
+	printf("One producer -> one consumer, %u messages\n", kMessages);
+	calculateTimeSPSCQueue();
+	calculateTimeLockedQueue();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
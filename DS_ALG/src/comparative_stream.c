@@ -0,0 +1,168 @@
+// comparative_stream.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Ingestion of a big file into a List of chunks, in MB/s: fread into a buffer
+// + an MM payload and a memcpy per chunk, against the stream filling the
+// List with slices of its blocks, in read and map modes, and the stream
+// alone cutting slices into one node. Every chunk is summed as u64 words.
+// The input size is the first argument in MB, 1 GB by default. It is written
+// just before, so it is read from the page cache.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_list.h"
+#include "adt_cursor.h"
+#include "adt_stream.h"
+
+#include "comparative_base.c"
+
+const char *kInputFile = "comparative_stream.bin";
+const u32 kDefaultMegabytes = 1024;
+const u32 kMegabyte = 1024 * 1024;
+const u32 kBlockSize = 1024 * 1024;
+const u16 kChunkSize = 4096;
+// chunks alive at once, each one an MM payload in the copying version
+const u16 kListCapacity = 32;
+
+static u64 checksum = 0;
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_printResult(const char *name, u64 bytes, double elapsed_us)
+{
+	COMPARATIVE_printResult(name, bytes / kChunkSize, elapsed_us);
+	printf("    %.1f MB/s\n", (bytes / (double)kMegabyte) / (elapsed_us / 1000000.0));
+}
+
+static void BENCH_sumChunk(u8 *data, u16 size)
+{
+	for (u16 i = 0; i + sizeof(u64) <= size; i += sizeof(u64))
+	{
+		u64 word;
+		memcpy(&word, data + i, sizeof(word));
+		checksum += word;
+	}
+}
+
+static void BENCH_sumList(List *list)
+{
+	Cursor cursor;
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		BENCH_sumChunk(CURSOR_get(&cursor), CURSOR_node(&cursor)->size_);
+	}
+}
+
+// The way chunks were ingested before the stream
+static void BENCH_copy(u64 bytes)
+{
+	List *list = LIST_create(kListCapacity);
+	u8 *buffer = FILEMAP_pagesAlloc(kBlockSize);
+	FILE *file = fopen(kInputFile, "rb");
+	double time_start = COMPARATIVE_now();
+	u32 read;
+	while (0 != (read = (u32)fread(buffer, 1, kBlockSize, file)))
+	{
+		for (u32 offset = 0; offset < read; offset += kChunkSize)
+		{
+			u16 size = read - offset < kChunkSize ? (u16)(read - offset) : kChunkSize;
+			void *payload = MM->malloc(size);
+			memcpy(payload, buffer + offset, size);
+			list->ops_->insertLast(list, payload, size);
+			if (True == list->ops_->isFull(list))
+			{
+				BENCH_sumList(list);
+				list->ops_->reset(list);
+			}
+		}
+	}
+	BENCH_sumList(list);
+	list->ops_->reset(list);
+	BENCH_printResult("fread + MM alloc + memcpy + insertLast", bytes, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	fclose(file);
+	FILEMAP_pagesFree(buffer, kBlockSize);
+	list->ops_->destroy(list);
+}
+
+static void BENCH_fill(StreamMode mode, const char *name, u64 bytes)
+{
+	List *list = LIST_create(kListCapacity);
+	double time_start = COMPARATIVE_now();
+	Stream *stream = STREAM_create(kInputFile, mode, kBlockSize, kChunkSize);
+	while (kErrorCode_Ok == stream->ops_->fill(stream, list))
+	{
+		BENCH_sumList(list);
+		stream->ops_->releaseList(stream, list);
+	}
+	stream->ops_->destroy(stream);
+	BENCH_printResult(name, bytes, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	list->ops_->destroy(list);
+}
+
+static void BENCH_next(StreamMode mode, const char *name, u64 bytes)
+{
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	double time_start = COMPARATIVE_now();
+	Stream *stream = STREAM_create(kInputFile, mode, kBlockSize, kChunkSize);
+	while (kErrorCode_Ok == stream->ops_->next(stream, &node))
+	{
+		BENCH_sumChunk(node.data_, node.size_);
+		stream->ops_->release(stream, &node);
+	}
+	stream->ops_->destroy(stream);
+	BENCH_printResult(name, bytes, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+}
+
+int main(int argc, char** argv)
+{
+	u32 megabytes = argc > 1 ? (u32)atoi(argv[1]) : kDefaultMegabytes;
+	if (0 == megabytes)
+	{
+		megabytes = kDefaultMegabytes;
+	}
+	u64 bytes = (u64)megabytes * kMegabyte;
+	u64 *block = FILEMAP_pagesAlloc(kMegabyte);
+	FILE *file = fopen(kInputFile, "wb");
+	if (NULL == block || NULL == file)
+	{
+		printf("ERROR: cannot write %s\n", kInputFile);
+		return -1;
+	}
+	for (u32 m = 0; m < megabytes; ++m)
+	{
+		for (u32 i = 0; i < kMegabyte / sizeof(u64); ++i)
+		{
+			block[i] = (u64)m * kMegabyte + i;
+		}
+		fwrite(block, 1, kMegabyte, file);
+	}
+	fclose(file);
+	FILEMAP_pagesFree(block, kMegabyte);
+	printf("%d MB in chunks of %d bytes, blocks of %d bytes\n", megabytes, kChunkSize, kBlockSize);
+
+	BENCH_copy(bytes);
+	BENCH_fill(kStreamMode_Read, "stream read fill + releaseList", bytes);
+	BENCH_fill(kStreamMode_Map, "stream map fill + releaseList", bytes);
+	BENCH_next(kStreamMode_Read, "stream read next + release", bytes);
+	BENCH_next(kStreamMode_Map, "stream map next + release", bytes);
+
+	remove(kInputFile);
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
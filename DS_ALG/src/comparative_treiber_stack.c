@@ -0,0 +1,128 @@
+// comparative_treiber_stack.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Push/pop pairs per second from 1 to 16 threads sharing one stack:
+// lock-free TreiberStack against a Stack wrapped in a mutex.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_stack.h"
+#include "adt_treiber_stack.h"
+
+#include "comparative_base.c"
+
+#define kMaxThreads 16
+const u32 kPairs = 1000000;
+
+typedef struct bench_context_s {
+	TreiberStack *treiber_;
+	Stack *locked_;
+	mtx_t mutex_;
+	u32 pairs_per_thread_;
+	_Atomic u64 checksum_;
+} BenchContext;
+
+static int TREIBER_worker(void *arg)
+{
+	BenchContext *ctx = (BenchContext *)arg;
+	TreiberStack *stack = ctx->treiber_;
+	u64 checksum = 0;
+	for (u32 i = 1; i <= ctx->pairs_per_thread_; ++i)
+	{
+		stack->ops_->push(stack, (void *)(uintptr_t)i, sizeof(u32));
+		checksum += (uintptr_t)stack->ops_->pop(stack);
+	}
+	atomic_fetch_add(&ctx->checksum_, checksum);
+	return 0;
+}
+
+static int LOCKED_worker(void *arg)
+{
+	BenchContext *ctx = (BenchContext *)arg;
+	Stack *stack = ctx->locked_;
+	u64 checksum = 0;
+	for (u32 i = 1; i <= ctx->pairs_per_thread_; ++i)
+	{
+		mtx_lock(&ctx->mutex_);
+		stack->ops_->push(stack, (void *)(uintptr_t)i, sizeof(u32));
+		mtx_unlock(&ctx->mutex_);
+		mtx_lock(&ctx->mutex_);
+		checksum += (uintptr_t)stack->ops_->pop(stack);
+		mtx_unlock(&ctx->mutex_);
+	}
+	atomic_fetch_add(&ctx->checksum_, checksum);
+	return 0;
+}
+
+void calculateTimeForStack(boolean lock_free, u16 threads)
+{
+	BenchContext ctx;
+	ctx.treiber_ = NULL;
+	ctx.locked_ = NULL;
+	// every thread has at most one element pushed at a time
+	if (lock_free)
+	{
+		ctx.treiber_ = TREIBERSTACK_create(threads);
+	}
+	else
+	{
+		ctx.locked_ = STACK_create(threads);
+		mtx_init(&ctx.mutex_, mtx_plain);
+	}
+	ctx.pairs_per_thread_ = kPairs / threads;
+	atomic_init(&ctx.checksum_, 0);
+
+	thrd_t workers[kMaxThreads];
+	double time_start = COMPARATIVE_now();
+	for (u16 i = 0; i < threads; ++i)
+	{
+		thrd_create(&workers[i], lock_free ? TREIBER_worker : LOCKED_worker, &ctx);
+	}
+	for (u16 i = 0; i < threads; ++i)
+	{
+		thrd_join(workers[i], NULL);
+	}
+	double time_end = COMPARATIVE_now();
+
+	char label[64];
+	snprintf(label, sizeof(label), "%s %2d threads", lock_free ? "TreiberStack" : "Stack + mutex", threads);
+	COMPARATIVE_printResult(label, ctx.pairs_per_thread_ * threads, time_end - time_start);
+	u64 expected = (u64)threads * ctx.pairs_per_thread_ * (ctx.pairs_per_thread_ + 1) / 2;
+	if (expected != atomic_load(&ctx.checksum_))
+	{
+		printf("    ERROR: checksum %llu, expected %llu\n",
+			(unsigned long long)atomic_load(&ctx.checksum_), (unsigned long long)expected);
+	}
+
+	if (lock_free)
+	{
+		ctx.treiber_->ops_->destroy(ctx.treiber_);
+	}
+	else
+	{
+		ctx.locked_->ops_->destroy(ctx.locked_);
+		mtx_destroy(&ctx.mutex_);
+	}
+}
+
+int main()
+{
+	const u16 thread_counts[] = { 1, 2, 4, 8, 16 };
+	printf("%u push/pop pairs per run\n", kPairs);
+	for (u16 i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i)
+	{
+		calculateTimeForStack(True, thread_counts[i]);
+		calculateTimeForStack(False, thread_counts[i]);
+		printf("\n");
+	}
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
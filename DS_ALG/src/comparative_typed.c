@@ -0,0 +1,227 @@
+// comparative_typed.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Generic containers (void* payloads in MemoryNodes, one MM block per
+// payload, every call through ops_) against the macro generated ones
+// (u32 stored by value, static inline calls). Times insertLast, at and
+// traverse on Vector and List, and enqueue + dequeue on Queue.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_queue.h"
+#include "adt_typed.h"
+
+#include "comparative_base.c"
+
+DEFINE_VECTOR(u32)
+DEFINE_LIST(u32)
+DEFINE_QUEUE(u32)
+
+// every generic element is a live MM payload block, and MM only has a few
+// hundred blocks per size class
+const u16 kElements = 256;
+const u32 kRounds = 1000;
+// List at walks from the head, so only some indices are read
+const u16 kListReads = 32;
+
+static u64 checksum = 0;
+
+static void BENCH_sumNode(MemoryNode *node)
+{
+	checksum += *(u32 *)node->data_;
+}
+
+static void BENCH_sumValue(u32 *value)
+{
+	checksum += *value;
+}
+
+static u32 *BENCH_newValue(u32 value)
+{
+	u32 *data = MM->malloc(sizeof(u32));
+	*data = value;
+	return data;
+}
+
+static void BENCH_printChecksum()
+{
+	printf("    checksum %llu\n", (unsigned long long)checksum);
+	checksum = 0;
+}
+
+static void BENCH_vector()
+{
+	u64 ops = (u64)kRounds * kElements;
+	double insert = 0.0, at = 0.0, traverse = 0.0, time_start;
+
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		Vector *vector = VECTOR_create(kElements);
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			vector->ops_->insertLast(vector, BENCH_newValue(i), sizeof(u32));
+		}
+		insert += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			checksum += *(u32 *)vector->ops_->at(vector, i);
+		}
+		at += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		vector->ops_->traverse(vector, BENCH_sumNode);
+		traverse += COMPARATIVE_now() - time_start;
+		vector->ops_->destroy(vector);
+	}
+	COMPARATIVE_printResult("Vector insertLast", ops, insert);
+	COMPARATIVE_printResult("Vector at", ops, at);
+	COMPARATIVE_printResult("Vector traverse", ops, traverse);
+	BENCH_printChecksum();
+
+	insert = at = traverse = 0.0;
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		Vector_u32 *vector = VECTOR_u32_create(kElements);
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			VECTOR_u32_insertLast(vector, i);
+		}
+		insert += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			checksum += *VECTOR_u32_at(vector, i);
+		}
+		at += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		VECTOR_u32_traverse(vector, BENCH_sumValue);
+		traverse += COMPARATIVE_now() - time_start;
+		VECTOR_u32_destroy(vector);
+	}
+	COMPARATIVE_printResult("Vector_u32 insertLast", ops, insert);
+	COMPARATIVE_printResult("Vector_u32 at", ops, at);
+	COMPARATIVE_printResult("Vector_u32 traverse", ops, traverse);
+	BENCH_printChecksum();
+}
+
+static void BENCH_list()
+{
+	u64 ops = (u64)kRounds * kElements;
+	u64 reads = (u64)kRounds * kListReads;
+	u16 step = kElements / kListReads;
+	double insert = 0.0, at = 0.0, traverse = 0.0, time_start;
+
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		List *list = LIST_create(kElements);
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			list->ops_->insertLast(list, BENCH_newValue(i), sizeof(u32));
+		}
+		insert += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; i += step)
+		{
+			checksum += *(u32 *)list->ops_->at(list, i);
+		}
+		at += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		list->ops_->traverse(list, BENCH_sumNode);
+		traverse += COMPARATIVE_now() - time_start;
+		list->ops_->destroy(list);
+	}
+	COMPARATIVE_printResult("List insertLast", ops, insert);
+	COMPARATIVE_printResult("List at", reads, at);
+	COMPARATIVE_printResult("List traverse", ops, traverse);
+	BENCH_printChecksum();
+
+	insert = at = traverse = 0.0;
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		List_u32 *list = LIST_u32_create(kElements);
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			LIST_u32_insertLast(list, i);
+		}
+		insert += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		for (u16 i = 0; i < kElements; i += step)
+		{
+			checksum += *LIST_u32_at(list, i);
+		}
+		at += COMPARATIVE_now() - time_start;
+		time_start = COMPARATIVE_now();
+		LIST_u32_traverse(list, BENCH_sumValue);
+		traverse += COMPARATIVE_now() - time_start;
+		LIST_u32_destroy(list);
+	}
+	COMPARATIVE_printResult("List_u32 insertLast", ops, insert);
+	COMPARATIVE_printResult("List_u32 at", reads, at);
+	COMPARATIVE_printResult("List_u32 traverse", ops, traverse);
+	BENCH_printChecksum();
+}
+
+static void BENCH_queue()
+{
+	u64 ops = (u64)kRounds * kElements * 2;
+	Queue *queue = QUEUE_create(kElements);
+	double time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			queue->ops_->enqueue(queue, BENCH_newValue(i), sizeof(u32));
+		}
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			u32 *value = queue->ops_->dequeue(queue);
+			checksum += *value;
+			MM->free(value);
+		}
+	}
+	COMPARATIVE_printResult("Queue enqueue + dequeue", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	queue->ops_->destroy(queue);
+
+	Queue_u32 *typed = QUEUE_u32_create(kElements);
+	time_start = COMPARATIVE_now();
+	for (u32 r = 0; r < kRounds; ++r)
+	{
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			QUEUE_u32_enqueue(typed, i);
+		}
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			u32 value = 0;
+			QUEUE_u32_dequeue(typed, &value);
+			checksum += value;
+		}
+	}
+	COMPARATIVE_printResult("Queue_u32 enqueue + dequeue", ops, COMPARATIVE_now() - time_start);
+	BENCH_printChecksum();
+	QUEUE_u32_destroy(typed);
+}
+
+int main()
+{
+	printf("%d rounds of %d u32 elements\n", kRounds, kElements);
+	BENCH_vector();
+	BENCH_list();
+	BENCH_queue();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
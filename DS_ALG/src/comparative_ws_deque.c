@@ -0,0 +1,316 @@
+// comparative_ws_deque.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Small work-stealing scheduler on top of WSDeque: every worker owns a deque,
+// runs its own tasks newest first and steals the oldest task of a random
+// victim when it runs out. The workload is a parallel quicksort of Vectors:
+// each partition step pushes one half as a new task and keeps the other.
+// Reports sort time, tasks run and steal rates from 1 to 8 workers against
+// the same quicksort run sequentially.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "EDK_MemoryManager/edk_memory_manager.h"
+#include "common_def.h"
+#include "adt_vector.h"
+#include "adt_ws_deque.h"
+
+#include "comparative_base.c"
+
+#define kMaxWorkers 8
+#define kVectors 8
+// one Vector storage (1600 MemoryNodes) must fit in a 64KB MM block
+#define kElements 1600
+const u16 kRuns = 100;
+const u16 kSequentialCutoff = 32;
+const u16 kDequeCapacity = 64;
+
+typedef struct worker_s {
+	struct scheduler_s *scheduler_;
+	WSDeque *deque_;
+	u16 index_;
+	u32 seed_;
+	u32 tasks_;
+	u32 steal_attempts_;
+	u32 steals_;
+} Worker;
+
+typedef struct scheduler_s {
+	Worker workers_[kMaxWorkers];
+	u16 worker_count_;
+	_Atomic u32 pending_;   // tasks pushed and not finished yet
+	Vector *vectors_[kVectors];
+} Scheduler;
+
+// A task is a range [lo, hi) of one vector packed in the pointer itself,
+// so pushing a task never allocates. hi > lo, so the pointer is never NULL.
+// It fits in 32 bits for the x32 build: 4 bits of vector, 14 of each bound.
+#define kTaskBoundBits 14
+#define kTaskBoundMask ((1u << kTaskBoundBits) - 1)
+_Static_assert(kVectors <= 16, "the vector of a task takes 4 bits");
+_Static_assert(kElements <= kTaskBoundMask, "the bounds of a task take 14 bits");
+#define TASK_MAKE(vec, lo, hi) ((void *)(uintptr_t)(((u32)(vec) << (2 * kTaskBoundBits)) | \
+	((u32)(lo) << kTaskBoundBits) | (u32)(hi)))
+#define TASK_VECTOR(task) ((u16)((u32)(uintptr_t)(task) >> (2 * kTaskBoundBits)))
+#define TASK_LO(task) ((u16)(((u32)(uintptr_t)(task) >> kTaskBoundBits) & kTaskBoundMask))
+#define TASK_HI(task) ((u16)((u32)(uintptr_t)(task) & kTaskBoundMask))
+
+// Payloads are the keys themselves, never dereferenced
+#define NODE_KEY(node) ((uintptr_t)(node)->data_)
+
+static void SORT_swap(MemoryNode *a, MemoryNode *b)
+{
+	void *data = a->data_;
+	u16 size = a->size_;
+	a->data_ = b->data_;
+	a->size_ = b->size_;
+	b->data_ = data;
+	b->size_ = size;
+}
+
+static void SORT_insertion(MemoryNode *nodes, u16 lo, u16 hi)
+{
+	for (u16 i = lo + 1; i < hi; ++i)
+	{
+		for (u16 j = i; j > lo && NODE_KEY(&nodes[j - 1]) > NODE_KEY(&nodes[j]); --j)
+		{
+			SORT_swap(&nodes[j - 1], &nodes[j]);
+		}
+	}
+}
+
+// Hoare partition around the median of three, returns the split point
+static u16 SORT_partition(MemoryNode *nodes, u16 lo, u16 hi)
+{
+	u16 mid = lo + (hi - lo) / 2;
+	if (NODE_KEY(&nodes[mid]) < NODE_KEY(&nodes[lo])) SORT_swap(&nodes[mid], &nodes[lo]);
+	if (NODE_KEY(&nodes[hi - 1]) < NODE_KEY(&nodes[lo])) SORT_swap(&nodes[hi - 1], &nodes[lo]);
+	if (NODE_KEY(&nodes[hi - 1]) < NODE_KEY(&nodes[mid])) SORT_swap(&nodes[hi - 1], &nodes[mid]);
+	uintptr_t pivot = NODE_KEY(&nodes[mid]);
+	s32 i = lo - 1;
+	s32 j = hi;
+	for (;;)
+	{
+		do { i++; } while (NODE_KEY(&nodes[i]) < pivot);
+		do { j--; } while (NODE_KEY(&nodes[j]) > pivot);
+		if (i >= j)
+			return (u16)(j + 1);
+		SORT_swap(&nodes[i], &nodes[j]);
+	}
+}
+
+static void SORT_sequential(MemoryNode *nodes, u16 lo, u16 hi)
+{
+	while (hi - lo > kSequentialCutoff)
+	{
+		u16 split = SORT_partition(nodes, lo, hi);
+		SORT_sequential(nodes, lo, split);
+		lo = split;
+	}
+	SORT_insertion(nodes, lo, hi);
+}
+
+static void SCHEDULER_run(Worker *worker, void *task)
+{
+	Scheduler *sched = worker->scheduler_;
+	u16 vec = TASK_VECTOR(task);
+	u16 lo = TASK_LO(task);
+	u16 hi = TASK_HI(task);
+	Vector *vector = sched->vectors_[vec];
+	MemoryNode *nodes = &vector->storage_[vector->head_];
+	while (hi - lo > kSequentialCutoff)
+	{
+		u16 split = SORT_partition(nodes, lo, hi);
+		// keep the left half, offer the right half to the thieves
+		atomic_fetch_add(&sched->pending_, 1);
+		if (kErrorCode_Ok != worker->deque_->ops_->push(worker->deque_, TASK_MAKE(vec, split, hi)))
+		{
+			atomic_fetch_sub(&sched->pending_, 1);
+			SORT_sequential(nodes, split, hi);
+		}
+		hi = split;
+	}
+	SORT_insertion(nodes, lo, hi);
+	worker->tasks_++;
+	atomic_fetch_sub(&sched->pending_, 1);
+}
+
+static int SCHEDULER_worker(void *arg)
+{
+	Worker *worker = (Worker *)arg;
+	Scheduler *sched = worker->scheduler_;
+	while (0 != atomic_load_explicit(&sched->pending_, memory_order_acquire))
+	{
+		void *task = worker->deque_->ops_->pop(worker->deque_);
+		if (NULL == task && sched->worker_count_ > 1)
+		{
+			// xorshift to pick a victim other than ourselves
+			worker->seed_ ^= worker->seed_ << 13;
+			worker->seed_ ^= worker->seed_ >> 17;
+			worker->seed_ ^= worker->seed_ << 5;
+			u16 victim = (worker->index_ + 1 + worker->seed_ % (sched->worker_count_ - 1)) % sched->worker_count_;
+			WSDeque *victim_deque = sched->workers_[victim].deque_;
+			worker->steal_attempts_++;
+			task = victim_deque->ops_->steal(victim_deque);
+			if (NULL != task)
+			{
+				worker->steals_++;
+			}
+		}
+		if (NULL == task)
+		{
+			thrd_yield();
+			continue;
+		}
+		SCHEDULER_run(worker, task);
+	}
+	return 0;
+}
+
+static void BENCH_fillVectors(Vector **vectors)
+{
+	for (u16 v = 0; v < kVectors; ++v)
+	{
+		vectors[v]->ops_->softReset(vectors[v]);
+		for (u16 i = 0; i < kElements; ++i)
+		{
+			// keys start at 1 so the payload is never NULL
+			vectors[v]->ops_->insertLast(vectors[v], (void *)(uintptr_t)(1 + rand()), sizeof(u32));
+		}
+	}
+}
+
+static boolean BENCH_isSorted(Vector **vectors)
+{
+	for (u16 v = 0; v < kVectors; ++v)
+	{
+		MemoryNode *nodes = &vectors[v]->storage_[vectors[v]->head_];
+		for (u16 i = 1; i < kElements; ++i)
+		{
+			if (NODE_KEY(&nodes[i - 1]) > NODE_KEY(&nodes[i]))
+				return False;
+		}
+	}
+	return True;
+}
+
+void calculateTimeSequential(Vector **vectors)
+{
+	double elapsed = 0.0;
+	boolean sorted = True;
+	srand(1);
+	for (u16 run = 0; run < kRuns; ++run)
+	{
+		BENCH_fillVectors(vectors);
+		double time_start = COMPARATIVE_now();
+		for (u16 v = 0; v < kVectors; ++v)
+		{
+			SORT_sequential(&vectors[v]->storage_[vectors[v]->head_], 0, kElements);
+		}
+		elapsed += COMPARATIVE_now() - time_start;
+		sorted = sorted && BENCH_isSorted(vectors);
+	}
+	COMPARATIVE_printResult("Sequential quicksort", (u32)kRuns * kVectors * kElements, elapsed);
+	if (False == sorted)
+		printf("    ERROR: vectors not sorted\n");
+}
+
+void calculateTimeScheduler(Vector **vectors, u16 workers)
+{
+	Scheduler sched;
+	sched.worker_count_ = workers;
+	for (u16 v = 0; v < kVectors; ++v)
+	{
+		sched.vectors_[v] = vectors[v];
+	}
+	for (u16 w = 0; w < workers; ++w)
+	{
+		sched.workers_[w].scheduler_ = &sched;
+		sched.workers_[w].deque_ = WSDEQUE_create(kDequeCapacity);
+		sched.workers_[w].index_ = w;
+		sched.workers_[w].seed_ = 2463534242u + w;
+		sched.workers_[w].tasks_ = 0;
+		sched.workers_[w].steal_attempts_ = 0;
+		sched.workers_[w].steals_ = 0;
+	}
+
+	double elapsed = 0.0;
+	boolean sorted = True;
+	srand(1);
+	for (u16 run = 0; run < kRuns; ++run)
+	{
+		BENCH_fillVectors(vectors);
+		double time_start = COMPARATIVE_now();
+		// the main thread is worker 0 and owns the root tasks
+		atomic_store(&sched.pending_, kVectors);
+		for (u16 v = 0; v < kVectors; ++v)
+		{
+			sched.workers_[0].deque_->ops_->push(sched.workers_[0].deque_, TASK_MAKE(v, 0, kElements));
+		}
+		thrd_t threads[kMaxWorkers];
+		for (u16 w = 1; w < workers; ++w)
+		{
+			thrd_create(&threads[w], SCHEDULER_worker, &sched.workers_[w]);
+		}
+		SCHEDULER_worker(&sched.workers_[0]);
+		for (u16 w = 1; w < workers; ++w)
+		{
+			thrd_join(threads[w], NULL);
+		}
+		elapsed += COMPARATIVE_now() - time_start;
+		sorted = sorted && BENCH_isSorted(vectors);
+	}
+
+	u32 tasks = 0;
+	u32 attempts = 0;
+	u32 steals = 0;
+	for (u16 w = 0; w < workers; ++w)
+	{
+		tasks += sched.workers_[w].tasks_;
+		attempts += sched.workers_[w].steal_attempts_;
+		steals += sched.workers_[w].steals_;
+		sched.workers_[w].deque_->ops_->destroy(sched.workers_[w].deque_);
+	}
+	char label[64];
+	snprintf(label, sizeof(label), "Work-stealing quicksort %d workers", workers);
+	COMPARATIVE_printResult(label, (u32)kRuns * kVectors * kElements, elapsed);
+	printf("    %.1f tasks per run, %.1f steals per run, %.1f%% of steal attempts succeed\n",
+		(double)tasks / kRuns, (double)steals / kRuns, 0 == attempts ? 0.0 : 100.0 * steals / attempts);
+	if (False == sorted)
+		printf("    ERROR: vectors not sorted\n");
+}
+
+int main()
+{
+	Vector *vectors[kVectors];
+	for (u16 v = 0; v < kVectors; ++v)
+	{
+		vectors[v] = VECTOR_create(kElements);
+		if (NULL == vectors[v])
+		{
+			printf("ERROR: cannot create the vectors\n");
+			return -1;
+		}
+	}
+	const u16 worker_counts[] = { 1, 2, 4, 8 };
+	printf("%d runs sorting %d Vectors of %d elements (ops = elements sorted)\n", kRuns, kVectors, kElements);
+	calculateTimeSequential(vectors);
+	for (u16 i = 0; i < sizeof(worker_counts) / sizeof(worker_counts[0]); ++i)
+	{
+		calculateTimeScheduler(vectors, worker_counts[i]);
+	}
+	for (u16 v = 0; v < kVectors; ++v)
+	{
+		// the keys are not MM blocks: drop them before destroying
+		vectors[v]->ops_->softReset(vectors[v]);
+		vectors[v]->ops_->destroy(vectors[v]);
+	}
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,346 @@
+/**
+ * @file logger.c
+ * @brief
+ * @author <mazcunyanbla@esat-alumni.com> <calatayudbri@esat-alumni.com>
+ * @date 2024-08-05
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "common_def.h"
+#include "logger.h"
+#include "file_map.h"
+
+// Output buffered by the flusher between two writes, and room kept for one record
+#define kLogBufferBytes (64 * 1024)
+#define kLogRecordBytes 1024
+
+// Ring of a thread, single producer (the thread) and single consumer (the
+// flusher). Allocated from the OS pages: kLogRingRecords records of 64
+// bytes take 256 KB, more than the largest block of the MM (64 KB).
+typedef struct log_ring_s
+{
+  _Atomic u32 head_;   // next record to format (flusher)
+  u8 pad_head_[CACHE_LINE_SIZE - sizeof(_Atomic u32)];
+  _Atomic u32 tail_;   // next free record (thread)
+  u32 cached_head_;    // thread's last seen head_
+  u8 pad_tail_[CACHE_LINE_SIZE - sizeof(_Atomic u32) - sizeof(u32)];
+  u32 id_;
+  struct log_ring_s *next_;
+  LogRecord records_[kLogRingRecords];
+} LogRing;
+
+static const char *kLogLevelNames[] = {"DEBUG", "INFO", "WARNING", "ERROR"};
+
+static LogRing *_Atomic rings = NULL;
+static _Atomic u32 ring_count = 0;
+// Every start invalidates the rings of the previous run kept by the threads
+static _Atomic u32 generation = 0;
+static _Thread_local LogRing *thread_ring = NULL;
+static _Thread_local u32 thread_generation = 0;
+
+static FILE *output_file = NULL;
+static thrd_t flusher;
+static _Atomic boolean running = False;
+static _Atomic boolean stopping = False;
+static _Atomic u32 dropped = 0;
+static _Atomic u64 flush_requests = 0;
+static _Atomic u64 flushed = 0;
+static char output_buffer[kLogBufferBytes];
+
+// Returns the ring of the calling thread, registering it the first time
+static LogRing *LOGGER_ring()
+{
+  u32 current = atomic_load_explicit(&generation, memory_order_acquire);
+  if (NULL != thread_ring && current == thread_generation)
+  {
+    return thread_ring;
+  }
+  LogRing *ring = FILEMAP_pagesAlloc(sizeof(LogRing));
+  if (NULL == ring)
+  {
+    return NULL;
+  }
+  ring->id_ = atomic_fetch_add(&ring_count, 1) + 1;
+  ring->next_ = atomic_load(&rings);
+  while (!atomic_compare_exchange_weak(&rings, &ring->next_, ring));
+  thread_ring = ring;
+  thread_generation = current;
+  return ring;
+}
+
+// Formats one record at buffer, never more than bytes, returns the length written
+static u32 LOGGER_format(char *buffer, u32 bytes, u16 level, u32 thread, const char *format, u16 count, const u64 *args)
+{
+  int written = 0 == thread ? snprintf(buffer, bytes, "[%s] ", kLogLevelNames[level & 3])
+                            : snprintf(buffer, bytes, "[%s][thread %u] ", kLogLevelNames[level & 3], thread);
+  u32 length = written > 0 ? (u32)written : 0;
+  u16 next = 0;
+  const char *c = format;
+  while ('\0' != *c && length + 1 < bytes)
+  {
+    if ('%' != *c)
+    {
+      buffer[length++] = *c++;
+      continue;
+    }
+    // %[flags][width][.precision][length]conversion, the length is read and
+    // replaced with ll to print the argument widened to 64 bits
+    const char *start = c++;
+    char spec[32];
+    u32 spec_length = 0;
+    spec[spec_length++] = '%';
+    while ('\0' != *c && NULL != strchr("-+ #0123456789.", *c) && spec_length < sizeof(spec) - 4)
+    {
+      spec[spec_length++] = *c++;
+    }
+    u16 modifier = 0; // 0 int, 1 short, 2 char, 3 64 bits
+    while ('\0' != *c && NULL != strchr("hlLqjzt", *c))
+    {
+      modifier = 'h' == *c ? (1 == modifier ? 2 : 1) : 3;
+      c++;
+    }
+    char conversion = *c;
+    if ('\0' == conversion)
+    {
+      break;
+    }
+    c++;
+    if ('%' == conversion)
+    {
+      buffer[length++] = '%';
+      continue;
+    }
+    if (next >= count || NULL == strchr("diuxXocfFeEgGaAsp", conversion))
+    {
+      // no argument left or not supported: printed as it is
+      u32 text = (u32)(c - start);
+      text = text < bytes - 1 - length ? text : bytes - 1 - length;
+      memcpy(buffer + length, start, text);
+      length += text;
+      continue;
+    }
+    u64 arg = args[next++];
+    if (NULL != strchr("diuxXo", conversion))
+    {
+      spec[spec_length++] = 'l';
+      spec[spec_length++] = 'l';
+    }
+    spec[spec_length++] = conversion;
+    spec[spec_length] = '\0';
+    switch (conversion)
+    {
+    case 'd':
+    case 'i':
+    {
+      long long value = 0 == modifier ? (int)arg : 1 == modifier ? (short)arg : 2 == modifier ? (signed char)arg : (long long)arg;
+      written = snprintf(buffer + length, bytes - length, spec, value);
+      break;
+    }
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    {
+      unsigned long long value = 0 == modifier ? (unsigned int)arg : 1 == modifier ? (unsigned short)arg :
+                                 2 == modifier ? (unsigned char)arg : (unsigned long long)arg;
+      written = snprintf(buffer + length, bytes - length, spec, value);
+      break;
+    }
+    case 'c':
+      written = snprintf(buffer + length, bytes - length, spec, (int)arg);
+      break;
+    case 's':
+      written = snprintf(buffer + length, bytes - length, spec, 0 == arg ? "(null)" : (const char *)(uintptr_t)arg);
+      break;
+    case 'p':
+      written = snprintf(buffer + length, bytes - length, spec, (void *)(uintptr_t)arg);
+      break;
+    default:
+    {
+      double value;
+      memcpy(&value, &arg, sizeof(value));
+      written = snprintf(buffer + length, bytes - length, spec, value);
+      break;
+    }
+    }
+    if (written > 0)
+    {
+      length += (u32)written < bytes - 1 - length ? (u32)written : bytes - 1 - length;
+    }
+  }
+  buffer[length++] = '\n';
+  return length;
+}
+
+// Formats every pending record of every ring, returns the number of records
+static u32 LOGGER_drain(u32 *buffered)
+{
+  u32 records = 0;
+  for (LogRing *ring = atomic_load(&rings); NULL != ring; ring = ring->next_)
+  {
+    u32 head = atomic_load_explicit(&ring->head_, memory_order_relaxed);
+    u32 tail = atomic_load_explicit(&ring->tail_, memory_order_acquire);
+    for (; head != tail; ++head)
+    {
+      if (*buffered > kLogBufferBytes - kLogRecordBytes)
+      {
+        fwrite(output_buffer, 1, *buffered, output_file);
+        *buffered = 0;
+      }
+      LogRecord *record = &ring->records_[head & (kLogRingRecords - 1)];
+      *buffered += LOGGER_format(output_buffer + *buffered, kLogRecordBytes, record->level_, ring->id_,
+                                 record->format_, record->count_, record->args_);
+      records++;
+      // the record is formatted, its slot can be reused
+      atomic_store_explicit(&ring->head_, head + 1, memory_order_release);
+    }
+  }
+  if (0 != *buffered)
+  {
+    fwrite(output_buffer, 1, *buffered, output_file);
+    *buffered = 0;
+  }
+  return records;
+}
+
+// Flusher thread: drains the rings, flushes the file when idle or asked for
+static int LOGGER_flusher(void *unused)
+{
+  (void)unused;
+  u32 buffered = 0;
+  boolean pending = False;
+  for (;;)
+  {
+    // read before draining, so every record logged before them is drained
+    u64 requests = atomic_load(&flush_requests);
+    boolean stop = atomic_load(&stopping);
+    u32 records = LOGGER_drain(&buffered);
+    pending = 0 != records ? True : pending;
+    if (requests != atomic_load_explicit(&flushed, memory_order_relaxed) || (0 == records && True == pending))
+    {
+      fflush(output_file);
+      pending = False;
+      atomic_store(&flushed, requests);
+    }
+    if (True == stop)
+    {
+      break;
+    }
+    if (0 == records)
+    {
+      thrd_sleep(&(struct timespec){.tv_nsec = 1000000}, NULL);
+    }
+  }
+  fflush(output_file);
+  return 0;
+}
+
+s16 LOGGER_start(FILE *output)
+{
+  if (NULL == output)
+  {
+    return kErrorCode_Null;
+  }
+  if (True == atomic_load(&running))
+  {
+    return kErrorCode_Logger;
+  }
+  output_file = output;
+  atomic_store(&dropped, 0);
+  atomic_store(&ring_count, 0);
+  atomic_store(&flush_requests, 0);
+  atomic_store(&flushed, 0);
+  atomic_store(&stopping, False);
+  atomic_fetch_add(&generation, 1);
+  if (thrd_success != thrd_create(&flusher, LOGGER_flusher, NULL))
+  {
+    return kErrorCode_Logger;
+  }
+  atomic_store(&running, True);
+  return kErrorCode_Ok;
+}
+
+s16 LOGGER_stop()
+{
+  if (True != atomic_load(&running))
+  {
+    return kErrorCode_Logger;
+  }
+  atomic_store(&running, False);
+  atomic_store(&stopping, True);
+  thrd_join(flusher, NULL);
+  LogRing *ring = atomic_exchange(&rings, NULL);
+  while (NULL != ring)
+  {
+    LogRing *next = ring->next_;
+    FILEMAP_pagesFree(ring, sizeof(LogRing));
+    ring = next;
+  }
+  output_file = NULL;
+  return kErrorCode_Ok;
+}
+
+s16 LOGGER_flush()
+{
+  if (True != atomic_load(&running))
+  {
+    return kErrorCode_Logger;
+  }
+  u64 ticket = atomic_fetch_add(&flush_requests, 1) + 1;
+  while (atomic_load(&flushed) < ticket)
+  {
+    thrd_yield();
+  }
+  return kErrorCode_Ok;
+}
+
+u32 LOGGER_dropped()
+{
+  return atomic_load(&dropped);
+}
+
+s16 LOGGER_write(u16 level, const char *format, u16 count, const u64 *args)
+{
+  if (NULL == format || (0 != count && NULL == args))
+  {
+    return kErrorCode_Null;
+  }
+  count = count < kLogMaxArguments ? count : kLogMaxArguments;
+  if (True != atomic_load_explicit(&running, memory_order_relaxed))
+  {
+    char buffer[kLogRecordBytes];
+    u32 length = LOGGER_format(buffer, sizeof(buffer), level, 0, format, count, args);
+    fwrite(buffer, 1, length, stdout);
+    return kErrorCode_Ok;
+  }
+  LogRing *ring = LOGGER_ring();
+  if (NULL == ring)
+  {
+    return kErrorCode_Memory;
+  }
+  u32 tail = atomic_load_explicit(&ring->tail_, memory_order_relaxed);
+  if (tail - ring->cached_head_ >= kLogRingRecords)
+  {
+    ring->cached_head_ = atomic_load_explicit(&ring->head_, memory_order_acquire);
+    if (tail - ring->cached_head_ >= kLogRingRecords)
+    {
+      atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+      return kErrorCode_LogFull;
+    }
+  }
+  LogRecord *record = &ring->records_[tail & (kLogRingRecords - 1)];
+  record->format_ = format;
+  record->level_ = level;
+  record->count_ = count;
+  if (0 != count)
+  {
+    memcpy(record->args_, args, count * sizeof(u64));
+  }
+  atomic_store_explicit(&ring->tail_, tail + 1, memory_order_release);
+  return kErrorCode_Ok;
+}
@@ -0,0 +1,198 @@
+// test_arena.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the arena allocator and the containers bound to it
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adt_arena.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u32 kChunkSize = 4096;
+const u16 kCapacity = 20;
+const u16 kRequests = 50;
+
+static char *TEST_newString(Arena *arena, const char *text)
+{
+	u32 bytes = (u32)strlen(text) + 1;
+	char *copy = arena->ops_->alloc(arena, bytes);
+	memcpy(copy, text, bytes);
+	return copy;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	Arena *arena = ARENA_create(kChunkSize);
+	if (NULL == arena) {
+		printf("\n create returned a null arena\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Arena: %zu\n", sizeof(Arena));
+	printf("  + ArenaChunk: %zu\n", sizeof(ArenaChunk));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Alloc\n");
+	u8 *first = arena->ops_->alloc(arena, 3);
+	u8 *second = arena->ops_->alloc(arena, 5);
+	if (NULL == first || NULL == second || 0 != (uintptr_t)second % kArenaAlignment ||
+		second - first != kArenaAlignment)
+	{
+		printf("  ==> ERROR: allocations are not bumped and aligned\n");
+	}
+	void *whole = arena->ops_->alloc(arena, kChunkSize);
+	printf("\t used %u of %u bytes after a whole chunk\n", arena->ops_->used(arena), arena->ops_->capacity(arena));
+	if (NULL == whole || 2 * kChunkSize != arena->ops_->capacity(arena))
+	{
+		printf("  ==> ERROR: a full chunk must chain a new one\n");
+	}
+	arena->ops_->print(arena);
+
+	printf("\n\n# Test Reset keeps the chunks\n");
+	error_type = arena->ops_->reset(arena);
+	TESTBASE_printFunctionResult(arena, (u8 *)"reset arena", error_type);
+	if (0 != arena->ops_->used(arena) || 2 * kChunkSize != arena->ops_->capacity(arena) ||
+		first != arena->ops_->alloc(arena, 3))
+	{
+		printf("  ==> ERROR: reset must rewind to the first chunk\n");
+	}
+	arena->ops_->reset(arena);
+
+	printf("\n\n# Test Vector in arena\n");
+	Vector *vector = VECTOR_createInArena(kCapacity, arena);
+	if (NULL == vector) {
+		printf("\n createInArena returned a null vector\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = vector->ops_->insertLast(vector, TEST_newString(arena, TestData.storage_ptr_test_A[i]),
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TESTBASE_printFunctionResult(vector, (u8 *)"insertLast vector", error_type);
+	}
+	error_type = vector->ops_->insertFirst(vector, TEST_newString(arena, "first"), 6);
+	TESTBASE_printFunctionResult(vector, (u8 *)"insertFirst vector", error_type);
+	printf("\t extractAt 1: %s\n", (char *)vector->ops_->extractAt(vector, 1));
+	error_type = vector->ops_->resize(vector, kCapacity * 2);
+	TESTBASE_printFunctionResult(vector, (u8 *)"resize vector", error_type);
+	Vector *other = VECTOR_createInArena(kCapacity, arena);
+	other->ops_->insertLast(other, TEST_newString(arena, "copied"), 7);
+	error_type = vector->ops_->concat(vector, other);
+	TESTBASE_printFunctionResult(vector, (u8 *)"concat vector + other", error_type);
+	vector->ops_->print(vector);
+	if (kNumberOfStoragePtrTest_A + 1 != vector->ops_->length(vector) ||
+		0 != strcmp("copied", vector->ops_->last(vector)))
+	{
+		printf("  ==> ERROR: wrong vector content\n");
+	}
+
+	printf("\n\n# Test List in arena\n");
+	List *list = LIST_createInArena(kCapacity, arena);
+	if (NULL == list) {
+		printf("\n createInArena returned a null list\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		error_type = list->ops_->insertFirst(list, TEST_newString(arena, TestData.storage_ptr_test_B[i]),
+			(u16)(strlen(TestData.storage_ptr_test_B[i]) + 1));
+		TESTBASE_printFunctionResult(list, (u8 *)"insertFirst list", error_type);
+	}
+	error_type = list->ops_->insertAt(list, TEST_newString(arena, "middle"), 7, 2);
+	TESTBASE_printFunctionResult(list, (u8 *)"insertAt list", error_type);
+	printf("\t extractFirst: %s\n", (char *)list->ops_->extractFirst(list));
+	printf("\t extractLast: %s\n", (char *)list->ops_->extractLast(list));
+	printf("\t extractAt 1: %s\n", (char *)list->ops_->extractAt(list, 1));
+	error_type = list->ops_->resize(list, 2);
+	TESTBASE_printFunctionResult(list, (u8 *)"resize list to 2", error_type);
+	list->ops_->print(list);
+	if (2 != list->ops_->length(list))
+	{
+		printf("  ==> ERROR: wrong list length\n");
+	}
+
+	printf("\n\n# Test Destroy is a no-op, the arena reset frees everything\n");
+	u32 used = arena->ops_->used(arena);
+	error_type = vector->ops_->destroy(vector);
+	TESTBASE_printFunctionResult(vector, (u8 *)"destroy vector", error_type);
+	error_type = other->ops_->destroy(other);
+	TESTBASE_printFunctionResult(other, (u8 *)"destroy other", error_type);
+	error_type = list->ops_->destroy(list);
+	TESTBASE_printFunctionResult(list, (u8 *)"destroy list", error_type);
+	if (used != arena->ops_->used(arena))
+	{
+		printf("  ==> ERROR: destroy changed the arena\n");
+	}
+	arena->ops_->print(arena);
+	arena->ops_->reset(arena);
+
+	printf("\n\n# Test Request loop reuses the chunks\n");
+	u32 capacity = 0;
+	for (u16 r = 0; r < kRequests; ++r)
+	{
+		Vector *v = VECTOR_createInArena(kCapacity, arena);
+		List *l = LIST_createInArena(kCapacity, arena);
+		for (u16 i = 0; i < kCapacity; ++i)
+		{
+			u32 *value = arena->ops_->alloc(arena, sizeof(u32));
+			*value = i;
+			v->ops_->insertLast(v, value, sizeof(u32));
+			l->ops_->insertLast(l, value, sizeof(u32));
+		}
+		v->ops_->destroy(v);
+		l->ops_->destroy(l);
+		arena->ops_->reset(arena);
+		if (0 == r)
+		{
+			capacity = arena->ops_->capacity(arena);
+		}
+	}
+	printf("\t %d requests, arena capacity %u bytes\n", kRequests, arena->ops_->capacity(arena));
+	if (capacity != arena->ops_->capacity(arena))
+	{
+		printf("  ==> ERROR: the arena keeps growing\n");
+	}
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != ARENA_create(0) || NULL != ARENA_create(kArenaMaxChunkSize + 1))
+	{
+		printf("ERROR: trying to create an arena with an invalid chunk size\n");
+	}
+	if (NULL != arena->ops_->alloc(arena, 0) || NULL != arena->ops_->alloc(arena, kChunkSize + 1) ||
+		NULL != arena->ops_->alloc(NULL, 4))
+	{
+		printf("ERROR: invalid allocations return memory\n");
+	}
+	if (NULL != VECTOR_createInArena(kCapacity, NULL) || NULL != LIST_createInArena(0, arena))
+	{
+		printf("ERROR: containers created without arena or capacity\n");
+	}
+	error_type = arena->ops_->reset(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"reset NULL (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = arena->ops_->destroy(arena);
+	TESTBASE_printFunctionResult(arena, (u8 *)"destroy arena", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,293 @@
+// test_avltree.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the AVL tree: insertions in shuffled and sorted order
+// keeping the tree balanced, lookups, select (at) and rank, lower bounds
+// and walks with a Cursor both ways, erasures down to an empty tree, and
+// strings ordered by their bytes
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_avltree.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kElements 20000
+
+// Payloads of the big battery, not owned by the tree: emptied with softReset
+static u32 values[kElements];
+static u32 order[kElements];
+
+// Copy of a test string owned by the tree, terminator included
+static void *TEST_copy(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MM->malloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Orders the u32 payloads as integers
+static s32 TEST_compareU32(const void *a, u16 a_bytes, const void *b, u16 b_bytes)
+{
+	(void)a_bytes;
+	(void)b_bytes;
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Checks heights, counts and balance of a subtree, returning its height
+static s16 TEST_check(AVLTreeNode *node, boolean *valid)
+{
+	if (NULL == node)
+	{
+		return 0;
+	}
+	s16 left = TEST_check(node->left_, valid);
+	s16 right = TEST_check(node->right_, valid);
+	u32 count = (NULL == node->left_ ? 0 : node->left_->count_) + (NULL == node->right_ ? 0 : node->right_->count_) + 1;
+	s16 height = (left > right ? left : right) + 1;
+	if (left - right > 1 || right - left > 1 || height != node->height_ || count != node->count_)
+	{
+		*valid = False;
+	}
+	return height;
+}
+
+// Checks that the tree holds count values from from, every step, both ways
+static void TEST_order(const char *name, AVLTree *tree, u32 from, u32 count, u32 step)
+{
+	Cursor cursor;
+	boolean valid = True;
+	u32 visited = 0;
+	s16 height = TEST_check(tree->root_, &valid);
+	printf("\t %s: %u elements, height %d\n", name, tree->ops_->length(tree), height);
+	if (True != valid)
+	{
+		printf("  ==> ERROR: %s is not balanced or has wrong subtree counts\n", name);
+	}
+	if (count != tree->ops_->length(tree))
+	{
+		printf("  ==> ERROR: %s must have %u elements\n", name, count);
+		return;
+	}
+	for (tree->ops_->begin(tree, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor), ++visited)
+	{
+		if (&values[from + visited * step] != CURSOR_get(&cursor) || &values[from + visited * step] != tree->ops_->at(tree, visited))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %u\n", name, visited);
+			return;
+		}
+	}
+	for (tree->ops_->rbegin(tree, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor), --visited)
+	{
+		if (&values[from + (visited - 1) * step] != CURSOR_get(&cursor))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %u walking back\n", name, visited - 1);
+			return;
+		}
+	}
+	if (0 != visited)
+	{
+		printf("  ==> ERROR: the cursors must visit the %u elements of %s\n", count, name);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+	srand(1);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		// even numbers, so there are gaps for the bounds
+		values[i] = i * 2;
+		order[i] = i;
+	}
+	for (u32 i = kElements - 1; i > 0; --i)
+	{
+		u32 j = (u32)rand() % (i + 1);
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test insert in shuffled order\n");
+	AVLTree *tree = AVLTREE_create(TEST_compareU32);
+	if (NULL == tree)
+	{
+		printf("\n create returned a null tree\n");
+		return -1;
+	}
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		error_type = tree->ops_->insert(tree, &values[order[i]], sizeof(u32));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert", error_type);
+	TEST_order("inserted", tree, 0, kElements, 1);
+	u32 copy = values[7];
+	error_type = tree->ops_->insert(tree, &copy, sizeof(u32));
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert element already inserted (NOT VALID)", error_type);
+	if (&values[0] != tree->ops_->first(tree) || &values[kElements - 1] != tree->ops_->last(tree) || kElements != tree->ops_->length(tree))
+	{
+		printf("  ==> ERROR: wrong first or last element\n");
+	}
+
+	printf("\n\n# Test find, rank and lower bound\n");
+	u32 found = 0;
+	u32 ranked = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		u32 key = i * 2;
+		u32 odd = key + 1;
+		found += &values[i] == tree->ops_->find(tree, &key, sizeof(u32)) ? 1 : 0;
+		ranked += i == tree->ops_->rank(tree, &key, sizeof(u32)) && i + 1 == tree->ops_->rank(tree, &odd, sizeof(u32)) ? 1 : 0;
+	}
+	printf("\t found %u elements, %u ranks right\n", found, ranked);
+	if (kElements != found || kElements != ranked)
+	{
+		printf("  ==> ERROR: find and rank must work for every element\n");
+	}
+	u32 odd = 2 * 1234 + 1;
+	if (NULL != tree->ops_->find(tree, &odd, sizeof(u32)) || NULL != tree->ops_->at(tree, kElements))
+	{
+		printf("  ==> ERROR: find and at must return NULL for missing elements\n");
+	}
+	error_type = tree->ops_->lowerBound(tree, &odd, sizeof(u32), &cursor);
+	TESTBASE_printFunctionResult(tree, (u8 *)"lowerBound between two elements", error_type);
+	if (&values[1235] != CURSOR_get(&cursor))
+	{
+		printf("  ==> ERROR: the lower bound of a missing element must be the next one\n");
+	}
+	u32 scanned = 0;
+	for (; True == CURSOR_valid(&cursor) && *(u32 *)CURSOR_get(&cursor) < 2 * 9000; CURSOR_next(&cursor))
+	{
+		++scanned;
+	}
+	printf("\t walked %u elements from %u up to %d\n", scanned, odd, 2 * 9000);
+	if (9000 - 1235 != scanned)
+	{
+		printf("  ==> ERROR: the walk must visit the elements of the range once\n");
+	}
+	u32 past = 2 * kElements;
+	tree->ops_->lowerBound(tree, &past, sizeof(u32), &cursor);
+	if (True == CURSOR_valid(&cursor) || kElements != tree->ops_->rank(tree, &past, sizeof(u32)))
+	{
+		printf("  ==> ERROR: the lower bound past the last element must be invalid\n");
+	}
+
+	printf("\n\n# Test erase down to an empty tree\n");
+	u32 erased = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		if (0 == order[i] % 3)
+		{
+			erased += &values[order[i]] == tree->ops_->erase(tree, &values[order[i]], sizeof(u32)) ? 1 : 0;
+		}
+	}
+	printf("\t erased %u elements\n", erased);
+	if ((kElements + 2) / 3 != erased)
+	{
+		printf("  ==> ERROR: erase must return the elements erased\n");
+	}
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		if (1 == order[i] % 3)
+		{
+			tree->ops_->erase(tree, &values[order[i]], sizeof(u32));
+		}
+	}
+	TEST_order("erased two of every three", tree, 2, kElements / 3, 3);
+	if (NULL != tree->ops_->erase(tree, &values[0], sizeof(u32)))
+	{
+		printf("  ==> ERROR: erasing an element twice must return NULL\n");
+	}
+	for (u32 i = 2; i < kElements; i += 3)
+	{
+		tree->ops_->erase(tree, &values[i], sizeof(u32));
+	}
+	if (True != tree->ops_->isEmpty(tree) || NULL != tree->ops_->first(tree) || NULL != tree->ops_->last(tree) ||
+		0 != tree->pool_->ops_->live(tree->pool_))
+	{
+		printf("  ==> ERROR: an empty tree must give its nodes back\n");
+	}
+	tree->ops_->begin(tree, &cursor);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: begin on an empty tree must be invalid\n");
+	}
+
+	printf("\n\n# Test insert in order\n");
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		tree->ops_->insert(tree, &values[i], sizeof(u32));
+	}
+	TEST_order("inserted in order", tree, 0, kElements, 1);
+	error_type = tree->ops_->softReset(tree);
+	TESTBASE_printFunctionResult(tree, (u8 *)"softReset", error_type);
+
+	printf("\n\n# Test strings and reset\n");
+	AVLTree *strings = AVLTREE_create(NULL);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		strings->ops_->insert(strings, TEST_copy(TestData.storage_ptr_test_A[i]), (u16)strlen(TestData.storage_ptr_test_A[i]));
+	}
+	// "1024" < "128" < "16384" < ... < "8192" compared as bytes
+	if (kNumberOfStoragePtrTest_A != strings->ops_->length(strings) || 0 != strncmp(strings->ops_->first(strings), "1024", 4) ||
+		0 != strncmp(strings->ops_->at(strings, 1), "128", 3) || 0 != strncmp(strings->ops_->last(strings), "8192", 4) ||
+		NULL == strings->ops_->find(strings, "4096", 4) || NULL != strings->ops_->find(strings, "409", 3))
+	{
+		printf("  ==> ERROR: the strings must be ordered by their bytes\n");
+	}
+	strings->ops_->print(strings);
+	error_type = strings->ops_->reset(strings);
+	TESTBASE_printFunctionResult(strings, (u8 *)"reset", error_type);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = tree->ops_->insert(NULL, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insert NULL (NOT VALID)", error_type);
+	error_type = tree->ops_->insert(tree, NULL, sizeof(u32));
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert data NULL (NOT VALID)", error_type);
+	error_type = tree->ops_->insert(tree, &values[0], 0);
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert bytes 0 (NOT VALID)", error_type);
+	error_type = tree->ops_->lowerBound(NULL, &values[0], sizeof(u32), &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"lowerBound NULL (NOT VALID)", error_type);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: lowerBound on a NULL tree must leave the cursor invalid\n");
+	}
+	error_type = tree->ops_->begin(tree, NULL);
+	TESTBASE_printFunctionResult(tree, (u8 *)"begin cursor NULL (NOT VALID)", error_type);
+	if (NULL != tree->ops_->find(NULL, &values[0], sizeof(u32)) || NULL != tree->ops_->find(tree, NULL, sizeof(u32)) ||
+		NULL != tree->ops_->erase(tree, &values[0], sizeof(u32)) || NULL != tree->ops_->at(NULL, 0) ||
+		NULL != tree->ops_->at(tree, 0) || 0 != tree->ops_->rank(NULL, &values[0], sizeof(u32)))
+	{
+		printf("  ==> ERROR: find, at and erase on an empty or NULL tree must return NULL\n");
+	}
+	error_type = tree->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	tree->ops_->destroy(tree);
+	strings->ops_->destroy(strings);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
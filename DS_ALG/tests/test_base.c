@@ -290,6 +290,102 @@ void TESTBASE_printFunctionResult(void *address, u8 *msg, s16 error_type)
 	case kErrorCode_NotEnoughCapacity:
 		printf("[Not enought capacity]");
 		break;
+	case kErrorCode_StackNull:
+		printf("[Stack NULL]");
+		break;
+	case kErrorCode_StackFull:
+		printf("[Stack Full]");
+		break;
+	case kErrorCode_QueueNull:
+		printf("[Queue NULL]");
+		break;
+	case kErrorCode_QueueFull:
+		printf("[Queue Full]");
+		break;
+	case kErrorCode_QueueEmpty:
+		printf("[Queue Empty]");
+		break;
+	case kErrorCode_DequeNull:
+		printf("[Deque NULL]");
+		break;
+	case kErrorCode_DequeFull:
+		printf("[Deque Full]");
+		break;
+	case kErrorCode_EpochNull:
+		printf("[Epoch NULL]");
+		break;
+	case kErrorCode_EpochPinned:
+		printf("[Epoch still pinned]");
+		break;
+	case kErrorCode_EpochNotPinned:
+		printf("[Epoch not pinned]");
+		break;
+	case kErrorCode_ArenaNull:
+		printf("[Arena NULL]");
+		break;
+	case kErrorCode_MemoryStackNull:
+		printf("[Memory stack NULL]");
+		break;
+	case kErrorCode_MemoryStackMarker:
+		printf("[Memory stack marker out of range]");
+		break;
+	case kErrorCode_MemoryStackGuard:
+		printf("[Memory stack guard bytes overwritten]");
+		break;
+	case kErrorCode_File:
+		printf("[File cannot be opened, mapped or written]");
+		break;
+	case kErrorCode_FileFormat:
+		printf("[File is not a valid binary container]");
+		break;
+	case kErrorCode_ReadOnly:
+		printf("[Container is read only]");
+		break;
+	case kErrorCode_StreamNull:
+		printf("[Stream NULL]");
+		break;
+	case kErrorCode_StreamEnd:
+		printf("[End of the stream]");
+		break;
+	case kErrorCode_StreamSlice:
+		printf("[Data is not a live slice of the stream]");
+		break;
+	case kErrorCode_Logger:
+		printf("[Logger not running or already running]");
+		break;
+	case kErrorCode_LogFull:
+		printf("[Log ring full, record dropped]");
+		break;
+	case kErrorCode_PoolNull:
+		printf("[Pool NULL]");
+		break;
+	case kErrorCode_BPTreeNull:
+		printf("[B+ tree NULL]");
+		break;
+	case kErrorCode_KeyNotFound:
+		printf("[Key not found]");
+		break;
+	case kErrorCode_KeyExists:
+		printf("[Key already inserted]");
+		break;
+	case kErrorCode_KeyOrder:
+		printf("[Keys not sorted]");
+		break;
+	case kErrorCode_SkipListNull:
+		printf("[Skip list NULL]");
+		break;
+	case kErrorCode_AVLTreeNull:
+		printf("[AVL tree NULL]");
+		break;
+	case kErrorCode_LRUCacheNull:
+		printf("[LRU cache NULL]");
+		break;
+	case kErrorCode_BloomNull:
+		printf("[Bloom filter NULL]");
+		break;
+	case kErrorCode_BloomShape:
+		printf("[Bloom filters of different shape]");
+		break;
 	default:
 		strcpy((char *)error_msg, "");
 		printf("FAIL with error %d (%s)", error_type, error_msg);
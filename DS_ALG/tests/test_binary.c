@@ -0,0 +1,233 @@
+// test_binary.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the binary files: save of Vector, List, DLList and Queue,
+// the read-only containers of mmapLoad and the rejection of broken files
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_binary.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u16 kCapacity = 10;
+
+const char *kVectorFile = "test_binary_vector.bin";
+const char *kListFile = "test_binary_list.bin";
+const char *kDLListFile = "test_binary_dllist.bin";
+const char *kQueueFile = "test_binary_queue.bin";
+const char *kEmptyFile = "test_binary_empty.bin";
+const char *kBrokenFile = "test_binary_broken.bin";
+
+// Checks that the cursor walks copies of the strings data[0..count) in order
+static void TEST_walk(const char *name, Cursor *cursor, void **data, u16 count, s16 step)
+{
+	u16 visited = 0;
+	for (s16 i = step > 0 ? 0 : count - 1; True == CURSOR_valid(cursor); CURSOR_next(cursor), i += step)
+	{
+		MemoryNode *node = CURSOR_node(cursor);
+		if (visited >= count || node->data_ == data[i] || node->size_ != strlen(data[i]) + 1 ||
+			0 != strcmp(node->data_, data[i]))
+		{
+			printf("  ==> ERROR: %s maps the wrong element at step %d\n", name, visited);
+			return;
+		}
+		visited++;
+	}
+	printf("\t %s mapped %d elements\n", name, visited);
+	if (visited != count)
+	{
+		printf("  ==> ERROR: %s must map %d elements\n", name, count);
+	}
+}
+
+// Writes the first bytes of a file to kBrokenFile
+static void TEST_truncate(const char *path, u32 bytes)
+{
+	u8 buffer[512];
+	FILE *file = fopen(path, "rb");
+	u32 read = (u32)fread(buffer, 1, sizeof(buffer), file);
+	fclose(file);
+	file = fopen(kBrokenFile, "wb");
+	fwrite(buffer, 1, bytes < read ? bytes : read, file);
+	fclose(file);
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+
+	Vector *vector = VECTOR_create(kCapacity);
+	List *list = LIST_create(kCapacity);
+	DLList *dllist = DLList_create(kCapacity);
+	Queue *queue = QUEUE_create(kCapacity);
+	Vector *empty = VECTOR_create(kCapacity);
+	if (NULL == vector || NULL == list || NULL == dllist || NULL == queue || NULL == empty) {
+		printf("\n create returned a null container\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		vector->ops_->insertLast(vector, TestData.storage_ptr_test_A[i], (u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		u16 bytes = (u16)(strlen(TestData.storage_ptr_test_B[i]) + 1);
+		list->ops_->insertLast(list, TestData.storage_ptr_test_B[i], bytes);
+		queue->ops_->enqueue(queue, TestData.storage_ptr_test_B[i], bytes);
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		dllist->ops_->insertLast(dllist, TestData.storage_ptr_test_C[i], (u16)(strlen(TestData.storage_ptr_test_C[i]) + 1));
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test save\n");
+	error_type = BINARY_saveVector(vector, kVectorFile);
+	TESTBASE_printFunctionResult(vector, (u8 *)"saveVector", error_type);
+	error_type = BINARY_saveList(list, kListFile);
+	TESTBASE_printFunctionResult(list, (u8 *)"saveList", error_type);
+	error_type = BINARY_saveDLList(dllist, kDLListFile);
+	TESTBASE_printFunctionResult(dllist, (u8 *)"saveDLList", error_type);
+	error_type = BINARY_saveQueue(queue, kQueueFile);
+	TESTBASE_printFunctionResult(queue, (u8 *)"saveQueue", error_type);
+	error_type = BINARY_saveVector(empty, kEmptyFile);
+	TESTBASE_printFunctionResult(empty, (u8 *)"saveVector empty", error_type);
+
+	printf("\n\n# Test mmapLoad\n");
+	Vector *mapped_vector = BINARY_mmapLoadVector(kVectorFile);
+	List *mapped_list = BINARY_mmapLoadList(kListFile);
+	DLList *mapped_dllist = BINARY_mmapLoadDLList(kDLListFile);
+	Queue *mapped_queue = BINARY_mmapLoadQueue(kQueueFile);
+	DLList *vector_as_dllist = BINARY_mmapLoadDLList(kVectorFile);
+	Vector *mapped_empty = BINARY_mmapLoadVector(kEmptyFile);
+	if (NULL == mapped_vector || NULL == mapped_list || NULL == mapped_dllist || NULL == mapped_queue ||
+		NULL == vector_as_dllist || NULL == mapped_empty)
+	{
+		printf("  ==> ERROR: mmapLoad returned a null container\n");
+		return -1;
+	}
+	mapped_vector->ops_->begin(mapped_vector, &cursor);
+	TEST_walk("mapped vector", &cursor, TestData.storage_ptr_test_A, kNumberOfStoragePtrTest_A, 1);
+	mapped_list->ops_->begin(mapped_list, &cursor);
+	TEST_walk("mapped list", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, 1);
+	mapped_dllist->ops_->rbegin(mapped_dllist, &cursor);
+	TEST_walk("mapped dllist backwards", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, -1);
+	mapped_queue->ops_->begin(mapped_queue, &cursor);
+	TEST_walk("mapped queue", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, 1);
+	vector_as_dllist->ops_->begin(vector_as_dllist, &cursor);
+	TEST_walk("vector file as dllist", &cursor, TestData.storage_ptr_test_A, kNumberOfStoragePtrTest_A, 1);
+	mapped_empty->ops_->begin(mapped_empty, &cursor);
+	TEST_walk("mapped empty vector", &cursor, NULL, 0, 1);
+
+	printf("\t mapped vector length %d, capacity %d\n", mapped_vector->ops_->length(mapped_vector),
+		mapped_vector->ops_->capacity(mapped_vector));
+	if (kNumberOfStoragePtrTest_A != mapped_vector->ops_->length(mapped_vector) ||
+		True != mapped_vector->ops_->isFull(mapped_vector) || True != mapped_empty->ops_->isEmpty(mapped_empty))
+	{
+		printf("  ==> ERROR: wrong length of the mapped vectors\n");
+	}
+	if (0 != strcmp(mapped_vector->ops_->at(mapped_vector, 4), TestData.storage_ptr_test_A[4]) ||
+		0 != strcmp(mapped_list->ops_->last(mapped_list), TestData.storage_ptr_test_B[kNumberOfStoragePtrTest_B - 1]) ||
+		0 != strcmp(mapped_queue->ops_->front(mapped_queue), TestData.storage_ptr_test_B[0]))
+	{
+		printf("  ==> ERROR: wrong element read from a mapped container\n");
+	}
+
+	printf("\n\n# Test read only\n");
+	error_type = mapped_vector->ops_->insertLast(mapped_vector, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(mapped_vector, (u8 *)"insertLast mapped vector (NOT VALID)", error_type);
+	error_type = mapped_list->ops_->insertFirst(mapped_list, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(mapped_list, (u8 *)"insertFirst mapped list (NOT VALID)", error_type);
+	error_type = mapped_dllist->ops_->resize(mapped_dllist, kCapacity * 2);
+	TESTBASE_printFunctionResult(mapped_dllist, (u8 *)"resize mapped dllist (NOT VALID)", error_type);
+	error_type = mapped_vector->ops_->reset(mapped_vector);
+	TESTBASE_printFunctionResult(mapped_vector, (u8 *)"reset mapped vector (NOT VALID)", error_type);
+	error_type = mapped_queue->ops_->enqueue(mapped_queue, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(mapped_queue, (u8 *)"enqueue mapped queue (NOT VALID)", error_type);
+	error_type = mapped_list->ops_->concat(mapped_list, list);
+	TESTBASE_printFunctionResult(mapped_list, (u8 *)"concat into mapped list (NOT VALID)", error_type);
+	if (NULL != mapped_vector->ops_->extractFirst(mapped_vector) || NULL != mapped_list->ops_->extractAt(mapped_list, 1) ||
+		NULL != mapped_dllist->ops_->extractLast(mapped_dllist) || NULL != mapped_queue->ops_->dequeue(mapped_queue))
+	{
+		printf("  ==> ERROR: extractions from mapped containers must return NULL\n");
+	}
+	if (kNumberOfStoragePtrTest_B != mapped_queue->ops_->length(mapped_queue))
+	{
+		printf("  ==> ERROR: the mapped queue must keep its elements\n");
+	}
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = BINARY_saveVector(NULL, kVectorFile);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"saveVector NULL (NOT VALID)", error_type);
+	error_type = BINARY_saveQueue(NULL, kQueueFile);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"saveQueue NULL (NOT VALID)", error_type);
+	error_type = BINARY_saveList(list, NULL);
+	TESTBASE_printFunctionResult(list, (u8 *)"saveList path NULL (NOT VALID)", error_type);
+	error_type = BINARY_saveDLList(dllist, "missing_directory/test_binary.bin");
+	TESTBASE_printFunctionResult(dllist, (u8 *)"saveDLList to a missing directory (NOT VALID)", error_type);
+	error_type = mapped_vector->ops_->insertLast(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insertLast mapped vector NULL (NOT VALID)", error_type);
+	if (NULL != BINARY_mmapLoadVector(NULL) || NULL != BINARY_mmapLoadList("missing_file.bin"))
+	{
+		printf("  ==> ERROR: mmapLoad of a missing file must return NULL\n");
+	}
+	TEST_truncate(kVectorFile, 12);
+	if (NULL != BINARY_mmapLoadVector(kBrokenFile))
+	{
+		printf("  ==> ERROR: mmapLoad of a file shorter than its header must return NULL\n");
+	}
+	TEST_truncate(kListFile, 60);
+	if (NULL != BINARY_mmapLoadList(kBrokenFile))
+	{
+		printf("  ==> ERROR: mmapLoad of a truncated file must return NULL\n");
+	}
+	FILE *text = fopen(kBrokenFile, "wb");
+	fputs("0123456789abcdef0123456789abcdef", text);
+	fclose(text);
+	if (NULL != BINARY_mmapLoadQueue(kBrokenFile))
+	{
+		printf("  ==> ERROR: mmapLoad of a file that isn't binary must return NULL\n");
+	}
+
+	// Work is done, clean the system; the payloads belong to TestData
+	mapped_vector->ops_->destroy(mapped_vector);
+	mapped_list->ops_->destroy(mapped_list);
+	mapped_dllist->ops_->destroy(mapped_dllist);
+	mapped_queue->ops_->destroy(mapped_queue);
+	vector_as_dllist->ops_->destroy(vector_as_dllist);
+	mapped_empty->ops_->destroy(mapped_empty);
+	remove(kVectorFile);
+	remove(kListFile);
+	remove(kDLListFile);
+	remove(kQueueFile);
+	remove(kEmptyFile);
+	remove(kBrokenFile);
+
+	while (NULL != vector->ops_->extractLast(vector));
+	vector->ops_->destroy(vector);
+	empty->ops_->destroy(empty);
+	while (NULL != list->ops_->extractFirst(list));
+	list->ops_->destroy(list);
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+	while (NULL != queue->ops_->dequeue(queue));
+	queue->ops_->destroy(queue);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,312 @@
+// test_bloom.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the Bloom filters: no key added is ever missed, the
+// false positives stay near the rate asked for, keys from MemoryNode
+// payloads, union and intersection, and the counting filter erasing keys,
+// with saturated counters and keys that were never added
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_bloom.h"
+#include "adt_memory_node.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kElements 20000
+#define kRate 0.01
+
+// Counts the keys of [from, to) the filter says it may contain
+static u32 TEST_bloomCount(BloomFilter *filter, u32 from, u32 to)
+{
+	u32 count = 0;
+	for (u32 i = from; i < to; ++i)
+	{
+		count += True == filter->ops_->contains(filter, &i, sizeof(u32)) ? 1 : 0;
+	}
+	return count;
+}
+
+static u32 TEST_countingCount(CountingBloom *filter, u32 from, u32 to)
+{
+	u32 count = 0;
+	for (u32 i = from; i < to; ++i)
+	{
+		count += True == filter->ops_->contains(filter, &i, sizeof(u32)) ? 1 : 0;
+	}
+	return count;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test add and contains\n");
+	BloomFilter *filter = BLOOM_create(kElements, kRate);
+	if (NULL == filter)
+	{
+		printf("\n create returned a null filter\n");
+		return -1;
+	}
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		error_type = filter->ops_->add(filter, &i, sizeof(u32));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(filter, (u8 *)"add", error_type);
+	u32 found = TEST_bloomCount(filter, 0, kElements);
+	u32 false_positives = TEST_bloomCount(filter, kElements, 2 * kElements);
+	printf("\t %u of %u keys found, %u false positives, %.2f bits per key\n", found, kElements, false_positives,
+		   filter->ops_->memory(filter) * 8.0 / kElements);
+	if (kElements != found || kElements != filter->ops_->length(filter))
+	{
+		printf("  ==> ERROR: every key added must be found\n");
+	}
+	if (false_positives > 2 * kRate * kElements)
+	{
+		printf("  ==> ERROR: the false positives must stay near the rate asked for\n");
+	}
+	filter->ops_->print(filter);
+
+	printf("\n\n# Test MemoryNode payloads\n");
+	BloomFilter *strings = BLOOM_create(kNumberOfStoragePtrTest_A, kRate);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		MemoryNode node;
+		MEMNODE_createLite(&node);
+		node.ops_->setData(&node, TestData.storage_ptr_test_A[i], (u16)strlen(TestData.storage_ptr_test_A[i]));
+		strings->ops_->addNode(strings, &node);
+	}
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	node.ops_->setData(&node, "4096", 4);
+	if (True != strings->ops_->containsNode(strings, &node) || True != strings->ops_->contains(strings, "16384", 5) ||
+		True == strings->ops_->contains(strings, "1638", 4))
+	{
+		printf("  ==> ERROR: the keys must be the bytes of the payloads\n");
+	}
+	// every key length goes through the lanes and both tails of the hash
+	u8 bytes[100];
+	for (u16 i = 0; i < sizeof(bytes); ++i)
+	{
+		bytes[i] = (u8)(i * 7);
+	}
+	BloomFilter *lengths = BLOOM_create(sizeof(bytes), kRate);
+	for (u16 i = 1; i <= sizeof(bytes); ++i)
+	{
+		lengths->ops_->add(lengths, bytes, i);
+	}
+	u32 lengths_found = 0;
+	for (u16 i = 1; i <= sizeof(bytes); ++i)
+	{
+		lengths_found += True == lengths->ops_->contains(lengths, bytes, i) ? 1 : 0;
+	}
+	if (sizeof(bytes) != lengths_found)
+	{
+		printf("  ==> ERROR: keys of every length must be found\n");
+	}
+	lengths->ops_->destroy(lengths);
+
+	printf("\n\n# Test merge and intersect\n");
+	BloomFilter *evens = BLOOM_create(kElements, kRate);
+	BloomFilter *thirds = BLOOM_create(kElements, kRate);
+	for (u32 i = 0; i < kElements; i += 2)
+	{
+		evens->ops_->add(evens, &i, sizeof(u32));
+	}
+	for (u32 i = 0; i < kElements; i += 3)
+	{
+		thirds->ops_->add(thirds, &i, sizeof(u32));
+	}
+	filter->ops_->reset(filter);
+	if (0 != TEST_bloomCount(filter, 0, kElements) || 0 != filter->ops_->length(filter))
+	{
+		printf("  ==> ERROR: a reset filter must be empty\n");
+	}
+	error_type = filter->ops_->merge(filter, evens);
+	TESTBASE_printFunctionResult(filter, (u8 *)"merge", error_type);
+	filter->ops_->merge(filter, thirds);
+	error_type = evens->ops_->intersect(evens, thirds);
+	TESTBASE_printFunctionResult(evens, (u8 *)"intersect", error_type);
+	u32 in_union = 0;
+	u32 in_intersection = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		if (0 == i % 2 || 0 == i % 3)
+		{
+			in_union += True == filter->ops_->contains(filter, &i, sizeof(u32)) ? 1 : 0;
+		}
+		if (0 == i % 6)
+		{
+			in_intersection += True == evens->ops_->contains(evens, &i, sizeof(u32)) ? 1 : 0;
+		}
+	}
+	u32 extra = 0;
+	for (u32 i = 1; i < kElements; i += 6)
+	{
+		extra += True == evens->ops_->contains(evens, &i, sizeof(u32)) ? 1 : 0;
+	}
+	printf("\t union %u keys, intersection %u keys and %u of %u others\n", in_union, in_intersection, extra, kElements / 6);
+	if ((kElements + 1) / 2 + (kElements + 2) / 3 - (kElements + 5) / 6 != in_union || (kElements + 5) / 6 != in_intersection)
+	{
+		printf("  ==> ERROR: the union and the intersection must keep their keys\n");
+	}
+	if (extra > kElements / 6 / 10)
+	{
+		printf("  ==> ERROR: the intersection must not keep the keys of one filter only\n");
+	}
+	BloomFilter *other = BLOOM_create(2 * kElements, kRate);
+	error_type = filter->ops_->merge(filter, other);
+	TESTBASE_printFunctionResult(filter, (u8 *)"merge filters of different size (NOT VALID)", error_type);
+	error_type = filter->ops_->intersect(filter, other);
+	TESTBASE_printFunctionResult(filter, (u8 *)"intersect filters of different size (NOT VALID)", error_type);
+
+	printf("\n\n# Test counting filter erase\n");
+	CountingBloom *counting = COUNTBLOOM_create(kElements, kRate);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		error_type = counting->ops_->add(counting, &i, sizeof(u32));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(counting, (u8 *)"add", error_type);
+	for (u32 i = 1; i < kElements; i += 2)
+	{
+		error_type = counting->ops_->erase(counting, &i, sizeof(u32));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(counting, (u8 *)"erase", error_type);
+	u32 kept = 0;
+	u32 erased = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		if (True == counting->ops_->contains(counting, &i, sizeof(u32)))
+		{
+			kept += 0 == i % 2 ? 1 : 0;
+			erased += 1 == i % 2 ? 1 : 0;
+		}
+	}
+	printf("\t %u keys kept, %u erased keys still found, %llu bytes\n", kept, erased,
+		   (unsigned long long)counting->ops_->memory(counting));
+	if (kElements / 2 != kept || kElements / 2 != counting->ops_->length(counting))
+	{
+		printf("  ==> ERROR: erasing keys must not lose the other ones\n");
+	}
+	if (erased > 2 * kRate * kElements / 2)
+	{
+		printf("  ==> ERROR: the erased keys must be gone but for false positives\n");
+	}
+	u32 absent = 3 * kElements;
+	while (True == counting->ops_->contains(counting, &absent, sizeof(u32)))
+	{
+		++absent;
+	}
+	error_type = counting->ops_->erase(counting, &absent, sizeof(u32));
+	TESTBASE_printFunctionResult(counting, (u8 *)"erase key never added (NOT VALID)", error_type);
+
+	printf("\n\n# Test saturated counters\n");
+	CountingBloom *saturated = COUNTBLOOM_create(kElements, kRate);
+	u32 key = 7;
+	for (u32 i = 0; i < kBloomCounterMax + 5; ++i)
+	{
+		saturated->ops_->add(saturated, &key, sizeof(u32));
+	}
+	for (u32 i = 0; i < kBloomCounterMax + 5; ++i)
+	{
+		saturated->ops_->erase(saturated, &key, sizeof(u32));
+	}
+	if (True != saturated->ops_->contains(saturated, &key, sizeof(u32)))
+	{
+		printf("  ==> ERROR: a saturated counter must never go down\n");
+	}
+	saturated->ops_->print(saturated);
+	key = 8;
+	saturated->ops_->add(saturated, &key, sizeof(u32));
+	error_type = counting->ops_->merge(counting, saturated);
+	TESTBASE_printFunctionResult(counting, (u8 *)"merge", error_type);
+	u32 merged = 0;
+	for (u32 i = 0; i < kElements; i += 2)
+	{
+		merged += True == counting->ops_->contains(counting, &i, sizeof(u32)) ? 1 : 0;
+	}
+	if (True != counting->ops_->contains(counting, &key, sizeof(u32)) || kElements / 2 != merged)
+	{
+		printf("  ==> ERROR: the merged counting filter must keep both sets of keys\n");
+	}
+	error_type = saturated->ops_->intersect(saturated, counting);
+	TESTBASE_printFunctionResult(saturated, (u8 *)"intersect", error_type);
+	if (True != saturated->ops_->contains(saturated, &key, sizeof(u32)))
+	{
+		printf("  ==> ERROR: the intersection must keep the keys of both filters\n");
+	}
+	error_type = counting->ops_->reset(counting);
+	TESTBASE_printFunctionResult(counting, (u8 *)"reset", error_type);
+	if (0 != TEST_countingCount(counting, 0, kElements) || 0 != counting->ops_->length(counting))
+	{
+		printf("  ==> ERROR: a reset filter must be empty\n");
+	}
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != BLOOM_create(0, kRate) || NULL != BLOOM_create(kElements, 0.0) || NULL != BLOOM_create(kElements, 1.0) ||
+		NULL != COUNTBLOOM_create(0, kRate) || NULL != COUNTBLOOM_create(kElements, -1.0))
+	{
+		printf("  ==> ERROR: create must reject no keys or a rate out of (0, 1)\n");
+	}
+	error_type = filter->ops_->add(NULL, &key, sizeof(u32));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"add NULL (NOT VALID)", error_type);
+	error_type = filter->ops_->add(filter, NULL, sizeof(u32));
+	TESTBASE_printFunctionResult(filter, (u8 *)"add data NULL (NOT VALID)", error_type);
+	error_type = filter->ops_->add(filter, &key, 0);
+	TESTBASE_printFunctionResult(filter, (u8 *)"add bytes 0 (NOT VALID)", error_type);
+	error_type = filter->ops_->addNode(filter, NULL);
+	TESTBASE_printFunctionResult(filter, (u8 *)"addNode node NULL (NOT VALID)", error_type);
+	error_type = filter->ops_->merge(filter, NULL);
+	TESTBASE_printFunctionResult(filter, (u8 *)"merge other NULL (NOT VALID)", error_type);
+	error_type = counting->ops_->erase(NULL, &key, sizeof(u32));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"erase NULL (NOT VALID)", error_type);
+	error_type = counting->ops_->eraseNode(counting, NULL);
+	TESTBASE_printFunctionResult(counting, (u8 *)"eraseNode node NULL (NOT VALID)", error_type);
+	error_type = counting->ops_->intersect(NULL, counting);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"intersect NULL (NOT VALID)", error_type);
+	if (False != filter->ops_->contains(NULL, &key, sizeof(u32)) || False != filter->ops_->contains(filter, NULL, sizeof(u32)) ||
+		False != filter->ops_->containsNode(filter, NULL) || False != counting->ops_->contains(NULL, &key, sizeof(u32)) ||
+		0 != filter->ops_->length(NULL) || 0 != counting->ops_->memory(NULL))
+	{
+		printf("  ==> ERROR: contains on a NULL filter or key must return False\n");
+	}
+	error_type = filter->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	error_type = counting->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy counting NULL (NOT VALID)", error_type);
+	filter->ops_->destroy(filter);
+	strings->ops_->destroy(strings);
+	evens->ops_->destroy(evens);
+	thirds->ops_->destroy(thirds);
+	other->ops_->destroy(other);
+	counting->ops_->destroy(counting);
+	saturated->ops_->destroy(saturated);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
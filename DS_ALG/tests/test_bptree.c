@@ -0,0 +1,375 @@
+// test_bptree.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the B+ tree: insertions in shuffled order through several
+// levels, lookups, lower bounds and range scans, erasures that borrow and
+// merge nodes down to an empty tree, a custom comparator and the bulk load
+// from a sorted vector
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_bptree.h"
+#include "adt_vector.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+// enough entries for three levels of 8 byte keys
+#define kEntries 20000
+
+// Payloads of the big battery, not owned by the tree: emptied with softReset.
+// Each one starts with its key, a big endian u64, so the vector of the bulk
+// load can hold them as they are
+static u64 values[kEntries];
+static u32 order[kEntries];
+
+static u64 TEST_bigEndian(u64 value)
+{
+	u64 key = 0;
+	u8 *bytes = (u8 *)&key;
+	for (u16 i = 0; i < 8; ++i)
+	{
+		bytes[i] = (u8)(value >> (56 - 8 * i));
+	}
+	return key;
+}
+
+// Key of the i-th value: the even numbers, so there are gaps for the bounds
+static u64 TEST_key(u32 i)
+{
+	return TEST_bigEndian((u64)i * 2);
+}
+
+// Copy of a test string owned by the tree, terminator included
+static void *TEST_copy(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MM->malloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Checks that the tree holds count values from from, in key order
+static void TEST_order(const char *name, BPTree *tree, u32 from, u32 count, u32 step)
+{
+	BPTreeCursor cursor;
+	u32 visited = 0;
+	printf("\t %s: %u entries, height %d\n", name, tree->ops_->length(tree), tree->height_);
+	if (count != tree->ops_->length(tree))
+	{
+		printf("  ==> ERROR: %s must have %u entries\n", name, count);
+		return;
+	}
+	for (tree->ops_->begin(tree, &cursor); True == BPTREE_cursorValid(&cursor); BPTREE_cursorNext(&cursor), ++visited)
+	{
+		u32 expected = from + visited * step;
+		if (&values[expected] != BPTREE_cursorData(&cursor) || 0 != memcmp(BPTREE_cursorKey(&cursor), &values[expected], 8) ||
+			sizeof(u64) != BPTREE_cursorSize(&cursor))
+		{
+			printf("  ==> ERROR: %s has the wrong entry at %u\n", name, visited);
+			return;
+		}
+	}
+	if (count != visited)
+	{
+		printf("  ==> ERROR: the cursor must visit the %u entries of %s\n", count, name);
+	}
+}
+
+// Orders 4 byte little endian keys as integers
+static s32 TEST_compareU32(const void *a, const void *b, u16 bytes)
+{
+	(void)bytes;
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+int main()
+{
+	s16 error_type = 0;
+	BPTreeCursor cursor;
+
+	TESTBASE_generateDataForTest();
+	srand(1);
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		values[i] = TEST_key(i);
+		order[i] = i;
+	}
+	for (u32 i = kEntries - 1; i > 0; --i)
+	{
+		u32 j = (u32)rand() % (i + 1);
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test insert in shuffled order\n");
+	BPTree *tree = BPTREE_create(sizeof(u64), NULL);
+	if (NULL == tree)
+	{
+		printf("\n create returned a null tree\n");
+		return -1;
+	}
+	printf("\t %d entries per leaf, %d children per inner node\n", tree->leaf_max_, tree->inner_max_ + 1);
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		error_type = tree->ops_->insert(tree, &values[order[i]], &values[order[i]], sizeof(u64));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert", error_type);
+	TEST_order("inserted", tree, 0, kEntries, 1);
+	if (tree->height_ < 3)
+	{
+		printf("  ==> ERROR: the tree must have grown to three levels\n");
+	}
+	error_type = tree->ops_->insert(tree, &values[7], &values[8], sizeof(u64));
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert key already inserted (NOT VALID)", error_type);
+	if (&values[7] != tree->ops_->find(tree, &values[7]) || kEntries != tree->ops_->length(tree))
+	{
+		printf("  ==> ERROR: inserting a key twice must keep the first payload\n");
+	}
+
+	printf("\n\n# Test find and lower bound\n");
+	u32 found = 0;
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		found += &values[i] == tree->ops_->find(tree, &values[i]) ? 1 : 0;
+	}
+	printf("\t found %u keys\n", found);
+	if (kEntries != found)
+	{
+		printf("  ==> ERROR: find must return the payload of every key\n");
+	}
+	u64 odd = TEST_bigEndian(2 * 1234 + 1);
+	if (NULL != tree->ops_->find(tree, &odd))
+	{
+		printf("  ==> ERROR: find must return NULL for a key not inserted\n");
+	}
+	error_type = tree->ops_->lowerBound(tree, &odd, &cursor);
+	TESTBASE_printFunctionResult(tree, (u8 *)"lowerBound between two keys", error_type);
+	if (True != BPTREE_cursorValid(&cursor) || &values[1235] != BPTREE_cursorData(&cursor))
+	{
+		printf("  ==> ERROR: the lower bound of a missing key must be the next key\n");
+	}
+	tree->ops_->lowerBound(tree, &values[1235], &cursor);
+	if (&values[1235] != BPTREE_cursorData(&cursor))
+	{
+		printf("  ==> ERROR: the lower bound of a key must be the key\n");
+	}
+	u64 past = TEST_key(kEntries);
+	tree->ops_->lowerBound(tree, &past, &cursor);
+	if (True == BPTREE_cursorValid(&cursor))
+	{
+		printf("  ==> ERROR: the lower bound past the last key must be invalid\n");
+	}
+
+	printf("\n\n# Test range scan\n");
+	u64 to = TEST_key(9000);
+	u32 scanned = 0;
+	u64 sum = 0;
+	for (tree->ops_->lowerBound(tree, &odd, &cursor);
+		True == BPTREE_cursorValid(&cursor) && memcmp(BPTREE_cursorKey(&cursor), &to, sizeof(u64)) < 0;
+		BPTREE_cursorNext(&cursor), ++scanned)
+	{
+		sum += (u64)((u64 *)BPTREE_cursorData(&cursor) - values);
+	}
+	printf("\t scanned %u entries from key %d up to key %d\n", scanned, 2 * 1234 + 1, 2 * 9000);
+	if (9000 - 1235 != scanned || (u64)(1235 + 8999) * (9000 - 1235) / 2 != sum)
+	{
+		printf("  ==> ERROR: the scan must visit the keys of the range once\n");
+	}
+
+	printf("\n\n# Test erase down to an empty tree\n");
+	u32 erased = 0;
+	for (u32 i = 0; i < kEntries; i += 2)
+	{
+		erased += &values[order[i]] == tree->ops_->erase(tree, &values[order[i]]) ? 1 : 0;
+	}
+	printf("\t erased %u keys, %u nodes in use\n", erased, tree->pool_->ops_->live(tree->pool_) - tree->reserved_);
+	if (kEntries / 2 != erased || kEntries / 2 != tree->ops_->length(tree))
+	{
+		printf("  ==> ERROR: erase must return the payload of every key\n");
+	}
+	u32 left = 0;
+	u32 previous = 0;
+	for (tree->ops_->begin(tree, &cursor); True == BPTREE_cursorValid(&cursor); BPTREE_cursorNext(&cursor), ++left)
+	{
+		u32 position = (u32)((u64 *)BPTREE_cursorData(&cursor) - values);
+		if (left > 0 && position <= previous)
+		{
+			printf("  ==> ERROR: the entries left must stay in key order\n");
+			break;
+		}
+		previous = position;
+	}
+	if (kEntries / 2 != left)
+	{
+		printf("  ==> ERROR: the cursor must visit the entries left\n");
+	}
+	if (NULL != tree->ops_->erase(tree, &values[order[0]]))
+	{
+		printf("  ==> ERROR: erasing a key twice must return NULL\n");
+	}
+	for (u32 i = 1; i < kEntries; i += 2)
+	{
+		tree->ops_->erase(tree, &values[order[i]]);
+	}
+	printf("\t emptied, height %d, %u nodes in use\n", tree->height_, tree->pool_->ops_->live(tree->pool_) - tree->reserved_);
+	if (True != tree->ops_->isEmpty(tree) || 0 != tree->height_ || NULL != tree->first_ ||
+		tree->pool_->ops_->live(tree->pool_) != tree->reserved_)
+	{
+		printf("  ==> ERROR: an empty tree must give its nodes back\n");
+	}
+	tree->ops_->begin(tree, &cursor);
+	if (True == BPTREE_cursorValid(&cursor))
+	{
+		printf("  ==> ERROR: begin on an empty tree must be invalid\n");
+	}
+
+	printf("\n\n# Test insert in order\n");
+	for (u32 i = 0; i < kEntries; ++i)
+	{
+		tree->ops_->insert(tree, &values[i], &values[i], sizeof(u64));
+	}
+	TEST_order("appended", tree, 0, kEntries, 1);
+	u32 leaves = 0;
+	for (BPTreeNode *leaf = tree->first_; NULL != leaf; leaf = leaf->next_)
+	{
+		++leaves;
+	}
+	printf("\t %u leaves\n", leaves);
+	if (leaves != (u32)(kEntries + tree->leaf_max_ - 1) / tree->leaf_max_)
+	{
+		printf("  ==> ERROR: the keys inserted in order must fill the leaves\n");
+	}
+	error_type = tree->ops_->softReset(tree);
+	TESTBASE_printFunctionResult(tree, (u8 *)"softReset", error_type);
+
+	printf("\n\n# Test custom comparator\n");
+	BPTree *numbers = BPTREE_create(sizeof(u32), TEST_compareU32);
+	u32 keys[300];
+	for (u32 i = 0; i < 300; ++i)
+	{
+		// 0, 256, 512... would be out of order compared as bytes
+		keys[i] = (order[i] % 1000) * 256;
+		numbers->ops_->insert(numbers, &keys[i], &keys[i], sizeof(u32));
+	}
+	u32 last_key = 0;
+	u32 sorted_keys = 0;
+	for (numbers->ops_->begin(numbers, &cursor); True == BPTREE_cursorValid(&cursor); BPTREE_cursorNext(&cursor), ++sorted_keys)
+	{
+		u32 key = *(const u32 *)BPTREE_cursorKey(&cursor);
+		if (sorted_keys > 0 && key <= last_key)
+		{
+			printf("  ==> ERROR: the entries must follow the comparator\n");
+			break;
+		}
+		last_key = key;
+	}
+	printf("\t %u entries in order\n", sorted_keys);
+	numbers->ops_->softReset(numbers);
+
+	printf("\n\n# Test bulk load\n");
+	Vector *vector = VECTOR_create(1500);
+	for (u16 i = 0; i < 1500; ++i)
+	{
+		vector->ops_->insertLast(vector, &values[i], sizeof(u64));
+	}
+	error_type = tree->ops_->bulkLoad(tree, vector);
+	TESTBASE_printFunctionResult(tree, (u8 *)"bulkLoad", error_type);
+	TEST_order("loaded", tree, 0, 1500, 1);
+	if (True != vector->ops_->isEmpty(vector))
+	{
+		printf("  ==> ERROR: bulkLoad must move the payloads out of the vector\n");
+	}
+	for (u32 i = 0; i < 1500; i += 3)
+	{
+		tree->ops_->erase(tree, &values[i]);
+		tree->ops_->erase(tree, &values[i + 1]);
+	}
+	TEST_order("loaded and erased", tree, 2, 500, 3);
+	for (u16 i = 0; i < 10; ++i)
+	{
+		vector->ops_->insertLast(vector, &values[2000 + i], sizeof(u64));
+	}
+	error_type = tree->ops_->bulkLoad(tree, vector);
+	TESTBASE_printFunctionResult(tree, (u8 *)"bulkLoad in a tree not empty (NOT VALID)", error_type);
+	tree->ops_->softReset(tree);
+	vector->ops_->insertAt(vector, &values[5000], sizeof(u64), 5);
+	error_type = tree->ops_->bulkLoad(tree, vector);
+	TESTBASE_printFunctionResult(tree, (u8 *)"bulkLoad keys not sorted (NOT VALID)", error_type);
+	if (11 != vector->ops_->length(vector) || True != tree->ops_->isEmpty(tree))
+	{
+		printf("  ==> ERROR: a failed bulkLoad must not touch the tree or the vector\n");
+	}
+	vector->ops_->softReset(vector);
+
+	printf("\n\n# Test strings and reset\n");
+	BPTree *strings = BPTREE_create(2, NULL);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		strings->ops_->insert(strings, TestData.storage_ptr_test_A[i], TEST_copy(TestData.storage_ptr_test_A[i]),
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+	}
+	if (kNumberOfStoragePtrTest_A != strings->ops_->length(strings) ||
+		0 != strcmp(strings->ops_->find(strings, "40"), "4096"))
+	{
+		printf("  ==> ERROR: the strings must be found by their first two characters\n");
+	}
+	strings->ops_->print(strings);
+	error_type = strings->ops_->reset(strings);
+	TESTBASE_printFunctionResult(strings, (u8 *)"reset", error_type);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != BPTREE_create(0, NULL) || NULL != BPTREE_create(kBPTreeMaxKeyBytes + 1, NULL))
+	{
+		printf("  ==> ERROR: create with a key size out of range must return NULL\n");
+	}
+	error_type = tree->ops_->insert(NULL, &values[0], &values[0], sizeof(u64));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insert NULL (NOT VALID)", error_type);
+	error_type = tree->ops_->insert(tree, NULL, &values[0], sizeof(u64));
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert key NULL (NOT VALID)", error_type);
+	error_type = tree->ops_->insert(tree, &values[0], NULL, sizeof(u64));
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert data NULL (NOT VALID)", error_type);
+	error_type = tree->ops_->insert(tree, &values[0], &values[0], 0);
+	TESTBASE_printFunctionResult(tree, (u8 *)"insert bytes 0 (NOT VALID)", error_type);
+	error_type = tree->ops_->bulkLoad(tree, NULL);
+	TESTBASE_printFunctionResult(tree, (u8 *)"bulkLoad NULL (NOT VALID)", error_type);
+	error_type = tree->ops_->lowerBound(NULL, &values[0], &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"lowerBound NULL (NOT VALID)", error_type);
+	if (True == BPTREE_cursorValid(&cursor))
+	{
+		printf("  ==> ERROR: lowerBound on a NULL tree must leave the cursor invalid\n");
+	}
+	error_type = tree->ops_->begin(tree, NULL);
+	TESTBASE_printFunctionResult(tree, (u8 *)"begin cursor NULL (NOT VALID)", error_type);
+	if (NULL != tree->ops_->find(NULL, &values[0]) || NULL != tree->ops_->find(tree, NULL) ||
+		NULL != tree->ops_->erase(tree, &values[0]) || NULL != tree->ops_->erase(NULL, &values[0]))
+	{
+		printf("  ==> ERROR: find and erase on an empty or NULL tree must return NULL\n");
+	}
+	error_type = tree->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	tree->ops_->destroy(tree);
+	numbers->ops_->destroy(numbers);
+	strings->ops_->destroy(strings);
+	vector->ops_->destroy(vector);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,237 @@
+// test_circular_dllist.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the circular DLList: both links of the ring stay closed
+// after every insertion and extraction, rotate in both directions, the
+// round-robin cursor of cycle and the reverse walk of rbegin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_dllist.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u16 kCapacity = 10;
+const u16 kElements = 5;
+
+// Copy of a test string owned by the list, terminator included
+static void *TEST_copy(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MM->malloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Checks that the list holds storage_ptr_test_A[order[i]] in order, walking
+// it both ways, and that its ring is closed (or open in a list not circular)
+static void TEST_order(const char *name, DLList *list, const u16 *order, u16 count, boolean circular)
+{
+	printf("\t %s:", name);
+	for (u16 i = 0; i < list->ops_->length(list); ++i)
+	{
+		printf(" %s", (char *)list->ops_->at(list, i));
+	}
+	printf("\n");
+	if (count != list->ops_->length(list))
+	{
+		printf("  ==> ERROR: %s must have %d elements\n", name, count);
+		return;
+	}
+	for (u16 i = 0; i < count; ++i)
+	{
+		if (0 != strcmp(list->ops_->at(list, i), TestData.storage_ptr_test_A[order[i]]))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %d\n", name, i);
+			return;
+		}
+	}
+	Cursor cursor;
+	u16 visited = 0;
+	for (list->ops_->rbegin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		visited++;
+		if (visited > count || 0 != strcmp(CURSOR_get(&cursor), TestData.storage_ptr_test_A[order[count - visited]]))
+		{
+			printf("  ==> ERROR: %s has the wrong prev_ links\n", name);
+			return;
+		}
+	}
+	MemoryNode *head = True == circular ? list->head_ : NULL;
+	MemoryNode *tail = True == circular ? list->tail_ : NULL;
+	if (count != visited || (NULL != list->tail_ && (head != list->tail_->next_ || tail != list->head_->prev_)))
+	{
+		printf("  ==> ERROR: the ends of %s must link to %s\n", name, True == circular ? "each other" : "NULL");
+	}
+}
+
+static u16 traversed = 0;
+
+static void TEST_count(MemoryNode *node)
+{
+	(void)node;
+	traversed++;
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test insert and extract\n");
+	DLList *list = DLList_createCircular(kCapacity);
+	if (NULL == list)
+	{
+		printf("\n createCircular returned a null list\n");
+		return -1;
+	}
+	for (u16 i = 1; i < kElements; ++i)
+	{
+		error_type = list->ops_->insertLast(list, TEST_copy(TestData.storage_ptr_test_A[i]),
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+	}
+	TESTBASE_printFunctionResult(list, (u8 *)"insertLast", error_type);
+	error_type = list->ops_->insertFirst(list, TEST_copy(TestData.storage_ptr_test_A[0]),
+		(u16)(strlen(TestData.storage_ptr_test_A[0]) + 1));
+	TESTBASE_printFunctionResult(list, (u8 *)"insertFirst", error_type);
+	TEST_order("inserted", list, (u16[]){0, 1, 2, 3, 4}, 5, True);
+	MM->free(list->ops_->extractFirst(list));
+	MM->free(list->ops_->extractLast(list));
+	MM->free(list->ops_->extractAt(list, 1));
+	TEST_order("extract first, last and at 1", list, (u16[]){1, 3}, 2, True);
+	error_type = list->ops_->insertAt(list, TEST_copy(TestData.storage_ptr_test_A[2]),
+		(u16)(strlen(TestData.storage_ptr_test_A[2]) + 1), 1);
+	TESTBASE_printFunctionResult(list, (u8 *)"insertAt", error_type);
+	list->ops_->insertLast(list, TEST_copy(TestData.storage_ptr_test_A[4]), (u16)(strlen(TestData.storage_ptr_test_A[4]) + 1));
+	list->ops_->insertFirst(list, TEST_copy(TestData.storage_ptr_test_A[0]), (u16)(strlen(TestData.storage_ptr_test_A[0]) + 1));
+	TEST_order("insert at, last and first", list, (u16[]){0, 1, 2, 3, 4}, 5, True);
+	if (NULL != list->ops_->at(list, kElements))
+	{
+		printf("  ==> ERROR: at past the length must not wrap around\n");
+	}
+
+	printf("\n\n# Test rotate\n");
+	error_type = list->ops_->rotate(list, 1);
+	TESTBASE_printFunctionResult(list, (u8 *)"rotate 1", error_type);
+	TEST_order("rotated 1", list, (u16[]){1, 2, 3, 4, 0}, 5, True);
+	error_type = list->ops_->rotate(list, -3);
+	TESTBASE_printFunctionResult(list, (u8 *)"rotate -3", error_type);
+	TEST_order("rotated -3", list, (u16[]){3, 4, 0, 1, 2}, 5, True);
+	list->ops_->rotate(list, 2 * kElements + 2);
+	TEST_order("rotated 12", list, (u16[]){0, 1, 2, 3, 4}, 5, True);
+
+	printf("\n\n# Test round-robin cursor\n");
+	error_type = list->ops_->cycle(list, &cursor);
+	TESTBASE_printFunctionResult(list, (u8 *)"cycle", error_type);
+	printf("\t");
+	for (u16 i = 0; i < 2 * kElements + 1; ++i, CURSOR_next(&cursor))
+	{
+		printf(" %s", (char *)CURSOR_get(&cursor));
+		if (True != CURSOR_valid(&cursor) || 0 != strcmp(CURSOR_get(&cursor), TestData.storage_ptr_test_A[i % kElements]))
+		{
+			printf("\n  ==> ERROR: the cursor must go round the list\n");
+			break;
+		}
+	}
+	printf("\n");
+	u16 visited = 0;
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		visited++;
+	}
+	if (kElements != visited)
+	{
+		printf("  ==> ERROR: begin must stop after the tail\n");
+	}
+
+	printf("\n\n# Test traverse and concat\n");
+	error_type = list->ops_->traverse(list, TEST_count);
+	TESTBASE_printFunctionResult(list, (u8 *)"traverse", error_type);
+	printf("\t traverse visited %d nodes\n", traversed);
+	if (kElements != traversed)
+	{
+		printf("  ==> ERROR: traverse must visit every node once\n");
+	}
+	DLList *other = DLList_createCircular(kCapacity);
+	error_type = other->ops_->concat(other, list);
+	TESTBASE_printFunctionResult(other, (u8 *)"concat into a circular list", error_type);
+	TEST_order("concat", other, (u16[]){0, 1, 2, 3, 4}, 5, True);
+	DLList *plain = DLList_create(kCapacity);
+	error_type = plain->ops_->concat(plain, list);
+	TESTBASE_printFunctionResult(plain, (u8 *)"concat of a circular list into a list", error_type);
+	TEST_order("concat into a list", plain, (u16[]){0, 1, 2, 3, 4}, 5, False);
+	error_type = plain->ops_->rotate(plain, 4);
+	TESTBASE_printFunctionResult(plain, (u8 *)"rotate a list not circular", error_type);
+	TEST_order("list rotated 4", plain, (u16[]){4, 0, 1, 2, 3}, 5, False);
+	plain->ops_->cycle(plain, &cursor);
+	visited = 0;
+	for (; True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		visited++;
+	}
+	if (kElements != visited)
+	{
+		printf("  ==> ERROR: cycle on a list not circular must stop after the tail\n");
+	}
+
+	printf("\n\n# Test resize and reset\n");
+	error_type = other->ops_->resize(other, 3);
+	TESTBASE_printFunctionResult(other, (u8 *)"resize", error_type);
+	TEST_order("resized to 3", other, (u16[]){0, 1, 2}, 3, True);
+	error_type = other->ops_->reset(other);
+	TESTBASE_printFunctionResult(other, (u8 *)"reset", error_type);
+	other->ops_->insertLast(other, TEST_copy(TestData.storage_ptr_test_A[3]), (u16)(strlen(TestData.storage_ptr_test_A[3]) + 1));
+	TEST_order("one element after reset", other, (u16[]){3}, 1, True);
+	other->ops_->rotate(other, 1);
+	MM->free(other->ops_->extractFirst(other));
+	if (NULL != other->head_ || NULL != other->tail_ || True != other->ops_->isEmpty(other))
+	{
+		printf("  ==> ERROR: extracting the last element must leave the list empty\n");
+	}
+	other->ops_->cycle(other, &cursor);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: cycle on an empty list must leave the cursor invalid\n");
+	}
+	other->ops_->print(other);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != DLList_createCircular(0))
+	{
+		printf("  ==> ERROR: createCircular with capacity 0 must return NULL\n");
+	}
+	error_type = list->ops_->rotate(NULL, 1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"rotate NULL (NOT VALID)", error_type);
+	error_type = list->ops_->cycle(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"cycle NULL (NOT VALID)", error_type);
+	error_type = list->ops_->cycle(list, NULL);
+	TESTBASE_printFunctionResult(list, (u8 *)"cycle cursor NULL (NOT VALID)", error_type);
+	error_type = other->ops_->rotate(other, 3);
+	TESTBASE_printFunctionResult(other, (u8 *)"rotate an empty list", error_type);
+	error_type = list->ops_->insertLast(NULL, NULL, 0);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insertLast NULL (NOT VALID)", error_type);
+	if (NULL != list->ops_->extractFirst(other) || NULL != list->ops_->extractLast(other))
+	{
+		printf("  ==> ERROR: extracting from an empty list must return NULL\n");
+	}
+	list->ops_->destroy(list);
+	other->ops_->destroy(other);
+	plain->ops_->destroy(plain);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
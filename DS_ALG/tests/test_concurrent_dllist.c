@@ -0,0 +1,279 @@
+// test_concurrent_dllist.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the fine-grained locking DLList
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_dllist.h"
+#include "adt_concurrent_dllist.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kWorkers 6
+const u16 kCapacityList1 = 30;
+const u16 kCapacityList2 = 3;
+const u16 kThreadedCapacity = 400;
+const u32 kOpsPerWorker = 20000;
+
+typedef struct test_context_s {
+	DLList *list_;
+	_Atomic u64 inserted_;   // sum of the values inserted
+	_Atomic u64 extracted_;  // sum of the values extracted
+} TestContext;
+
+static u32 *TEST_newValue(u32 value)
+{
+	u32 *data = MM->malloc(sizeof(u32));
+	*data = value;
+	return data;
+}
+
+static void TEST_extracted(TestContext *ctx, u32 *data)
+{
+	if (NULL != data)
+	{
+		atomic_fetch_add(&ctx->extracted_, *data);
+		MM->free(data);
+	}
+}
+
+// Each worker works on one zone of the list: the head, the tail or the
+// middle (insertAt / extractAt), so every kind of contention happens
+static int TEST_worker(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	static _Atomic u32 next_id = 0;
+	u32 id = atomic_fetch_add(&next_id, 1);
+	DLList *list = ctx->list_;
+	for (u32 i = 0; i < kOpsPerWorker; ++i)
+	{
+		u32 value = id * kOpsPerWorker + i + 1;
+		u32 *data = TEST_newValue(value);
+		s16 error;
+		switch (id % 3)
+		{
+		case 0: error = list->ops_->insertFirst(list, data, sizeof(u32)); break;
+		case 1: error = list->ops_->insertLast(list, data, sizeof(u32)); break;
+		default: error = list->ops_->insertAt(list, data, sizeof(u32), (u16)(i % 8)); break;
+		}
+		if (kErrorCode_Ok == error)
+			atomic_fetch_add(&ctx->inserted_, value);
+		else
+			MM->free(data);
+
+		switch ((id + i) % 3)
+		{
+		case 0: TEST_extracted(ctx, list->ops_->extractFirst(list)); break;
+		case 1: TEST_extracted(ctx, list->ops_->extractLast(list)); break;
+		default: TEST_extracted(ctx, list->ops_->extractAt(list, (u16)(i % 8))); break;
+		}
+		if (0 == i % 64)
+			thrd_yield();
+	}
+	return 0;
+}
+
+static u32 traversed = 0;
+static void TEST_countNode(MemoryNode *node)
+{
+	if (NULL != node->data_)
+		++traversed;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	// list created just to have a reference to the operations
+	DLList *ls = ConcurrentDLList_create(1);
+	DLList *list_1 = ConcurrentDLList_create(kCapacityList1);
+	DLList *list_2 = ConcurrentDLList_create(kCapacityList2);
+	if (NULL == ls || NULL == list_1 || NULL == list_2) {
+		printf("\n create returned a null list\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + ConcurrentDLList: %zu\n", sizeof(ConcurrentDLList));
+	printf("  + ConcurrentDLListNode: %zu\n", sizeof(ConcurrentDLListNode));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Insert\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = ls->ops_->insertLast(list_1, TestData.storage_ptr_test_A[i], (strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TestData.storage_ptr_test_A[i] = NULL;
+		TESTBASE_printFunctionResult(list_1, (u8 *)"insertLast list_1", error_type);
+	}
+	error_type = ls->ops_->insertFirst(list_1, TestData.single_ptr_data_1, kSingleSizeData1);
+	TestData.single_ptr_data_1 = NULL;
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertFirst list_1", error_type);
+	void *inserted_at_3 = TestData.single_ptr_data_2;
+	error_type = ls->ops_->insertAt(list_1, TestData.single_ptr_data_2, kSingleSizeData2, 3);
+	TestData.single_ptr_data_2 = NULL;
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertAt list_1", error_type);
+	printf("list_1:\n");
+	ls->ops_->print(list_1);
+	if (kNumberOfStoragePtrTest_A + 2 != ls->ops_->length(list_1))
+	{
+		printf("  ==> ERROR: wrong length\n");
+	}
+
+	printf("\n\n# Test First / Last / At\n");
+	void *at_3 = ls->ops_->at(list_1, 3);
+	printf("\t first: %s\n", (char *)ls->ops_->first(list_1));
+	printf("\t at 3: %s\n", (char *)at_3);
+	printf("\t last: %s\n", (char *)ls->ops_->last(list_1));
+	if (at_3 != inserted_at_3)
+	{
+		printf("  ==> ERROR: at returned the wrong element\n");
+	}
+	if (NULL != ls->ops_->at(list_1, ls->ops_->length(list_1)))
+	{
+		printf("  ==> ERROR: at out of range returned data\n");
+	}
+
+	printf("\n\n# Test Traverse\n");
+	error_type = ls->ops_->traverse(list_1, TEST_countNode);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"traverse list_1", error_type);
+	if (traversed != ls->ops_->length(list_1))
+	{
+		printf("  ==> ERROR: traverse visited %u nodes\n", traversed);
+	}
+
+	printf("\n\n# Test Extract\n");
+	void *data = ls->ops_->extractAt(list_1, 3);
+	if (data != at_3)
+	{
+		printf("  ==> ERROR: extractAt returned the wrong element\n");
+	}
+	MM->free(data);
+	data = ls->ops_->extractFirst(list_1);
+	printf("\t extractFirst: %s\n", (char *)data);
+	MM->free(data);
+	data = ls->ops_->extractLast(list_1);
+	printf("\t extractLast: %s\n", (char *)data);
+	MM->free(data);
+	ls->ops_->print(list_1);
+
+	printf("\n\n# Test Capacity\n");
+	error_type = ls->ops_->insertLast(list_2, TestData.single_ptr_data_3, kSingleSizeData3);
+	TestData.single_ptr_data_3 = NULL;
+	TESTBASE_printFunctionResult(list_2, (u8 *)"insertLast list_2", error_type);
+	for (u16 i = 0; i < kCapacityList2; ++i)
+	{
+		u32 *value = TEST_newValue(i);
+		error_type = ls->ops_->insertFirst(list_2, value, sizeof(u32));
+		TESTBASE_printFunctionResult(list_2, (u8 *)"insertFirst list_2", error_type);
+		if (kErrorCode_Ok != error_type)
+			MM->free(value);
+	}
+	if (True != ls->ops_->isFull(list_2))
+	{
+		printf("  ==> ERROR: list_2 must be full\n");
+	}
+	error_type = ls->ops_->resize(list_2, 1);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"resize list_2 to 1", error_type);
+	if (1 != ls->ops_->length(list_2))
+	{
+		printf("  ==> ERROR: resize kept %d elements\n", ls->ops_->length(list_2));
+	}
+	error_type = ls->ops_->concat(list_2, list_1);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"concat list_2 + list_1", error_type);
+	if (1 + ls->ops_->length(list_1) != ls->ops_->length(list_2))
+	{
+		printf("  ==> ERROR: concat copied %d elements\n", ls->ops_->length(list_2) - 1);
+	}
+	ls->ops_->print(list_2);
+	error_type = ls->ops_->reset(list_2);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"reset list_2", error_type);
+	if (True != ls->ops_->isEmpty(list_2))
+	{
+		printf("  ==> ERROR: list_2 must be empty\n");
+	}
+	// the tail of a circular source links back to its head
+	DLList *circular = DLList_createCircular(kCapacityList2);
+	for (u32 i = 0; i < kCapacityList2; ++i)
+	{
+		circular->ops_->insertLast(circular, TEST_newValue(i), sizeof(u32));
+	}
+	error_type = ls->ops_->concat(list_2, circular);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"concat list_2 + circular", error_type);
+	if (kCapacityList2 != ls->ops_->length(list_2))
+	{
+		printf("  ==> ERROR: concat of a circular list copied %d elements\n", ls->ops_->length(list_2));
+	}
+	circular->ops_->destroy(circular);
+	ls->ops_->reset(list_2);
+
+	printf("\n\n# Test Worker threads (head, tail and middle)\n");
+	TestContext ctx;
+	ctx.list_ = ConcurrentDLList_create(kThreadedCapacity);
+	atomic_init(&ctx.inserted_, 0);
+	atomic_init(&ctx.extracted_, 0);
+	thrd_t workers[kWorkers];
+	for (u16 i = 0; i < kWorkers; ++i)
+	{
+		thrd_create(&workers[i], TEST_worker, &ctx);
+	}
+	for (u16 i = 0; i < kWorkers; ++i)
+	{
+		thrd_join(workers[i], NULL);
+	}
+	u16 left = ctx.list_->ops_->length(ctx.list_);
+	while (NULL != (data = ctx.list_->ops_->extractFirst(ctx.list_)))
+	{
+		TEST_extracted(&ctx, data);
+	}
+	printf("\t %d elements left, inserted sum %llu, extracted sum %llu\n", left,
+		(unsigned long long)atomic_load(&ctx.inserted_), (unsigned long long)atomic_load(&ctx.extracted_));
+	if (atomic_load(&ctx.inserted_) != atomic_load(&ctx.extracted_) || 0 != ctx.list_->ops_->length(ctx.list_))
+	{
+		printf("  ==> ERROR: elements lost or duplicated\n");
+	}
+	ctx.list_->ops_->destroy(ctx.list_);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != ConcurrentDLList_create(0))
+	{
+		printf("ERROR: trying to create a list with capacity 0\n");
+	}
+	error_type = ls->ops_->insertLast(NULL, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insertLast NULL (NOT VALID)", error_type);
+	error_type = ls->ops_->insertFirst(list_1, NULL, kSingleSizeData4);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertFirst NULL data (NOT VALID)", error_type);
+	error_type = ls->ops_->resize(list_1, 0);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"resize to 0 (NOT VALID)", error_type);
+	error_type = ls->ops_->traverse(list_2, TEST_countNode);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"traverse empty list (NOT VALID)", error_type);
+	if (NULL != ls->ops_->extractAt(list_1, 1000) || NULL != ls->ops_->extractLast(list_2) ||
+		NULL != ls->ops_->first(list_2) || NULL != ls->ops_->last(list_2) || NULL != ls->ops_->at(NULL, 0))
+	{
+		printf("ERROR: empty or NULL list returns data\n");
+	}
+
+	// Work is done, clean the system
+	error_type = ls->ops_->destroy(list_1);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"destroy list_1", error_type);
+	error_type = ls->ops_->destroy(list_2);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"destroy list_2", error_type);
+	error_type = ls->ops_->destroy(ls);
+	TESTBASE_printFunctionResult(ls, (u8 *)"destroy ConcurrentDLList Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,225 @@
+// test_cursor.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the cursors (begin, rbegin, CURSOR_next/valid/get) and
+// traverseEx of Vector, List, DLList, Stack, Queue and ConcurrentDLList
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_dllist.h"
+#include "adt_stack.h"
+#include "adt_queue.h"
+#include "adt_concurrent_dllist.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u16 kCapacity = 10;
+
+// Context of TEST_visit: counts the calls and stops on a given data
+typedef struct visit_s
+{
+	u16 calls_;
+	void *stop_at_;
+} Visit;
+
+static boolean TEST_visit(MemoryNode *node, void *context)
+{
+	Visit *visit = (Visit *)context;
+	visit->calls_++;
+	return node->data_ == visit->stop_at_ ? False : True;
+}
+
+// Checks that the cursor walks exactly data[0..count) in order
+static void TEST_walk(const char *name, Cursor *cursor, void **data, u16 count, s16 step)
+{
+	u16 visited = 0;
+	for (s16 i = step > 0 ? 0 : count - 1; True == CURSOR_valid(cursor); CURSOR_next(cursor), i += step)
+	{
+		if (visited >= count || CURSOR_get(cursor) != data[i] || CURSOR_node(cursor)->data_ != data[i])
+		{
+			printf("  ==> ERROR: %s walks the wrong element at step %d\n", name, visited);
+			return;
+		}
+		visited++;
+	}
+	printf("\t %s visited %d elements\n", name, visited);
+	if (visited != count)
+	{
+		printf("  ==> ERROR: %s must visit %d elements\n", name, count);
+	}
+}
+
+static void TEST_traverseEx(const char *name, s16 error_type, Visit *visit, u16 expected_calls)
+{
+	TESTBASE_printFunctionResult(NULL, (u8 *)name, error_type);
+	if (expected_calls != visit->calls_)
+	{
+		printf("  ==> ERROR: %s called the callback %d times instead of %d\n", name, visit->calls_, expected_calls);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+	Visit visit;
+
+	TESTBASE_generateDataForTest();
+
+	Vector *vector = VECTOR_create(kCapacity);
+	List *list = LIST_create(kCapacity);
+	DLList *dllist = DLList_create(kCapacity);
+	Stack *stack = STACK_create(kCapacity);
+	Queue *queue = QUEUE_create(kCapacity);
+	DLList *concurrent = ConcurrentDLList_create(kCapacity);
+	if (NULL == vector || NULL == list || NULL == dllist || NULL == stack || NULL == queue || NULL == concurrent) {
+		printf("\n create returned a null container\n");
+		return -1;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test empty containers\n");
+	error_type = vector->ops_->begin(vector, &cursor);
+	TESTBASE_printFunctionResult(vector, (u8 *)"begin empty vector", error_type);
+	TEST_walk("empty vector cursor", &cursor, NULL, 0, 1);
+	dllist->ops_->rbegin(dllist, &cursor);
+	TEST_walk("empty dllist reverse cursor", &cursor, NULL, 0, -1);
+	concurrent->ops_->begin(concurrent, &cursor);
+	TEST_walk("empty concurrent dllist cursor", &cursor, NULL, 0, 1);
+	visit.calls_ = 0;
+	visit.stop_at_ = NULL;
+	error_type = list->ops_->traverseEx(list, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx empty list", error_type, &visit, 0);
+
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		vector->ops_->insertLast(vector, TestData.storage_ptr_test_A[i], (u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		u16 bytes = (u16)(strlen(TestData.storage_ptr_test_B[i]) + 1);
+		list->ops_->insertLast(list, TestData.storage_ptr_test_B[i], bytes);
+		stack->ops_->push(stack, TestData.storage_ptr_test_B[i], bytes);
+		queue->ops_->enqueue(queue, TestData.storage_ptr_test_B[i], bytes);
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		u16 bytes = (u16)(strlen(TestData.storage_ptr_test_C[i]) + 1);
+		dllist->ops_->insertLast(dllist, TestData.storage_ptr_test_C[i], bytes);
+		concurrent->ops_->insertLast(concurrent, TestData.storage_ptr_test_C[i], bytes);
+	}
+
+	printf("\n\n# Test cursors\n");
+	error_type = vector->ops_->begin(vector, &cursor);
+	TESTBASE_printFunctionResult(vector, (u8 *)"begin vector", error_type);
+	TEST_walk("vector cursor", &cursor, TestData.storage_ptr_test_A, kNumberOfStoragePtrTest_A, 1);
+	error_type = list->ops_->begin(list, &cursor);
+	TESTBASE_printFunctionResult(list, (u8 *)"begin list", error_type);
+	TEST_walk("list cursor", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, 1);
+	error_type = dllist->ops_->begin(dllist, &cursor);
+	TESTBASE_printFunctionResult(dllist, (u8 *)"begin dllist", error_type);
+	TEST_walk("dllist cursor", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, 1);
+	error_type = dllist->ops_->rbegin(dllist, &cursor);
+	TESTBASE_printFunctionResult(dllist, (u8 *)"rbegin dllist", error_type);
+	TEST_walk("dllist reverse cursor", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, -1);
+	error_type = stack->ops_->begin(stack, &cursor);
+	TESTBASE_printFunctionResult(stack, (u8 *)"begin stack", error_type);
+	TEST_walk("stack cursor (top first)", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, -1);
+	error_type = queue->ops_->begin(queue, &cursor);
+	TESTBASE_printFunctionResult(queue, (u8 *)"begin queue", error_type);
+	TEST_walk("queue cursor (front first)", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, 1);
+	concurrent->ops_->begin(concurrent, &cursor);
+	TEST_walk("concurrent dllist cursor", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, 1);
+	concurrent->ops_->rbegin(concurrent, &cursor);
+	TEST_walk("concurrent dllist reverse cursor", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, -1);
+	CURSOR_next(&cursor);
+	if (True == CURSOR_valid(&cursor) || NULL != CURSOR_get(&cursor))
+	{
+		printf("  ==> ERROR: a finished cursor must stay invalid\n");
+	}
+
+	printf("\n\n# Test traverseEx\n");
+	visit.calls_ = 0;
+	visit.stop_at_ = NULL;
+	error_type = vector->ops_->traverseEx(vector, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx vector", error_type, &visit, kNumberOfStoragePtrTest_A);
+	visit.calls_ = 0;
+	visit.stop_at_ = TestData.storage_ptr_test_A[3];
+	error_type = vector->ops_->traverseEx(vector, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx vector stopping at 3", error_type, &visit, 4);
+	visit.calls_ = 0;
+	visit.stop_at_ = TestData.storage_ptr_test_B[1];
+	error_type = list->ops_->traverseEx(list, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx list stopping at 1", error_type, &visit, 2);
+	visit.calls_ = 0;
+	visit.stop_at_ = TestData.storage_ptr_test_C[kNumberOfStoragePtrTest_C - 1];
+	error_type = dllist->ops_->traverseEx(dllist, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx dllist stopping at the last", error_type, &visit, kNumberOfStoragePtrTest_C);
+	visit.calls_ = 0;
+	visit.stop_at_ = TestData.storage_ptr_test_B[kNumberOfStoragePtrTest_B - 2];
+	error_type = stack->ops_->traverseEx(stack, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx stack stopping below the top", error_type, &visit, 2);
+	visit.calls_ = 0;
+	visit.stop_at_ = TestData.storage_ptr_test_B[0];
+	error_type = queue->ops_->traverseEx(queue, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx queue stopping at the front", error_type, &visit, 1);
+	visit.calls_ = 0;
+	visit.stop_at_ = TestData.storage_ptr_test_C[2];
+	error_type = concurrent->ops_->traverseEx(concurrent, TEST_visit, &visit);
+	TEST_traverseEx("traverseEx concurrent dllist stopping at 2", error_type, &visit, 3);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = vector->ops_->begin(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"begin vector NULL (NOT VALID)", error_type);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: a failed begin must leave the cursor invalid\n");
+	}
+	error_type = list->ops_->begin(list, NULL);
+	TESTBASE_printFunctionResult(list, (u8 *)"begin cursor NULL (NOT VALID)", error_type);
+	error_type = dllist->ops_->rbegin(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"rbegin dllist NULL (NOT VALID)", error_type);
+	error_type = stack->ops_->begin(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"begin stack NULL (NOT VALID)", error_type);
+	error_type = queue->ops_->begin(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"begin queue NULL (NOT VALID)", error_type);
+	error_type = vector->ops_->traverseEx(vector, NULL, NULL);
+	TESTBASE_printFunctionResult(vector, (u8 *)"traverseEx callback NULL (NOT VALID)", error_type);
+	error_type = list->ops_->traverseEx(NULL, TEST_visit, &visit);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"traverseEx list NULL (NOT VALID)", error_type);
+	CURSOR_next(NULL);
+	if (True == CURSOR_valid(NULL) || NULL != CURSOR_get(NULL) || NULL != CURSOR_node(NULL))
+	{
+		printf("  ==> ERROR: NULL cursors must be invalid\n");
+	}
+
+	// Work is done, clean the system; the payloads belong to TestData
+	while (NULL != vector->ops_->extractLast(vector));
+	vector->ops_->destroy(vector);
+	while (NULL != list->ops_->extractFirst(list));
+	list->ops_->destroy(list);
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+	while (NULL != stack->ops_->pop(stack));
+	stack->ops_->destroy(stack);
+	while (NULL != queue->ops_->dequeue(queue));
+	queue->ops_->destroy(queue);
+	while (NULL != concurrent->ops_->extractFirst(concurrent));
+	concurrent->ops_->destroy(concurrent);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,268 @@
+// test_deque.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the deque: insertions and extractions at both ends across
+// block boundaries and map growth, random access, the cursor walking from
+// block to block and the operations on the middle elements
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_deque.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+// more blocks than the first map has slots
+#define kElements 200
+
+// Payloads of the big battery, not owned by the deque: emptied with softReset
+static u32 values[kElements];
+
+// Copy of a test string owned by the deque, terminator included
+static void *TEST_copy(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MM->malloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Checks that the deque holds values[from..from + count) in order
+static void TEST_order(const char *name, Deque *deque, u16 from, u16 count)
+{
+	printf("\t %s: %d elements\n", name, deque->ops_->length(deque));
+	if (count != deque->ops_->length(deque))
+	{
+		printf("  ==> ERROR: %s must have %d elements\n", name, count);
+		return;
+	}
+	for (u16 i = 0; i < count; ++i)
+	{
+		if (&values[from + i] != deque->ops_->at(deque, i))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %d\n", name, i);
+			return;
+		}
+	}
+	if (0 != count && (&values[from] != deque->ops_->first(deque) || &values[from + count - 1] != deque->ops_->last(deque)))
+	{
+		printf("  ==> ERROR: wrong first or last element in %s\n", name);
+	}
+}
+
+static u64 sum = 0;
+
+static void TEST_sum(MemoryNode *node)
+{
+	sum += *(u32 *)node->data_;
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test insert at both ends\n");
+	Deque *deque = DEQUE_create(kElements);
+	if (NULL == deque)
+	{
+		printf("\n create returned a null deque\n");
+		return -1;
+	}
+	for (u16 i = kElements / 2; i < kElements; ++i)
+	{
+		error_type = deque->ops_->insertLast(deque, &values[i], sizeof(u32));
+	}
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertLast", error_type);
+	for (u16 i = kElements / 2; i > 0; --i)
+	{
+		error_type = deque->ops_->insertFirst(deque, &values[i - 1], sizeof(u32));
+	}
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertFirst", error_type);
+	TEST_order("inserted", deque, 0, kElements);
+	printf("\t %d blocks in a map of %d slots\n", deque->blocks_, deque->map_capacity_);
+	if (deque->map_capacity_ <= kDequeMapInitial)
+	{
+		printf("  ==> ERROR: the map must have grown\n");
+	}
+	error_type = deque->ops_->insertLast(deque, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertLast full (NOT VALID)", error_type);
+	error_type = deque->ops_->insertFirst(deque, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertFirst full (NOT VALID)", error_type);
+
+	printf("\n\n# Test cursor and traverse\n");
+	error_type = deque->ops_->begin(deque, &cursor);
+	TESTBASE_printFunctionResult(deque, (u8 *)"begin", error_type);
+	u16 visited = 0;
+	for (; True == CURSOR_valid(&cursor); CURSOR_next(&cursor), ++visited)
+	{
+		if (&values[visited] != CURSOR_get(&cursor))
+		{
+			printf("  ==> ERROR: the cursor must walk the elements in order\n");
+			break;
+		}
+	}
+	printf("\t cursor visited %d elements\n", visited);
+	if (kElements != visited)
+	{
+		printf("  ==> ERROR: the cursor must visit every element\n");
+	}
+	error_type = deque->ops_->traverse(deque, TEST_sum);
+	TESTBASE_printFunctionResult(deque, (u8 *)"traverse", error_type);
+	printf("\t sum %llu\n", (unsigned long long)sum);
+	if ((u64)kElements * (kElements - 1) / 2 != sum)
+	{
+		printf("  ==> ERROR: traverse must visit every element once\n");
+	}
+
+	printf("\n\n# Test extract at both ends\n");
+	for (u16 i = 0; i < kElements / 4; ++i)
+	{
+		if (&values[i] != deque->ops_->extractFirst(deque) || &values[kElements - 1 - i] != deque->ops_->extractLast(deque))
+		{
+			printf("  ==> ERROR: wrong element extracted at step %d\n", i);
+			break;
+		}
+	}
+	TEST_order("extracted 50 first and 50 last", deque, kElements / 4, kElements / 2);
+	printf("\t %d blocks in use\n", deque->blocks_);
+
+	printf("\n\n# Test insert and extract in the middle\n");
+	u32 marker_front = 1000;
+	u32 marker_back = 2000;
+	error_type = deque->ops_->insertAt(deque, &marker_front, sizeof(u32), 10);
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertAt 10", error_type);
+	error_type = deque->ops_->insertAt(deque, &marker_back, sizeof(u32), 90);
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertAt 90", error_type);
+	if (&marker_front != deque->ops_->at(deque, 10) || &marker_back != deque->ops_->at(deque, 90) ||
+		&values[59] != deque->ops_->at(deque, 9) || &values[60] != deque->ops_->at(deque, 11) ||
+		&values[138] != deque->ops_->at(deque, 89) || &values[139] != deque->ops_->at(deque, 91))
+	{
+		printf("  ==> ERROR: insertAt must move the elements one place\n");
+	}
+	if (&marker_back != deque->ops_->extractAt(deque, 90) || &marker_front != deque->ops_->extractAt(deque, 10))
+	{
+		printf("  ==> ERROR: extractAt must return the element at the position\n");
+	}
+	TEST_order("inserted and extracted", deque, kElements / 4, kElements / 2);
+	if (NULL != deque->ops_->at(deque, kElements / 2) || NULL != deque->ops_->extractAt(deque, kElements / 2))
+	{
+		printf("  ==> ERROR: the positions past the last element must not be valid\n");
+	}
+
+	printf("\n\n# Test back and forth over a block boundary\n");
+	while (0 != (deque->first_ + deque->length_) % kDequeBlockNodes)
+	{
+		deque->ops_->extractLast(deque);
+	}
+	u16 length = deque->length_;
+	u16 blocks = deque->blocks_;
+	for (u16 i = 0; i < 100; ++i)
+	{
+		deque->ops_->insertLast(deque, &values[0], sizeof(u32));
+		deque->ops_->extractLast(deque);
+	}
+	if (length != deque->length_ || blocks != deque->blocks_ || NULL == deque->spare_)
+	{
+		printf("  ==> ERROR: the block released must be kept as the spare one\n");
+	}
+	while (False == deque->ops_->isEmpty(deque))
+	{
+		deque->ops_->extractFirst(deque);
+	}
+	printf("\t emptied, %d blocks in use\n", deque->blocks_);
+	if (0 != deque->blocks_ || NULL != deque->ops_->first(deque) || NULL != deque->ops_->last(deque))
+	{
+		printf("  ==> ERROR: an empty deque must not keep blocks in use\n");
+	}
+	deque->ops_->insertFirst(deque, &values[1], sizeof(u32));
+	deque->ops_->insertLast(deque, &values[2], sizeof(u32));
+	deque->ops_->insertFirst(deque, &values[0], sizeof(u32));
+	TEST_order("refilled", deque, 0, 3);
+	error_type = deque->ops_->softReset(deque);
+	TESTBASE_printFunctionResult(deque, (u8 *)"softReset", error_type);
+
+	printf("\n\n# Test resize, concat and reset\n");
+	Deque *strings = DEQUE_create(kNumberOfStoragePtrTest_A);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		strings->ops_->insertLast(strings, TEST_copy(TestData.storage_ptr_test_A[i]),
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+	}
+	Deque *other = DEQUE_create(2);
+	other->ops_->insertLast(other, TEST_copy(TestData.storage_ptr_test_B[0]), (u16)(strlen(TestData.storage_ptr_test_B[0]) + 1));
+	error_type = other->ops_->concat(other, strings);
+	TESTBASE_printFunctionResult(other, (u8 *)"concat", error_type);
+	if (kNumberOfStoragePtrTest_A + 1 != other->ops_->length(other) || kNumberOfStoragePtrTest_A + 2 != other->ops_->capacity(other) ||
+		0 != strcmp(other->ops_->at(other, kNumberOfStoragePtrTest_A), TestData.storage_ptr_test_A[kNumberOfStoragePtrTest_A - 1]) ||
+		other->ops_->at(other, 1) == strings->ops_->at(strings, 0))
+	{
+		printf("  ==> ERROR: concat must append copies of the elements\n");
+	}
+	error_type = other->ops_->resize(other, 3);
+	TESTBASE_printFunctionResult(other, (u8 *)"resize", error_type);
+	if (3 != other->ops_->length(other) || True != other->ops_->isFull(other))
+	{
+		printf("  ==> ERROR: resize must drop the last elements\n");
+	}
+	other->ops_->print(other);
+	error_type = other->ops_->reset(other);
+	TESTBASE_printFunctionResult(other, (u8 *)"reset", error_type);
+	if (True != other->ops_->isEmpty(other))
+	{
+		printf("  ==> ERROR: reset must empty the deque\n");
+	}
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != DEQUE_create(0))
+	{
+		printf("  ==> ERROR: create with capacity 0 must return NULL\n");
+	}
+	error_type = deque->ops_->insertLast(NULL, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insertLast NULL (NOT VALID)", error_type);
+	error_type = deque->ops_->insertFirst(deque, NULL, sizeof(u32));
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertFirst data NULL (NOT VALID)", error_type);
+	error_type = deque->ops_->insertAt(deque, &values[0], 0, 0);
+	TESTBASE_printFunctionResult(deque, (u8 *)"insertAt bytes 0 (NOT VALID)", error_type);
+	error_type = deque->ops_->resize(deque, 0);
+	TESTBASE_printFunctionResult(deque, (u8 *)"resize 0 (NOT VALID)", error_type);
+	error_type = deque->ops_->concat(deque, NULL);
+	TESTBASE_printFunctionResult(deque, (u8 *)"concat NULL (NOT VALID)", error_type);
+	error_type = deque->ops_->begin(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"begin NULL (NOT VALID)", error_type);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: begin on a NULL deque must leave the cursor invalid\n");
+	}
+	error_type = deque->ops_->traverse(deque, NULL);
+	TESTBASE_printFunctionResult(deque, (u8 *)"traverse callback NULL (NOT VALID)", error_type);
+	if (NULL != deque->ops_->extractFirst(deque) || NULL != deque->ops_->extractLast(NULL) || NULL != deque->ops_->at(NULL, 0))
+	{
+		printf("  ==> ERROR: extracting from an empty or NULL deque must return NULL\n");
+	}
+	error_type = deque->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	deque->ops_->destroy(deque);
+	strings->ops_->destroy(strings);
+	other->ops_->destroy(other);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,223 @@
+// test_durable_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the durable queue: replay of the log after reopening,
+// acknowledged dequeues, deletion of consumed segments and recovery of a
+// log with a torn tail
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_queue.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const char *kDurableFile = "test_durable_queue";
+const u16 kCapacity = 10;
+const u16 kBatch = 4;
+// a segment holds three or four records of the test strings
+const u32 kSegmentBytes = 80;
+const u32 kMaxSegments = 100;
+
+static void TEST_segmentName(u32 segment, char *name)
+{
+	sprintf(name, "%s.%08u.log", kDurableFile, segment);
+}
+
+static boolean TEST_exists(const char *name)
+{
+	FILE *file = fopen(name, "rb");
+	if (NULL == file)
+	{
+		return False;
+	}
+	fclose(file);
+	return True;
+}
+
+// Returns the number of segment files on disk
+static u32 TEST_segments()
+{
+	char name[64];
+	u32 count = 0;
+	for (u32 i = 0; i < kMaxSegments; ++i)
+	{
+		TEST_segmentName(i, name);
+		count += True == TEST_exists(name) ? 1 : 0;
+	}
+	return count;
+}
+
+// Removes every file of the log
+static void TEST_removeLog()
+{
+	char name[64];
+	for (u32 i = 0; i < kMaxSegments; ++i)
+	{
+		TEST_segmentName(i, name);
+		remove(name);
+	}
+	sprintf(name, "%s.meta", kDurableFile);
+	remove(name);
+}
+
+// Checks that the queue holds copies of the strings data[0..count) in order
+static void TEST_content(const char *name, Queue *queue, void **data, u16 count)
+{
+	u16 visited = 0;
+	Cursor cursor;
+	for (queue->ops_->begin(queue, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+	{
+		MemoryNode *node = CURSOR_node(&cursor);
+		if (visited >= count || node->data_ == data[visited] || 0 != strcmp(node->data_, data[visited]))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %d\n", name, visited);
+			return;
+		}
+		visited++;
+	}
+	printf("\t %s: %d elements\n", name, visited);
+	if (visited != count)
+	{
+		printf("  ==> ERROR: %s must have %d elements\n", name, count);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+	TEST_removeLog();
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test enqueue and replay\n");
+	Queue *queue = QUEUE_openDurable(kDurableFile, kCapacity, kBatch, kSegmentBytes);
+	if (NULL == queue)
+	{
+		printf("\n openDurable returned a null queue\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = queue->ops_->enqueue(queue, TestData.storage_ptr_test_A[i],
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+	}
+	TESTBASE_printFunctionResult(queue, (u8 *)"enqueue", error_type);
+	error_type = queue->ops_->enqueue(queue, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(queue, (u8 *)"enqueue full (NOT VALID)", error_type);
+	TEST_content("before closing", queue, TestData.storage_ptr_test_A, kNumberOfStoragePtrTest_A);
+	printf("\t %d segment files\n", TEST_segments());
+	error_type = queue->ops_->destroy(queue);
+	TESTBASE_printFunctionResult(queue, (u8 *)"destroy", error_type);
+	// the log holds more elements than the capacity, it is grown
+	queue = QUEUE_openDurable(kDurableFile, 2, kBatch, kSegmentBytes);
+	TEST_content("replayed", queue, TestData.storage_ptr_test_A, kNumberOfStoragePtrTest_A);
+
+	printf("\n\n# Test dequeue and acknowledged offset\n");
+	for (u16 i = 0; i < 3; ++i)
+	{
+		char *data = queue->ops_->dequeue(queue);
+		if (NULL == data || 0 != strcmp(data, TestData.storage_ptr_test_A[i]))
+		{
+			printf("  ==> ERROR: dequeue returned the wrong element %d\n", i);
+		}
+		MM->free(data);
+	}
+	error_type = queue->ops_->sync(queue);
+	TESTBASE_printFunctionResult(queue, (u8 *)"sync", error_type);
+	queue->ops_->destroy(queue);
+	queue = QUEUE_openDurable(kDurableFile, kCapacity, kBatch, kSegmentBytes);
+	TEST_content("replayed after 3 dequeues", queue, TestData.storage_ptr_test_A + 3, kNumberOfStoragePtrTest_A - 3);
+
+	printf("\n\n# Test truncation of consumed segments\n");
+	u32 segments = TEST_segments();
+	error_type = queue->ops_->reset(queue);
+	TESTBASE_printFunctionResult(queue, (u8 *)"reset", error_type);
+	char name[64];
+	TEST_segmentName(0, name);
+	printf("\t %d segment files before consuming everything, %d after\n", segments, TEST_segments());
+	if (True == TEST_exists(name) || TEST_segments() >= segments || True != queue->ops_->isEmpty(queue))
+	{
+		printf("  ==> ERROR: the consumed segments must be deleted\n");
+	}
+	queue->ops_->destroy(queue);
+	queue = QUEUE_openDurable(kDurableFile, kCapacity, kBatch, kSegmentBytes);
+	TEST_content("replayed after the truncation", queue, NULL, 0);
+
+	printf("\n\n# Test torn tail\n");
+	Queue *source = QUEUE_create(kCapacity);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		source->ops_->enqueue(source, TestData.storage_ptr_test_B[i], (u16)(strlen(TestData.storage_ptr_test_B[i]) + 1));
+	}
+	error_type = queue->ops_->concat(queue, source);
+	TESTBASE_printFunctionResult(queue, (u8 *)"concat", error_type);
+	queue->ops_->destroy(queue);
+	// a crash in the middle of a record leaves part of it at the end
+	u32 last = 0;
+	for (u32 i = 0; i < kMaxSegments; ++i)
+	{
+		TEST_segmentName(i, name);
+		last = True == TEST_exists(name) ? i : last;
+	}
+	TEST_segmentName(last, name);
+	FILE *file = fopen(name, "ab");
+	fwrite(TestData.single_ptr_data_2, 1, kSingleSizeData2, file);
+	fclose(file);
+	queue = QUEUE_openDurable(kDurableFile, kCapacity, kBatch, kSegmentBytes);
+	TEST_content("replayed with a torn tail", queue, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B);
+	// the tail is cut, so the next records are found by the next replay
+	error_type = queue->ops_->enqueue(queue, TestData.storage_ptr_test_C[0],
+		(u16)(strlen(TestData.storage_ptr_test_C[0]) + 1));
+	TESTBASE_printFunctionResult(queue, (u8 *)"enqueue after the torn tail", error_type);
+	queue->ops_->destroy(queue);
+	queue = QUEUE_openDurable(kDurableFile, kCapacity, kBatch, kSegmentBytes);
+	char *back = queue->ops_->back(queue);
+	if (kNumberOfStoragePtrTest_B + 1 != queue->ops_->length(queue) || NULL == back ||
+		0 != strcmp(back, TestData.storage_ptr_test_C[0]))
+	{
+		printf("  ==> ERROR: the element enqueued after the torn tail must be replayed\n");
+	}
+	queue->ops_->print(queue);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != QUEUE_openDurable(NULL, kCapacity, kBatch, kSegmentBytes) ||
+		NULL != QUEUE_openDurable(kDurableFile, 0, kBatch, kSegmentBytes) ||
+		NULL != QUEUE_openDurable(kDurableFile, kCapacity, 0, kSegmentBytes) ||
+		NULL != QUEUE_openDurable("missing_directory/queue", kCapacity, kBatch, kSegmentBytes))
+	{
+		printf("  ==> ERROR: openDurable with wrong parameters must return NULL\n");
+	}
+	error_type = queue->ops_->enqueue(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"enqueue queue NULL (NOT VALID)", error_type);
+	error_type = queue->ops_->enqueue(queue, NULL, kSingleSizeData1);
+	TESTBASE_printFunctionResult(queue, (u8 *)"enqueue data NULL (NOT VALID)", error_type);
+	error_type = queue->ops_->enqueue(queue, TestData.single_ptr_data_1, 0);
+	TESTBASE_printFunctionResult(queue, (u8 *)"enqueue bytes 0 (NOT VALID)", error_type);
+	error_type = queue->ops_->sync(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"sync NULL (NOT VALID)", error_type);
+	error_type = queue->ops_->concat(queue, NULL);
+	TESTBASE_printFunctionResult(queue, (u8 *)"concat source NULL (NOT VALID)", error_type);
+	error_type = queue->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	error_type = source->ops_->sync(source);
+	TESTBASE_printFunctionResult(source, (u8 *)"sync of a queue in memory", error_type);
+	queue->ops_->destroy(queue);
+	while (NULL != source->ops_->dequeue(source));
+	source->ops_->destroy(source);
+	TEST_removeLog();
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
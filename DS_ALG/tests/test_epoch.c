@@ -0,0 +1,223 @@
+// test_epoch.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the epoch-based reclamation domain
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_epoch.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kTestThreads 8
+const u16 kBatchSize = 8;
+const u32 kPairsPerThread = 20000;
+
+static _Atomic u32 freed_by_callback;
+
+static void TEST_countingFree(void *ptr)
+{
+	atomic_fetch_add(&freed_by_callback, 1);
+	MM->free(ptr);
+}
+
+// Lock-free stack of MM nodes: popped nodes are retired, not freed, so a
+// thread still reading one in TEST_pop never touches freed memory
+typedef struct test_node_s {
+	struct test_node_s *next_;
+	u32 value_;
+} TestNode;
+
+typedef struct test_context_s {
+	EpochDomain *domain_;
+	_Atomic(TestNode *) top_;
+	_Atomic u64 sum_;
+} TestContext;
+
+static void TEST_push(TestContext *ctx, EpochRecord *record, u32 value)
+{
+	(void)record;
+	TestNode *node = MM->malloc(sizeof(TestNode));
+	node->value_ = value;
+	node->next_ = atomic_load(&ctx->top_);
+	while (!atomic_compare_exchange_weak(&ctx->top_, &node->next_, node));
+}
+
+static u32 TEST_pop(TestContext *ctx, EpochRecord *record)
+{
+	ctx->domain_->ops_->pin(record);
+	TestNode *node = atomic_load(&ctx->top_);
+	while (NULL != node && !atomic_compare_exchange_weak(&ctx->top_, &node, node->next_));
+	u32 value = 0;
+	if (NULL != node)
+	{
+		value = node->value_;
+		ctx->domain_->ops_->retire(record, node, TEST_countingFree);
+	}
+	ctx->domain_->ops_->unpin(record);
+	return value;
+}
+
+static int TEST_worker(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	EpochRecord *record = ctx->domain_->ops_->registerThread(ctx->domain_);
+	u64 sum = 0;
+	for (u32 i = 1; i <= kPairsPerThread; ++i)
+	{
+		TEST_push(ctx, record, i);
+		sum += TEST_pop(ctx, record);
+	}
+	atomic_fetch_add(&ctx->sum_, sum);
+	ctx->domain_->ops_->unregisterThread(record);
+	return 0;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	EpochDomain *e = EPOCH_create(1);
+	EpochDomain *domain_1 = EPOCH_create(kBatchSize);
+	if (NULL == e || NULL == domain_1) {
+		printf("\n create returned a null domain\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + EpochDomain: %zu\n", sizeof(EpochDomain));
+	printf("  + EpochRecord: %zu\n", sizeof(EpochRecord));
+	printf("  + EpochChunk: %zu\n", sizeof(EpochChunk));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	EpochRecord *reader = e->ops_->registerThread(domain_1);
+	EpochRecord *writer = e->ops_->registerThread(domain_1);
+	if (NULL == reader || NULL == writer || reader == writer)
+	{
+		printf("  ==> ERROR: registerThread doesn't return a record per thread\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Retire while another thread is pinned\n");
+	error_type = e->ops_->pin(reader);
+	TESTBASE_printFunctionResult(reader, (u8 *)"pin reader", error_type);
+	error_type = e->ops_->pin(reader);
+	TESTBASE_printFunctionResult(reader, (u8 *)"pin reader (nested)", error_type);
+	atomic_init(&freed_by_callback, 0);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		e->ops_->pin(writer);
+		error_type = e->ops_->retire(writer, TestData.storage_ptr_test_A[i], TEST_countingFree);
+		TestData.storage_ptr_test_A[i] = NULL;
+		TESTBASE_printFunctionResult(writer, (u8 *)"retire writer", error_type);
+		e->ops_->unpin(writer);
+	}
+	for (u16 i = 0; i < 4; ++i)
+	{
+		e->ops_->tryAdvance(domain_1);
+	}
+	e->ops_->collect(writer);
+	printf("domain_1:\n");
+	e->ops_->print(domain_1);
+	if (0 != atomic_load(&freed_by_callback) || e->ops_->epoch(domain_1) > 1)
+	{
+		printf("  ==> ERROR: memory freed while a reader was pinned (%u freed)\n", atomic_load(&freed_by_callback));
+	}
+
+	printf("\n\n# Test Unpin lets the epoch advance\n");
+	error_type = e->ops_->unpin(reader);
+	TESTBASE_printFunctionResult(reader, (u8 *)"unpin reader (nested)", error_type);
+	if (True == e->ops_->tryAdvance(domain_1))
+	{
+		printf("  ==> ERROR: nested unpin released the reader\n");
+	}
+	error_type = e->ops_->unpin(reader);
+	TESTBASE_printFunctionResult(reader, (u8 *)"unpin reader", error_type);
+	for (u16 i = 0; i < 2; ++i)
+	{
+		e->ops_->tryAdvance(domain_1);
+	}
+	e->ops_->collect(writer);
+	printf("\t epoch %u, %u freed, %u pending\n", e->ops_->epoch(domain_1),
+		atomic_load(&freed_by_callback), e->ops_->pending(writer));
+	if (kNumberOfStoragePtrTest_A != atomic_load(&freed_by_callback) || 0 != e->ops_->pending(writer))
+	{
+		printf("  ==> ERROR: retired memory not freed after two epochs\n");
+	}
+	error_type = e->ops_->unpin(reader);
+	TESTBASE_printFunctionResult(reader, (u8 *)"unpin reader (NOT VALID)", error_type);
+
+	printf("\n\n# Test Unregister / register reuses records\n");
+	e->ops_->pin(writer);
+	error_type = e->ops_->unregisterThread(writer);
+	TESTBASE_printFunctionResult(writer, (u8 *)"unregister pinned writer (NOT VALID)", error_type);
+	e->ops_->unpin(writer);
+	error_type = e->ops_->unregisterThread(writer);
+	TESTBASE_printFunctionResult(writer, (u8 *)"unregister writer", error_type);
+	EpochRecord *again = e->ops_->registerThread(domain_1);
+	if (again != writer)
+	{
+		printf("  ==> ERROR: the released record is not reused\n");
+	}
+	e->ops_->unregisterThread(again);
+	e->ops_->unregisterThread(reader);
+
+	printf("\n\n# Test Lock-free stack threads\n");
+	TestContext ctx;
+	ctx.domain_ = EPOCH_create(kBatchSize);
+	atomic_init(&ctx.top_, NULL);
+	atomic_init(&ctx.sum_, 0);
+	atomic_store(&freed_by_callback, 0);
+	thrd_t workers[kTestThreads];
+	for (u16 i = 0; i < kTestThreads; ++i)
+	{
+		thrd_create(&workers[i], TEST_worker, &ctx);
+	}
+	for (u16 i = 0; i < kTestThreads; ++i)
+	{
+		thrd_join(workers[i], NULL);
+	}
+	u64 expected = (u64)kTestThreads * kPairsPerThread * (kPairsPerThread + 1) / 2;
+	printf("\t sum %llu (expected %llu), %u nodes freed, epoch %u\n",
+		(unsigned long long)atomic_load(&ctx.sum_), (unsigned long long)expected,
+		atomic_load(&freed_by_callback), e->ops_->epoch(ctx.domain_));
+	if (expected != atomic_load(&ctx.sum_) || kTestThreads * kPairsPerThread != atomic_load(&freed_by_callback))
+	{
+		printf("  ==> ERROR: nodes lost, duplicated or not freed\n");
+	}
+	e->ops_->destroy(ctx.domain_);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != EPOCH_create(0) || NULL != e->ops_->registerThread(NULL))
+	{
+		printf("ERROR: NULL domain or 0 batch size accepted\n");
+	}
+	error_type = e->ops_->pin(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"pin NULL (NOT VALID)", error_type);
+	error_type = e->ops_->retire(NULL, TestData.single_ptr_data_1, NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"retire NULL record (NOT VALID)", error_type);
+	error_type = e->ops_->retire(reader, NULL, NULL);
+	TESTBASE_printFunctionResult(reader, (u8 *)"retire NULL pointer (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = e->ops_->destroy(domain_1);
+	TESTBASE_printFunctionResult(domain_1, (u8 *)"destroy domain_1", error_type);
+	error_type = e->ops_->destroy(e);
+	TESTBASE_printFunctionResult(e, (u8 *)"destroy EpochDomain Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,226 @@
+// test_facade.cpp
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the C++ facade over the C ADTs: RAII, deep copies,
+// moves that steal the C container, growth and <algorithm> on the iterators.
+// test_base.c is C only, so this battery prints its own results.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+#include "adt_facade.hpp"
+
+const u16 kCapacity = 2;
+const u32 kElements = 20;
+
+// Counts the live instances to check that every element is destroyed
+struct Tracked
+{
+	static s32 live;
+	u32 value_;
+
+	Tracked(u32 value) : value_(value) { ++live; }
+	Tracked(const Tracked &other) : value_(other.value_) { ++live; }
+	~Tracked() { --live; }
+};
+s32 Tracked::live = 0;
+
+static void TEST_check(const char *name, bool ok)
+{
+	if (!ok)
+	{
+		printf("  ==> ERROR: %s\n", name);
+	}
+}
+
+static void TEST_result(const char *name, s16 error_type)
+{
+	printf("\t%s: %d\n", name, error_type);
+}
+
+static void TEST_vector()
+{
+	printf("\n\n# Test ds::vector\n");
+	ds::vector<u32> vector(kCapacity);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		vector.push_back(i);
+	}
+	printf("\t length %d, capacity %d\n", vector.size(), vector.capacity());
+	TEST_check("vector must grow past its capacity", kElements == vector.size() && vector.capacity() >= kElements);
+	TEST_check("vector operator[] and back", 7 == vector[7] && kElements - 1 == vector.back());
+	TEST_check("std::accumulate over vector", kElements * (kElements - 1) / 2 ==
+		std::accumulate(vector.begin(), vector.end(), 0u));
+
+	std::sort(vector.begin(), vector.end(), std::greater<u32>());
+	TEST_check("std::sort descending", kElements - 1 == vector.front() && 0 == vector.back() &&
+		std::is_sorted(vector.begin(), vector.end(), std::greater<u32>()));
+	TEST_check("std::lower_bound", vector.end() - 6 ==
+		std::lower_bound(vector.begin(), vector.end(), 5u, std::greater<u32>()));
+
+	ds::vector<u32> copy(vector);
+	copy[0] = 100;
+	TEST_check("copy must be deep", 100 == copy[0] && kElements - 1 == vector[0] && copy.native() != vector.native());
+
+	Vector *native = vector.native();
+	ds::vector<u32> moved(std::move(vector));
+	TEST_check("move must steal the C vector", native == moved.native() && nullptr == vector.native() &&
+		0 == vector.size() && vector.begin() == vector.end());
+	vector = std::move(copy);
+	TEST_check("move assignment", 100 == vector[0] && nullptr == copy.native());
+
+	TEST_result("pop_back", moved.pop_back());
+	moved.clear();
+	TEST_result("pop_back when empty (NOT VALID)", moved.pop_back());
+	TEST_check("clear keeps the C vector", moved.empty() && native == moved.native());
+
+	ds::vector<u32> lazy;
+	TEST_check("default vector allocates nothing", nullptr == lazy.native() && 0 == lazy.capacity());
+	std::copy(moved.begin(), moved.end(), std::back_inserter(lazy));
+	std::copy(vector.cbegin(), vector.cend(), std::back_inserter(lazy));
+	TEST_check("std::back_inserter", kElements == lazy.size() && 100 == lazy.front());
+}
+
+static void TEST_lists()
+{
+	printf("\n\n# Test ds::list\n");
+	ds::list<u32> list(kCapacity);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		list.push_back(i);
+	}
+	list.push_front(99);
+	printf("\t length %d, capacity %d, front %u, back %u\n", list.size(), list.capacity(), list.front(), list.back());
+	TEST_check("list must grow past its capacity", kElements + 1 == list.size() && 99 == list.front());
+	TEST_check("std::find over list", 5 == std::distance(list.begin(), std::find(list.begin(), list.end(), 4u)));
+	TEST_check("std::count_if over list", 10 == std::count_if(list.cbegin(), list.cend(),
+		[](u32 value) { return value < 10; }));
+	TEST_result("pop_back", list.pop_back());
+	TEST_result("pop_front", list.pop_front());
+	TEST_check("pops", kElements - 1 == list.size() && 0 == list.front() && kElements - 2 == list.back());
+
+	ds::list<u32> copy = list;
+	List *native = list.native();
+	ds::list<u32> moved = std::move(list);
+	TEST_check("list copy and move", copy.native() != native && moved.native() == native && list.empty() &&
+		std::equal(copy.begin(), copy.end(), moved.begin()));
+
+	printf("\n\n# Test ds::dllist\n");
+	ds::dllist<u32> dllist;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		dllist.push_back(i);
+	}
+	std::reverse(dllist.begin(), dllist.end());
+	TEST_check("std::reverse over dllist", kElements - 1 == dllist.front() && 0 == dllist.back());
+	TEST_check("walk back from end", 0 == *std::prev(dllist.end()) && 1 == *std::prev(dllist.end(), 2));
+	auto reverse = std::make_reverse_iterator(dllist.end());
+	TEST_check("reverse iterators", 0 == *reverse && std::is_sorted(reverse, std::make_reverse_iterator(dllist.begin())));
+	TEST_result("pop_back", dllist.pop_back());
+	TEST_check("dllist pop_back", 1 == dllist.back());
+}
+
+static void TEST_adaptors()
+{
+	printf("\n\n# Test ds::queue and ds::stack\n");
+	ds::queue<u32> queue(kCapacity);
+	ds::stack<u32> stack(kCapacity);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		queue.push(i);
+		stack.push(i);
+	}
+	printf("\t queue front %u back %u, stack top %u\n", queue.front(), queue.back(), stack.top());
+	TEST_check("queue and stack must grow", kElements == queue.size() && kElements == stack.size());
+	TEST_check("stack top doesn't extract", kElements - 1 == stack.top() && kElements == stack.size());
+
+	ds::queue<u32> queue_copy(queue);
+	ds::stack<u32> stack_copy(stack);
+	bool in_order = true;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		in_order = in_order && i == queue_copy.front() && kElements - 1 - i == stack_copy.top();
+		queue_copy.pop();
+		stack_copy.pop();
+	}
+	TEST_check("queue is FIFO and stack LIFO after copy", in_order && queue_copy.empty() && stack_copy.empty());
+	TEST_result("queue pop when empty (NOT VALID)", queue_copy.pop());
+	TEST_result("stack pop when empty (NOT VALID)", stack_copy.pop());
+
+	ds::queue<u32> queue_moved(std::move(queue));
+	ds::stack<u32> stack_moved(std::move(stack));
+	TEST_check("queue and stack move", queue.empty() && stack.empty() && kElements == queue_moved.size() &&
+		kElements == stack_moved.size());
+}
+
+static void TEST_lifetime()
+{
+	printf("\n\n# Test element lifetime\n");
+	{
+		ds::vector<Tracked> vector;
+		ds::dllist<Tracked> dllist;
+		ds::queue<Tracked> queue;
+		ds::stack<Tracked> stack;
+		for (u32 i = 0; i < kElements; ++i)
+		{
+			vector.emplace_back(i);
+			dllist.emplace_front(i);
+			queue.emplace(i);
+			stack.emplace(i);
+		}
+		ds::vector<Tracked> copy(vector);
+		ds::dllist<Tracked> moved(std::move(dllist));
+		printf("\t live elements %d\n", Tracked::live);
+		TEST_check("one live element per payload", (s32)(kElements * 5) == Tracked::live);
+		vector.pop_back();
+		moved.pop_front();
+		TEST_check("pops destroy the element", (s32)(kElements * 5 - 2) == Tracked::live);
+	}
+	TEST_check("destructors must destroy every element", 0 == Tracked::live);
+
+	ds::list<double> doubles;
+	ds::stack<u64> wide;
+	bool aligned = true;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		doubles.push_back(i * 0.5);
+		wide.push(i);
+		aligned = aligned && 0 == (uintptr_t)&doubles.back() % alignof(double) && 0 == (uintptr_t)&wide.top() % alignof(u64);
+	}
+	TEST_check("payloads must be aligned for their type", aligned);
+
+	std::vector<u32, ds::mm_allocator<u32>> std_vector;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		std_vector.push_back(i);
+	}
+	TEST_check("std::vector with mm_allocator", kElements == std_vector.size() && kElements - 1 == std_vector.back());
+}
+
+int main()
+{
+	printf("Size of:\n");
+	printf("  + ds::vector<u32>: %zu\n", sizeof(ds::vector<u32>));
+	printf("  + ds::list<u32>: %zu\n", sizeof(ds::list<u32>));
+	printf("  + ds::queue<u32>: %zu\n", sizeof(ds::queue<u32>));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	TEST_vector();
+	TEST_lists();
+	TEST_adaptors();
+	TEST_lifetime();
+
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,175 @@
+// test_fast_path.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the inline fast path: every fast operation must give the
+// same result as its ops_ version
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_fast_path.h"
+#include "adt_concurrent_dllist.h"
+#include "adt_arena.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u16 kCapacity = 10;
+
+static void TEST_compare(const char *name, boolean same)
+{
+	if (True != same)
+	{
+		printf("  ==> ERROR: %s differs from the ops_ version\n", name);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	Vector *vector = VECTOR_create(kCapacity);
+	List *list = LIST_create(kCapacity);
+	DLList *dllist = DLList_create(kCapacity);
+	Stack *stack = STACK_create(kCapacity);
+	Queue *queue = QUEUE_create(kCapacity);
+	if (NULL == vector || NULL == list || NULL == dllist || NULL == stack || NULL == queue) {
+		printf("\n create returned a null container\n");
+		return -1;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Vector\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = VECTOR_fastInsertLast(vector, TestData.storage_ptr_test_A[i],
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TESTBASE_printFunctionResult(vector, (u8 *)"fastInsertLast vector", error_type);
+	}
+	error_type = VECTOR_fastInsertLast(vector, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(vector, (u8 *)"fastInsertLast vector when full (NOT VALID)", error_type);
+	vector->ops_->print(vector);
+	TEST_compare("VECTOR_fastLength", vector->ops_->length(vector) == VECTOR_fastLength(vector));
+	TEST_compare("VECTOR_fastCapacity", vector->ops_->capacity(vector) == VECTOR_fastCapacity(vector));
+	TEST_compare("VECTOR_fastIsFull", vector->ops_->isFull(vector) == VECTOR_fastIsFull(vector));
+	TEST_compare("VECTOR_fastIsEmpty", vector->ops_->isEmpty(vector) == VECTOR_fastIsEmpty(vector));
+	TEST_compare("VECTOR_fastFirst", vector->ops_->first(vector) == VECTOR_fastFirst(vector));
+	TEST_compare("VECTOR_fastLast", vector->ops_->last(vector) == VECTOR_fastLast(vector));
+	for (u16 i = 0; i < kCapacity; ++i)
+	{
+		TEST_compare("VECTOR_fastAt", vector->ops_->at(vector, i) == VECTOR_fastAt(vector, i));
+	}
+
+	printf("\n\n# Test List\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		error_type = LIST_fastInsertLast(list, TestData.storage_ptr_test_B[i],
+			(u16)(strlen(TestData.storage_ptr_test_B[i]) + 1));
+		TESTBASE_printFunctionResult(list, (u8 *)"fastInsertLast list", error_type);
+	}
+	list->ops_->insertFirst(list, TestData.single_ptr_data_1, kSingleSizeData1);
+	list->ops_->print(list);
+	TEST_compare("LIST_fastLength", list->ops_->length(list) == LIST_fastLength(list));
+	TEST_compare("LIST_fastIsFull", list->ops_->isFull(list) == LIST_fastIsFull(list));
+	TEST_compare("LIST_fastFirst", list->ops_->first(list) == LIST_fastFirst(list));
+	TEST_compare("LIST_fastLast", list->ops_->last(list) == LIST_fastLast(list));
+	for (u16 i = 0; i < LIST_fastLength(list); ++i)
+	{
+		TEST_compare("LIST_fastAt", list->ops_->at(list, i) == LIST_fastAt(list, i));
+	}
+
+	printf("\n\n# Test DLList\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		error_type = DLList_fastInsertLast(dllist, TestData.storage_ptr_test_C[i],
+			(u16)(strlen(TestData.storage_ptr_test_C[i]) + 1));
+		TESTBASE_printFunctionResult(dllist, (u8 *)"fastInsertLast dllist", error_type);
+	}
+	void *last = dllist->ops_->extractLast(dllist);
+	TEST_compare("DLList_fastInsertLast prev link", TestData.storage_ptr_test_C[kNumberOfStoragePtrTest_C - 1] == last &&
+		TestData.storage_ptr_test_C[kNumberOfStoragePtrTest_C - 2] == DLList_fastLast(dllist));
+	TEST_compare("DLList_fastLength", dllist->ops_->length(dllist) == DLList_fastLength(dllist));
+	TEST_compare("DLList_fastFirst", dllist->ops_->first(dllist) == DLList_fastFirst(dllist));
+	for (u16 i = 0; i < DLList_fastLength(dllist); ++i)
+	{
+		TEST_compare("DLList_fastAt", dllist->ops_->at(dllist, i) == DLList_fastAt(dllist, i));
+	}
+
+	printf("\n\n# Test Stack and Queue\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		u16 bytes = (u16)(strlen(TestData.storage_ptr_test_B[i]) + 1);
+		error_type = STACK_fastPush(stack, TestData.storage_ptr_test_B[i], bytes);
+		TESTBASE_printFunctionResult(stack, (u8 *)"fastPush", error_type);
+		error_type = QUEUE_fastEnqueue(queue, TestData.storage_ptr_test_B[i], bytes);
+		TESTBASE_printFunctionResult(queue, (u8 *)"fastEnqueue", error_type);
+	}
+	printf("\t top %s, front %s, back %s\n", (char *)STACK_fastTop(stack), (char *)QUEUE_fastFront(queue),
+		(char *)QUEUE_fastBack(queue));
+	TEST_compare("STACK_fastTop", TestData.storage_ptr_test_B[kNumberOfStoragePtrTest_B - 1] == STACK_fastTop(stack) &&
+		kNumberOfStoragePtrTest_B == STACK_fastLength(stack));
+	TEST_compare("QUEUE_fastFront", queue->ops_->front(queue) == QUEUE_fastFront(queue));
+	TEST_compare("QUEUE_fastBack", queue->ops_->back(queue) == QUEUE_fastBack(queue));
+	TEST_compare("QUEUE_fastLength", queue->ops_->length(queue) == QUEUE_fastLength(queue));
+
+	printf("\n\n# Test Lists with other ops take the ops_ path\n");
+	Arena *arena = ARENA_create(1024);
+	List *arena_list = LIST_createInArena(kCapacity, arena);
+	DLList *concurrent = ConcurrentDLList_create(kCapacity);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		u16 bytes = (u16)(strlen(TestData.storage_ptr_test_B[i]) + 1);
+		LIST_fastInsertLast(arena_list, TestData.storage_ptr_test_B[i], bytes);
+		DLList_fastInsertLast(concurrent, TestData.storage_ptr_test_B[i], bytes);
+	}
+	TEST_compare("LIST_fastInsertLast in arena", kNumberOfStoragePtrTest_B == LIST_fastLength(arena_list) &&
+		TestData.storage_ptr_test_B[0] == LIST_fastFirst(arena_list));
+	TEST_compare("DLList_fast on concurrent list", kNumberOfStoragePtrTest_B == DLList_fastLength(concurrent) &&
+		TestData.storage_ptr_test_B[1] == DLList_fastAt(concurrent, 1) &&
+		TestData.storage_ptr_test_B[kNumberOfStoragePtrTest_B - 1] == DLList_fastLast(concurrent));
+	arena->ops_->destroy(arena);
+	while (NULL != concurrent->ops_->extractFirst(concurrent));
+	concurrent->ops_->destroy(concurrent);
+
+#ifdef DEBUG
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = VECTOR_fastInsertLast(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"fastInsertLast vector NULL (NOT VALID)", error_type);
+	error_type = LIST_fastInsertLast(list, NULL, kSingleSizeData1);
+	TESTBASE_printFunctionResult(list, (u8 *)"fastInsertLast data NULL (NOT VALID)", error_type);
+	error_type = STACK_fastPush(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"fastPush stack NULL (NOT VALID)", error_type);
+	error_type = QUEUE_fastEnqueue(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"fastEnqueue queue NULL (NOT VALID)", error_type);
+	if (NULL != VECTOR_fastAt(vector, kCapacity) || NULL != LIST_fastAt(list, kCapacity) ||
+		NULL != DLList_fastAt(dllist, kCapacity) || 0 != VECTOR_fastLength(NULL))
+	{
+		printf("ERROR: debug checks let invalid reads through\n");
+	}
+#endif
+
+	// Work is done, clean the system; the payloads belong to TestData
+	while (NULL != vector->ops_->extractLast(vector));
+	vector->ops_->destroy(vector);
+	while (NULL != list->ops_->extractFirst(list));
+	list->ops_->destroy(list);
+	while (NULL != dllist->ops_->extractFirst(dllist));
+	dllist->ops_->destroy(dllist);
+	while (NULL != stack->ops_->pop(stack));
+	stack->ops_->destroy(stack);
+	while (NULL != queue->ops_->dequeue(queue));
+	queue->ops_->destroy(queue);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,221 @@
+// test_logger.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the asynchronous logger: formatting of the binary
+// arguments, level filtering, records of several threads, dropped records
+// and the synchronous output while the logger is stopped
+
+// LOG_DEBUG is removed at compile time
+#define LOG_LEVEL kLogLevel_Info
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "logger.h"
+#include "adt_memory_node.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const char *kLogFile = "test_logger.log";
+const u32 kWorkers = 4;
+const u32 kWorkerRecords = 1000;
+
+// Returns the number of lines of the log containing text, 0 if it can't be read
+static u32 TEST_count(const char *text)
+{
+	char line[256];
+	u32 count = 0;
+	FILE *file = fopen(kLogFile, "rb");
+	if (NULL == file)
+	{
+		return 0;
+	}
+	while (NULL != fgets(line, sizeof(line), file))
+	{
+		count += NULL != strstr(line, text) ? 1 : 0;
+	}
+	fclose(file);
+	return count;
+}
+
+// Checks that the log has the line expected
+static void TEST_line(const char *expected)
+{
+	char line[256];
+	boolean found = False;
+	FILE *file = fopen(kLogFile, "rb");
+	while (NULL != file && False == found && NULL != fgets(line, sizeof(line), file))
+	{
+		line[strcspn(line, "\r\n")] = '\0';
+		found = 0 == strcmp(line, expected) ? True : False;
+	}
+	if (NULL != file)
+	{
+		fclose(file);
+	}
+	printf("\t %s\n", expected);
+	if (True != found)
+	{
+		printf("  ==> ERROR: the log must have the line above\n");
+	}
+}
+
+static int TEST_worker(void *arg)
+{
+	u32 worker = *(u32 *)arg;
+	for (u32 i = 0; i < kWorkerRecords; ++i)
+	{
+		LOG_INFO("worker %u record %u", worker, i);
+	}
+	return 0;
+}
+
+// Checks that the records of every worker are in the log, in order
+static void TEST_workers()
+{
+	char line[256];
+	u32 next[4] = {0, 0, 0, 0};
+	boolean ordered = True;
+	FILE *file = fopen(kLogFile, "rb");
+	while (NULL != file && NULL != fgets(line, sizeof(line), file))
+	{
+		u32 worker, record;
+		const char *text = strstr(line, "worker ");
+		if (NULL != text && 2 == sscanf(text, "worker %u record %u", &worker, &record) && worker < kWorkers)
+		{
+			ordered = record == next[worker] ? ordered : False;
+			next[worker] = record + 1;
+		}
+	}
+	if (NULL != file)
+	{
+		fclose(file);
+	}
+	for (u32 worker = 0; worker < kWorkers; ++worker)
+	{
+		printf("\t worker %u: %u records\n", worker, next[worker]);
+		if (kWorkerRecords != next[worker])
+		{
+			printf("  ==> ERROR: every record of the worker must be in the log\n");
+		}
+	}
+	if (True != ordered)
+	{
+		printf("  ==> ERROR: the records of a worker must keep their order\n");
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+	remove(kLogFile);
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test synchronous output, logger stopped\n");
+	error_type = LOG_INFO("synchronous %s %d", (char *)TestData.storage_ptr_test_A[0], 42);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"LOG_INFO", error_type);
+
+	printf("\n\n# Test formats\n");
+	FILE *output = fopen(kLogFile, "wb");
+	error_type = LOGGER_start(output);
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_start", error_type);
+	s8 small = -5;
+	u16 medium = 65000;
+	u64 big = 0xFFFFFFFFFFull;
+	LOG_INFO("integers %d %u %5d|%-4u| %ld", small, medium, -42, 7u, 123456789012l);
+	LOG_INFO("hex %x %08X %llx %hhu", 255, 0xBEEFu, big, 300);
+	LOG_INFO("reals %.2f %e %g", 3.14159, 2.5f, 0.125);
+	LOG_WARNING("text %s %.3s %c %s", "literal", "truncated", 'z', (char *)NULL);
+	LOG_ERROR("no arguments, 100%%");
+	LOG_ERROR("missing %d %d", 1);
+	LOG_DEBUG("removed at compile time %d", 1);
+	// the errors of the memory nodes are logged too
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	node.ops_->data(NULL);
+	error_type = LOGGER_flush();
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_flush", error_type);
+	TEST_line("[INFO][thread 1] integers -5 65000   -42|7   | 123456789012");
+	TEST_line("[INFO][thread 1] hex ff 0000BEEF ffffffffff 44");
+	TEST_line("[INFO][thread 1] reals 3.14 2.500000e+00 0.125");
+	TEST_line("[WARNING][thread 1] text literal tru z (null)");
+	TEST_line("[ERROR][thread 1] no arguments, 100%");
+	TEST_line("[ERROR][thread 1] missing 1 %d");
+	TEST_line("[ERROR][thread 1] [MEMNODE_data] not enough memory available");
+	if (0 != TEST_count("removed"))
+	{
+		printf("  ==> ERROR: LOG_DEBUG must be removed below LOG_LEVEL\n");
+	}
+
+	printf("\n\n# Test threads\n");
+	thrd_t workers[4];
+	u32 ids[4];
+	for (u32 i = 0; i < kWorkers; ++i)
+	{
+		ids[i] = i;
+		thrd_create(&workers[i], TEST_worker, &ids[i]);
+	}
+	for (u32 i = 0; i < kWorkers; ++i)
+	{
+		thrd_join(workers[i], NULL);
+	}
+	error_type = LOGGER_flush();
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_flush", error_type);
+	TEST_workers();
+
+	printf("\n\n# Test full ring\n");
+	u32 records = 3 * kLogRingRecords;
+	u32 dropped = LOGGER_dropped();
+	for (u32 i = 0; i < records; ++i)
+	{
+		LOG_INFO("burst %u", i);
+	}
+	LOGGER_flush();
+	dropped = LOGGER_dropped() - dropped;
+	printf("\t %u records logged, %u written and %u dropped\n", records, TEST_count("burst"), dropped);
+	if (records != TEST_count("burst") + dropped)
+	{
+		printf("  ==> ERROR: every record must be written or dropped\n");
+	}
+
+	printf("\n\n# Test restart\n");
+	error_type = LOGGER_stop();
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_stop", error_type);
+	error_type = LOGGER_start(output);
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_start", error_type);
+	LOG_INFO("after restart %d", 2);
+	error_type = LOGGER_stop();
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_stop", error_type);
+	TEST_line("[INFO][thread 1] after restart 2");
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = LOGGER_start(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"LOGGER_start output NULL (NOT VALID)", error_type);
+	error_type = LOGGER_stop();
+	TESTBASE_printFunctionResult(NULL, (u8 *)"LOGGER_stop stopped (NOT VALID)", error_type);
+	error_type = LOGGER_flush();
+	TESTBASE_printFunctionResult(NULL, (u8 *)"LOGGER_flush stopped (NOT VALID)", error_type);
+	error_type = LOGGER_write(kLogLevel_Info, NULL, 0, NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"LOGGER_write format NULL (NOT VALID)", error_type);
+	LOGGER_start(output);
+	error_type = LOGGER_start(output);
+	TESTBASE_printFunctionResult(output, (u8 *)"LOGGER_start running (NOT VALID)", error_type);
+	LOGGER_stop();
+	fclose(output);
+	remove(kLogFile);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,265 @@
+// test_lru_cache.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the LRU cache: hits and misses, the order of use after
+// get and peek, evictions by the byte budget and the callback that receives
+// them, replaced payloads, erasures, the growth of the hash index, and
+// strings freed by reset
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_lru_cache.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kElements 20000
+#define kEvictedLog 16
+
+// Payloads of the battery, not owned by the cache: the callback keeps them
+static u32 values[kElements];
+
+// What the callback received
+static u32 evicted = 0;
+static u32 evicted_bytes = 0;
+static u32 evicted_keys[kEvictedLog];
+
+// Copy of a test string owned by the cache, terminator included
+static void *TEST_copy(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MM->malloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Records the keys of the payloads the cache drops
+static void TEST_evict(const void *key, MemoryNode *node, void *context)
+{
+	if (evicted < kEvictedLog)
+	{
+		evicted_keys[evicted] = *(const u32 *)key;
+	}
+	++evicted;
+	evicted_bytes += node->size_;
+	*(u32 *)context += 1;
+}
+
+// Checks the payloads from the most recently used against the expected values
+static void TEST_order(const char *name, LRUCache *cache, const u32 *expected, u32 count)
+{
+	Cursor cursor;
+	u32 visited = 0;
+	boolean valid = True;
+	for (cache->ops_->begin(cache, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor), ++visited)
+	{
+		if (visited >= count || *(u32 *)CURSOR_get(&cursor) != expected[visited])
+		{
+			valid = False;
+		}
+	}
+	printf("\t %s: %u entries, %llu bytes\n", name, cache->ops_->length(cache), (unsigned long long)cache->ops_->bytes(cache));
+	if (True != valid || count != visited || count != cache->ops_->length(cache))
+	{
+		printf("  ==> ERROR: %s is not in the order of use\n", name);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+	u32 callbacks = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		values[i] = i;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test put and get past the initial buckets\n");
+	LRUCache *cache = LRUCACHE_create(sizeof(u32), (u64)kElements * sizeof(u32), TEST_evict, &callbacks);
+	if (NULL == cache)
+	{
+		printf("\n create returned a null cache\n");
+		return -1;
+	}
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		error_type = cache->ops_->put(cache, &i, &values[i], sizeof(u32));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(cache, (u8 *)"put", error_type);
+	u32 hits = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		hits += &values[i] == cache->ops_->get(cache, &i) ? 1 : 0;
+	}
+	u32 missing = kElements;
+	printf("\t %u hits, %u buckets\n", hits, cache->bucket_mask_ + 1);
+	if (kElements != hits || kElements != cache->ops_->length(cache) || NULL != cache->ops_->get(cache, &missing) ||
+		cache->bucket_mask_ + 1 < kElements || 0 != evicted)
+	{
+		printf("  ==> ERROR: every key must hit, the buckets must grow and nothing must be evicted\n");
+	}
+	error_type = cache->ops_->softReset(cache);
+	TESTBASE_printFunctionResult(cache, (u8 *)"softReset", error_type);
+	if (0 != cache->ops_->length(cache) || 0 != cache->ops_->bytes(cache) || 0 != cache->pool_->ops_->live(cache->pool_))
+	{
+		printf("  ==> ERROR: an empty cache must give its entries back\n");
+	}
+
+	printf("\n\n# Test order of use and eviction\n");
+	// four payloads of a u32 fit
+	cache->ops_->setBudget(cache, 4 * sizeof(u32));
+	for (u32 i = 0; i < 4; ++i)
+	{
+		cache->ops_->put(cache, &i, &values[i], sizeof(u32));
+	}
+	u32 key = 0;
+	cache->ops_->get(cache, &key);
+	key = 1;
+	cache->ops_->peek(cache, &key);
+	u32 used[] = {0, 3, 2, 1};
+	TEST_order("after get 0 and peek 1", cache, used, 4);
+	key = 4;
+	error_type = cache->ops_->put(cache, &key, &values[4], sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put over the budget", error_type);
+	u32 evicting[] = {4, 0, 3, 2};
+	TEST_order("after put 4", cache, evicting, 4);
+	key = 1;
+	if (1 != evicted || 1 != evicted_keys[0] || 1 != callbacks || NULL != cache->ops_->peek(cache, &key))
+	{
+		printf("  ==> ERROR: the least recently used entry must be evicted through the callback\n");
+	}
+
+	printf("\n\n# Test replace and byte budget\n");
+	key = 2;
+	error_type = cache->ops_->put(cache, &key, &values[kElements - 1], sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put key already cached", error_type);
+	u32 replaced[] = {kElements - 1, 4, 0, 3};
+	TEST_order("after replacing 2", cache, replaced, 4);
+	if (2 != evicted || 2 != evicted_keys[1] || 4 * sizeof(u32) != cache->ops_->bytes(cache))
+	{
+		printf("  ==> ERROR: the replaced payload must go to the callback\n");
+	}
+	// a payload of two u32 takes the room of the two least recently used
+	key = 5;
+	error_type = cache->ops_->put(cache, &key, &values[5], 2 * sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put a bigger payload", error_type);
+	if (4 != evicted || 3 != evicted_keys[2] || 0 != evicted_keys[3] || 3 != cache->ops_->length(cache) ||
+		4 * sizeof(u32) != cache->ops_->bytes(cache))
+	{
+		printf("  ==> ERROR: a bigger payload must evict until it fits\n");
+	}
+	error_type = cache->ops_->put(cache, &key, &values[5], 2 * sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put the cached payload again", error_type);
+	if (&values[5] != cache->ops_->peek(cache, &key) || 4 != evicted || 3 != cache->ops_->length(cache))
+	{
+		printf("  ==> ERROR: putting the cached payload again must not drop it\n");
+	}
+	error_type = cache->ops_->put(cache, &key, &values[5], 5 * sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put payload over the whole budget (NOT VALID)", error_type);
+	if (&values[5] != cache->ops_->peek(cache, &key) || 4 != evicted)
+	{
+		printf("  ==> ERROR: a payload that cannot fit must not drop anything\n");
+	}
+	error_type = cache->ops_->setBudget(cache, 3 * sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"setBudget below the bytes", error_type);
+	u32 shrunk[] = {5, kElements - 1};
+	TEST_order("after setBudget", cache, shrunk, 2);
+	if (5 != evicted || 4 != evicted_keys[4] || evicted_bytes != 5 * sizeof(u32))
+	{
+		printf("  ==> ERROR: setBudget must evict the entries that no longer fit\n");
+	}
+
+	printf("\n\n# Test erase\n");
+	key = 5;
+	if (&values[5] != cache->ops_->erase(cache, &key) || NULL != cache->ops_->erase(cache, &key) || 5 != evicted)
+	{
+		printf("  ==> ERROR: erase must return the payload once and not call the callback\n");
+	}
+	key = 2;
+	if (&values[kElements - 1] != cache->ops_->erase(cache, &key) || 0 != cache->ops_->length(cache) ||
+		0 != cache->ops_->bytes(cache) || 0 != cache->pool_->ops_->live(cache->pool_))
+	{
+		printf("  ==> ERROR: an empty cache must give its entries back\n");
+	}
+	cache->ops_->begin(cache, &cursor);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: begin on an empty cache must be invalid\n");
+	}
+
+	printf("\n\n# Test strings and reset\n");
+	// keys of eight bytes and room for the four longest strings
+	LRUCache *strings = LRUCACHE_create(8, 4 * 6, NULL, NULL);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		char name[8] = {0};
+		strncpy(name, TestData.storage_ptr_test_A[i], sizeof(name) - 1);
+		void *data = TEST_copy(TestData.storage_ptr_test_A[i]);
+		strings->ops_->put(strings, name, data, (u16)(strlen(data) + 1));
+	}
+	char name[8] = {0};
+	strncpy(name, "16384", sizeof(name) - 1);
+	if (0 == strings->ops_->length(strings) || strings->ops_->bytes(strings) > 4 * 6 || NULL == strings->ops_->peek(strings, name))
+	{
+		printf("  ==> ERROR: the strings must be evicted and freed down to the budget\n");
+	}
+	strings->ops_->print(strings);
+	error_type = strings->ops_->reset(strings);
+	TESTBASE_printFunctionResult(strings, (u8 *)"reset", error_type);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != LRUCACHE_create(0, 16, NULL, NULL) || NULL != LRUCACHE_create(kLRUCacheMaxKeyBytes + 1, 16, NULL, NULL) ||
+		NULL != LRUCACHE_create(sizeof(u32), 0, NULL, NULL))
+	{
+		printf("  ==> ERROR: create must reject a wrong key size or budget\n");
+	}
+	error_type = cache->ops_->put(NULL, &key, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"put NULL (NOT VALID)", error_type);
+	error_type = cache->ops_->put(cache, NULL, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put key NULL (NOT VALID)", error_type);
+	error_type = cache->ops_->put(cache, &key, NULL, sizeof(u32));
+	TESTBASE_printFunctionResult(cache, (u8 *)"put data NULL (NOT VALID)", error_type);
+	error_type = cache->ops_->put(cache, &key, &values[0], 0);
+	TESTBASE_printFunctionResult(cache, (u8 *)"put bytes 0 (NOT VALID)", error_type);
+	error_type = cache->ops_->setBudget(cache, 0);
+	TESTBASE_printFunctionResult(cache, (u8 *)"setBudget 0 (NOT VALID)", error_type);
+	error_type = cache->ops_->begin(NULL, &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"begin NULL (NOT VALID)", error_type);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: begin on a NULL cache must leave the cursor invalid\n");
+	}
+	error_type = cache->ops_->begin(cache, NULL);
+	TESTBASE_printFunctionResult(cache, (u8 *)"begin cursor NULL (NOT VALID)", error_type);
+	if (NULL != cache->ops_->get(NULL, &key) || NULL != cache->ops_->get(cache, NULL) || NULL != cache->ops_->peek(NULL, &key) ||
+		NULL != cache->ops_->erase(NULL, &key) || NULL != cache->ops_->erase(cache, &key) || 0 != cache->ops_->length(NULL) ||
+		0 != cache->ops_->bytes(NULL))
+	{
+		printf("  ==> ERROR: get, peek and erase on an empty or NULL cache must return NULL\n");
+	}
+	error_type = cache->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	cache->ops_->destroy(cache);
+	strings->ops_->destroy(strings);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
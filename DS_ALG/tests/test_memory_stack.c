@@ -0,0 +1,241 @@
+// test_memory_stack.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the double-ended memory stack and the containers on it
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "adt_memory_stack.h"
+#include "adt_vector.h"
+#include "adt_stack.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u32 kStackCapacity = 4096;
+const u16 kCapacity = 20;
+const u16 kFrames = 50;
+
+static char *TEST_newString(MemoryStack *memory_stack, MemoryStackSide side, const char *text)
+{
+	u32 bytes = (u32)strlen(text) + 1;
+	char *copy = memory_stack->ops_->alloc(memory_stack, side, bytes);
+	memcpy(copy, text, bytes);
+	return copy;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	MemoryStack *memory_stack = MEMSTACK_create(kStackCapacity);
+	if (NULL == memory_stack) {
+		printf("\n create returned a null memory stack\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + MemoryStack: %zu\n", sizeof(MemoryStack));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Alloc on both sides\n");
+	u8 *low = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, 3);
+	u8 *high = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_High, 5);
+	if (NULL == low || NULL == high || 0 != (uintptr_t)low % kMemoryStackAlignment ||
+		0 != (uintptr_t)high % kMemoryStackAlignment || high <= low)
+	{
+		printf("  ==> ERROR: allocations are not aligned or the sides cross\n");
+	}
+	memset(low, 'L', 3);
+	memset(high, 'H', 5);
+	error_type = memory_stack->ops_->checkGuards(memory_stack);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"checkGuards", error_type);
+	memory_stack->ops_->print(memory_stack);
+
+	printf("\n\n# Test Markers\n");
+	MemoryStackMarker low_marker = memory_stack->ops_->marker(memory_stack, kMemoryStackSide_Low);
+	MemoryStackMarker high_marker = memory_stack->ops_->marker(memory_stack, kMemoryStackSide_High);
+	u32 used = memory_stack->ops_->used(memory_stack);
+	u8 *scratch = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, 100);
+	memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, 200);
+	memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_High, 300);
+	printf("\t used %u bytes, %u before the markers\n", memory_stack->ops_->used(memory_stack), used);
+	error_type = memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_Low, low_marker);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"freeToMarker low", error_type);
+	error_type = memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_High, high_marker);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"freeToMarker high", error_type);
+	if (used != memory_stack->ops_->used(memory_stack) ||
+		scratch != memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, 100))
+	{
+		printf("  ==> ERROR: freeToMarker must rewind to the marker\n");
+	}
+	memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_Low, low_marker);
+	if ('L' != low[2] || 'H' != high[4])
+	{
+		printf("  ==> ERROR: freeToMarker touched older allocations\n");
+	}
+
+	printf("\n\n# Test Full and high-water mark\n");
+	u32 high_water = memory_stack->ops_->highWater(memory_stack);
+	void *whole = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_High, kStackCapacity);
+	if (NULL != whole)
+	{
+		printf("  ==> ERROR: both sides overlap\n");
+	}
+	u32 free_bytes = kStackCapacity - memory_stack->ops_->used(memory_stack);
+	u32 big = free_bytes / 2 + 1;
+	void *big_low = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, big);
+	void *big_high = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_High, big);
+	printf("\t high-water mark %u bytes before, %u after\n", high_water,
+		memory_stack->ops_->highWater(memory_stack));
+	if (NULL == big_low || NULL != big_high ||
+		memory_stack->ops_->highWater(memory_stack) <= high_water)
+	{
+		printf("  ==> ERROR: wrong free space or high-water mark\n");
+	}
+	memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_Low, low_marker);
+
+#ifdef DEBUG
+	printf("\n\n# Test Guard bytes\n");
+	MemoryStackMarker marker = memory_stack->ops_->marker(memory_stack, kMemoryStackSide_High);
+	u8 *overrun = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_High, 10);
+	memset(overrun, 0, 11);
+	error_type = memory_stack->ops_->checkGuards(memory_stack);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"checkGuards after overrun (NOT VALID)", error_type);
+	error_type = memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_High, marker);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"freeToMarker over overrun (NOT VALID)", error_type);
+	if (kMemoryStackFreedValue != overrun[0] ||
+		kErrorCode_Ok != memory_stack->ops_->checkGuards(memory_stack))
+	{
+		printf("  ==> ERROR: the overrun allocation is not freed\n");
+	}
+#endif
+
+	printf("\n\n# Test Vector in memory stack\n");
+	low_marker = memory_stack->ops_->marker(memory_stack, kMemoryStackSide_Low);
+	Vector *vector = VECTOR_createInMemoryStack(kCapacity, memory_stack, kMemoryStackSide_Low);
+	if (NULL == vector) {
+		printf("\n createInMemoryStack returned a null vector\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = vector->ops_->insertLast(vector,
+			TEST_newString(memory_stack, kMemoryStackSide_Low, TestData.storage_ptr_test_A[i]),
+			(u16)(strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TESTBASE_printFunctionResult(vector, (u8 *)"insertLast vector", error_type);
+	}
+	printf("\t extractFirst: %s\n", (char *)vector->ops_->extractFirst(vector));
+	error_type = vector->ops_->resize(vector, kCapacity * 2);
+	TESTBASE_printFunctionResult(vector, (u8 *)"resize vector", error_type);
+	vector->ops_->print(vector);
+	if (kNumberOfStoragePtrTest_A - 1 != vector->ops_->length(vector) ||
+		0 != strcmp(TestData.storage_ptr_test_A[kNumberOfStoragePtrTest_A - 1], vector->ops_->last(vector)))
+	{
+		printf("  ==> ERROR: wrong vector content\n");
+	}
+	used = memory_stack->ops_->used(memory_stack);
+	error_type = vector->ops_->destroy(vector);
+	TESTBASE_printFunctionResult(vector, (u8 *)"destroy vector", error_type);
+	if (used != memory_stack->ops_->used(memory_stack))
+	{
+		printf("  ==> ERROR: destroy changed the memory stack\n");
+	}
+	memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_Low, low_marker);
+
+	printf("\n\n# Test Stack in memory stack\n");
+	high_marker = memory_stack->ops_->marker(memory_stack, kMemoryStackSide_High);
+	Stack *stack = STACK_createInMemoryStack(kCapacity, memory_stack, kMemoryStackSide_High);
+	if (NULL == stack) {
+		printf("\n createInMemoryStack returned a null stack\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		error_type = stack->ops_->push(stack,
+			TEST_newString(memory_stack, kMemoryStackSide_High, TestData.storage_ptr_test_B[i]),
+			(u16)(strlen(TestData.storage_ptr_test_B[i]) + 1));
+		TESTBASE_printFunctionResult(stack, (u8 *)"push stack", error_type);
+	}
+	printf("\t pop: %s\n", (char *)stack->ops_->pop(stack));
+	printf("\t top: %s\n", (char *)stack->ops_->top(stack));
+	stack->ops_->print(stack);
+	if (kNumberOfStoragePtrTest_B - 1 != stack->ops_->length(stack))
+	{
+		printf("  ==> ERROR: wrong stack length, top must not extract\n");
+	}
+	error_type = stack->ops_->destroy(stack);
+	TESTBASE_printFunctionResult(stack, (u8 *)"destroy stack", error_type);
+	error_type = memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_High, high_marker);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"freeToMarker high", error_type);
+
+	printf("\n\n# Test Frame loop reuses the same bytes\n");
+	used = memory_stack->ops_->used(memory_stack);
+	for (u16 f = 0; f < kFrames; ++f)
+	{
+		MemoryStackMarker frame = memory_stack->ops_->marker(memory_stack, kMemoryStackSide_Low);
+		Vector *v = VECTOR_createInMemoryStack(kCapacity, memory_stack, kMemoryStackSide_Low);
+		Stack *s = STACK_createInMemoryStack(kCapacity, memory_stack, kMemoryStackSide_Low);
+		for (u16 i = 0; i < kCapacity; ++i)
+		{
+			u32 *value = memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, sizeof(u32));
+			*value = i;
+			v->ops_->insertLast(v, value, sizeof(u32));
+			s->ops_->push(s, value, sizeof(u32));
+		}
+		memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_Low, frame);
+	}
+	printf("\t %d frames, used %u bytes, high-water mark %u bytes\n", kFrames,
+		memory_stack->ops_->used(memory_stack), memory_stack->ops_->highWater(memory_stack));
+	if (used != memory_stack->ops_->used(memory_stack))
+	{
+		printf("  ==> ERROR: the frames leak memory\n");
+	}
+	error_type = memory_stack->ops_->reset(memory_stack);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"reset memory stack", error_type);
+	if (0 != memory_stack->ops_->used(memory_stack))
+	{
+		printf("  ==> ERROR: reset must free both sides\n");
+	}
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != MEMSTACK_create(0) || NULL != MEMSTACK_create(kMemoryStackMaxCapacity + kMemoryStackAlignment))
+	{
+		printf("ERROR: trying to create a memory stack with an invalid capacity\n");
+	}
+	if (NULL != memory_stack->ops_->alloc(memory_stack, kMemoryStackSide_Low, 0) ||
+		NULL != memory_stack->ops_->alloc(NULL, kMemoryStackSide_Low, 4))
+	{
+		printf("ERROR: invalid allocations return memory\n");
+	}
+	if (NULL != VECTOR_createInMemoryStack(kCapacity, NULL, kMemoryStackSide_Low) ||
+		NULL != STACK_createInMemoryStack(0, memory_stack, kMemoryStackSide_High))
+	{
+		printf("ERROR: containers created without memory stack or capacity\n");
+	}
+	error_type = memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_Low, kStackCapacity);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"freeToMarker above the top (NOT VALID)", error_type);
+	error_type = memory_stack->ops_->freeToMarker(memory_stack, kMemoryStackSide_High, 0);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"freeToMarker high below the top (NOT VALID)", error_type);
+	error_type = memory_stack->ops_->reset(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"reset NULL (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = memory_stack->ops_->destroy(memory_stack);
+	TESTBASE_printFunctionResult(memory_stack, (u8 *)"destroy memory stack", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
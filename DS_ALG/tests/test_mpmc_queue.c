@@ -0,0 +1,243 @@
+// test_mpmc_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the bounded and segmented multi-producer/multi-consumer queues
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_mpmc_queue.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kTestThreads 4
+const u16 kCapacityMPMCQueue1 = 10; // rounded up to 16
+const u16 kCapacityMPMCQueue2 = 2;
+const u16 kSegmentCapacity = 8;
+const u32 kMessagesPerProducer = 20000;
+// producers wait above this backlog: MM pools can't hold 80000 pending payloads
+const u32 kMaxBacklog = 256;
+
+typedef struct test_context_s {
+	MPMCQueue *bounded_;
+	MPMCSegQueue *segmented_;
+	_Atomic u64 sum_;
+	_Atomic u32 received_;
+} TestContext;
+
+static int TEST_producer(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	for (u32 i = 1; i <= kMessagesPerProducer; ++i)
+	{
+		// payloads are sequence numbers, never dereferenced
+		if (NULL != ctx->bounded_)
+			ctx->bounded_->ops_->enqueue(ctx->bounded_, (void *)(uintptr_t)i, sizeof(u32));
+		else
+		{
+			while (ctx->segmented_->ops_->length(ctx->segmented_) > kMaxBacklog)
+			{
+				thrd_yield();
+			}
+			ctx->segmented_->ops_->enqueue(ctx->segmented_, (void *)(uintptr_t)i, sizeof(u32));
+		}
+	}
+	return 0;
+}
+
+static int TEST_consumer(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	const u32 total = kTestThreads * kMessagesPerProducer;
+	while (atomic_load(&ctx->received_) < total)
+	{
+		void *data;
+		if (NULL != ctx->bounded_)
+			data = ctx->bounded_->ops_->tryDequeue(ctx->bounded_);
+		else
+			data = ctx->segmented_->ops_->tryDequeue(ctx->segmented_);
+		if (NULL == data)
+		{
+			thrd_yield();
+			continue;
+		}
+		atomic_fetch_add(&ctx->sum_, (uintptr_t)data);
+		atomic_fetch_add(&ctx->received_, 1);
+	}
+	return 0;
+}
+
+static void TEST_runThreads(TestContext *ctx, const char *name)
+{
+	thrd_t producers[kTestThreads];
+	thrd_t consumers[kTestThreads];
+	atomic_init(&ctx->sum_, 0);
+	atomic_init(&ctx->received_, 0);
+	for (u16 i = 0; i < kTestThreads; ++i)
+	{
+		thrd_create(&producers[i], TEST_producer, ctx);
+		thrd_create(&consumers[i], TEST_consumer, ctx);
+	}
+	for (u16 i = 0; i < kTestThreads; ++i)
+	{
+		thrd_join(producers[i], NULL);
+		thrd_join(consumers[i], NULL);
+	}
+	u64 expected = (u64)kTestThreads * kMessagesPerProducer * (kMessagesPerProducer + 1) / 2;
+	printf("\t %s: %u messages received, sum %llu (expected %llu)\n", name,
+		atomic_load(&ctx->received_), (unsigned long long)atomic_load(&ctx->sum_), (unsigned long long)expected);
+	if (expected != atomic_load(&ctx->sum_))
+	{
+		printf("  ==> ERROR: messages lost or duplicated (%s)\n", name);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	MPMCQueue *q = MPMCQUEUE_create(1);
+	MPMCQueue *queue_1 = MPMCQUEUE_create(kCapacityMPMCQueue1);
+	MPMCQueue *queue_2 = MPMCQUEUE_create(kCapacityMPMCQueue2);
+	MPMCSegQueue *s = MPMCSEGQUEUE_create(kSegmentCapacity);
+	MPMCSegQueue *seg_queue_1 = MPMCSEGQUEUE_create(kSegmentCapacity);
+	if (NULL == q || NULL == queue_1 || NULL == queue_2 || NULL == s || NULL == seg_queue_1) {
+		printf("\n create returned a null queue\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + MPMCQueue: %zu\n", sizeof(MPMCQueue));
+	printf("  + MPMCCell: %zu\n", sizeof(MPMCCell));
+	printf("  + MPMCSegQueue: %zu\n", sizeof(MPMCSegQueue));
+	printf("  + MPMCSegment: %zu\n", sizeof(MPMCSegment));
+
+	printf("---------------- BOUNDED BATTERY ----------------\n\n");
+	printf("\n\n# Test Enqueue\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = q->ops_->enqueue(queue_1, TestData.storage_ptr_test_A[i], (strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TestData.storage_ptr_test_A[i] = NULL;
+		TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueue queue_1", error_type);
+	}
+	printf("queue_1:\n");
+	q->ops_->print(queue_1);
+
+	printf("\n\n# Test tryEnqueue on a full queue\n");
+	u16 insert_errors = 0;
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		error_type = q->ops_->tryEnqueue(queue_2, TestData.storage_ptr_test_C[i], (strlen(TestData.storage_ptr_test_C[i]) + 1));
+		TESTBASE_printFunctionResult(queue_2, (u8 *)"tryEnqueue queue_2", error_type);
+		if (kErrorCode_Ok == error_type)
+			TestData.storage_ptr_test_C[i] = NULL;
+		else
+			insert_errors++;
+	}
+	if ((kNumberOfStoragePtrTest_C - kCapacityMPMCQueue2) != insert_errors || False == q->ops_->isFull(queue_2))
+	{
+		printf("  ==> ERROR: isFull / tryEnqueue don't work correctly (queue_2)\n");
+	}
+
+	printf("\n\n# Test tryDequeue\n");
+	void *data = NULL;
+	for (u16 i = 0; i < 3; ++i)
+	{
+		data = q->ops_->tryDequeue(queue_1);
+		if (NULL == data)
+			printf("ERROR: NULL pointer extracted at front queue_1\n");
+		else
+			printf("extracted \"%s\" at front in queue_1\n", (char *)data);
+		MM->free(data);
+	}
+	printf("\t queue_1: [Capacity = %d] - [Length  = %d]\n", q->ops_->capacity(queue_1), q->ops_->length(queue_1));
+
+	printf("\n\n# Test Reset\n");
+	error_type = q->ops_->reset(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"reset queue_2", error_type);
+	if (NULL != q->ops_->tryDequeue(queue_2) || False == q->ops_->isEmpty(queue_2))
+	{
+		printf("ERROR: tryDequeue returns data from an empty queue\n");
+	}
+
+	printf("\n\n---------------- SEGMENTED BATTERY ----------------\n\n");
+	printf("\n\n# Test Enqueue (more elements than one segment)\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		error_type = s->ops_->enqueue(seg_queue_1, TestData.storage_ptr_test_B[i], (strlen(TestData.storage_ptr_test_B[i]) + 1));
+		TestData.storage_ptr_test_B[i] = NULL;
+		TESTBASE_printFunctionResult(seg_queue_1, (u8 *)"enqueue seg_queue_1", error_type);
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		if (NULL == TestData.storage_ptr_test_C[i])
+			continue;
+		error_type = s->ops_->tryEnqueue(seg_queue_1, TestData.storage_ptr_test_C[i], (strlen(TestData.storage_ptr_test_C[i]) + 1));
+		TestData.storage_ptr_test_C[i] = NULL;
+		TESTBASE_printFunctionResult(seg_queue_1, (u8 *)"tryEnqueue seg_queue_1", error_type);
+	}
+	printf("seg_queue_1:\n");
+	s->ops_->print(seg_queue_1);
+
+	printf("\n\n# Test tryDequeue across segments\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B + 1; ++i)
+	{
+		data = s->ops_->tryDequeue(seg_queue_1);
+		if (NULL == data)
+			printf("ERROR: NULL pointer extracted at front seg_queue_1\n");
+		else
+			printf("extracted \"%s\" at front in seg_queue_1\n", (char *)data);
+		MM->free(data);
+	}
+	printf("seg_queue_1:\n");
+	s->ops_->print(seg_queue_1);
+
+	printf("\n\n# Test Producer / Consumer threads\n");
+	TestContext ctx;
+	ctx.bounded_ = MPMCQUEUE_create(64);
+	ctx.segmented_ = NULL;
+	TEST_runThreads(&ctx, "bounded");
+	q->ops_->destroy(ctx.bounded_);
+	ctx.bounded_ = NULL;
+	ctx.segmented_ = MPMCSEGQUEUE_create(kSegmentCapacity);
+	TEST_runThreads(&ctx, "segmented");
+	s->ops_->print(ctx.segmented_);
+	s->ops_->destroy(ctx.segmented_);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = q->ops_->tryEnqueue(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"tryEnqueue NULL (NOT VALID)", error_type);
+	error_type = s->ops_->enqueue(seg_queue_1, NULL, kSingleSizeData1);
+	TESTBASE_printFunctionResult(seg_queue_1, (u8 *)"enqueue NULL data (NOT VALID)", error_type);
+	if (NULL != q->ops_->tryDequeue(NULL) || NULL != s->ops_->tryDequeue(NULL))
+	{
+		printf("ERROR: NULL queue returns data\n");
+	}
+
+	// Work is done, clean the system
+	error_type = q->ops_->destroy(queue_1);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"destroy queue_1", error_type);
+	error_type = q->ops_->destroy(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"destroy queue_2", error_type);
+	error_type = q->ops_->destroy(q);
+	TESTBASE_printFunctionResult(q, (u8 *)"destroy MPMCQueue Operations", error_type);
+	error_type = s->ops_->destroy(seg_queue_1);
+	TESTBASE_printFunctionResult(seg_queue_1, (u8 *)"destroy seg_queue_1", error_type);
+	error_type = s->ops_->destroy(s);
+	TESTBASE_printFunctionResult(s, (u8 *)"destroy MPMCSegQueue Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
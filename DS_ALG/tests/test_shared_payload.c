@@ -0,0 +1,195 @@
+// test_shared_payload.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the shared payloads: references, copy-on-write of the
+// memory node operations and concat of vectors and lists of shared payloads
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_memory_node.h"
+#include "adt_vector.h"
+#include "adt_list.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u16 kCapacity = 10;
+
+// Shared copy of a test string, terminator included
+static void *TEST_shared(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MEMNODE_sharedAlloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Checks that every payload of the cursor is the string expected with refs references
+static void TEST_payloads(const char *name, Cursor *cursor, void **data, u16 count, u32 refs)
+{
+	u16 visited = 0;
+	for (; True == CURSOR_valid(cursor); CURSOR_next(cursor))
+	{
+		MemoryNode *node = CURSOR_node(cursor);
+		if (visited >= count || 0 != strcmp(node->data_, data[visited]) ||
+			refs != MEMNODE_references(node->data_) || &memory_node_shared_ops != node->ops_)
+		{
+			printf("  ==> ERROR: %s has the wrong payload at %d\n", name, visited);
+			return;
+		}
+		visited++;
+	}
+	printf("\t %s: %d payloads with %d references\n", name, visited, refs);
+	if (visited != count)
+	{
+		printf("  ==> ERROR: %s must have %d payloads\n", name, count);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test shared nodes and copy-on-write\n");
+	MemoryNode first, second;
+	MEMNODE_createLiteShared(&first);
+	MEMNODE_createLiteShared(&second);
+	first.ops_->setData(&first, TEST_shared(TestData.single_ptr_data_3), (u16)(strlen(TestData.single_ptr_data_3) + 1));
+	error_type = MEMNODE_share(&second, &first);
+	TESTBASE_printFunctionResult(&second, (u8 *)"share", error_type);
+	if (first.data_ != second.data_ || 2 != MEMNODE_references(first.data_))
+	{
+		printf("  ==> ERROR: share must reference the same payload\n");
+	}
+	error_type = second.ops_->memSet(&second, 'x');
+	TESTBASE_printFunctionResult(&second, (u8 *)"memSet on a shared payload", error_type);
+	if (first.data_ == second.data_ || 1 != MEMNODE_references(first.data_) ||
+		1 != MEMNODE_references(second.data_) || 0 != strcmp(first.data_, TestData.single_ptr_data_3))
+	{
+		printf("  ==> ERROR: memSet must copy the payload before writing it\n");
+	}
+	void *own = second.data_;
+	error_type = second.ops_->memMask(&second, 0x0F);
+	TESTBASE_printFunctionResult(&second, (u8 *)"memMask on an own payload", error_type);
+	if (own != second.data_)
+	{
+		printf("  ==> ERROR: memMask must write in place a payload with one reference\n");
+	}
+	MEMNODE_share(&second, &first);
+	error_type = second.ops_->memConcat(&second, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(&second, (u8 *)"memConcat on a shared payload", error_type);
+	if (1 != MEMNODE_references(first.data_) || second.size_ != first.size_ + kSingleSizeData1 ||
+		0 != memcmp(second.data_, first.data_, first.size_))
+	{
+		printf("  ==> ERROR: memConcat must leave the other references untouched\n");
+	}
+	error_type = second.ops_->memCopy(&second, TestData.single_ptr_data_2, kSingleSizeData2);
+	TESTBASE_printFunctionResult(&second, (u8 *)"memCopy", error_type);
+	error_type = first.ops_->reset(&first);
+	TESTBASE_printFunctionResult(&first, (u8 *)"reset", error_type);
+	second.ops_->reset(&second);
+
+	printf("\n\n# Test concat of vectors\n");
+	Vector *source = VECTOR_createShared(kCapacity);
+	Vector *vector = VECTOR_createShared(kCapacity);
+	Vector *plain = VECTOR_create(kCapacity);
+	if (NULL == source || NULL == vector || NULL == plain)
+	{
+		printf("\n createShared returned a null vector\n");
+		return -1;
+	}
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_B; ++i)
+	{
+		source->ops_->insertLast(source, TEST_shared(TestData.storage_ptr_test_B[i]),
+			(u16)(strlen(TestData.storage_ptr_test_B[i]) + 1));
+	}
+	error_type = vector->ops_->concat(vector, source);
+	TESTBASE_printFunctionResult(vector, (u8 *)"concat", error_type);
+	vector->ops_->begin(vector, &cursor);
+	TEST_payloads("vector after concat", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, 2);
+	if (vector->ops_->first(vector) != source->ops_->first(source))
+	{
+		printf("  ==> ERROR: concat must share the payloads, not copy them\n");
+	}
+	error_type = plain->ops_->concat(plain, source);
+	TESTBASE_printFunctionResult(plain, (u8 *)"concat into a vector not shared", error_type);
+	if (plain->ops_->first(plain) == source->ops_->first(source) || 2 != MEMNODE_references(source->ops_->first(source)))
+	{
+		printf("  ==> ERROR: a vector not shared must copy the payloads\n");
+	}
+	// destroying the source leaves the payloads to the vector
+	source->ops_->destroy(source);
+	vector->ops_->begin(vector, &cursor);
+	TEST_payloads("vector after destroying the source", &cursor, TestData.storage_ptr_test_B, kNumberOfStoragePtrTest_B, 1);
+	error_type = vector->ops_->resize(vector, 3);
+	TESTBASE_printFunctionResult(vector, (u8 *)"resize", error_type);
+	void *extracted = vector->ops_->extractLast(vector);
+	error_type = MEMNODE_release(extracted);
+	TESTBASE_printFunctionResult(extracted, (u8 *)"release of an extracted payload", error_type);
+	vector->ops_->insertLast(vector, TEST_shared(TestData.storage_ptr_test_B[2]), (u16)(strlen(TestData.storage_ptr_test_B[2]) + 1));
+	vector->ops_->begin(vector, &cursor);
+	TEST_payloads("vector after resize and insert", &cursor, TestData.storage_ptr_test_B, 3, 1);
+	vector->ops_->destroy(vector);
+	plain->ops_->destroy(plain);
+
+	printf("\n\n# Test concat of lists\n");
+	List *list_source = LIST_createShared(kCapacity);
+	List *list = LIST_createShared(kCapacity);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		list_source->ops_->insertLast(list_source, TEST_shared(TestData.storage_ptr_test_C[i]),
+			(u16)(strlen(TestData.storage_ptr_test_C[i]) + 1));
+	}
+	error_type = list->ops_->concat(list, list_source);
+	TESTBASE_printFunctionResult(list, (u8 *)"concat", error_type);
+	list->ops_->begin(list, &cursor);
+	TEST_payloads("list after concat", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, 2);
+	error_type = list_source->ops_->reset(list_source);
+	TESTBASE_printFunctionResult(list_source, (u8 *)"reset of the source", error_type);
+	list->ops_->begin(list, &cursor);
+	TEST_payloads("list after resetting the source", &cursor, TestData.storage_ptr_test_C, kNumberOfStoragePtrTest_C, 1);
+	// a list not shared as source: its payloads are copied into shared ones
+	List *list_plain = LIST_create(kCapacity);
+	list_plain->ops_->insertLast(list_plain, TestData.storage_ptr_test_A[0], (u16)(strlen(TestData.storage_ptr_test_A[0]) + 1));
+	error_type = list_source->ops_->concat(list_source, list_plain);
+	TESTBASE_printFunctionResult(list_source, (u8 *)"concat of a list not shared", error_type);
+	list_source->ops_->begin(list_source, &cursor);
+	TEST_payloads("list with copies", &cursor, TestData.storage_ptr_test_A, 1, 1);
+	list_plain->ops_->extractFirst(list_plain);
+	list_plain->ops_->destroy(list_plain);
+	list_source->ops_->destroy(list_source);
+	list->ops_->destroy(list);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != MEMNODE_sharedAlloc(0) || NULL != MEMNODE_retain(NULL) || 0 != MEMNODE_references(NULL))
+	{
+		printf("  ==> ERROR: the shared payloads functions must reject NULL and 0\n");
+	}
+	error_type = MEMNODE_release(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"release NULL (NOT VALID)", error_type);
+	error_type = MEMNODE_share(NULL, &first);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"share node NULL (NOT VALID)", error_type);
+	error_type = MEMNODE_share(&second, &first);
+	TESTBASE_printFunctionResult(&second, (u8 *)"share of a node without payload (NOT VALID)", error_type);
+	error_type = first.ops_->memSet(&first, 0);
+	TESTBASE_printFunctionResult(&first, (u8 *)"memSet without payload (NOT VALID)", error_type);
+	error_type = first.ops_->reset(&first);
+	TESTBASE_printFunctionResult(&first, (u8 *)"reset without payload (NOT VALID)", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,277 @@
+// test_skiplist.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the skip list: insertions in shuffled order, lookups,
+// lower bounds and range walks with a Cursor both ways, erasures down to an
+// empty list, and strings ordered by their bytes
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_skiplist.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kElements 20000
+
+// Payloads of the big battery, not owned by the list: emptied with softReset
+static u32 values[kElements];
+static u32 order[kElements];
+
+// Copy of a test string owned by the list, terminator included
+static void *TEST_copy(void *string)
+{
+	u16 bytes = (u16)(strlen(string) + 1);
+	void *data = MM->malloc(bytes);
+	memcpy(data, string, bytes);
+	return data;
+}
+
+// Orders the u32 payloads as integers
+static s32 TEST_compareU32(const void *a, u16 a_bytes, const void *b, u16 b_bytes)
+{
+	(void)a_bytes;
+	(void)b_bytes;
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+// Checks that the list holds count values from from, every step, both ways
+static void TEST_order(const char *name, SkipList *list, u32 from, u32 count, u32 step)
+{
+	Cursor cursor;
+	u32 visited = 0;
+	printf("\t %s: %u elements, %d levels\n", name, list->ops_->length(list), list->level_);
+	if (count != list->ops_->length(list))
+	{
+		printf("  ==> ERROR: %s must have %u elements\n", name, count);
+		return;
+	}
+	for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor), ++visited)
+	{
+		if (&values[from + visited * step] != CURSOR_get(&cursor))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %u\n", name, visited);
+			return;
+		}
+	}
+	for (list->ops_->rbegin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor), --visited)
+	{
+		if (&values[from + (visited - 1) * step] != CURSOR_get(&cursor))
+		{
+			printf("  ==> ERROR: %s has the wrong element at %u walking back\n", name, visited - 1);
+			return;
+		}
+	}
+	if (0 != visited)
+	{
+		printf("  ==> ERROR: the cursors must visit the %u elements of %s\n", count, name);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+	Cursor cursor;
+
+	TESTBASE_generateDataForTest();
+	srand(1);
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		// even numbers, so there are gaps for the bounds
+		values[i] = i * 2;
+		order[i] = i;
+	}
+	for (u32 i = kElements - 1; i > 0; --i)
+	{
+		u32 j = (u32)rand() % (i + 1);
+		u32 swap = order[i];
+		order[i] = order[j];
+		order[j] = swap;
+	}
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test insert in shuffled order\n");
+	SkipList *list = SKIPLIST_create(TEST_compareU32);
+	if (NULL == list)
+	{
+		printf("\n create returned a null skip list\n");
+		return -1;
+	}
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		error_type = list->ops_->insert(list, &values[order[i]], sizeof(u32));
+		if (kErrorCode_Ok != error_type)
+		{
+			break;
+		}
+	}
+	TESTBASE_printFunctionResult(list, (u8 *)"insert", error_type);
+	TEST_order("inserted", list, 0, kElements, 1);
+	u32 links = 0;
+	for (u16 i = 0; i < kSkipListMaxLevel; ++i)
+	{
+		links += NULL == list->pools_[i] ? 0 : list->pools_[i]->ops_->live(list->pools_[i]) * (i + 1);
+	}
+	printf("\t %.2f links per element\n", (double)links / kElements);
+	if (links > kElements * 2)
+	{
+		printf("  ==> ERROR: the towers must be 4/3 links high on average\n");
+	}
+	u32 copy = values[7];
+	error_type = list->ops_->insert(list, &copy, sizeof(u32));
+	TESTBASE_printFunctionResult(list, (u8 *)"insert element already inserted (NOT VALID)", error_type);
+	if (&values[0] != list->ops_->first(list) || &values[kElements - 1] != list->ops_->last(list))
+	{
+		printf("  ==> ERROR: wrong first or last element\n");
+	}
+
+	printf("\n\n# Test find and lower bound\n");
+	u32 found = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		u32 key = i * 2;
+		found += &values[i] == list->ops_->find(list, &key, sizeof(u32)) ? 1 : 0;
+	}
+	printf("\t found %u elements\n", found);
+	if (kElements != found)
+	{
+		printf("  ==> ERROR: find must return every element\n");
+	}
+	u32 odd = 2 * 1234 + 1;
+	if (NULL != list->ops_->find(list, &odd, sizeof(u32)))
+	{
+		printf("  ==> ERROR: find must return NULL for an element not inserted\n");
+	}
+	error_type = list->ops_->lowerBound(list, &odd, sizeof(u32), &cursor);
+	TESTBASE_printFunctionResult(list, (u8 *)"lowerBound between two elements", error_type);
+	if (&values[1235] != CURSOR_get(&cursor))
+	{
+		printf("  ==> ERROR: the lower bound of a missing element must be the next one\n");
+	}
+	u32 past = 2 * kElements;
+	list->ops_->lowerBound(list, &past, sizeof(u32), &cursor);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: the lower bound past the last element must be invalid\n");
+	}
+
+	printf("\n\n# Test range walk\n");
+	u32 scanned = 0;
+	u64 sum = 0;
+	for (list->ops_->lowerBound(list, &odd, sizeof(u32), &cursor);
+		True == CURSOR_valid(&cursor) && *(u32 *)CURSOR_get(&cursor) < 2 * 9000;
+		CURSOR_next(&cursor), ++scanned)
+	{
+		sum += *(u32 *)CURSOR_get(&cursor) / 2;
+	}
+	printf("\t walked %u elements from %u up to %d\n", scanned, odd, 2 * 9000);
+	if (9000 - 1235 != scanned || (u64)(1235 + 8999) * (9000 - 1235) / 2 != sum)
+	{
+		printf("  ==> ERROR: the walk must visit the elements of the range once\n");
+	}
+
+	printf("\n\n# Test erase down to an empty list\n");
+	u32 erased = 0;
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		if (0 == order[i] % 3)
+		{
+			erased += &values[order[i]] == list->ops_->erase(list, &values[order[i]], sizeof(u32)) ? 1 : 0;
+		}
+	}
+	printf("\t erased %u elements\n", erased);
+	if ((kElements + 2) / 3 != erased)
+	{
+		printf("  ==> ERROR: erase must return the elements erased\n");
+	}
+	for (u32 i = 0; i < kElements; ++i)
+	{
+		if (1 == order[i] % 3)
+		{
+			list->ops_->erase(list, &values[order[i]], sizeof(u32));
+		}
+	}
+	TEST_order("erased two of every three", list, 2, kElements / 3, 3);
+	if (NULL != list->ops_->erase(list, &values[0], sizeof(u32)))
+	{
+		printf("  ==> ERROR: erasing an element twice must return NULL\n");
+	}
+	for (u32 i = 2; i < kElements; i += 3)
+	{
+		list->ops_->erase(list, &values[i], sizeof(u32));
+	}
+	printf("\t emptied, %d levels\n", list->level_);
+	if (True != list->ops_->isEmpty(list) || 1 != list->level_ || NULL != list->ops_->first(list) || NULL != list->ops_->last(list))
+	{
+		printf("  ==> ERROR: an empty list must drop its levels\n");
+	}
+	list->ops_->begin(list, &cursor);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: begin on an empty list must be invalid\n");
+	}
+	for (u32 i = kElements; i > 0; --i)
+	{
+		list->ops_->insert(list, &values[i - 1], sizeof(u32));
+	}
+	TEST_order("inserted backwards", list, 0, kElements, 1);
+	error_type = list->ops_->softReset(list);
+	TESTBASE_printFunctionResult(list, (u8 *)"softReset", error_type);
+
+	printf("\n\n# Test strings and reset\n");
+	SkipList *strings = SKIPLIST_create(NULL);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		strings->ops_->insert(strings, TEST_copy(TestData.storage_ptr_test_A[i]), (u16)strlen(TestData.storage_ptr_test_A[i]));
+	}
+	// "1024" < "128" < "16384" < ... < "8192" compared as bytes
+	if (kNumberOfStoragePtrTest_A != strings->ops_->length(strings) || 0 != strncmp(strings->ops_->first(strings), "1024", 4) ||
+		0 != strncmp(strings->ops_->last(strings), "8192", 4) || NULL == strings->ops_->find(strings, "4096", 4) ||
+		NULL != strings->ops_->find(strings, "409", 3))
+	{
+		printf("  ==> ERROR: the strings must be ordered by their bytes\n");
+	}
+	strings->ops_->print(strings);
+	error_type = strings->ops_->reset(strings);
+	TESTBASE_printFunctionResult(strings, (u8 *)"reset", error_type);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = list->ops_->insert(NULL, &values[0], sizeof(u32));
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insert NULL (NOT VALID)", error_type);
+	error_type = list->ops_->insert(list, NULL, sizeof(u32));
+	TESTBASE_printFunctionResult(list, (u8 *)"insert data NULL (NOT VALID)", error_type);
+	error_type = list->ops_->insert(list, &values[0], 0);
+	TESTBASE_printFunctionResult(list, (u8 *)"insert bytes 0 (NOT VALID)", error_type);
+	error_type = list->ops_->lowerBound(NULL, &values[0], sizeof(u32), &cursor);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"lowerBound NULL (NOT VALID)", error_type);
+	if (True == CURSOR_valid(&cursor))
+	{
+		printf("  ==> ERROR: lowerBound on a NULL list must leave the cursor invalid\n");
+	}
+	error_type = list->ops_->begin(list, NULL);
+	TESTBASE_printFunctionResult(list, (u8 *)"begin cursor NULL (NOT VALID)", error_type);
+	if (NULL != list->ops_->find(NULL, &values[0], sizeof(u32)) || NULL != list->ops_->find(list, NULL, sizeof(u32)) ||
+		NULL != list->ops_->erase(list, &values[0], sizeof(u32)) || NULL != list->ops_->first(NULL))
+	{
+		printf("  ==> ERROR: find and erase on an empty or NULL list must return NULL\n");
+	}
+	error_type = list->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	list->ops_->destroy(list);
+	strings->ops_->destroy(strings);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
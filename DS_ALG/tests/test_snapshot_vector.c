@@ -0,0 +1,221 @@
+// test_snapshot_vector.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the read-mostly snapshot (RCU) vector
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_snapshot_vector.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kReaders 6
+const u16 kInitialCapacity = 4;
+const u16 kTableSize = 64;
+const u32 kWrites = 5000;
+
+// payload of the threaded test, check_ is always ~value_
+typedef struct test_entry_s {
+	u32 value_;
+	u32 check_;
+} TestEntry;
+
+typedef struct test_context_s {
+	SnapshotVector *vector_;
+	_Atomic boolean done_;
+	_Atomic u32 errors_;
+	_Atomic u32 reads_;
+} TestContext;
+
+static TestEntry *TEST_newEntry(u32 value)
+{
+	TestEntry *entry = MM->malloc(sizeof(TestEntry));
+	entry->value_ = value;
+	entry->check_ = ~value;
+	return entry;
+}
+
+static int TEST_reader(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	SnapshotVector *vector = ctx->vector_;
+	EpochRecord *reader = vector->ops_->registerReader(vector);
+	u32 last_version = 0;
+	while (False == atomic_load(&ctx->done_))
+	{
+		const SnapshotVersion *version = vector->ops_->acquire(vector, reader);
+		if (version->number_ < last_version || kTableSize != vector->ops_->length(version))
+		{
+			atomic_fetch_add(&ctx->errors_, 1);
+		}
+		last_version = version->number_;
+		for (u16 i = 0; i < kTableSize; ++i)
+		{
+			TestEntry *entry = vector->ops_->at(version, i);
+			if (NULL == entry || entry->check_ != ~entry->value_)
+			{
+				atomic_fetch_add(&ctx->errors_, 1);
+			}
+		}
+		vector->ops_->release(vector, reader);
+		atomic_fetch_add(&ctx->reads_, 1);
+	}
+	vector->ops_->unregisterReader(reader);
+	return 0;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	SnapshotVector *v = SNAPSHOTVECTOR_create(1);
+	SnapshotVector *vector_1 = SNAPSHOTVECTOR_create(kInitialCapacity);
+	if (NULL == v || NULL == vector_1) {
+		printf("\n create returned a null vector\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + SnapshotVector: %zu\n", sizeof(SnapshotVector));
+	printf("  + SnapshotVersion: %zu\n", sizeof(SnapshotVersion));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Insert (growing from %d elements)\n", kInitialCapacity);
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = v->ops_->insertLast(vector_1, TestData.storage_ptr_test_A[i], (strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TestData.storage_ptr_test_A[i] = NULL;
+		TESTBASE_printFunctionResult(vector_1, (u8 *)"insertLast vector_1", error_type);
+	}
+	error_type = v->ops_->insertFirst(vector_1, TestData.single_ptr_data_1, kSingleSizeData1);
+	TestData.single_ptr_data_1 = NULL;
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"insertFirst vector_1", error_type);
+	error_type = v->ops_->insertAt(vector_1, TestData.single_ptr_data_2, kSingleSizeData2, 3);
+	TestData.single_ptr_data_2 = NULL;
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"insertAt vector_1", error_type);
+	printf("vector_1:\n");
+	v->ops_->print(vector_1);
+	if (kNumberOfStoragePtrTest_A + 2 != v->ops_->version(vector_1))
+	{
+		printf("  ==> ERROR: every write must publish one version\n");
+	}
+
+	printf("\n\n# Test A snapshot doesn't change while it is held\n");
+	EpochRecord *reader = v->ops_->registerReader(vector_1);
+	const SnapshotVersion *snapshot = v->ops_->acquire(vector_1, reader);
+	u16 snapshot_length = v->ops_->length(snapshot);
+	char *first = v->ops_->at(snapshot, 0);
+	char first_copy[kSingleSizeData1];
+	memcpy(first_copy, first, kSingleSizeData1);
+	error_type = v->ops_->setAt(vector_1, TestData.single_ptr_data_3, kSingleSizeData3, 0);
+	TestData.single_ptr_data_3 = NULL;
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"setAt vector_1", error_type);
+	error_type = v->ops_->removeAt(vector_1, 1);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"removeAt vector_1", error_type);
+	if (snapshot_length != v->ops_->length(snapshot) || first != v->ops_->at(snapshot, 0) ||
+		0 != memcmp(first, first_copy, kSingleSizeData1))
+	{
+		printf("  ==> ERROR: the held snapshot changed\n");
+	}
+	const SnapshotVersion *current = v->ops_->acquire(vector_1, reader);
+	printf("\t snapshot version %u: %d elements, current version %u: %d elements\n", snapshot->number_,
+		v->ops_->length(snapshot), current->number_, v->ops_->length(current));
+	if (current == snapshot || snapshot_length - 1 != v->ops_->length(current))
+	{
+		printf("  ==> ERROR: the writes were not published\n");
+	}
+	v->ops_->print(vector_1);
+	error_type = v->ops_->release(vector_1, reader);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"release (nested)", error_type);
+	error_type = v->ops_->release(vector_1, reader);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"release", error_type);
+	error_type = v->ops_->release(vector_1, reader);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"release (NOT VALID)", error_type);
+
+	printf("\n\n# Test Old versions are freed once released\n");
+	for (u16 i = 0; i < 2 * kSnapshotVectorBatchSize; ++i)
+	{
+		v->ops_->setAt(vector_1, MM->malloc(4), 4, 2);
+	}
+	u32 pending = vector_1->domain_->ops_->pending(vector_1->writer_record_);
+	printf("\t %u versions and payloads waiting to be freed\n", pending);
+	if (pending > 2 * kSnapshotVectorBatchSize * kEpochMaxPendingBatches)
+	{
+		printf("  ==> ERROR: old versions are not reclaimed\n");
+	}
+
+	printf("\n\n# Test Readers / writer threads\n");
+	TestContext ctx;
+	ctx.vector_ = SNAPSHOTVECTOR_create(kTableSize);
+	atomic_init(&ctx.done_, False);
+	atomic_init(&ctx.errors_, 0);
+	atomic_init(&ctx.reads_, 0);
+	for (u16 i = 0; i < kTableSize; ++i)
+	{
+		ctx.vector_->ops_->insertLast(ctx.vector_, TEST_newEntry(i), sizeof(TestEntry));
+	}
+	thrd_t readers[kReaders];
+	for (u16 i = 0; i < kReaders; ++i)
+	{
+		thrd_create(&readers[i], TEST_reader, &ctx);
+	}
+	for (u32 i = 0; i < kWrites; ++i)
+	{
+		ctx.vector_->ops_->setAt(ctx.vector_, TEST_newEntry(i), sizeof(TestEntry), i % kTableSize);
+		if (0 == i % 64)
+			thrd_yield();
+	}
+	atomic_store(&ctx.done_, True);
+	for (u16 i = 0; i < kReaders; ++i)
+	{
+		thrd_join(readers[i], NULL);
+	}
+	printf("\t %u writes, %u snapshots read, %u errors\n", kWrites, atomic_load(&ctx.reads_), atomic_load(&ctx.errors_));
+	if (0 != atomic_load(&ctx.errors_))
+	{
+		printf("  ==> ERROR: readers saw a torn or freed version\n");
+	}
+	v->ops_->destroy(ctx.vector_);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != SNAPSHOTVECTOR_create(0) || NULL != SNAPSHOTVECTOR_create(kSnapshotVectorMaxCapacity + 1))
+	{
+		printf("ERROR: trying to create a vector with an invalid capacity\n");
+	}
+	error_type = v->ops_->insertLast(NULL, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insertLast NULL (NOT VALID)", error_type);
+	error_type = v->ops_->insertLast(vector_1, NULL, kSingleSizeData4);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"insertLast NULL data (NOT VALID)", error_type);
+	error_type = v->ops_->setAt(vector_1, TestData.single_ptr_data_4, kSingleSizeData4, 1000);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"setAt out of range (NOT VALID)", error_type);
+	error_type = v->ops_->removeAt(vector_1, 1000);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"removeAt out of range (NOT VALID)", error_type);
+	if (NULL != v->ops_->acquire(NULL, reader) || NULL != v->ops_->at(NULL, 0))
+	{
+		printf("ERROR: NULL vector returns data\n");
+	}
+
+	// Work is done, clean the system
+	error_type = v->ops_->unregisterReader(reader);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"unregisterReader vector_1", error_type);
+	error_type = v->ops_->destroy(vector_1);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"destroy vector_1", error_type);
+	error_type = v->ops_->destroy(v);
+	TESTBASE_printFunctionResult(v, (u8 *)"destroy SnapshotVector Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
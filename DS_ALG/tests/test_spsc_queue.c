@@ -0,0 +1,204 @@
+// test_spsc_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for single-producer/single-consumer queue ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_spsc_queue.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const u16 kCapacitySPSCQueue1 = 30; // rounded up to 32
+const u16 kCapacitySPSCQueue2 = 2;
+const u32 kTransferMessages = 100000;
+
+static int TEST_producer(void *arg)
+{
+	SPSCQueue *qu = (SPSCQueue *)arg;
+	for (u32 i = 1; i <= kTransferMessages; ++i)
+	{
+		// the payload is the sequence number itself, never dereferenced
+		while (kErrorCode_QueueFull == qu->ops_->enqueue(qu, (void *)(uintptr_t)i, sizeof(u32)))
+		{
+			thrd_yield();
+		}
+	}
+	return 0;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	SPSCQueue *q = NULL;
+	q = SPSCQUEUE_create(1);
+	if (NULL == q) {
+		printf("\n create returned a null node in queue for ops");
+		return -1;
+	}
+	SPSCQueue *queue_1 = SPSCQUEUE_create(kCapacitySPSCQueue1);
+	if (NULL == queue_1) {
+		printf("\n create returned a null node in queue_1\n");
+		return -1;
+	}
+	SPSCQueue *queue_2 = SPSCQUEUE_create(kCapacitySPSCQueue2);
+	if (NULL == queue_2) {
+		printf("\n create returned a null node in queue_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + SPSCQueue: %zu\n", sizeof(SPSCQueue));
+	printf("  + queue_1 capacity: %d\n", q->ops_->capacity(queue_1));
+	printf("  + queue_2 capacity: %d\n", q->ops_->capacity(queue_2));
+	if (32 != q->ops_->capacity(queue_1))
+	{
+		printf("ERROR: capacity is not rounded up to a power of two (queue_1)\n");
+	}
+
+	printf("---------------- FIRST BATTERY ----------------\n\n");
+	printf("\n\n# Test Enqueue\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = q->ops_->enqueue(queue_1, TestData.storage_ptr_test_A[i], (strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TestData.storage_ptr_test_A[i] = NULL;
+		TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueue queue_1", error_type);
+	}
+	printf("queue_1:\n");
+	q->ops_->print(queue_1);
+
+	u16 insert_errors = 0;
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		if (False == q->ops_->isFull(queue_2))
+		{
+			error_type = q->ops_->enqueue(queue_2, TestData.storage_ptr_test_C[i], (strlen(TestData.storage_ptr_test_C[i]) + 1));
+			TestData.storage_ptr_test_C[i] = NULL;
+			TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2", error_type);
+		}
+		else
+		{
+			error_type = q->ops_->enqueue(queue_2, TestData.storage_ptr_test_C[i], (strlen(TestData.storage_ptr_test_C[i]) + 1));
+			TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2 (FULL)", error_type);
+			insert_errors++;
+		}
+	}
+	if ((kNumberOfStoragePtrTest_C - kCapacitySPSCQueue2) != insert_errors)
+	{
+		printf("  ==> ERROR: isFull doesn't work correctly (queue_2)\n");
+	}
+	printf("queue_2:\n");
+	q->ops_->print(queue_2);
+
+	printf("\n\n# Test Front & Back\n");
+	void *data = q->ops_->front(queue_1);
+	printf("Front in queue_1: \"%s\"\n", NULL == data ? "NULL" : (char *)data);
+	data = q->ops_->back(queue_1);
+	printf("Back in queue_1: \"%s\"\n", NULL == data ? "NULL" : (char *)data);
+
+	printf("\n\n# Test Dequeue\n");
+	for (u16 i = 0; i < 3; ++i)
+	{
+		data = q->ops_->dequeue(queue_1);
+		if (NULL == data)
+			printf("ERROR: NULL pointer extracted at front queue_1\n");
+		else
+			printf("extracted \"%s\" at front in queue_1\n", (char *)data);
+		MM->free(data);
+	}
+	printf("\t queue_1: [Capacity = %d] - [Length  = %d]\n", q->ops_->capacity(queue_1), q->ops_->length(queue_1));
+
+	printf("\n\n# Test Wrap Around\n");
+	// drain and refill queue_2 several times so the indices wrap over the ring
+	for (u16 round = 0; round < 5; ++round)
+	{
+		data = q->ops_->dequeue(queue_2);
+		error_type = q->ops_->enqueue(queue_2, data, (strlen(data) + 1));
+		TESTBASE_printFunctionResult(queue_2, (u8 *)"dequeue + enqueue queue_2", error_type);
+	}
+	printf("queue_2:\n");
+	q->ops_->print(queue_2);
+
+	printf("\n\n# Test Reset\n");
+	error_type = q->ops_->reset(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"reset queue_2", error_type);
+	if (False == q->ops_->isEmpty(queue_2))
+	{
+		printf("ERROR: isEmpty doesn't work correctly (queue_2)\n");
+	}
+	data = q->ops_->dequeue(queue_2);
+	if (NULL != data)
+	{
+		printf("ERROR: trying to dequeue from an empty queue\n");
+	}
+
+	printf("\n\n# Test Producer / Consumer threads\n");
+	SPSCQueue *queue_3 = SPSCQUEUE_create(64);
+	thrd_t producer;
+	if (thrd_success != thrd_create(&producer, TEST_producer, queue_3))
+	{
+		printf("ERROR: cannot create the producer thread\n");
+		return -1;
+	}
+	u32 expected = 1;
+	u32 order_errors = 0;
+	while (expected <= kTransferMessages)
+	{
+		data = q->ops_->dequeue(queue_3);
+		if (NULL == data)
+		{
+			thrd_yield();
+			continue;
+		}
+		if ((u32)(uintptr_t)data != expected)
+		{
+			order_errors++;
+		}
+		expected++;
+	}
+	thrd_join(producer, NULL);
+	printf("\t %u messages transferred, %u out of order\n", kTransferMessages, order_errors);
+	if (0 != order_errors || False == q->ops_->isEmpty(queue_3))
+	{
+		printf("  ==> ERROR: producer/consumer transfer is not FIFO\n");
+	}
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	error_type = q->ops_->enqueue(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"enqueue NULL (NOT VALID)", error_type);
+	error_type = q->ops_->enqueue(queue_1, NULL, kSingleSizeData1);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueue NULL data (NOT VALID)", error_type);
+	if (NULL != q->ops_->dequeue(NULL) || NULL != q->ops_->front(NULL) || NULL != q->ops_->back(NULL))
+	{
+		printf("ERROR: NULL queue returns data\n");
+	}
+	error_type = q->ops_->reset(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"reset NULL (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = q->ops_->destroy(queue_1);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"destroy queue_1", error_type);
+	error_type = q->ops_->destroy(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"destroy queue_2", error_type);
+	error_type = q->ops_->destroy(queue_3);
+	TESTBASE_printFunctionResult(queue_3, (u8 *)"destroy queue_3", error_type);
+	error_type = q->ops_->destroy(q);
+	TESTBASE_printFunctionResult(q, (u8 *)"destroy SPSCQueue Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
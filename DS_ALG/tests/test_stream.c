@@ -0,0 +1,204 @@
+// test_stream.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the stream reader in both modes: slices cut from the
+// blocks, block references, fill/releaseList with a List and wrong releases
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_stream.h"
+#include "adt_cursor.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+const char *kStreamFile = "test_stream.bin";
+// three full blocks and a short one
+#define kFileBytes (3 * kStreamBlockAlignment + 3392)
+const u16 kSliceSize = 1000;
+// 65536 / 1000 -> 65 slices + one of 536 bytes per full block, 4 in the last
+const u32 kSlices = 3 * 66 + 4;
+const u16 kListCapacity = 3;
+
+static u8 content[kFileBytes];
+
+// Reads the whole file slice by slice, checking every byte and the cuts
+static void TEST_read(Stream *stream, const char *name)
+{
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	u32 slices = 0;
+	u16 max_live = 0;
+	u64 position = 0;
+	s16 error_type;
+	while (kErrorCode_Ok == (error_type = stream->ops_->next(stream, &node)))
+	{
+		u32 in_block = (u32)(position % kStreamBlockAlignment);
+		u16 expected = kSliceSize;
+		if (in_block + kSliceSize > kStreamBlockAlignment)
+		{
+			expected = (u16)(kStreamBlockAlignment - in_block);
+		}
+		if (position + expected > kFileBytes)
+		{
+			expected = (u16)(kFileBytes - position);
+		}
+		if (expected != node.size_ || 0 != memcmp(node.data_, content + position, node.size_))
+		{
+			printf("  ==> ERROR: %s wrong slice %d\n", name, slices);
+			return;
+		}
+		position += node.size_;
+		slices++;
+		if (stream->ops_->liveBlocks(stream) > max_live)
+		{
+			max_live = stream->ops_->liveBlocks(stream);
+		}
+		stream->ops_->release(stream, &node);
+	}
+	printf("\t %s: %d slices, %llu bytes, at most %d live blocks\n", name, slices,
+		(unsigned long long)stream->ops_->position(stream), max_live);
+	TESTBASE_printFunctionResult(stream, (u8 *)"next at the end", error_type);
+	if (kSlices != slices || kFileBytes != stream->ops_->position(stream) || 1 != max_live ||
+		0 != stream->ops_->liveBlocks(stream) || NULL != node.data_)
+	{
+		printf("  ==> ERROR: %s must cut %d slices from one live block at a time\n", name, kSlices);
+	}
+}
+
+// A slice kept alive keeps its block, the others are recycled
+static void TEST_references(Stream *stream, const char *name)
+{
+	MemoryNode first, node;
+	MEMNODE_createLite(&first);
+	MEMNODE_createLite(&node);
+	stream->ops_->next(stream, &first);
+	while (kErrorCode_Ok == stream->ops_->next(stream, &node))
+	{
+		stream->ops_->release(stream, &node);
+	}
+	printf("\t %s: %d live blocks holding the first slice\n", name, stream->ops_->liveBlocks(stream));
+	stream->ops_->print(stream);
+	if (1 != stream->ops_->liveBlocks(stream) || 0 != memcmp(first.data_, content, first.size_))
+	{
+		printf("  ==> ERROR: %s the first slice must keep its block\n", name);
+	}
+	stream->ops_->release(stream, &first);
+	if (0 != stream->ops_->liveBlocks(stream))
+	{
+		printf("  ==> ERROR: %s the last release must recycle the block\n", name);
+	}
+}
+
+int main()
+{
+	s16 error_type = 0;
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+
+	TESTBASE_generateDataForTest();
+	for (u32 i = 0; i < kFileBytes; ++i)
+	{
+		content[i] = (u8)(i % 251);
+	}
+	FILE *file = fopen(kStreamFile, "wb");
+	fwrite(content, 1, kFileBytes, file);
+	fclose(file);
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test read mode\n");
+	Stream *stream = STREAM_create(kStreamFile, kStreamMode_Read, kStreamBlockAlignment, kSliceSize);
+	if (NULL == stream)
+	{
+		printf("\n create returned a null stream\n");
+		return -1;
+	}
+	TEST_read(stream, "read mode");
+	stream->ops_->destroy(stream);
+	stream = STREAM_create(kStreamFile, kStreamMode_Read, 1, kSliceSize);
+	TEST_references(stream, "read mode");
+	stream->ops_->destroy(stream);
+
+	printf("\n\n# Test map mode\n");
+	stream = STREAM_create(kStreamFile, kStreamMode_Map, kStreamBlockAlignment, kSliceSize);
+	TEST_read(stream, "map mode");
+	stream->ops_->destroy(stream);
+	stream = STREAM_create(kStreamFile, kStreamMode_Map, kStreamBlockAlignment, kSliceSize);
+	TEST_references(stream, "map mode");
+	stream->ops_->destroy(stream);
+
+	printf("\n\n# Test fill and releaseList\n");
+	// slices of 64000 from blocks of 131072: 64000 + 64000 + 3072, then 64000 + 4928
+	stream = STREAM_create(kStreamFile, kStreamMode_Read, 2 * kStreamBlockAlignment, 64000);
+	List *list = LIST_create(kListCapacity);
+	u32 rounds = 0;
+	u32 slices = 0;
+	u64 position = 0;
+	while (kErrorCode_Ok == (error_type = stream->ops_->fill(stream, list)))
+	{
+		Cursor cursor;
+		for (list->ops_->begin(list, &cursor); True == CURSOR_valid(&cursor); CURSOR_next(&cursor))
+		{
+			MemoryNode *slice = CURSOR_node(&cursor);
+			if (0 != memcmp(slice->data_, content + position, slice->size_))
+			{
+				printf("  ==> ERROR: fill inserted the wrong slice %d\n", slices);
+			}
+			position += slice->size_;
+			slices++;
+		}
+		error_type = stream->ops_->releaseList(stream, list);
+		TESTBASE_printFunctionResult(list, (u8 *)"releaseList", error_type);
+		rounds++;
+	}
+	printf("\t %d fills, %d slices, %llu bytes\n", rounds, slices, (unsigned long long)position);
+	TESTBASE_printFunctionResult(stream, (u8 *)"fill at the end", error_type);
+	if (2 != rounds || 5 != slices || kFileBytes != position || 0 != stream->ops_->liveBlocks(stream))
+	{
+		printf("  ==> ERROR: fill must cut 5 slices in 2 rounds and releaseList give them back\n");
+	}
+	list->ops_->destroy(list);
+	stream->ops_->destroy(stream);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != STREAM_create(NULL, kStreamMode_Read, kStreamBlockAlignment, kSliceSize) ||
+		NULL != STREAM_create("missing_file.bin", kStreamMode_Map, kStreamBlockAlignment, kSliceSize) ||
+		NULL != STREAM_create(kStreamFile, kStreamMode_Read, kStreamBlockAlignment, 0))
+	{
+		printf("  ==> ERROR: create with wrong parameters must return NULL\n");
+	}
+	stream = STREAM_create(kStreamFile, kStreamMode_Read, kStreamBlockAlignment, kSliceSize);
+	error_type = stream->ops_->next(NULL, &node);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"next stream NULL (NOT VALID)", error_type);
+	error_type = stream->ops_->next(stream, NULL);
+	TESTBASE_printFunctionResult(stream, (u8 *)"next node NULL (NOT VALID)", error_type);
+	error_type = stream->ops_->releaseData(stream, TestData.single_ptr_data_1);
+	TESTBASE_printFunctionResult(stream, (u8 *)"releaseData of foreign data (NOT VALID)", error_type);
+	stream->ops_->next(stream, &node);
+	void *slice = node.data_;
+	stream->ops_->release(stream, &node);
+	stream->ops_->next(stream, &node);
+	error_type = stream->ops_->fill(stream, NULL);
+	TESTBASE_printFunctionResult(stream, (u8 *)"fill list NULL (NOT VALID)", error_type);
+	error_type = stream->ops_->destroy(NULL);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"destroy NULL (NOT VALID)", error_type);
+	if (slice != (u8 *)node.data_ - kSliceSize)
+	{
+		printf("  ==> ERROR: slices must follow each other in the block\n");
+	}
+	// destroy frees the block of the slice still alive
+	stream->ops_->destroy(stream);
+	remove(kStreamFile);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
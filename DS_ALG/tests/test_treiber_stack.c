@@ -0,0 +1,195 @@
+// test_treiber_stack.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the lock-free Treiber stack
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_treiber_stack.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kTestThreads 8
+const u16 kCapacityTreiberStack1 = 12;
+const u16 kCapacityTreiberStack2 = 3;
+const u32 kPairsPerThread = 20000;
+
+typedef struct test_context_s {
+	TreiberStack *stack_;
+	_Atomic u64 sum_;
+	_Atomic u32 push_errors_;
+} TestContext;
+
+// Every thread pushes its own values and pops whatever is on top: the
+// popped values must add up to the pushed ones once every thread is done.
+static int TEST_worker(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	u64 sum = 0;
+	for (u32 i = 1; i <= kPairsPerThread; ++i)
+	{
+		// payloads are numbers, never dereferenced
+		if (kErrorCode_Ok != ctx->stack_->ops_->push(ctx->stack_, (void *)(uintptr_t)i, sizeof(u32)))
+		{
+			atomic_fetch_add(&ctx->push_errors_, 1);
+			continue;
+		}
+		void *data = ctx->stack_->ops_->pop(ctx->stack_);
+		sum += (uintptr_t)data;
+	}
+	atomic_fetch_add(&ctx->sum_, sum);
+	return 0;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	TreiberStack *s = TREIBERSTACK_create(1);
+	TreiberStack *stack_1 = TREIBERSTACK_create(kCapacityTreiberStack1);
+	TreiberStack *stack_2 = TREIBERSTACK_create(kCapacityTreiberStack2);
+	if (NULL == s || NULL == stack_1 || NULL == stack_2) {
+		printf("\n create returned a null stack\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + TreiberStack: %zu\n", sizeof(TreiberStack));
+	printf("  + TreiberNode: %zu\n", sizeof(TreiberNode));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Push\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_A; ++i)
+	{
+		error_type = s->ops_->push(stack_1, TestData.storage_ptr_test_A[i], (strlen(TestData.storage_ptr_test_A[i]) + 1));
+		TestData.storage_ptr_test_A[i] = NULL;
+		TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1", error_type);
+	}
+	printf("stack_1:\n");
+	s->ops_->print(stack_1);
+
+	printf("\n\n# Test Push on a full stack\n");
+	u16 insert_errors = 0;
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		error_type = s->ops_->push(stack_2, TestData.storage_ptr_test_C[i], (strlen(TestData.storage_ptr_test_C[i]) + 1));
+		TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+		if (kErrorCode_Ok == error_type)
+			TestData.storage_ptr_test_C[i] = NULL;
+		else
+			insert_errors++;
+	}
+	if ((kNumberOfStoragePtrTest_C - kCapacityTreiberStack2) != insert_errors || False == s->ops_->isFull(stack_2))
+	{
+		printf("  ==> ERROR: isFull / push don't work correctly (stack_2)\n");
+	}
+
+	printf("\n\n# Test Top\n");
+	void *data = s->ops_->top(stack_1);
+	if (NULL == data)
+		printf("ERROR: NULL pointer at top of stack_1\n");
+	else
+		printf("top of stack_1: \"%s\"\n", (char *)data);
+
+	printf("\n\n# Test Pop\n");
+	for (u16 i = 0; i < 3; ++i)
+	{
+		void *top = s->ops_->top(stack_1);
+		data = s->ops_->pop(stack_1);
+		if (NULL == data)
+			printf("ERROR: NULL pointer popped from stack_1\n");
+		else
+			printf("popped \"%s\" from stack_1\n", (char *)data);
+		if (top != data)
+			printf("  ==> ERROR: pop doesn't return the top element\n");
+		MM->free(data);
+	}
+	printf("\t stack_1: [Capacity = %d] - [Length  = %d]\n", s->ops_->capacity(stack_1), s->ops_->length(stack_1));
+	if (kNumberOfStoragePtrTest_A - 3 != s->ops_->length(stack_1))
+	{
+		printf("  ==> ERROR: length doesn't match the pushed elements (stack_1)\n");
+	}
+
+	printf("\n\n# Test Reset\n");
+	error_type = s->ops_->reset(stack_2);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"reset stack_2", error_type);
+	if (NULL != s->ops_->pop(stack_2) || False == s->ops_->isEmpty(stack_2))
+	{
+		printf("ERROR: pop returns data from an empty stack\n");
+	}
+	printf("\t push after reset reuses the nodes\n");
+	for (u16 i = 0; i < kNumberOfStoragePtrTest_C; ++i)
+	{
+		if (NULL == TestData.storage_ptr_test_C[i])
+			continue;
+		error_type = s->ops_->push(stack_2, TestData.storage_ptr_test_C[i], (strlen(TestData.storage_ptr_test_C[i]) + 1));
+		TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+		if (kErrorCode_Ok == error_type)
+			TestData.storage_ptr_test_C[i] = NULL;
+	}
+	printf("stack_2:\n");
+	s->ops_->print(stack_2);
+
+	printf("\n\n# Test Push / Pop threads\n");
+	TestContext ctx;
+	ctx.stack_ = TREIBERSTACK_create(kTestThreads);
+	atomic_init(&ctx.sum_, 0);
+	atomic_init(&ctx.push_errors_, 0);
+	thrd_t workers[kTestThreads];
+	for (u16 i = 0; i < kTestThreads; ++i)
+	{
+		thrd_create(&workers[i], TEST_worker, &ctx);
+	}
+	for (u16 i = 0; i < kTestThreads; ++i)
+	{
+		thrd_join(workers[i], NULL);
+	}
+	u64 expected = (u64)kTestThreads * kPairsPerThread * (kPairsPerThread + 1) / 2;
+	printf("\t sum %llu (expected %llu), %u push errors, length %d\n",
+		(unsigned long long)atomic_load(&ctx.sum_), (unsigned long long)expected,
+		atomic_load(&ctx.push_errors_), s->ops_->length(ctx.stack_));
+	if (expected != atomic_load(&ctx.sum_) || 0 != atomic_load(&ctx.push_errors_) ||
+		False == s->ops_->isEmpty(ctx.stack_))
+	{
+		printf("  ==> ERROR: elements lost or duplicated\n");
+	}
+	s->ops_->destroy(ctx.stack_);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != TREIBERSTACK_create(0))
+	{
+		printf("ERROR: trying to create a stack with 0 capacity\n");
+	}
+	error_type = s->ops_->push(NULL, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"push NULL (NOT VALID)", error_type);
+	error_type = s->ops_->push(stack_1, NULL, kSingleSizeData1);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"push NULL data (NOT VALID)", error_type);
+	if (NULL != s->ops_->pop(NULL) || NULL != s->ops_->top(NULL))
+	{
+		printf("ERROR: NULL stack returns data\n");
+	}
+
+	// Work is done, clean the system
+	error_type = s->ops_->destroy(stack_1);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"destroy stack_1", error_type);
+	error_type = s->ops_->destroy(stack_2);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"destroy stack_2", error_type);
+	error_type = s->ops_->destroy(s);
+	TESTBASE_printFunctionResult(s, (u8 *)"destroy TreiberStack Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
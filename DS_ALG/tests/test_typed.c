@@ -0,0 +1,248 @@
+// test_typed.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the macro generated typed Vector, List and Queue
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "adt_typed.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+typedef struct point_s
+{
+	float x_;
+	float y_;
+} Point;
+
+DEFINE_VECTOR(u32)
+DEFINE_VECTOR(Point)
+DEFINE_LIST(u32)
+DEFINE_QUEUE(u32)
+DEFINE_VECTOR(double)
+DEFINE_LIST(double)
+
+const u16 kCapacity = 10;
+
+static u32 sum = 0;
+
+static void TEST_sum(u32 *value)
+{
+	sum += *value;
+}
+
+static void TEST_movePoint(Point *point)
+{
+	point->x_ += 1.0f;
+}
+
+int main()
+{
+	s16 error_type = 0;
+	u32 value = 0;
+
+	TESTBASE_generateDataForTest();
+
+	Vector_u32 *vector = VECTOR_u32_create(kCapacity);
+	Vector_Point *points = VECTOR_Point_create(kCapacity);
+	List_u32 *list = LIST_u32_create(kCapacity);
+	Queue_u32 *queue = QUEUE_u32_create(kCapacity);
+	if (NULL == vector || NULL == points || NULL == list || NULL == queue) {
+		printf("\n create returned a null container\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Vector_u32: %zu\n", sizeof(Vector_u32));
+	printf("  + List_u32: %zu\n", sizeof(List_u32));
+	printf("  + ListNode_u32: %zu\n", sizeof(ListNode_u32));
+	printf("  + Queue_u32: %zu\n", sizeof(Queue_u32));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Vector_u32\n");
+	for (u32 i = 1; i <= 5; ++i)
+	{
+		error_type = VECTOR_u32_insertLast(vector, i * 10);
+		TESTBASE_printFunctionResult(vector, (u8 *)"insertLast", error_type);
+	}
+	error_type = VECTOR_u32_insertFirst(vector, 1);
+	TESTBASE_printFunctionResult(vector, (u8 *)"insertFirst", error_type);
+	error_type = VECTOR_u32_insertAt(vector, 25, 3);
+	TESTBASE_printFunctionResult(vector, (u8 *)"insertAt 3", error_type);
+	// 1 10 20 25 30 40 50
+	printf("\t first %u, at 3 %u, last %u\n", *VECTOR_u32_first(vector), *VECTOR_u32_at(vector, 3),
+		*VECTOR_u32_last(vector));
+	if (1 != *VECTOR_u32_first(vector) || 25 != *VECTOR_u32_at(vector, 3) || 50 != *VECTOR_u32_last(vector))
+	{
+		printf("  ==> ERROR: wrong vector content\n");
+	}
+	error_type = VECTOR_u32_extractAt(vector, 1, &value);
+	TESTBASE_printFunctionResult(vector, (u8 *)"extractAt 1", error_type);
+	if (10 != value)
+	{
+		printf("  ==> ERROR: extractAt returned %u\n", value);
+	}
+	VECTOR_u32_extractFirst(vector, &value);
+	VECTOR_u32_extractLast(vector, &value);
+	sum = 0;
+	VECTOR_u32_traverse(vector, TEST_sum);
+	printf("\t length %u, sum %u\n", VECTOR_u32_length(vector), sum);
+	if (4 != VECTOR_u32_length(vector) || 115 != sum)
+	{
+		printf("  ==> ERROR: wrong vector after extracts\n");
+	}
+	Vector_u32 *other = VECTOR_u32_create(kCapacity);
+	for (u32 i = 0; i < kCapacity; ++i)
+	{
+		VECTOR_u32_insertLast(other, i);
+	}
+	error_type = VECTOR_u32_insertLast(other, 99);
+	TESTBASE_printFunctionResult(other, (u8 *)"insertLast when full (NOT VALID)", error_type);
+	error_type = VECTOR_u32_concat(vector, other);
+	TESTBASE_printFunctionResult(vector, (u8 *)"concat vector + other", error_type);
+	if (4 + kCapacity != VECTOR_u32_length(vector) || (u32)(kCapacity - 1) != *VECTOR_u32_last(vector))
+	{
+		printf("  ==> ERROR: wrong vector after concat\n");
+	}
+	error_type = VECTOR_u32_resize(vector, 2);
+	TESTBASE_printFunctionResult(vector, (u8 *)"resize to 2", error_type);
+	if (2 != VECTOR_u32_length(vector) || True != VECTOR_u32_isFull(vector))
+	{
+		printf("  ==> ERROR: resize must drop the elements past the capacity\n");
+	}
+	VECTOR_u32_destroy(other);
+
+	printf("\n\n# Test Vector_Point\n");
+	for (u16 i = 0; i < 3; ++i)
+	{
+		Point point = { (float)i, (float)i * 2.0f };
+		VECTOR_Point_insertLast(points, point);
+	}
+	VECTOR_Point_traverse(points, TEST_movePoint);
+	Point *last = VECTOR_Point_last(points);
+	printf("\t last point (%.1f, %.1f)\n", last->x_, last->y_);
+	if (3.0f != last->x_ || 4.0f != last->y_)
+	{
+		printf("  ==> ERROR: the points are not stored by value\n");
+	}
+
+	printf("\n\n# Test List_u32\n");
+	for (u32 i = 1; i <= 5; ++i)
+	{
+		error_type = LIST_u32_insertLast(list, i * 10);
+		TESTBASE_printFunctionResult(list, (u8 *)"insertLast", error_type);
+	}
+	LIST_u32_insertFirst(list, 1);
+	error_type = LIST_u32_insertAt(list, 25, 3);
+	TESTBASE_printFunctionResult(list, (u8 *)"insertAt 3", error_type);
+	printf("\t first %u, at 3 %u, last %u\n", *LIST_u32_first(list), *LIST_u32_at(list, 3),
+		*LIST_u32_last(list));
+	if (1 != *LIST_u32_first(list) || 25 != *LIST_u32_at(list, 3) || 50 != *LIST_u32_last(list))
+	{
+		printf("  ==> ERROR: wrong list content\n");
+	}
+	error_type = LIST_u32_extractLast(list, &value);
+	TESTBASE_printFunctionResult(list, (u8 *)"extractLast", error_type);
+	if (50 != value || 40 != *LIST_u32_last(list))
+	{
+		printf("  ==> ERROR: extractLast must move the tail\n");
+	}
+	LIST_u32_extractAt(list, 1, &value);
+	LIST_u32_extractFirst(list, &value);
+	error_type = LIST_u32_concat(list, list);
+	TESTBASE_printFunctionResult(list, (u8 *)"concat list + list", error_type);
+	sum = 0;
+	LIST_u32_traverse(list, TEST_sum);
+	printf("\t length %u, sum %u\n", LIST_u32_length(list), sum);
+	if (8 != LIST_u32_length(list) || 230 != sum)
+	{
+		printf("  ==> ERROR: wrong list after concat\n");
+	}
+	error_type = LIST_u32_resize(list, 3);
+	TESTBASE_printFunctionResult(list, (u8 *)"resize to 3", error_type);
+	if (3 != LIST_u32_length(list) || 30 != *LIST_u32_last(list))
+	{
+		printf("  ==> ERROR: resize must drop the elements past the capacity\n");
+	}
+
+	printf("\n\n# Test Queue_u32\n");
+	for (u32 i = 0; i < kCapacity; ++i)
+	{
+		QUEUE_u32_enqueue(queue, i);
+	}
+	error_type = QUEUE_u32_enqueue(queue, 99);
+	TESTBASE_printFunctionResult(queue, (u8 *)"enqueue when full (NOT VALID)", error_type);
+	printf("\t front %u, back %u\n", *QUEUE_u32_front(queue), *QUEUE_u32_back(queue));
+	for (u32 i = 0; i < kCapacity; ++i)
+	{
+		QUEUE_u32_dequeue(queue, &value);
+		if (i != value)
+		{
+			printf("  ==> ERROR: dequeue out of order\n");
+		}
+	}
+	error_type = QUEUE_u32_dequeue(queue, &value);
+	TESTBASE_printFunctionResult(queue, (u8 *)"dequeue when empty (NOT VALID)", error_type);
+
+	printf("\n\n# Test alignment of double elements\n");
+	Vector_double *doubles = VECTOR_double_create(kCapacity);
+	List_double *double_list = LIST_double_create(kCapacity);
+	boolean aligned = True;
+	for (u32 i = 0; i < kCapacity; ++i)
+	{
+		VECTOR_double_insertLast(doubles, i * 0.5);
+		LIST_double_insertFirst(double_list, i * 0.5);
+		aligned = aligned && 0 == (uintptr_t)VECTOR_double_at(doubles, (u16)i) % _Alignof(double) &&
+			0 == (uintptr_t)LIST_double_first(double_list) % _Alignof(double);
+	}
+	VECTOR_double_resize(doubles, 2 * kCapacity);
+	aligned = aligned && 0 == (uintptr_t)VECTOR_double_first(doubles) % _Alignof(double);
+	printf("\t %u doubles, %s\n", (u32)kCapacity, True == aligned ? "aligned" : "misaligned");
+	if (True != aligned)
+	{
+		printf("  ==> ERROR: the double elements must be aligned to 8 bytes\n");
+	}
+	VECTOR_double_destroy(doubles);
+	LIST_double_destroy(double_list);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != VECTOR_u32_create(0) || NULL != LIST_u32_create(0) || NULL != QUEUE_u32_create(0))
+	{
+		printf("ERROR: trying to create a container with capacity 0\n");
+	}
+	if (NULL != VECTOR_u32_at(vector, kCapacity) || NULL != LIST_u32_at(list, kCapacity) ||
+		NULL != VECTOR_u32_first(NULL) || NULL != QUEUE_u32_front(NULL))
+	{
+		printf("ERROR: accessors return elements that don't exist\n");
+	}
+	error_type = VECTOR_u32_insertLast(NULL, 1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"insertLast vector NULL (NOT VALID)", error_type);
+	error_type = VECTOR_u32_extractAt(vector, kCapacity, &value);
+	TESTBASE_printFunctionResult(vector, (u8 *)"extractAt out of range (NOT VALID)", error_type);
+	error_type = LIST_u32_extractFirst(NULL, &value);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"extractFirst list NULL (NOT VALID)", error_type);
+	error_type = QUEUE_u32_enqueue(NULL, 1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"enqueue queue NULL (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = VECTOR_u32_destroy(vector);
+	TESTBASE_printFunctionResult(vector, (u8 *)"destroy vector", error_type);
+	error_type = VECTOR_Point_destroy(points);
+	TESTBASE_printFunctionResult(points, (u8 *)"destroy points", error_type);
+	error_type = LIST_u32_destroy(list);
+	TESTBASE_printFunctionResult(list, (u8 *)"destroy list", error_type);
+	error_type = QUEUE_u32_destroy(queue);
+	TESTBASE_printFunctionResult(queue, (u8 *)"destroy queue", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
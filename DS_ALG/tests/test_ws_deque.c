@@ -0,0 +1,214 @@
+// test_ws_deque.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the Chase-Lev work-stealing deque
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "adt_ws_deque.h"
+#include "EDK_MemoryManager/edk_memory_manager.h"
+
+#include "../tests/test_base.c"
+
+#define kThieves 3
+#define kTasks 100000
+const u16 kInitialCapacity = 2;
+const u16 kTasksInBattery = 10;
+const u16 kOwnerBurst = 64;
+
+typedef struct test_context_s {
+	WSDeque *deque_;
+	_Atomic boolean done_;
+	_Atomic u32 stolen_;
+} TestContext;
+
+// how many times each task has been taken, must end up all ones
+static _Atomic u8 taken[kTasks + 1];
+
+static void TEST_take(void *task)
+{
+	atomic_fetch_add(&taken[(uintptr_t)task], 1);
+}
+
+static int TEST_thief(void *arg)
+{
+	TestContext *ctx = (TestContext *)arg;
+	while (False == atomic_load(&ctx->done_))
+	{
+		// task ids are never dereferenced
+		void *task = ctx->deque_->ops_->steal(ctx->deque_);
+		if (NULL == task)
+		{
+			thrd_yield();
+			continue;
+		}
+		TEST_take(task);
+		atomic_fetch_add(&ctx->stolen_, 1);
+	}
+	return 0;
+}
+
+int main()
+{
+	s16 error_type = 0;
+
+	TESTBASE_generateDataForTest();
+
+	WSDeque *d = WSDEQUE_create(1);
+	WSDeque *deque_1 = WSDEQUE_create(kInitialCapacity);
+	if (NULL == d || NULL == deque_1) {
+		printf("\n create returned a null deque\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + WSDeque: %zu\n", sizeof(WSDeque));
+	printf("  + WSDequeArray: %zu\n", sizeof(WSDequeArray));
+
+	printf("---------------- BATTERY ----------------\n\n");
+	printf("\n\n# Test Push (growing from %d slots)\n", kInitialCapacity);
+	for (u16 i = 1; i <= kTasksInBattery; ++i)
+	{
+		error_type = d->ops_->push(deque_1, (void *)(uintptr_t)i);
+		TESTBASE_printFunctionResult(deque_1, (u8 *)"push deque_1", error_type);
+	}
+	printf("deque_1:\n");
+	d->ops_->print(deque_1);
+	if (kTasksInBattery != d->ops_->length(deque_1) || d->ops_->capacity(deque_1) < kTasksInBattery)
+	{
+		printf("  ==> ERROR: the deque didn't grow correctly (deque_1)\n");
+	}
+
+	printf("\n\n# Test Pop (owner takes the newest) and Steal (thieves take the oldest)\n");
+	void *task = d->ops_->pop(deque_1);
+	printf("popped task %d\n", (int)(uintptr_t)task);
+	if ((uintptr_t)kTasksInBattery != (uintptr_t)task)
+	{
+		printf("  ==> ERROR: pop doesn't return the last pushed task\n");
+	}
+	task = d->ops_->steal(deque_1);
+	printf("stolen task %d\n", (int)(uintptr_t)task);
+	if (1 != (uintptr_t)task)
+	{
+		printf("  ==> ERROR: steal doesn't return the first pushed task\n");
+	}
+	printf("\t deque_1: [Capacity = %d] - [Length  = %d]\n", d->ops_->capacity(deque_1), d->ops_->length(deque_1));
+
+	printf("\n\n# Test Pop until empty\n");
+	u16 popped = 0;
+	while (NULL != d->ops_->pop(deque_1))
+	{
+		popped++;
+	}
+	if (kTasksInBattery - 2 != popped || False == d->ops_->isEmpty(deque_1) ||
+		NULL != d->ops_->steal(deque_1))
+	{
+		printf("  ==> ERROR: %d tasks popped, deque not empty\n", popped);
+	}
+
+	printf("\n\n# Test Push on a full deque\n");
+	u16 push_errors = 0;
+	for (u32 i = 1; i <= kWSDequeMaxCapacity + 1; ++i)
+	{
+		error_type = d->ops_->push(deque_1, (void *)(uintptr_t)i);
+		if (kErrorCode_Ok != error_type)
+		{
+			TESTBASE_printFunctionResult(deque_1, (u8 *)"push deque_1", error_type);
+			push_errors++;
+		}
+	}
+	if (1 != push_errors || kWSDequeMaxCapacity != d->ops_->length(deque_1))
+	{
+		printf("  ==> ERROR: push doesn't stop at kWSDequeMaxCapacity\n");
+	}
+
+	printf("\n\n# Test Owner / Thief threads\n");
+	TestContext ctx;
+	ctx.deque_ = WSDEQUE_create(kInitialCapacity);
+	atomic_init(&ctx.done_, False);
+	atomic_init(&ctx.stolen_, 0);
+	thrd_t thieves[kThieves];
+	for (u16 i = 0; i < kThieves; ++i)
+	{
+		thrd_create(&thieves[i], TEST_thief, &ctx);
+	}
+	// the owner pushes bursts of tasks, lets the thieves run and pops back
+	// as many as it pushed: whatever was stolen meanwhile is not there
+	u32 next = 1;
+	while (next <= kTasks)
+	{
+		for (u16 i = 0; i < kOwnerBurst && next <= kTasks; ++i)
+		{
+			error_type = ctx.deque_->ops_->push(ctx.deque_, (void *)(uintptr_t)next++);
+			if (kErrorCode_Ok != error_type)
+				TESTBASE_printFunctionResult(ctx.deque_, (u8 *)"push owner", error_type);
+		}
+		for (u16 i = 0; i < kOwnerBurst / 4; ++i)
+		{
+			task = ctx.deque_->ops_->pop(ctx.deque_);
+			if (NULL != task)
+				TEST_take(task);
+		}
+		thrd_yield();
+		for (u16 i = 0; i < kOwnerBurst; ++i)
+		{
+			task = ctx.deque_->ops_->pop(ctx.deque_);
+			if (NULL != task)
+				TEST_take(task);
+		}
+	}
+	while (NULL != (task = ctx.deque_->ops_->pop(ctx.deque_)))
+	{
+		TEST_take(task);
+	}
+	atomic_store(&ctx.done_, True);
+	for (u16 i = 0; i < kThieves; ++i)
+	{
+		thrd_join(thieves[i], NULL);
+	}
+	u32 wrong = 0;
+	for (u32 i = 1; i <= kTasks; ++i)
+	{
+		if (1 != atomic_load(&taken[i]))
+			wrong++;
+	}
+	printf("\t %d tasks, %u stolen, %u taken zero or several times\n", kTasks, atomic_load(&ctx.stolen_), wrong);
+	if (0 != wrong)
+	{
+		printf("  ==> ERROR: tasks lost or duplicated\n");
+	}
+	d->ops_->destroy(ctx.deque_);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	if (NULL != WSDEQUE_create(0) || NULL != WSDEQUE_create(kWSDequeMaxCapacity + 1))
+	{
+		printf("ERROR: trying to create a deque with an invalid capacity\n");
+	}
+	error_type = d->ops_->push(NULL, (void *)1);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"push NULL (NOT VALID)", error_type);
+	error_type = d->ops_->push(deque_1, NULL);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"push NULL task (NOT VALID)", error_type);
+	if (NULL != d->ops_->pop(NULL) || NULL != d->ops_->steal(NULL))
+	{
+		printf("ERROR: NULL deque returns tasks\n");
+	}
+
+	// Work is done, clean the system
+	error_type = d->ops_->destroy(deque_1);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"destroy deque_1", error_type);
+	error_type = d->ops_->destroy(d);
+	TESTBASE_printFunctionResult(d, (u8 *)"destroy WSDeque Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
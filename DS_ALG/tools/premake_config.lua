@@ -18,19 +18,68 @@ PROJECT_NAMES = {
   --"PR03_CircularVector",
   "PR05_List",
   "PR06_DLList",
-  --"PR07_CircularList",
-  --"PR08_CircularDLList",
+  "PR07_CircularList",
+  "PR07_ComparativeCircularList",
+  "PR08_CircularDLList",
   "PR09_Stack",
   "PR10_Queue",
-  --"PR11_Logger",
+  "PR11_Logger",
+  "PR11_ComparativeLogger",
   "PR12_Comparative",
   --"PR13_SortingAlgorithms",
+  "PR14_SPSCQueue",
+  "PR14_ComparativeSPSCQueue",
+  "PR15_MPMCQueue",
+  "PR15_ComparativeMPMCQueue",
+  "PR16_TreiberStack",
+  "PR16_ComparativeTreiberStack",
+  "PR17_WSDeque",
+  "PR17_ComparativeWSDeque",
+  "PR18_Epoch",
+  "PR18_ComparativeEpoch",
+  "PR19_SnapshotVector",
+  "PR19_ComparativeSnapshotVector",
+  "PR20_ConcurrentDLList",
+  "PR20_ComparativeConcurrentDLList",
+  "PR21_Arena",
+  "PR21_ComparativeArena",
+  "PR22_MemoryStack",
+  "PR22_ComparativeMemoryStack",
+  "PR23_Typed",
+  "PR23_ComparativeTyped",
+  "PR24_FastPath",
+  "PR24_ComparativeFastPath",
+  "PR25_Facade",
+  "PR25_ComparativeFacade",
+  "PR26_Cursor",
+  "PR26_ComparativeCursor",
+  "PR27_Binary",
+  "PR27_ComparativeBinary",
+  "PR28_Stream",
+  "PR28_ComparativeStream",
+  "PR29_DurableQueue",
+  "PR29_ComparativeDurableQueue",
+  "PR30_SharedPayload",
+  "PR30_ComparativeSharedPayload",
+  "PR31_Deque",
+  "PR31_ComparativeDeque",
+  "PR32_BPTree",
+  "PR32_ComparativeBPTree",
+  "PR33_SkipList",
+  "PR33_ComparativeSkipList",
+  "PR34_AVLTree",
+  "PR34_ComparativeAVLTree",
+  "PR35_LRUCache",
+  "PR35_ComparativeLRUCache",
+  "PR36_Bloom",
+  "PR36_ComparativeBloom",
 }
 
 -- Solution workspace declaration:
 workspace("DS_ALG_AI1" .. _ACTION)
   location(PROJ_DIR .. "/build/")
   language "C"
+  cdialect "C11"
   kind "ConsoleApp"
   startproject "PR01_Vector"
   platforms {
@@ -43,6 +92,21 @@ workspace("DS_ALG_AI1" .. _ACTION)
   }
   configurations { "Debug", "Release" }
 
+-- The concurrent ADTs use C11 <stdatomic.h> and <threads.h>:
+filter { "action:vs*" }
+  buildoptions {
+    "/experimental:c11atomics",
+  }
+filter { "system:linux" }
+  links {
+    "pthread",
+  }
+  -- mmap, madvise, fsync, truncate... of file_map.h and the durable Queue
+  -- are hidden by strict C11 without it
+  defines {
+    "_DEFAULT_SOURCE",
+  }
+
 -- Workspace "Debug" configuration:
 filter { "configurations:Debug" }
   defines {
@@ -123,6 +187,7 @@ project "PR00_MemoryNode"
 	files {
 	  path.join(PROJ_DIR, "include/adt_memory_node.h"),
 	  path.join(PROJ_DIR, "src/adt_memory_node.c"),
+	  path.join(PROJ_DIR, "src/logger.c"),
 	  path.join(PROJ_DIR, "tests/test_memory_node.c"),
   }
 
@@ -131,6 +196,7 @@ project "PR01_Vector"
   files {
     path.join(PROJ_DIR, "include/adt_memory_node.h"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_vector.h"),
     path.join(PROJ_DIR, "src/adt_vector.c"),
     path.join(PROJ_DIR, "tests/test_vector.c"),
@@ -140,6 +206,7 @@ project "PR01_Vector"
   files {
     path.join(PROJ_DIR, "include/adt_memory_node.h"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_mh_vector.h"),
     path.join(PROJ_DIR, "src/adt_mh_vector.c"),
     path.join(PROJ_DIR, "tests/test_vector.c"),
@@ -149,6 +216,7 @@ project "PR01_Vector"
   files {
     path.join(PROJ_DIR, "include/adt_memory_node.h"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_list.h"),
     path.join(PROJ_DIR, "src/adt_list.c"),
     path.join(PROJ_DIR, "tests/test_adt_list.c"),
@@ -158,16 +226,61 @@ project "PR01_Vector"
   files {
     path.join(PROJ_DIR, "include/adt_memory_node.h"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_dllist.h"),
     path.join(PROJ_DIR, "src/adt_dllist.c"),
     path.join(PROJ_DIR, "tests/test_adt_dllist.c"),
   }
 
+  project "PR07_CircularList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "tests/test_circular_list.c"),
+  }
+
+  project "PR07_ComparativeCircularList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "src/comparative_circular_list.c"),
+  }
+
+  project "PR08_CircularDLList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "tests/test_circular_dllist.c"),
+  }
+
   project "PR09_Stack"
   files {
     path.join(PROJ_DIR, "include/adt_vector.h"),
     path.join(PROJ_DIR, "src/adt_vector.c"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_stack.h"),
     path.join(PROJ_DIR, "src/adt_stack.c"),
     path.join(PROJ_DIR, "tests/test_stack.c"),
@@ -177,11 +290,27 @@ project "PR01_Vector"
     path.join(PROJ_DIR, "include/adt_dllist.h"),
     path.join(PROJ_DIR, "src/adt_list.c"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_queue.h"),
     path.join(PROJ_DIR, "src/adt_queue.c"),
     path.join(PROJ_DIR, "tests/test_queue.c"),
   }
 
+  project "PR11_Logger"
+  files {
+    path.join(PROJ_DIR, "include/logger.h"),
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "tests/test_logger.c"),
+  }
+  project "PR11_ComparativeLogger"
+  files {
+    path.join(PROJ_DIR, "include/logger.h"),
+    path.join(PROJ_DIR, "src/comparative_logger.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+  }
+
   project "PR12_Comparative"
   files {
     path.join(PROJ_DIR, "include/adt_vector.h"),
@@ -195,15 +324,689 @@ project "PR01_Vector"
     
     path.join(PROJ_DIR, "include/adt_memory_node.h"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "src/comparative.c"),
   }
 
+  project "PR14_SPSCQueue"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_spsc_queue.h"),
+    path.join(PROJ_DIR, "src/adt_spsc_queue.c"),
+    path.join(PROJ_DIR, "tests/test_spsc_queue.c"),
+  }
+
+  project "PR14_ComparativeSPSCQueue"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_spsc_queue.h"),
+    path.join(PROJ_DIR, "src/adt_spsc_queue.c"),
+    path.join(PROJ_DIR, "src/comparative_spsc_queue.c"),
+  }
+
+  project "PR15_MPMCQueue"
+  files {
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_mpmc_queue.h"),
+    path.join(PROJ_DIR, "src/adt_mpmc_queue.c"),
+    path.join(PROJ_DIR, "tests/test_mpmc_queue.c"),
+  }
+
+  project "PR15_ComparativeMPMCQueue"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_mpmc_queue.h"),
+    path.join(PROJ_DIR, "src/adt_mpmc_queue.c"),
+    path.join(PROJ_DIR, "src/comparative_mpmc_queue.c"),
+  }
+
+  project "PR16_TreiberStack"
+  files {
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_treiber_stack.h"),
+    path.join(PROJ_DIR, "src/adt_treiber_stack.c"),
+    path.join(PROJ_DIR, "tests/test_treiber_stack.c"),
+  }
+
+  project "PR16_ComparativeTreiberStack"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_treiber_stack.h"),
+    path.join(PROJ_DIR, "src/adt_treiber_stack.c"),
+    path.join(PROJ_DIR, "src/comparative_treiber_stack.c"),
+  }
+
+  project "PR17_WSDeque"
+  files {
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_ws_deque.h"),
+    path.join(PROJ_DIR, "src/adt_ws_deque.c"),
+    path.join(PROJ_DIR, "tests/test_ws_deque.c"),
+  }
+
+  project "PR17_ComparativeWSDeque"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_ws_deque.h"),
+    path.join(PROJ_DIR, "src/adt_ws_deque.c"),
+    path.join(PROJ_DIR, "src/comparative_ws_deque.c"),
+  }
+
+  project "PR18_Epoch"
+  files {
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_epoch.h"),
+    path.join(PROJ_DIR, "src/adt_epoch.c"),
+    path.join(PROJ_DIR, "tests/test_epoch.c"),
+  }
+
+  project "PR18_ComparativeEpoch"
+  files {
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_epoch.h"),
+    path.join(PROJ_DIR, "src/adt_epoch.c"),
+    path.join(PROJ_DIR, "src/comparative_epoch.c"),
+  }
+
+  project "PR19_SnapshotVector"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_epoch.h"),
+    path.join(PROJ_DIR, "src/adt_epoch.c"),
+    path.join(PROJ_DIR, "include/adt_snapshot_vector.h"),
+    path.join(PROJ_DIR, "src/adt_snapshot_vector.c"),
+    path.join(PROJ_DIR, "tests/test_snapshot_vector.c"),
+  }
+
+  project "PR19_ComparativeSnapshotVector"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/aligned_memory.h"),
+    path.join(PROJ_DIR, "include/adt_epoch.h"),
+    path.join(PROJ_DIR, "src/adt_epoch.c"),
+    path.join(PROJ_DIR, "include/adt_snapshot_vector.h"),
+    path.join(PROJ_DIR, "src/adt_snapshot_vector.c"),
+    path.join(PROJ_DIR, "src/comparative_snapshot_vector.c"),
+  }
+
+  project "PR20_ConcurrentDLList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_concurrent_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_concurrent_dllist.c"),
+    path.join(PROJ_DIR, "tests/test_concurrent_dllist.c"),
+  }
+
+  project "PR20_ComparativeConcurrentDLList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_concurrent_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_concurrent_dllist.c"),
+    path.join(PROJ_DIR, "src/comparative_concurrent_dllist.c"),
+  }
+
+  project "PR21_Arena"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "tests/test_arena.c"),
+  }
+
+  project "PR21_ComparativeArena"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "src/comparative_arena.c"),
+  }
+
+  project "PR22_MemoryStack"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "tests/test_memory_stack.c"),
+  }
+
+  project "PR22_ComparativeMemoryStack"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "src/comparative_memory_stack.c"),
+  }
+
+  project "PR23_Typed"
+  files {
+    path.join(PROJ_DIR, "include/adt_typed.h"),
+    path.join(PROJ_DIR, "tests/test_typed.c"),
+  }
+
+  project "PR23_ComparativeTyped"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_typed.h"),
+    path.join(PROJ_DIR, "src/comparative_typed.c"),
+  }
+
+  project "PR24_FastPath"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_fast_path.h"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_concurrent_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_concurrent_dllist.c"),
+    path.join(PROJ_DIR, "tests/test_fast_path.c"),
+  }
+
+  project "PR24_ComparativeFastPath"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_fast_path.h"),
+    path.join(PROJ_DIR, "src/comparative_fast_path.c"),
+  }
+
+  project "PR25_Facade"
+  language "C++"
+  cppdialect "C++17"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_facade.hpp"),
+    path.join(PROJ_DIR, "tests/test_facade.cpp"),
+  }
+
+  project "PR25_ComparativeFacade"
+  language "C++"
+  cppdialect "C++17"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_facade.hpp"),
+    path.join(PROJ_DIR, "src/comparative_facade.cpp"),
+  }
+
+  project "PR26_Cursor"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_stack.h"),
+    path.join(PROJ_DIR, "src/adt_stack.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_concurrent_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_concurrent_dllist.c"),
+    path.join(PROJ_DIR, "tests/test_cursor.c"),
+  }
+
+  project "PR26_ComparativeCursor"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "src/comparative_cursor.c"),
+  }
+
+  project "PR27_Binary"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_binary.h"),
+    path.join(PROJ_DIR, "src/adt_binary.c"),
+    path.join(PROJ_DIR, "tests/test_binary.c"),
+  }
+
+  project "PR27_ComparativeBinary"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "include/adt_binary.h"),
+    path.join(PROJ_DIR, "src/adt_binary.c"),
+    path.join(PROJ_DIR, "src/comparative_binary.c"),
+  }
+
+  project "PR28_Stream"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_stream.h"),
+    path.join(PROJ_DIR, "src/adt_stream.c"),
+    path.join(PROJ_DIR, "tests/test_stream.c"),
+  }
+
+  project "PR28_ComparativeStream"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_stream.h"),
+    path.join(PROJ_DIR, "src/adt_stream.c"),
+    path.join(PROJ_DIR, "src/comparative_stream.c"),
+  }
+
+  project "PR29_DurableQueue"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "tests/test_durable_queue.c"),
+  }
+
+  project "PR29_ComparativeDurableQueue"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "include/adt_queue.h"),
+    path.join(PROJ_DIR, "src/adt_queue.c"),
+    path.join(PROJ_DIR, "src/comparative_durable_queue.c"),
+  }
+
+  project "PR30_SharedPayload"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "tests/test_shared_payload.c"),
+  }
+
+  project "PR30_ComparativeSharedPayload"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_list.h"),
+    path.join(PROJ_DIR, "src/adt_list.c"),
+    path.join(PROJ_DIR, "src/comparative_shared_payload.c"),
+  }
+
+  project "PR31_Deque"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_deque.h"),
+    path.join(PROJ_DIR, "src/adt_deque.c"),
+    path.join(PROJ_DIR, "tests/test_deque.c"),
+  }
+
+  project "PR31_ComparativeDeque"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/adt_deque.h"),
+    path.join(PROJ_DIR, "src/adt_deque.c"),
+    path.join(PROJ_DIR, "src/comparative_deque.c"),
+  }
+
+  project "PR32_BPTree"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_bptree.h"),
+    path.join(PROJ_DIR, "src/adt_bptree.c"),
+    path.join(PROJ_DIR, "tests/test_bptree.c"),
+  }
+
+  project "PR32_ComparativeBPTree"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_bptree.h"),
+    path.join(PROJ_DIR, "src/adt_bptree.c"),
+    path.join(PROJ_DIR, "src/comparative_bptree.c"),
+  }
+
+  project "PR33_SkipList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_skiplist.h"),
+    path.join(PROJ_DIR, "src/adt_skiplist.c"),
+    path.join(PROJ_DIR, "tests/test_skiplist.c"),
+  }
+
+  project "PR33_ComparativeSkipList"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_skiplist.h"),
+    path.join(PROJ_DIR, "src/adt_skiplist.c"),
+    path.join(PROJ_DIR, "src/comparative_skiplist.c"),
+  }
+
+  project "PR34_AVLTree"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_avltree.h"),
+    path.join(PROJ_DIR, "src/adt_avltree.c"),
+    path.join(PROJ_DIR, "tests/test_avltree.c"),
+  }
+
+  project "PR34_ComparativeAVLTree"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_avltree.h"),
+    path.join(PROJ_DIR, "src/adt_avltree.c"),
+    path.join(PROJ_DIR, "src/comparative_avltree.c"),
+  }
+
+  project "PR35_LRUCache"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_lru_cache.h"),
+    path.join(PROJ_DIR, "src/adt_lru_cache.c"),
+    path.join(PROJ_DIR, "tests/test_lru_cache.c"),
+  }
+
+  project "PR35_ComparativeLRUCache"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_pool.h"),
+    path.join(PROJ_DIR, "src/adt_pool.c"),
+    path.join(PROJ_DIR, "include/adt_lru_cache.h"),
+    path.join(PROJ_DIR, "src/adt_lru_cache.c"),
+    path.join(PROJ_DIR, "src/comparative_lru_cache.c"),
+  }
+
+  project "PR36_Bloom"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_bloom.h"),
+    path.join(PROJ_DIR, "src/adt_bloom.c"),
+    path.join(PROJ_DIR, "tests/test_bloom.c"),
+  }
+
+  project "PR36_ComparativeBloom"
+  files {
+    path.join(PROJ_DIR, "include/adt_memory_node.h"),
+    path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
+    path.join(PROJ_DIR, "include/adt_cursor.h"),
+    path.join(PROJ_DIR, "include/adt_arena.h"),
+    path.join(PROJ_DIR, "src/adt_arena.c"),
+    path.join(PROJ_DIR, "include/adt_memory_stack.h"),
+    path.join(PROJ_DIR, "src/adt_memory_stack.c"),
+    path.join(PROJ_DIR, "include/adt_vector.h"),
+    path.join(PROJ_DIR, "src/adt_vector.c"),
+    path.join(PROJ_DIR, "include/adt_dllist.h"),
+    path.join(PROJ_DIR, "src/adt_dllist.c"),
+    path.join(PROJ_DIR, "include/file_map.h"),
+    path.join(PROJ_DIR, "include/adt_bloom.h"),
+    path.join(PROJ_DIR, "src/adt_bloom.c"),
+    path.join(PROJ_DIR, "src/comparative_bloom.c"),
+  }
+
   --[[
 
   project "PR03_CircularVector"
   files {
     path.join(PROJ_DIR, "include/adt_memory_node.h"),
     path.join(PROJ_DIR, "src/adt_memory_node.c"),
+    path.join(PROJ_DIR, "src/logger.c"),
     path.join(PROJ_DIR, "include/adt_vector.h"),
     path.join(PROJ_DIR, "src/adt_vector.c"),
     path.join(PROJ_DIR, "tests/test_vector.c"),